@@ -6,13 +6,28 @@ dnl Function to detect if libagdb dependencies are available
 AC_DEFUN([AX_LIBAGDB_CHECK_LOCAL],
   [dnl Check for internationalization functions in libagdb/libagdb_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for the clock functions used by the statistics in libagdb/libagdb_io_handle.c
+  AC_CHECK_HEADERS([sys/time.h time.h])
+
+  AC_SEARCH_LIBS([clock_gettime], [rt])
+
+  AC_CHECK_FUNCS([clock_gettime gettimeofday])
+
+  dnl Check for the memory map functions used in libagdb/libagdb_memory_map.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([mmap munmap])
 ])
 
 dnl Function to detect if agdbtools dependencies are available
 AC_DEFUN([AX_AGDBTOOLS_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([signal.h sys/signal.h unistd.h])
+  [AC_CHECK_HEADERS([dirent.h fcntl.h signal.h sys/signal.h sys/stat.h sys/time.h unistd.h])
+
+  dnl Check for the clock functions used by agdbbench
+  AC_SEARCH_LIBS([clock_gettime], [rt])
 
-  AC_CHECK_FUNCS([close getopt setvbuf])
+  AC_CHECK_FUNCS([clock_gettime close getopt gettimeofday opendir posix_fadvise setvbuf tmpfile])
 
   AS_IF(
    [test "x$ac_cv_func_close" != xyes],
@@ -0,0 +1,381 @@
+/*
+ * Benchmarks parsing of Windows SuperFetch database files.
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "agdbtools_getopt.h"
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+#include "agdbtools_libclocale.h"
+#include "agdbtools_libcnotify.h"
+#include "agdbtools_output.h"
+#include "agdbtools_signal.h"
+#include "agdbtools_unused.h"
+#include "bench_handle.h"
+
+bench_handle_t *agdbbench_bench_handle = NULL;
+int agdbbench_abort                     = 0;
+
+/* Signal handler for agdbbench
+ */
+void agdbbench_signal_handler(
+      agdbtools_signal_t signal AGDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "agdbbench_signal_handler";
+
+	AGDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	agdbbench_abort = 1;
+
+	if( agdbbench_bench_handle != NULL )
+	{
+		if( bench_handle_signal_abort(
+		     agdbbench_bench_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal bench handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description               = \
+		"Use agdbbench to benchmark parsing of Windows SuperFetch database files.";
+
+	agdbtools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'i', "iterations", "number of iterations per source file, where the first iteration is the cold iteration, default is 10" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file(s)" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libagdb_error_t *error                = NULL;
+	system_character_t *option_iterations = NULL;
+	system_character_t *source            = NULL;
+	char *program                         = "agdbbench";
+	system_integer_t option               = 0;
+	int number_of_options                 = (int) ( sizeof( options ) / sizeof( agdbtools_option_t ) );
+	int result                            = 0;
+	int source_index                      = 0;
+	int verbose                           = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "agdbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( agdbtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	agdbtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( agdbtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = agdbtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				agdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				agdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				agdbtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		agdbtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libagdb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libagdb_notify_set_verbose(
+	 verbose );
+
+	if( bench_handle_initialize(
+	     &agdbbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize bench handle.\n" );
+
+		goto on_error;
+	}
+	if( agdbtools_signal_attach(
+	     agdbbench_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( option_iterations != NULL )
+	{
+		result = bench_handle_set_number_of_iterations(
+		          agdbbench_bench_handle,
+		          option_iterations,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of iterations.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations defaulting to: %d.\n",
+			 agdbbench_bench_handle->number_of_iterations );
+		}
+	}
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( agdbbench_abort != 0 )
+		{
+			break;
+		}
+		source = argv[ source_index ];
+
+		if( bench_handle_bench_file(
+		     agdbbench_bench_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark source file: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+		if( bench_handle_results_fprint(
+		     agdbbench_bench_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print benchmark results.\n" );
+
+			goto on_error;
+		}
+	}
+	if( agdbtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle_free(
+	     &agdbbench_bench_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free bench handle.\n" );
+
+		goto on_error;
+	}
+	if( agdbbench_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Benchmark aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( agdbbench_bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &agdbbench_bench_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,413 @@
+/*
+ * Carves Windows SuperFetch database files from raw data, such as disk images or memory dumps.
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "agdbtools_getopt.h"
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+#include "agdbtools_libclocale.h"
+#include "agdbtools_libcnotify.h"
+#include "agdbtools_output.h"
+#include "agdbtools_signal.h"
+#include "agdbtools_unused.h"
+#include "carve_handle.h"
+
+carve_handle_t *agdbcarve_carve_handle = NULL;
+int agdbcarve_abort                     = 0;
+
+/* Signal handler for agdbcarve
+ */
+void agdbcarve_signal_handler(
+      agdbtools_signal_t signal AGDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "agdbcarve_signal_handler";
+
+	AGDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	agdbcarve_abort = 1;
+
+	if( agdbcarve_carve_handle != NULL )
+	{
+		if( carve_handle_signal_abort(
+		     agdbcarve_carve_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal carve handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description               = \
+		"Use agdbcarve to carve Windows SuperFetch database files from raw data,\n"
+		"such as a disk image or memory dump.";
+
+	agdbtools_option_t options[ ] = {
+		{ 'a', "alignment", "alignment of the file headers in the source in bytes, default is 512, use 1 to scan every byte" },
+		{ 'h', NULL, "shows this help" },
+		{ 't', "target", "target directory to write the recovered files to" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libagdb_error_t *error               = NULL;
+	system_character_t *option_alignment = NULL;
+	system_character_t *option_target    = NULL;
+	system_character_t *source           = NULL;
+	char *program                        = "agdbcarve";
+	system_integer_t option              = 0;
+	int number_of_options                = (int) ( sizeof( options ) / sizeof( agdbtools_option_t ) );
+	int result                           = 0;
+	int verbose                          = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "agdbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( agdbtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	agdbtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( agdbtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = agdbtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				agdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'a':
+				option_alignment = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				agdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 't':
+				option_target = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				agdbtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		agdbtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libagdb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libagdb_notify_set_verbose(
+	 verbose );
+
+	if( carve_handle_initialize(
+	     &agdbcarve_carve_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize carve handle.\n" );
+
+		goto on_error;
+	}
+	if( agdbtools_signal_attach(
+	     agdbcarve_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( option_alignment != NULL )
+	{
+		result = carve_handle_set_alignment(
+		          agdbcarve_carve_handle,
+		          option_alignment,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set alignment.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported alignment defaulting to: %" PRIzd ".\n",
+			 agdbcarve_carve_handle->alignment );
+		}
+	}
+	if( option_target != NULL )
+	{
+		if( carve_handle_set_target_path(
+		     agdbcarve_carve_handle,
+		     option_target,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set target path.\n" );
+
+			goto on_error;
+		}
+	}
+	if( carve_handle_open_input(
+	     agdbcarve_carve_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( carve_handle_carve_input(
+	     agdbcarve_carve_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to carve source: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( carve_handle_close_input(
+	     agdbcarve_carve_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close input.\n" );
+
+		goto on_error;
+	}
+	if( carve_handle_results_fprint(
+	     agdbcarve_carve_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print carve results.\n" );
+
+		goto on_error;
+	}
+	if( agdbtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( carve_handle_free(
+	     &agdbcarve_carve_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free carve handle.\n" );
+
+		goto on_error;
+	}
+	if( agdbcarve_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Carve aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( agdbcarve_carve_handle != NULL )
+	{
+		carve_handle_free(
+		 &agdbcarve_carve_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
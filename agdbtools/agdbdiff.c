@@ -0,0 +1,367 @@
+/*
+ * Shows the differences between two Windows SuperFetch database files.
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "agdbtools_getopt.h"
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+#include "agdbtools_libclocale.h"
+#include "agdbtools_libcnotify.h"
+#include "agdbtools_output.h"
+#include "agdbtools_signal.h"
+#include "agdbtools_unused.h"
+#include "diff_handle.h"
+
+diff_handle_t *agdbdiff_diff_handle = NULL;
+int agdbdiff_abort                   = 0;
+
+/* Signal handler for agdbdiff
+ */
+void agdbdiff_signal_handler(
+      agdbtools_signal_t signal AGDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "agdbdiff_signal_handler";
+
+	AGDBTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	agdbdiff_abort = 1;
+
+	if( agdbdiff_diff_handle != NULL )
+	{
+		if( diff_handle_signal_abort(
+		     agdbdiff_diff_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal diff handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description               = \
+		"Use agdbdiff to show the differences between two Windows SuperFetch\n"
+		"database files, such as two snapshots of the same system.";
+
+	agdbtools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "previous", "the previous source file" },
+		{ 0, "current", "the current source file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libagdb_error_t *error              = NULL;
+	system_character_t *current_source  = NULL;
+	system_character_t *previous_source = NULL;
+	char *program                       = "agdbdiff";
+	system_integer_t option             = 0;
+	int number_of_options               = (int) ( sizeof( options ) / sizeof( agdbtools_option_t ) );
+	int verbose                         = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "agdbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( agdbtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	agdbtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( agdbtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = agdbtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				agdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				agdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				agdbtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( argc - optind ) < 2 )
+	{
+		fprintf(
+		 stderr,
+		 "Missing previous or current source file.\n" );
+
+		agdbtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	previous_source = argv[ optind ];
+	current_source  = argv[ optind + 1 ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libagdb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libagdb_notify_set_verbose(
+	 verbose );
+
+	if( diff_handle_initialize(
+	     &agdbdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize diff handle.\n" );
+
+		goto on_error;
+	}
+	if( agdbtools_signal_attach(
+	     agdbdiff_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff_handle_open_input(
+	     agdbdiff_diff_handle,
+	     previous_source,
+	     current_source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM " or: %" PRIs_SYSTEM ".\n",
+		 previous_source,
+		 current_source );
+
+		goto on_error;
+	}
+	if( diff_handle_compare_input(
+	     agdbdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to compare: %" PRIs_SYSTEM " with: %" PRIs_SYSTEM ".\n",
+		 previous_source,
+		 current_source );
+
+		goto on_error;
+	}
+	if( diff_handle_differences_fprint(
+	     agdbdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print differences.\n" );
+
+		goto on_error;
+	}
+	if( diff_handle_close_input(
+	     agdbdiff_diff_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close input.\n" );
+
+		goto on_error;
+	}
+	if( agdbtools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff_handle_free(
+	     &agdbdiff_diff_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free diff handle.\n" );
+
+		goto on_error;
+	}
+	if( agdbdiff_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Diff aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( agdbdiff_diff_handle != NULL )
+	{
+		diff_handle_free(
+		 &agdbdiff_diff_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
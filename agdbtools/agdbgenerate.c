@@ -0,0 +1,429 @@
+/*
+ * Generates synthetic Windows SuperFetch database files.
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "agdbtools_getopt.h"
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+#include "agdbtools_libclocale.h"
+#include "agdbtools_libcnotify.h"
+#include "agdbtools_output.h"
+#include "generate_handle.h"
+
+/* Sets a generate handle value from an option
+ * Returns 1 if successful or -1 on error
+ */
+int agdbgenerate_set_option_value(
+     generate_handle_t *generate_handle,
+     int (*set_value_function)(
+            generate_handle_t *generate_handle,
+            const system_character_t *string,
+            libcerror_error_t **error ),
+     const system_character_t *string,
+     const char *description,
+     libcerror_error_t **error )
+{
+	static char *function = "agdbgenerate_set_option_value";
+	int result            = 0;
+
+	if( set_value_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid set value function.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		return( 1 );
+	}
+	result = set_value_function(
+	          generate_handle,
+	          string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set %s.",
+		 function,
+		 description );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported %s: %" PRIs_SYSTEM ".",
+		 function,
+		 description,
+		 string );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description                  = \
+		"Use agdbgenerate to generate synthetic Windows SuperFetch database files.";
+
+	agdbtools_option_t options[ ] = {
+		{ 'b', "bits", "number of bits of the entry layouts, options: 32 (default) or 64" },
+		{ 'e', "sub_entries", "number of sub entries per file and source, default is 1" },
+		{ 'f', "files", "number of files per volume, default is 1" },
+		{ 'h', NULL, "shows this help" },
+		{ 'n', "volumes", "number of volumes, default is 1" },
+		{ 's', "sources", "number of sources, default is 1" },
+		{ 't', "type", "file type, options: uncompressed (default), vista, win7, win8.0 or win8.1" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "destination", "the destination file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	generate_handle_t *generate_handle       = NULL;
+	libagdb_error_t *error                   = NULL;
+	system_character_t *option_bits          = NULL;
+	system_character_t *option_files         = NULL;
+	system_character_t *option_sources       = NULL;
+	system_character_t *option_sub_entries   = NULL;
+	system_character_t *option_type          = NULL;
+	system_character_t *option_volumes       = NULL;
+	char *program                            = "agdbgenerate";
+	system_integer_t option                  = 0;
+	int number_of_options                    = (int) ( sizeof( options ) / sizeof( agdbtools_option_t ) );
+	int verbose                              = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "agdbtools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( agdbtools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	agdbtools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( agdbtools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = agdbtools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				agdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_bits = optarg;
+
+				break;
+
+			case (system_integer_t) 'e':
+				option_sub_entries = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_files = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				agdbtools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'n':
+				option_volumes = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_sources = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_type = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				agdbtools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing destination file.\n" );
+
+		agdbtools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libagdb_notify_set_stream(
+	 stderr,
+	 NULL );
+	libagdb_notify_set_verbose(
+	 verbose );
+
+	if( generate_handle_initialize(
+	     &generate_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize generate handle.\n" );
+
+		goto on_error;
+	}
+	if( agdbgenerate_set_option_value(
+	     generate_handle,
+	     &generate_handle_set_file_type,
+	     option_type,
+	     "file type",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set file type.\n" );
+
+		goto on_error;
+	}
+	if( agdbgenerate_set_option_value(
+	     generate_handle,
+	     &generate_handle_set_number_of_bits,
+	     option_bits,
+	     "number of bits",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set number of bits.\n" );
+
+		goto on_error;
+	}
+	if( agdbgenerate_set_option_value(
+	     generate_handle,
+	     &generate_handle_set_number_of_volumes,
+	     option_volumes,
+	     "number of volumes",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set number of volumes.\n" );
+
+		goto on_error;
+	}
+	if( agdbgenerate_set_option_value(
+	     generate_handle,
+	     &generate_handle_set_number_of_files,
+	     option_files,
+	     "number of files",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set number of files.\n" );
+
+		goto on_error;
+	}
+	if( agdbgenerate_set_option_value(
+	     generate_handle,
+	     &generate_handle_set_number_of_sub_entries,
+	     option_sub_entries,
+	     "number of sub entries",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set number of sub entries.\n" );
+
+		goto on_error;
+	}
+	if( agdbgenerate_set_option_value(
+	     generate_handle,
+	     &generate_handle_set_number_of_sources,
+	     option_sources,
+	     "number of sources",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set number of sources.\n" );
+
+		goto on_error;
+	}
+	if( generate_handle_write_file(
+	     generate_handle,
+	     argv[ optind ],
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate destination file: %" PRIs_SYSTEM ".\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	if( generate_handle_free(
+	     &generate_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free generate handle.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &generate_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -51,10 +51,11 @@
 #include "agdbtools_output.h"
 #include "agdbtools_signal.h"
 #include "agdbtools_unused.h"
+#include "info_batch.h"
 #include "info_handle.h"
 
-info_handle_t *agdbinfo_info_handle = NULL;
-int agdbinfo_abort                  = 0;
+info_batch_t *agdbinfo_info_batch = NULL;
+int agdbinfo_abort                = 0;
 
 /* Signal handler for agdbinfo
  */
@@ -68,14 +69,14 @@ void agdbinfo_signal_handler(
 
 	agdbinfo_abort = 1;
 
-	if( agdbinfo_info_handle != NULL )
+	if( agdbinfo_info_batch != NULL )
 	{
-		if( info_handle_signal_abort(
-		     agdbinfo_info_handle,
+		if( info_batch_signal_abort(
+		     agdbinfo_info_batch,
 		     &error ) != 1 )
 		{
 			libcnotify_printf(
-			 "%s: unable to signal info handle to abort.\n",
+			 "%s: unable to signal info batch to abort.\n",
 			 function );
 
 			libcnotify_print_error_backtrace(
@@ -113,18 +114,24 @@ int main( int argc, char * const argv[] )
 
 	agdbtools_option_t options[ ] = {
 		{ 'h', NULL, "shows this help" },
+		{ 'j', "threads", "number of worker threads, default is 1" },
+		{ 'o', "format", "output format, options: text (default), json, ndjson" },
+		{ 's', NULL, "only determine the file type from the signature" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
-		{ 0, "source", "the source file" },
+		{ 0, "source", "the source file(s) or directory" },
 	};
 	system_character_t options_string[ 32 ];
 
-	libagdb_error_t *error     = NULL;
-	system_character_t *source = NULL;
-	char *program              = "agdbinfo";
-	system_integer_t option    = 0;
-	int number_of_options      = (int) ( sizeof( options ) / sizeof( agdbtools_option_t ) );
-	int verbose                = 0;
+	libagdb_error_t *error                   = NULL;
+	system_character_t *option_output_format = NULL;
+	system_character_t *option_threads       = NULL;
+	char *program                            = "agdbinfo";
+	system_integer_t option                  = 0;
+	int number_of_options                    = (int) ( sizeof( options ) / sizeof( agdbtools_option_t ) );
+	int result                               = 0;
+	int signature_only                       = 0;
+	int verbose                              = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -157,10 +164,6 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	agdbtools_output_version_fprint(
-	 stdout,
-	 program );
-
 	if( agdbtools_getopt_get_options_string(
 	     options,
 	     number_of_options,
@@ -182,6 +185,10 @@ int main( int argc, char * const argv[] )
 		{
 			case (system_integer_t) '?':
 			default:
+				agdbtools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -197,6 +204,10 @@ int main( int argc, char * const argv[] )
 				return( EXIT_FAILURE );
 
 			case (system_integer_t) 'h':
+				agdbtools_output_version_fprint(
+				 stdout,
+				 program );
+
 				agdbtools_getopt_usage_fprint(
 				 stdout,
 				 program,
@@ -206,12 +217,31 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				option_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				signature_only = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
 				break;
 
 			case (system_integer_t) 'V':
+				agdbtools_output_version_fprint(
+				 stdout,
+				 program );
+
 				agdbtools_output_copyright_fprint(
 				 stdout );
 
@@ -220,6 +250,10 @@ int main( int argc, char * const argv[] )
 	}
 	if( optind == argc )
 	{
+		agdbtools_output_version_fprint(
+		 stdout,
+		 program );
+
 		fprintf(
 		 stderr,
 		 "Missing source file.\n" );
@@ -233,8 +267,6 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
-
 	libcnotify_verbose_set(
 	 verbose );
 	libagdb_notify_set_stream(
@@ -243,57 +275,112 @@ int main( int argc, char * const argv[] )
 	libagdb_notify_set_verbose(
 	 verbose );
 
-	if( info_handle_initialize(
-	     &agdbinfo_info_handle,
+	if( info_batch_initialize(
+	     &agdbinfo_info_batch,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to initialize info handle.\n" );
+		 "Unable to initialize info batch.\n" );
 
 		goto on_error;
 	}
-	if( info_handle_open_input(
-	     agdbinfo_info_handle,
-	     source,
-	     &error ) != 1 )
+	if( option_output_format != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open source file.\n" );
+		result = info_batch_set_output_format(
+		          agdbinfo_info_batch,
+		          option_output_format,
+		          &error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
 	}
-	if( info_handle_file_fprint(
-	     agdbinfo_info_handle,
-	     &error ) != 1 )
+	if( option_threads != NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to print file information.\n" );
+		result = info_batch_set_number_of_threads(
+		          agdbinfo_info_batch,
+		          option_threads,
+		          &error );
 
-		goto on_error;
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+		}
+	}
+	agdbinfo_info_batch->signature_only = (uint8_t) signature_only;
+
+	/* The version is not printed in the JSON output formats to keep the output machine readable
+	 */
+	if( agdbinfo_info_batch->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		agdbtools_output_version_fprint(
+		 stdout,
+		 program );
 	}
-	if( info_handle_close_input(
-	     agdbinfo_info_handle,
-	     &error ) != 0 )
+	while( optind < argc )
+	{
+		if( info_batch_append_source(
+		     agdbinfo_info_batch,
+		     argv[ optind ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source: %" PRIs_SYSTEM ".\n",
+			 argv[ optind ] );
+
+			goto on_error;
+		}
+		optind++;
+	}
+	result = info_batch_process(
+	          agdbinfo_info_batch,
+	          &error );
+
+	if( result == -1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to close info handle.\n" );
+		 "Unable to process source files.\n" );
 
 		goto on_error;
 	}
-	if( info_handle_free(
-	     &agdbinfo_info_handle,
+	if( info_batch_free(
+	     &agdbinfo_info_batch,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to free info handle.\n" );
+		 "Unable to free info batch.\n" );
 
 		goto on_error;
 	}
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -304,10 +391,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( agdbinfo_info_handle != NULL )
+	if( agdbinfo_info_batch != NULL )
 	{
-		info_handle_free(
-		 &agdbinfo_info_handle,
+		info_batch_free(
+		 &agdbinfo_info_batch,
 		 NULL );
 	}
 	return( EXIT_FAILURE );
@@ -0,0 +1,1682 @@
+/*
+ * Bench handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include <time.h>
+
+#include "agdbinput.h"
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+#include "agdbtools_unused.h"
+#include "bench_handle.h"
+
+#define BENCH_HANDLE_NOTIFY_STREAM	stdout
+
+/* The benchmark phase descriptions
+ */
+static const char *bench_handle_phase_descriptions[ BENCH_HANDLE_NUMBER_OF_PHASES ] = {
+	"Open",
+	"  Header",
+	"  Block scan",
+	"  Decompress",
+	"  Volume parse",
+	"  File parse",
+	"  Source parse",
+	"Volume access",
+	"File access",
+	"Source access",
+	"Close" };
+
+/* Retrieves a string representation of the file type
+ */
+const char *bench_handle_get_file_type_string(
+             uint8_t file_type )
+{
+	switch( file_type )
+	{
+		case LIBAGDB_FILE_TYPE_UNCOMPRESSED:
+			return( "Uncompressed" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_VISTA:
+			return( "Windows Vista compressed (MEMO)" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7:
+			return( "Windows 7 compressed (MEM0)" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0:
+			return( "Windows 8.0 compressed (MEM)" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1:
+			return( "Windows 8.1 compressed (MAM)" );
+
+		default:
+			break;
+	}
+	return( "Unknown" );
+}
+
+/* Retrieves the current value of a monotonic clock in micro seconds
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+#else
+	struct timeval time_value;
+#endif
+
+	static char *function = "bench_handle_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 )
+	 || ( frequency.QuadPart == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = (uint64_t) ( ( counter.QuadPart / frequency.QuadPart ) * 1000000 )
+	              + (uint64_t) ( ( ( counter.QuadPart % frequency.QuadPart ) * 1000000 ) / frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_value.tv_sec * 1000000 )
+	              + ( (uint64_t) time_value.tv_nsec / 1000 );
+
+#else
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time of day.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_value.tv_sec * 1000000 )
+	              + (uint64_t) time_value.tv_usec;
+
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+}
+
+/* Creates a bench handle
+ * Make sure the value bench_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_initialize";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*bench_handle = memory_allocate_structure(
+	                 bench_handle_t );
+
+	if( *bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create bench handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *bench_handle,
+	     0,
+	     sizeof( bench_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bench handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *bench_handle )->number_of_iterations = BENCH_HANDLE_DEFAULT_NUMBER_OF_ITERATIONS;
+	( *bench_handle )->notify_stream        = BENCH_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *bench_handle != NULL )
+	{
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a bench handle
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_free";
+	int result            = 1;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *bench_handle != NULL )
+	{
+		if( ( *bench_handle )->input_file != NULL )
+		{
+			if( libagdb_file_free(
+			     &( ( *bench_handle )->input_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *bench_handle )->value_string != NULL )
+		{
+			memory_free(
+			 ( *bench_handle )->value_string );
+		}
+		memory_free(
+		 *bench_handle );
+
+		*bench_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the bench handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_signal_abort";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->abort = 1;
+
+	if( bench_handle->input_file != NULL )
+	{
+		if( libagdb_file_signal_abort(
+		     bench_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal input file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the number of iterations
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_handle_set_number_of_iterations(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_set_number_of_iterations";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = agdbinput_determine_decimal_value(
+	          string,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of iterations.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) INT_MAX ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			bench_handle->number_of_iterations = (int) value_64bit;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the benchmark phase of a library trace phase
+ * Returns the benchmark phase or -1 if the trace phase is not attributed
+ */
+int bench_handle_get_phase_from_trace_phase(
+     int trace_phase )
+{
+	switch( trace_phase )
+	{
+		case LIBAGDB_TRACE_PHASE_COMPRESSED_FILE_HEADER:
+		case LIBAGDB_TRACE_PHASE_FILE_HEADER:
+			return( BENCH_HANDLE_PHASE_HEADER );
+
+		case LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCKS:
+			return( BENCH_HANDLE_PHASE_BLOCK_SCAN );
+
+		case LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK:
+			return( BENCH_HANDLE_PHASE_DECOMPRESS );
+
+		case LIBAGDB_TRACE_PHASE_VOLUME_INFORMATION:
+			return( BENCH_HANDLE_PHASE_VOLUME_PARSE );
+
+		case LIBAGDB_TRACE_PHASE_FILE_INFORMATION:
+			return( BENCH_HANDLE_PHASE_FILE_PARSE );
+
+		case LIBAGDB_TRACE_PHASE_SOURCE_INFORMATION:
+			return( BENCH_HANDLE_PHASE_SOURCE_PARSE );
+
+		default:
+			break;
+	}
+	return( -1 );
+}
+
+/* Trace begin callback
+ * Records the start time of the traced phase
+ */
+void bench_handle_trace_begin_callback(
+      intptr_t *callback_data,
+      libagdb_file_t *file AGDBTOOLS_ATTRIBUTE_UNUSED,
+      int trace_phase AGDBTOOLS_ATTRIBUTE_UNUSED,
+      uint32_t trace_index AGDBTOOLS_ATTRIBUTE_UNUSED,
+      uint8_t file_type AGDBTOOLS_ATTRIBUTE_UNUSED,
+      off64_t offset AGDBTOOLS_ATTRIBUTE_UNUSED,
+      size64_t size AGDBTOOLS_ATTRIBUTE_UNUSED )
+{
+	bench_handle_t *bench_handle = NULL;
+	uint64_t current_time        = 0;
+
+	AGDBTOOLS_UNREFERENCED_PARAMETER( file )
+	AGDBTOOLS_UNREFERENCED_PARAMETER( trace_phase )
+	AGDBTOOLS_UNREFERENCED_PARAMETER( trace_index )
+	AGDBTOOLS_UNREFERENCED_PARAMETER( file_type )
+	AGDBTOOLS_UNREFERENCED_PARAMETER( offset )
+	AGDBTOOLS_UNREFERENCED_PARAMETER( size )
+
+	if( callback_data == NULL )
+	{
+		return;
+	}
+	bench_handle = (bench_handle_t *) callback_data;
+
+	if( ( bench_handle->trace_depth >= 0 )
+	 && ( bench_handle->trace_depth < BENCH_HANDLE_MAXIMUM_TRACE_DEPTH ) )
+	{
+		if( bench_handle_get_current_time(
+		     &current_time,
+		     NULL ) != 1 )
+		{
+			current_time = 0;
+		}
+		bench_handle->trace_start_times[ bench_handle->trace_depth ]  = current_time;
+		bench_handle->trace_nested_times[ bench_handle->trace_depth ] = 0;
+	}
+	bench_handle->trace_depth += 1;
+}
+
+/* Trace end callback
+ * Attributes the time spent in the traced phase, excluding the time spent in
+ * nested traced phases, to the corresponding benchmark phase
+ */
+void bench_handle_trace_end_callback(
+      intptr_t *callback_data,
+      libagdb_file_t *file AGDBTOOLS_ATTRIBUTE_UNUSED,
+      int trace_phase,
+      uint32_t trace_index,
+      int result,
+      size64_t size )
+{
+	bench_handle_t *bench_handle = NULL;
+	uint64_t current_time        = 0;
+	uint64_t elapsed_time        = 0;
+	uint64_t phase_time          = 0;
+	int phase                    = 0;
+
+	AGDBTOOLS_UNREFERENCED_PARAMETER( file )
+
+	if( callback_data == NULL )
+	{
+		return;
+	}
+	bench_handle = (bench_handle_t *) callback_data;
+
+	if( bench_handle->trace_depth <= 0 )
+	{
+		return;
+	}
+	bench_handle->trace_depth -= 1;
+
+	if( bench_handle->trace_depth >= BENCH_HANDLE_MAXIMUM_TRACE_DEPTH )
+	{
+		return;
+	}
+	if( bench_handle_get_current_time(
+	     &current_time,
+	     NULL ) != 1 )
+	{
+		current_time = 0;
+	}
+	if( current_time > bench_handle->trace_start_times[ bench_handle->trace_depth ] )
+	{
+		elapsed_time = current_time - bench_handle->trace_start_times[ bench_handle->trace_depth ];
+	}
+	if( elapsed_time > bench_handle->trace_nested_times[ bench_handle->trace_depth ] )
+	{
+		phase_time = elapsed_time - bench_handle->trace_nested_times[ bench_handle->trace_depth ];
+	}
+	if( bench_handle->trace_depth > 0 )
+	{
+		bench_handle->trace_nested_times[ bench_handle->trace_depth - 1 ] += elapsed_time;
+	}
+	phase = bench_handle_get_phase_from_trace_phase(
+	         trace_phase );
+
+	if( phase != -1 )
+	{
+		bench_handle->phase_times[ phase ] += phase_time;
+	}
+	if( ( trace_phase == LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK )
+	 && ( result == 1 ) )
+	{
+		if( ( bench_handle->trace_number_of_blocks == 0 )
+		 || ( phase_time > bench_handle->trace_slowest_block_time ) )
+		{
+			bench_handle->trace_slowest_block_index = trace_index;
+			bench_handle->trace_slowest_block_time  = phase_time;
+		}
+		bench_handle->trace_number_of_blocks       += 1;
+		bench_handle->trace_decompressed_data_size += (uint64_t) size;
+	}
+}
+
+/* Resizes the value string
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_resize_value_string(
+     bench_handle_t *bench_handle,
+     size_t value_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "bench_handle_resize_value_string";
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_string_size == 0 )
+	 || ( value_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_size <= bench_handle->value_string_size )
+	{
+		return( 1 );
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            bench_handle->value_string,
+	                            sizeof( uint8_t ) * value_string_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize value string.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->value_string      = reallocation;
+	bench_handle->value_string_size = value_string_size;
+
+	return( 1 );
+}
+
+/* Drops the file from the operating system file cache, if supported
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int bench_handle_drop_file_cache(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_drop_file_cache";
+
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int file_descriptor   = -1;
+	int result            = 0;
+#endif
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Dropping the cached pages is advisory, a failure only means
+	 * the cold iteration might be served from the file cache
+	 */
+	if( posix_fadvise(
+	     file_descriptor,
+	     0,
+	     0,
+	     POSIX_FADV_DONTNEED ) == 0 )
+	{
+		result = 1;
+	}
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+#else
+	return( 0 );
+#endif
+}
+
+/* Runs a single benchmark iteration
+ * The first iteration is considered the cold iteration
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_run_iteration(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     int iteration,
+     libcerror_error_t **error )
+{
+	libagdb_file_information_t *file_information     = NULL;
+	libagdb_source_information_t *source_information = NULL;
+	libagdb_volume_information_t *volume_information = NULL;
+	static char *function                            = "bench_handle_run_iteration";
+	size_t value_string_size                         = 0;
+	uint64_t end_time                                = 0;
+	uint64_t start_time                              = 0;
+	uint64_t value_64bit                             = 0;
+	uint32_t value_32bit                             = 0;
+	int file_index                                   = 0;
+	int number_of_files                              = 0;
+	int number_of_sources                            = 0;
+	int number_of_volumes                            = 0;
+	int phase                                        = 0;
+	int source_index                                 = 0;
+	int total_number_of_files                        = 0;
+	int volume_index                                 = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_handle->input_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid bench handle - input file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( iteration < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid iteration value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     bench_handle->phase_times,
+	     0,
+	     sizeof( uint64_t ) * BENCH_HANDLE_NUMBER_OF_PHASES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear phase times.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->trace_depth                  = 0;
+	bench_handle->trace_number_of_blocks       = 0;
+	bench_handle->trace_decompressed_data_size = 0;
+	bench_handle->trace_slowest_block_index    = 0;
+	bench_handle->trace_slowest_block_time     = 0;
+
+	if( libagdb_file_initialize(
+	     &( bench_handle->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The trace callbacks attribute the time spent in the open phase
+	 * to the header, block scan, decompress and parse phases
+	 */
+	if( libagdb_file_set_trace_callbacks(
+	     bench_handle->input_file,
+	     &bench_handle_trace_begin_callback,
+	     &bench_handle_trace_end_callback,
+	     (intptr_t *) bench_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callbacks.",
+		 function );
+
+		goto on_error;
+	}
+	/* Open phase
+	 */
+	if( bench_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libagdb_file_open_wide(
+	     bench_handle->input_file,
+	     filename,
+	     LIBAGDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libagdb_file_open(
+	     bench_handle->input_file,
+	     filename,
+	     LIBAGDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	bench_handle->phase_times[ BENCH_HANDLE_PHASE_OPEN ] = end_time - start_time;
+
+	if( libagdb_file_get_file_type(
+	     bench_handle->input_file,
+	     &( bench_handle->file_type ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_get_uncompressed_data_size(
+	     bench_handle->input_file,
+	     &( bench_handle->uncompressed_data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* Volumes phase
+	 */
+	if( bench_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libagdb_file_get_number_of_volumes(
+	     bench_handle->input_file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libagdb_file_get_volume_information(
+		     bench_handle->input_file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume information: %d.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libagdb_volume_information_get_creation_time(
+		     volume_information,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve creation time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libagdb_volume_information_get_serial_number(
+		     volume_information,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve serial number.",
+			 function );
+
+			goto on_error;
+		}
+		if( libagdb_volume_information_get_utf8_device_path_size(
+		     volume_information,
+		     &value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve device path size.",
+			 function );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			if( bench_handle_resize_value_string(
+			     bench_handle,
+			     value_string_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libagdb_volume_information_get_utf8_device_path(
+			     volume_information,
+			     bench_handle->value_string,
+			     value_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve device path.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libagdb_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume information.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	bench_handle->phase_times[ BENCH_HANDLE_PHASE_VOLUMES ] = end_time - start_time;
+
+	/* Files phase
+	 */
+	if( bench_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libagdb_file_get_volume_information(
+		     bench_handle->input_file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume information: %d.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libagdb_volume_information_get_number_of_files(
+		     volume_information,
+		     &number_of_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of files.",
+			 function );
+
+			goto on_error;
+		}
+		for( file_index = 0;
+		     file_index < number_of_files;
+		     file_index++ )
+		{
+			if( libagdb_volume_information_get_file_information(
+			     volume_information,
+			     file_index,
+			     &file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file information: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			if( libagdb_file_information_get_utf8_path_size(
+			     file_information,
+			     &value_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve path size.",
+				 function );
+
+				goto on_error;
+			}
+			if( value_string_size > 0 )
+			{
+				if( bench_handle_resize_value_string(
+				     bench_handle,
+				     value_string_size,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+				if( libagdb_file_information_get_utf8_path(
+				     file_information,
+				     bench_handle->value_string,
+				     value_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve path.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libagdb_file_information_free(
+			     &file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file information.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		total_number_of_files += number_of_files;
+
+		if( libagdb_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume information.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	bench_handle->phase_times[ BENCH_HANDLE_PHASE_FILES ] = end_time - start_time;
+
+	/* Sources phase
+	 */
+	if( bench_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libagdb_file_get_number_of_sources(
+	     bench_handle->input_file,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( libagdb_file_get_source_information(
+		     bench_handle->input_file,
+		     source_index,
+		     &source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source information: %d.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		if( libagdb_source_information_get_utf8_executable_filename_size(
+		     source_information,
+		     &value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve executable filename size.",
+			 function );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			if( bench_handle_resize_value_string(
+			     bench_handle,
+			     value_string_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			if( libagdb_source_information_get_utf8_executable_filename(
+			     source_information,
+			     bench_handle->value_string,
+			     value_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve executable filename.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libagdb_source_information_free(
+		     &source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free source information.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	bench_handle->phase_times[ BENCH_HANDLE_PHASE_SOURCES ] = end_time - start_time;
+
+	/* Close phase
+	 */
+	if( bench_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libagdb_file_close(
+	     bench_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	bench_handle->phase_times[ BENCH_HANDLE_PHASE_CLOSE ] = end_time - start_time;
+
+	if( libagdb_file_free(
+	     &( bench_handle->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free input file.",
+		 function );
+
+		goto on_error;
+	}
+	bench_handle->number_of_volumes      = number_of_volumes;
+	bench_handle->number_of_files        = total_number_of_files;
+	bench_handle->number_of_sources      = number_of_sources;
+	bench_handle->number_of_blocks       = bench_handle->trace_number_of_blocks;
+	bench_handle->decompressed_data_size = bench_handle->trace_decompressed_data_size;
+
+	if( iteration == 0 )
+	{
+		bench_handle->cold_slowest_block_index = bench_handle->trace_slowest_block_index;
+		bench_handle->cold_slowest_block_time  = bench_handle->trace_slowest_block_time;
+	}
+	for( phase = 0;
+	     phase < BENCH_HANDLE_NUMBER_OF_PHASES;
+	     phase++ )
+	{
+		if( iteration == 0 )
+		{
+			bench_handle->cold_times[ phase ] = bench_handle->phase_times[ phase ];
+		}
+		else
+		{
+			if( ( iteration == 1 )
+			 || ( bench_handle->phase_times[ phase ] < bench_handle->minimum_warm_times[ phase ] ) )
+			{
+				bench_handle->minimum_warm_times[ phase ] = bench_handle->phase_times[ phase ];
+			}
+			bench_handle->total_warm_times[ phase ] += bench_handle->phase_times[ phase ];
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_information != NULL )
+	{
+		libagdb_file_information_free(
+		 &file_information,
+		 NULL );
+	}
+	if( source_information != NULL )
+	{
+		libagdb_source_information_free(
+		 &source_information,
+		 NULL );
+	}
+	if( volume_information != NULL )
+	{
+		libagdb_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	if( bench_handle->input_file != NULL )
+	{
+		libagdb_file_free(
+		 &( bench_handle->input_file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks a file
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_bench_file(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_handle_bench_file";
+	int iteration         = 0;
+	int result            = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     bench_handle->cold_times,
+	     0,
+	     sizeof( uint64_t ) * BENCH_HANDLE_NUMBER_OF_PHASES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cold times.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     bench_handle->minimum_warm_times,
+	     0,
+	     sizeof( uint64_t ) * BENCH_HANDLE_NUMBER_OF_PHASES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear minimum warm times.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     bench_handle->total_warm_times,
+	     0,
+	     sizeof( uint64_t ) * BENCH_HANDLE_NUMBER_OF_PHASES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear total warm times.",
+		 function );
+
+		return( -1 );
+	}
+	result = bench_handle_drop_file_cache(
+	          bench_handle,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to drop file cache.",
+		 function );
+
+		return( -1 );
+	}
+	bench_handle->file_cache_dropped = result;
+
+	for( iteration = 0;
+	     iteration < bench_handle->number_of_iterations;
+	     iteration++ )
+	{
+		if( bench_handle->abort != 0 )
+		{
+			break;
+		}
+		if( bench_handle_run_iteration(
+		     bench_handle,
+		     filename,
+		     iteration,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run iteration: %d.",
+			 function,
+			 iteration );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Prints the benchmark results
+ * Returns 1 if successful or -1 on error
+ */
+int bench_handle_results_fprint(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function         = "bench_handle_results_fprint";
+	double average_warm_time      = 0.0;
+	double number_of_bytes        = 0.0;
+	double number_of_entries      = 0.0;
+	int number_of_warm_iterations = 0;
+	int phase                     = 0;
+
+	if( bench_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bench handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_warm_iterations = bench_handle->number_of_iterations - 1;
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "Windows SuperFetch database benchmark results:\n" );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\tSource\t\t\t\t: %" PRIs_SYSTEM "\n",
+	 filename );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\tFile type\t\t\t: %s\n",
+	 bench_handle_get_file_type_string(
+	  bench_handle->file_type ) );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\tUncompressed data size\t\t: %" PRIu32 " bytes\n",
+	 bench_handle->uncompressed_data_size );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\tNumber of volumes\t\t: %d\n",
+	 bench_handle->number_of_volumes );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\tNumber of files\t\t\t: %d\n",
+	 bench_handle->number_of_files );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\tNumber of sources\t\t: %d\n",
+	 bench_handle->number_of_sources );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\tNumber of compressed blocks\t: %d\n",
+	 bench_handle->number_of_blocks );
+
+	if( bench_handle->number_of_blocks > 0 )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\tDecompressed data size\t\t: %" PRIu64 " bytes\n",
+		 bench_handle->decompressed_data_size );
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\tSlowest block (cold)\t\t: %" PRIu32 " (%.3f ms)\n",
+		 bench_handle->cold_slowest_block_index,
+		 (double) bench_handle->cold_slowest_block_time / 1000.0 );
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\tNumber of iterations\t\t: %d\n",
+	 bench_handle->number_of_iterations );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\tCold iteration\t\t\t: " );
+
+	if( bench_handle->file_cache_dropped != 0 )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "file cache dropped\n" );
+	}
+	else
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "file cache not dropped (unsupported)\n" );
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 bench_handle->notify_stream,
+	 "%-16sCold (ms)\tWarm minimum (ms)\tWarm average (ms)\tWarm throughput\n",
+	 "Phase" );
+
+	for( phase = 0;
+	     phase < BENCH_HANDLE_NUMBER_OF_PHASES;
+	     phase++ )
+	{
+		fprintf(
+		 bench_handle->notify_stream,
+		 "%-16s%.3f",
+		 bench_handle_phase_descriptions[ phase ],
+		 (double) bench_handle->cold_times[ phase ] / 1000.0 );
+
+		if( number_of_warm_iterations <= 0 )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\t\tN/A\t\t\tN/A\t\t\tN/A\n" );
+
+			continue;
+		}
+		average_warm_time = (double) bench_handle->total_warm_times[ phase ] / (double) number_of_warm_iterations;
+
+		fprintf(
+		 bench_handle->notify_stream,
+		 "\t\t%.3f\t\t\t%.3f\t\t\t",
+		 (double) bench_handle->minimum_warm_times[ phase ] / 1000.0,
+		 average_warm_time / 1000.0 );
+
+		if( average_warm_time <= 0.0 )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "N/A\n" );
+
+			continue;
+		}
+		number_of_bytes   = 0.0;
+		number_of_entries = 0.0;
+
+		switch( phase )
+		{
+			case BENCH_HANDLE_PHASE_OPEN:
+				number_of_bytes = (double) bench_handle->uncompressed_data_size;
+				break;
+
+			case BENCH_HANDLE_PHASE_DECOMPRESS:
+				number_of_bytes = (double) bench_handle->decompressed_data_size;
+				break;
+
+			case BENCH_HANDLE_PHASE_BLOCK_SCAN:
+				number_of_entries = (double) bench_handle->number_of_blocks;
+				break;
+
+			case BENCH_HANDLE_PHASE_VOLUME_PARSE:
+			case BENCH_HANDLE_PHASE_VOLUMES:
+				number_of_entries = (double) bench_handle->number_of_volumes;
+				break;
+
+			case BENCH_HANDLE_PHASE_FILE_PARSE:
+			case BENCH_HANDLE_PHASE_FILES:
+				number_of_entries = (double) bench_handle->number_of_files;
+				break;
+
+			case BENCH_HANDLE_PHASE_SOURCE_PARSE:
+			case BENCH_HANDLE_PHASE_SOURCES:
+				number_of_entries = (double) bench_handle->number_of_sources;
+				break;
+
+			default:
+				break;
+		}
+		if( number_of_bytes > 0.0 )
+		{
+			/* Bytes per micro second equals MB/s
+			 */
+			fprintf(
+			 bench_handle->notify_stream,
+			 "%.2f MB/s\n",
+			 number_of_bytes / average_warm_time );
+		}
+		else if( number_of_entries > 0.0 )
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "%.0f entries/s\n",
+			 ( number_of_entries * 1000000.0 ) / average_warm_time );
+		}
+		else
+		{
+			fprintf(
+			 bench_handle->notify_stream,
+			 "\n" );
+		}
+	}
+	fprintf(
+	 bench_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
@@ -0,0 +1,251 @@
+/*
+ * Bench handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_HANDLE_H )
+#define _BENCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define BENCH_HANDLE_DEFAULT_NUMBER_OF_ITERATIONS	10
+
+/* The maximum nesting depth of the traced library phases
+ */
+#define BENCH_HANDLE_MAXIMUM_TRACE_DEPTH		8
+
+/* The benchmark phases
+ * The header, block scan, decompress and parse phases are part of the open phase
+ * and are attributed using the library trace callbacks
+ */
+enum BENCH_HANDLE_PHASES
+{
+	BENCH_HANDLE_PHASE_OPEN				= 0,
+	BENCH_HANDLE_PHASE_HEADER			= 1,
+	BENCH_HANDLE_PHASE_BLOCK_SCAN			= 2,
+	BENCH_HANDLE_PHASE_DECOMPRESS			= 3,
+	BENCH_HANDLE_PHASE_VOLUME_PARSE			= 4,
+	BENCH_HANDLE_PHASE_FILE_PARSE			= 5,
+	BENCH_HANDLE_PHASE_SOURCE_PARSE			= 6,
+	BENCH_HANDLE_PHASE_VOLUMES			= 7,
+	BENCH_HANDLE_PHASE_FILES			= 8,
+	BENCH_HANDLE_PHASE_SOURCES			= 9,
+	BENCH_HANDLE_PHASE_CLOSE			= 10,
+
+	BENCH_HANDLE_NUMBER_OF_PHASES			= 11
+};
+
+typedef struct bench_handle bench_handle_t;
+
+struct bench_handle
+{
+	/* The number of iterations
+	 */
+	int number_of_iterations;
+
+	/* The libagdb input file
+	 */
+	libagdb_file_t *input_file;
+
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The uncompressed data size
+	 */
+	uint32_t uncompressed_data_size;
+
+	/* The number of volumes
+	 */
+	int number_of_volumes;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of sources
+	 */
+	int number_of_sources;
+
+	/* The number of decompressed blocks
+	 */
+	int number_of_blocks;
+
+	/* The decompressed data size
+	 */
+	uint64_t decompressed_data_size;
+
+	/* The index of the slowest decompressed block of the cold iteration
+	 */
+	uint32_t cold_slowest_block_index;
+
+	/* The time of the slowest decompressed block of the cold iteration in micro seconds
+	 */
+	uint64_t cold_slowest_block_time;
+
+	/* The phase times of the current iteration in micro seconds
+	 */
+	uint64_t phase_times[ BENCH_HANDLE_NUMBER_OF_PHASES ];
+
+	/* The current trace depth
+	 */
+	int trace_depth;
+
+	/* The start times of the traced phases in micro seconds
+	 */
+	uint64_t trace_start_times[ BENCH_HANDLE_MAXIMUM_TRACE_DEPTH ];
+
+	/* The time spent in nested traced phases in micro seconds
+	 */
+	uint64_t trace_nested_times[ BENCH_HANDLE_MAXIMUM_TRACE_DEPTH ];
+
+	/* The number of decompressed blocks of the current iteration
+	 */
+	int trace_number_of_blocks;
+
+	/* The decompressed data size of the current iteration
+	 */
+	uint64_t trace_decompressed_data_size;
+
+	/* The index of the slowest decompressed block of the current iteration
+	 */
+	uint32_t trace_slowest_block_index;
+
+	/* The time of the slowest decompressed block of the current iteration in micro seconds
+	 */
+	uint64_t trace_slowest_block_time;
+
+	/* Value to indicate the file cache was dropped before the cold iteration
+	 */
+	int file_cache_dropped;
+
+	/* The cold (first iteration) phase times in micro seconds
+	 */
+	uint64_t cold_times[ BENCH_HANDLE_NUMBER_OF_PHASES ];
+
+	/* The minimum warm phase times in micro seconds
+	 */
+	uint64_t minimum_warm_times[ BENCH_HANDLE_NUMBER_OF_PHASES ];
+
+	/* The total warm phase times in micro seconds
+	 */
+	uint64_t total_warm_times[ BENCH_HANDLE_NUMBER_OF_PHASES ];
+
+	/* The value string
+	 */
+	uint8_t *value_string;
+
+	/* The value string size
+	 */
+	size_t value_string_size;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+const char *bench_handle_get_file_type_string(
+             uint8_t file_type );
+
+int bench_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
+int bench_handle_initialize(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_free(
+     bench_handle_t **bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_signal_abort(
+     bench_handle_t *bench_handle,
+     libcerror_error_t **error );
+
+int bench_handle_set_number_of_iterations(
+     bench_handle_t *bench_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int bench_handle_get_phase_from_trace_phase(
+     int trace_phase );
+
+void bench_handle_trace_begin_callback(
+      intptr_t *callback_data,
+      libagdb_file_t *file,
+      int trace_phase,
+      uint32_t trace_index,
+      uint8_t file_type,
+      off64_t offset,
+      size64_t size );
+
+void bench_handle_trace_end_callback(
+      intptr_t *callback_data,
+      libagdb_file_t *file,
+      int trace_phase,
+      uint32_t trace_index,
+      int result,
+      size64_t size );
+
+int bench_handle_resize_value_string(
+     bench_handle_t *bench_handle,
+     size_t value_string_size,
+     libcerror_error_t **error );
+
+int bench_handle_drop_file_cache(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int bench_handle_run_iteration(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     int iteration,
+     libcerror_error_t **error );
+
+int bench_handle_bench_file(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int bench_handle_results_fprint(
+     bench_handle_t *bench_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_HANDLE_H ) */
+
@@ -0,0 +1,1202 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "agdbinput.h"
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+#include "carve_handle.h"
+
+#define CARVE_HANDLE_NOTIFY_STREAM	stdout
+
+/* Retrieves a string representation of the file type
+ */
+const char *carve_handle_get_file_type_string(
+             uint8_t file_type )
+{
+	switch( file_type )
+	{
+		case LIBAGDB_FILE_TYPE_UNCOMPRESSED:
+			return( "Uncompressed" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_VISTA:
+			return( "Windows Vista compressed (MEMO)" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7:
+			return( "Windows 7 compressed (MEM0)" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0:
+			return( "Windows 8.0 compressed (MEM)" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1:
+			return( "Windows 8.1 compressed (MAM)" );
+
+		default:
+			break;
+	}
+	return( "Unknown" );
+}
+
+/* Creates a carve handle
+ * Make sure the value carve_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_initialize";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*carve_handle = memory_allocate_structure(
+	                 carve_handle_t );
+
+	if( *carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carve handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *carve_handle,
+	     0,
+	     sizeof( carve_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carve handle.",
+		 function );
+
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+
+		return( -1 );
+	}
+	if( libagdb_file_initialize(
+	     &( ( *carve_handle )->carved_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize carved file.",
+		 function );
+
+		goto on_error;
+	}
+	( *carve_handle )->alignment     = CARVE_HANDLE_DEFAULT_ALIGNMENT;
+	( *carve_handle )->notify_stream = CARVE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *carve_handle != NULL )
+	{
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a carve handle
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_free";
+	int result            = 1;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		if( ( *carve_handle )->input_stream != NULL )
+		{
+			if( carve_handle_close_input(
+			     *carve_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libagdb_file_free(
+		     &( ( *carve_handle )->carved_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free carved file.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *carve_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *carve_handle )->buffer );
+		}
+		if( ( *carve_handle )->target_path != NULL )
+		{
+			memory_free(
+			 ( *carve_handle )->target_path );
+		}
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the carve handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_signal_abort";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->abort = 1;
+
+	if( carve_handle->carved_file != NULL )
+	{
+		if( libagdb_file_signal_abort(
+		     carve_handle->carved_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal carved file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the alignment
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int carve_handle_set_alignment(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_set_alignment";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = agdbinput_determine_decimal_value(
+	          string,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine alignment.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) CARVE_HANDLE_BUFFER_SIZE ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			carve_handle->alignment = (size_t) value_64bit;
+		}
+	}
+	return( result );
+}
+
+/* Sets the target path
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_set_target_path(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_set_target_path";
+	size_t string_length  = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->target_path != NULL )
+	{
+		memory_free(
+		 carve_handle->target_path );
+
+		carve_handle->target_path      = NULL;
+		carve_handle->target_path_size = 0;
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->target_path = system_string_allocate(
+	                             string_length + 1 );
+
+	if( carve_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     carve_handle->target_path,
+	     string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy target path.",
+		 function );
+
+		memory_free(
+		 carve_handle->target_path );
+
+		carve_handle->target_path = NULL;
+
+		return( -1 );
+	}
+	carve_handle->target_path[ string_length ] = 0;
+
+	carve_handle->target_path_size = string_length + 1;
+
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_open_input(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_open_input";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->input_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle - input stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	carve_handle->input_stream = file_stream_open_wide(
+	                              filename,
+	                              _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	carve_handle->input_stream = file_stream_open(
+	                              filename,
+	                              FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( carve_handle->input_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int carve_handle_close_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_close_input";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->input_stream == NULL )
+	{
+		return( 0 );
+	}
+	if( file_stream_close(
+	     carve_handle->input_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input stream.",
+		 function );
+
+		carve_handle->input_stream = NULL;
+
+		return( -1 );
+	}
+	carve_handle->input_stream = NULL;
+
+	return( 0 );
+}
+
+/* Fills the buffer with data read from the input
+ * The buffer is enlarged if the required size exceeds the buffer size
+ * On return data_size contains the number of bytes in the buffer
+ * and at_end is set if the end of the input was reached
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_fill_buffer(
+     carve_handle_t *carve_handle,
+     size_t *data_size,
+     size_t required_size,
+     int *at_end,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "carve_handle_fill_buffer";
+	size_t read_count     = 0;
+	size_t read_size      = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->input_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carve handle - missing input stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( required_size == 0 )
+	 || ( required_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid required size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( at_end == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid at end.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_size > carve_handle->buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_size > carve_handle->buffer_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            carve_handle->buffer,
+		                            sizeof( uint8_t ) * required_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		carve_handle->buffer      = reallocation;
+		carve_handle->buffer_size = required_size;
+	}
+	while( ( *at_end == 0 )
+	    && ( *data_size < required_size ) )
+	{
+		read_size = required_size - *data_size;
+
+		read_count = file_stream_read(
+		              carve_handle->input_stream,
+		              &( carve_handle->buffer[ *data_size ] ),
+		              read_size );
+
+		if( read_count != read_size )
+		{
+			if( ferror(
+			     carve_handle->input_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data from input.",
+				 function );
+
+				return( -1 );
+			}
+			*at_end = 1;
+		}
+		*data_size += read_count;
+	}
+	return( 1 );
+}
+
+/* Writes a recovered file to the target path
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_write_file(
+     carve_handle_t *carve_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	system_character_t *filename = NULL;
+	FILE *output_stream          = NULL;
+	static char *function        = "carve_handle_write_file";
+	size_t filename_size         = 0;
+	size_t write_count           = 0;
+	int print_count              = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carve handle - missing target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The filename consists of: <target>/carved_<offset>.agdb
+	 * where the offset requires a maximum of 20 digits
+	 */
+	filename_size = carve_handle->target_path_size + 32;
+
+	filename = system_string_allocate(
+	            filename_size );
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	print_count = system_string_sprintf(
+	               filename,
+	               filename_size,
+	               _SYSTEM_STRING( "%" ) _SYSTEM_STRING( PRIs_SYSTEM ) _SYSTEM_STRING( "/carved_%" ) _SYSTEM_STRING( PRIu64 ) _SYSTEM_STRING( ".agdb" ),
+	               carve_handle->target_path,
+	               (uint64_t) file_offset );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= filename_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	output_stream = file_stream_open_wide(
+	                 filename,
+	                 _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	output_stream = file_stream_open(
+	                 filename,
+	                 FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open output: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               output_stream,
+	               data,
+	               data_size );
+
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data to output: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     output_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close output: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		output_stream = NULL;
+
+		goto on_error;
+	}
+	output_stream = NULL;
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\tWritten to\t\t\t: %" PRIs_SYSTEM "\n",
+	 filename );
+
+	memory_free(
+	 filename );
+
+	return( 1 );
+
+on_error:
+	if( output_stream != NULL )
+	{
+		file_stream_close(
+		 output_stream );
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+}
+
+/* Validates a candidate file by parsing it and writes it if a target path was set
+ * Returns 1 if the file was recovered, 0 if not or -1 on error
+ */
+int carve_handle_recover_file(
+     carve_handle_t *carve_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     uint8_t file_type,
+     uint32_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *parse_error = NULL;
+	static char *function          = "carve_handle_recover_file";
+	int number_of_sources          = 0;
+	int number_of_volumes          = 0;
+	int result                     = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* A candidate that cannot be parsed is not an error
+	 */
+	result = libagdb_file_open_memory(
+	          carve_handle->carved_file,
+	          data,
+	          data_size,
+	          LIBAGDB_OPEN_READ,
+	          &parse_error );
+
+	if( result == 1 )
+	{
+		result = libagdb_file_get_number_of_volumes(
+		          carve_handle->carved_file,
+		          &number_of_volumes,
+		          &parse_error );
+	}
+	if( result == 1 )
+	{
+		result = libagdb_file_get_number_of_sources(
+		          carve_handle->carved_file,
+		          &number_of_sources,
+		          &parse_error );
+	}
+	if( libagdb_file_close(
+	     carve_handle->carved_file,
+	     NULL ) != 0 )
+	{
+		result = -1;
+	}
+	if( parse_error != NULL )
+	{
+		libcerror_error_free(
+		 &parse_error );
+	}
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	carve_handle->number_of_recovered_files += 1;
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "Recovered file at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+	 file_offset,
+	 file_offset );
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\tFile type\t\t\t: %s\n",
+	 carve_handle_get_file_type_string(
+	  file_type ) );
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\tFile size\t\t\t: %" PRIzd " bytes\n",
+	 data_size );
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\tUncompressed data size\t\t: %" PRIu32 " bytes\n",
+	 uncompressed_data_size );
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\tNumber of volumes\t\t: %d\n",
+	 number_of_volumes );
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\tNumber of sources\t\t: %d\n",
+	 number_of_sources );
+
+	if( carve_handle->target_path != NULL )
+	{
+		if( carve_handle_write_file(
+		     carve_handle,
+		     data,
+		     data_size,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write recovered file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Carves Windows SuperFetch database files from the input
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_carve_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function           = "carve_handle_carve_input";
+	size64_t file_size              = 0;
+	size64_t maximum_file_size      = 0;
+	size_t data_size                = 0;
+	size_t required_size            = 0;
+	size_t scan_offset              = 0;
+	off64_t buffer_offset           = 0;
+	uint32_t uncompressed_data_size = 0;
+	uint8_t file_type               = 0;
+	int at_end                      = 0;
+	int result                      = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	while( carve_handle->abort == 0 )
+	{
+		if( carve_handle_fill_buffer(
+		     carve_handle,
+		     &data_size,
+		     CARVE_HANDLE_BUFFER_SIZE,
+		     &at_end,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to fill buffer.",
+			 function );
+
+			return( -1 );
+		}
+		result = libagdb_carve_scan_data(
+		          carve_handle->buffer,
+		          data_size,
+		          buffer_offset,
+		          carve_handle->alignment,
+		          &scan_offset,
+		          &file_type,
+		          &uncompressed_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      && ( at_end != 0 ) )
+		{
+			break;
+		}
+		/* Discard the data before the scan offset, the remaining data is
+		 * either the candidate file or the tail of the buffer that could
+		 * not be scanned yet
+		 */
+		if( scan_offset > 0 )
+		{
+			data_size -= scan_offset;
+
+			memmove(
+			 carve_handle->buffer,
+			 &( carve_handle->buffer[ scan_offset ] ),
+			 data_size );
+
+			buffer_offset += (off64_t) scan_offset;
+			scan_offset    = 0;
+		}
+		if( result == 0 )
+		{
+			continue;
+		}
+		carve_handle->number_of_candidates += 1;
+
+		if( libagdb_carve_get_maximum_file_size(
+		     file_type,
+		     uncompressed_data_size,
+		     &maximum_file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum file size.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( maximum_file_size > (size64_t) data_size )
+		 && ( at_end == 0 ) )
+		{
+			if( maximum_file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				required_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+			}
+			else
+			{
+				required_size = (size_t) maximum_file_size;
+			}
+			if( carve_handle_fill_buffer(
+			     carve_handle,
+			     &data_size,
+			     required_size,
+			     &at_end,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to fill buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		result = libagdb_carve_get_file_size(
+		          carve_handle->buffer,
+		          data_size,
+		          file_type,
+		          uncompressed_data_size,
+		          &file_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			result = carve_handle_recover_file(
+			          carve_handle,
+			          carve_handle->buffer,
+			          (size_t) file_size,
+			          buffer_offset,
+			          file_type,
+			          uncompressed_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to recover file at offset: %" PRIi64 ".",
+				 function,
+				 buffer_offset );
+
+				return( -1 );
+			}
+		}
+		/* The size of a Windows 8.1 compressed file is an upper bound
+		 * hence the scan continues after the file header
+		 */
+		if( ( result == 1 )
+		 && ( file_type != LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1 ) )
+		{
+			scan_offset = (size_t) file_size;
+		}
+		else
+		{
+			scan_offset = 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Prints the carve results
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_results_fprint(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_results_fprint";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "Windows SuperFetch database carve results:\n" );
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\tAlignment\t\t\t: %" PRIzd " bytes\n",
+	 carve_handle->alignment );
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\tNumber of candidates\t\t: %" PRIu64 "\n",
+	 carve_handle->number_of_candidates );
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\tNumber of recovered files\t: %" PRIu64 "\n",
+	 carve_handle->number_of_recovered_files );
+
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
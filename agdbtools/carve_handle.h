@@ -0,0 +1,162 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CARVE_HANDLE_H )
+#define _CARVE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define CARVE_HANDLE_DEFAULT_ALIGNMENT		512
+
+/* The size of the buffer the input is scanned in
+ * The buffer is enlarged when a candidate file does not fit
+ */
+#define CARVE_HANDLE_BUFFER_SIZE		( 16 * 1024 * 1024 )
+
+typedef struct carve_handle carve_handle_t;
+
+struct carve_handle
+{
+	/* The alignment of the file headers in the input
+	 */
+	size_t alignment;
+
+	/* The target path
+	 */
+	system_character_t *target_path;
+
+	/* The target path size
+	 */
+	size_t target_path_size;
+
+	/* The input stream
+	 */
+	FILE *input_stream;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The libagdb file used to validate candidate files
+	 */
+	libagdb_file_t *carved_file;
+
+	/* The number of candidate files
+	 */
+	uint64_t number_of_candidates;
+
+	/* The number of recovered files
+	 */
+	uint64_t number_of_recovered_files;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+const char *carve_handle_get_file_type_string(
+             uint8_t file_type );
+
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_set_alignment(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int carve_handle_set_target_path(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int carve_handle_open_input(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int carve_handle_close_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_fill_buffer(
+     carve_handle_t *carve_handle,
+     size_t *data_size,
+     size_t required_size,
+     int *at_end,
+     libcerror_error_t **error );
+
+int carve_handle_write_file(
+     carve_handle_t *carve_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int carve_handle_recover_file(
+     carve_handle_t *carve_handle,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     uint8_t file_type,
+     uint32_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int carve_handle_carve_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_results_fprint(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CARVE_HANDLE_H ) */
+
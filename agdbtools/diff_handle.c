@@ -0,0 +1,1223 @@
+/*
+ * Diff handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+#include "diff_handle.h"
+
+#define DIFF_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates a diff handle
+ * Make sure the value diff_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_initialize(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_initialize";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diff handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*diff_handle = memory_allocate_structure(
+	                diff_handle_t );
+
+	if( *diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create diff handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *diff_handle,
+	     0,
+	     sizeof( diff_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear diff handle.",
+		 function );
+
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+
+		return( -1 );
+	}
+	if( libagdb_file_initialize(
+	     &( ( *diff_handle )->previous_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize previous file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_initialize(
+	     &( ( *diff_handle )->current_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize current file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_diff_initialize(
+	     &( ( *diff_handle )->diff ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize diff.",
+		 function );
+
+		goto on_error;
+	}
+	( *diff_handle )->notify_stream = DIFF_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *diff_handle != NULL )
+	{
+		if( ( *diff_handle )->current_file != NULL )
+		{
+			libagdb_file_free(
+			 &( ( *diff_handle )->current_file ),
+			 NULL );
+		}
+		if( ( *diff_handle )->previous_file != NULL )
+		{
+			libagdb_file_free(
+			 &( ( *diff_handle )->previous_file ),
+			 NULL );
+		}
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a diff handle
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_free(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_free";
+	int result            = 1;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff_handle != NULL )
+	{
+		if( ( *diff_handle )->input_is_open != 0 )
+		{
+			if( diff_handle_close_input(
+			     *diff_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libagdb_diff_free(
+		     &( ( *diff_handle )->diff ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free diff.",
+			 function );
+
+			result = -1;
+		}
+		if( libagdb_file_free(
+		     &( ( *diff_handle )->current_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free current file.",
+			 function );
+
+			result = -1;
+		}
+		if( libagdb_file_free(
+		     &( ( *diff_handle )->previous_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free previous file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *diff_handle );
+
+		*diff_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the diff handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_signal_abort(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_signal_abort";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	diff_handle->abort = 1;
+
+	if( diff_handle->previous_file != NULL )
+	{
+		if( libagdb_file_signal_abort(
+		     diff_handle->previous_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal previous file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( diff_handle->current_file != NULL )
+	{
+		if( libagdb_file_signal_abort(
+		     diff_handle->current_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal current file to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the previous and current input
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_open_input(
+     diff_handle_t *diff_handle,
+     const system_character_t *previous_filename,
+     const system_character_t *current_filename,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_open_input";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( diff_handle->input_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diff handle - input already open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libagdb_file_open_wide(
+	     diff_handle->previous_file,
+	     previous_filename,
+	     LIBAGDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libagdb_file_open(
+	     diff_handle->previous_file,
+	     previous_filename,
+	     LIBAGDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open previous input file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libagdb_file_open_wide(
+	     diff_handle->current_file,
+	     current_filename,
+	     LIBAGDB_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libagdb_file_open(
+	     diff_handle->current_file,
+	     current_filename,
+	     LIBAGDB_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open current input file.",
+		 function );
+
+		libagdb_file_close(
+		 diff_handle->previous_file,
+		 NULL );
+
+		return( -1 );
+	}
+	diff_handle->input_is_open = 1;
+
+	return( 1 );
+}
+
+/* Closes the previous and current input
+ * Returns the 0 if successful or -1 on error
+ */
+int diff_handle_close_input(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_close_input";
+	int result            = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( diff_handle->input_is_open == 0 )
+	{
+		return( 0 );
+	}
+	if( libagdb_file_close(
+	     diff_handle->current_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close current input file.",
+		 function );
+
+		result = -1;
+	}
+	if( libagdb_file_close(
+	     diff_handle->previous_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close previous input file.",
+		 function );
+
+		result = -1;
+	}
+	diff_handle->input_is_open = 0;
+
+	return( result );
+}
+
+/* Compares the previous and current input
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_compare_input(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "diff_handle_compare_input";
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_diff_compare_files(
+	     diff_handle->diff,
+	     diff_handle->previous_file,
+	     diff_handle->current_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the device path and serial number of a specific volume
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_volume_fprint(
+     diff_handle_t *diff_handle,
+     libagdb_file_t *file,
+     int volume_index,
+     libcerror_error_t **error )
+{
+	libagdb_volume_information_t *volume_information = NULL;
+	system_character_t *value_string                 = NULL;
+	static char *function                            = "diff_handle_volume_fprint";
+	size_t value_string_size                         = 0;
+	uint32_t serial_number                           = 0;
+	int result                                       = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_file_get_volume_information(
+	     file,
+	     volume_index,
+	     &volume_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d information.",
+		 function,
+		 volume_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_volume_information_get_utf16_device_path_size(
+		  volume_information,
+		  &value_string_size,
+		  error );
+#else
+	result = libagdb_volume_information_get_utf8_device_path_size(
+		  volume_information,
+		  &value_string_size,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device path size.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_string_size > 0 )
+	{
+		value_string = system_string_allocate(
+				value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libagdb_volume_information_get_utf16_device_path(
+			  volume_information,
+			  (uint16_t *) value_string,
+			  value_string_size,
+			  error );
+#else
+		result = libagdb_volume_information_get_utf8_device_path(
+			  volume_information,
+			  (uint8_t *) value_string,
+			  value_string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve device path.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 diff_handle->notify_stream,
+		 "%" PRIs_SYSTEM "",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	if( libagdb_volume_information_get_serial_number(
+	     volume_information,
+	     &serial_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve serial number.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 diff_handle->notify_stream,
+	 " (serial number: 0x%08" PRIx32 ")",
+	 serial_number );
+
+	if( libagdb_volume_information_free(
+	     &volume_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume information.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( volume_information != NULL )
+	{
+		libagdb_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the path of a specific file of a specific volume
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_file_path_fprint(
+     diff_handle_t *diff_handle,
+     libagdb_file_t *file,
+     int volume_index,
+     int file_index,
+     libcerror_error_t **error )
+{
+	libagdb_file_information_t *file_information     = NULL;
+	libagdb_volume_information_t *volume_information = NULL;
+	system_character_t *value_string                 = NULL;
+	static char *function                            = "diff_handle_file_path_fprint";
+	size_t value_string_size                         = 0;
+	int result                                       = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_file_get_volume_information(
+	     file,
+	     volume_index,
+	     &volume_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d information.",
+		 function,
+		 volume_index );
+
+		goto on_error;
+	}
+	if( libagdb_volume_information_get_file_information(
+	     volume_information,
+	     file_index,
+	     &file_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d information.",
+		 function,
+		 file_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_information_get_utf16_path_size(
+		  file_information,
+		  &value_string_size,
+		  error );
+#else
+	result = libagdb_file_information_get_utf8_path_size(
+		  file_information,
+		  &value_string_size,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path size.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_string_size > 0 )
+	{
+		value_string = system_string_allocate(
+				value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libagdb_file_information_get_utf16_path(
+			  file_information,
+			  (uint16_t *) value_string,
+			  value_string_size,
+			  error );
+#else
+		result = libagdb_file_information_get_utf8_path(
+			  file_information,
+			  (uint8_t *) value_string,
+			  value_string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 diff_handle->notify_stream,
+		 "%" PRIs_SYSTEM "",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	if( libagdb_file_information_free(
+	     &file_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_volume_information_free(
+	     &volume_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume information.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( file_information != NULL )
+	{
+		libagdb_file_information_free(
+		 &file_information,
+		 NULL );
+	}
+	if( volume_information != NULL )
+	{
+		libagdb_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the executable filename and prefetch hash of a specific source
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_source_fprint(
+     diff_handle_t *diff_handle,
+     libagdb_file_t *file,
+     int source_index,
+     libcerror_error_t **error )
+{
+	libagdb_source_information_t *source_information = NULL;
+	system_character_t *value_string                 = NULL;
+	static char *function                            = "diff_handle_source_fprint";
+	size_t value_string_size                         = 0;
+	uint32_t prefetch_hash                           = 0;
+	int result                                       = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_file_get_source_information(
+	     file,
+	     source_index,
+	     &source_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source: %d information.",
+		 function,
+		 source_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_source_information_get_utf16_executable_filename_size(
+		  source_information,
+		  &value_string_size,
+		  error );
+#else
+	result = libagdb_source_information_get_utf8_executable_filename_size(
+		  source_information,
+		  &value_string_size,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_string_size > 0 )
+	{
+		value_string = system_string_allocate(
+				value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libagdb_source_information_get_utf16_executable_filename(
+			  source_information,
+			  (uint16_t *) value_string,
+			  value_string_size,
+			  error );
+#else
+		result = libagdb_source_information_get_utf8_executable_filename(
+			  source_information,
+			  (uint8_t *) value_string,
+			  value_string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve executable filename.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 diff_handle->notify_stream,
+		 "%" PRIs_SYSTEM "",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	if( libagdb_source_information_get_prefetch_hash(
+	     source_information,
+	     &prefetch_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 diff_handle->notify_stream,
+	 " (prefetch hash: 0x%08" PRIx32 ")",
+	 prefetch_hash );
+
+	if( libagdb_source_information_free(
+	     &source_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source information.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( source_information != NULL )
+	{
+		libagdb_source_information_free(
+		 &source_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the differences
+ * Removed items are prefixed with -, added items with + and changed items with ~
+ * Returns 1 if successful or -1 on error
+ */
+int diff_handle_differences_fprint(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error )
+{
+	libagdb_difference_t difference;
+
+	static char *function     = "diff_handle_differences_fprint";
+	int difference_index      = 0;
+	int number_of_differences = 0;
+	int result                = 0;
+
+	if( diff_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_diff_get_number_of_differences(
+	     diff_handle->diff,
+	     &number_of_differences,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of differences.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 diff_handle->notify_stream,
+	 "Windows SuperFetch database differences:\n" );
+
+	fprintf(
+	 diff_handle->notify_stream,
+	 "\tNumber of differences\t\t: %d\n",
+	 number_of_differences );
+
+	fprintf(
+	 diff_handle->notify_stream,
+	 "\n" );
+
+	for( difference_index = 0;
+	     difference_index < number_of_differences;
+	     difference_index++ )
+	{
+		if( diff_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libagdb_diff_get_difference(
+		     diff_handle->diff,
+		     difference_index,
+		     &difference,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve difference: %d.",
+			 function,
+			 difference_index );
+
+			return( -1 );
+		}
+		switch( difference.type )
+		{
+			case LIBAGDB_DIFFERENCE_TYPE_VOLUME_ADDED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "+ Volume: " );
+
+				result = diff_handle_volume_fprint(
+				          diff_handle,
+				          diff_handle->current_file,
+				          difference.current_volume_index,
+				          error );
+				break;
+
+			case LIBAGDB_DIFFERENCE_TYPE_VOLUME_REMOVED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "- Volume: " );
+
+				result = diff_handle_volume_fprint(
+				          diff_handle,
+				          diff_handle->previous_file,
+				          difference.previous_volume_index,
+				          error );
+				break;
+
+			case LIBAGDB_DIFFERENCE_TYPE_FILE_ADDED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "+ File: " );
+
+				result = diff_handle_file_path_fprint(
+				          diff_handle,
+				          diff_handle->current_file,
+				          difference.current_volume_index,
+				          difference.current_entry_index,
+				          error );
+
+				if( result == 1 )
+				{
+					fprintf(
+					 diff_handle->notify_stream,
+					 " (number of entries: %" PRIu32 ")",
+					 difference.current_number_of_entries );
+				}
+				break;
+
+			case LIBAGDB_DIFFERENCE_TYPE_FILE_REMOVED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "- File: " );
+
+				result = diff_handle_file_path_fprint(
+				          diff_handle,
+				          diff_handle->previous_file,
+				          difference.previous_volume_index,
+				          difference.previous_entry_index,
+				          error );
+
+				if( result == 1 )
+				{
+					fprintf(
+					 diff_handle->notify_stream,
+					 " (number of entries: %" PRIu32 ")",
+					 difference.previous_number_of_entries );
+				}
+				break;
+
+			case LIBAGDB_DIFFERENCE_TYPE_FILE_CHANGED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "~ File: " );
+
+				result = diff_handle_file_path_fprint(
+				          diff_handle,
+				          diff_handle->current_file,
+				          difference.current_volume_index,
+				          difference.current_entry_index,
+				          error );
+
+				if( result == 1 )
+				{
+					fprintf(
+					 diff_handle->notify_stream,
+					 " (number of entries: %" PRIu32 " -> %" PRIu32 ")",
+					 difference.previous_number_of_entries,
+					 difference.current_number_of_entries );
+				}
+				break;
+
+			case LIBAGDB_DIFFERENCE_TYPE_SOURCE_ADDED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "+ Source: " );
+
+				result = diff_handle_source_fprint(
+				          diff_handle,
+				          diff_handle->current_file,
+				          difference.current_entry_index,
+				          error );
+				break;
+
+			case LIBAGDB_DIFFERENCE_TYPE_SOURCE_REMOVED:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "- Source: " );
+
+				result = diff_handle_source_fprint(
+				          diff_handle,
+				          diff_handle->previous_file,
+				          difference.previous_entry_index,
+				          error );
+				break;
+
+			default:
+				fprintf(
+				 diff_handle->notify_stream,
+				 "? Unknown difference type: %" PRIu8 "",
+				 difference.type );
+
+				result = 1;
+
+				break;
+		}
+		fprintf(
+		 diff_handle->notify_stream,
+		 "\n" );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print difference: %d.",
+			 function,
+			 difference_index );
+
+			return( -1 );
+		}
+	}
+	fprintf(
+	 diff_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
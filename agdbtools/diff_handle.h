@@ -0,0 +1,119 @@
+/*
+ * Diff handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DIFF_HANDLE_H )
+#define _DIFF_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct diff_handle diff_handle_t;
+
+struct diff_handle
+{
+	/* The libagdb previous file
+	 */
+	libagdb_file_t *previous_file;
+
+	/* The libagdb current file
+	 */
+	libagdb_file_t *current_file;
+
+	/* The libagdb diff
+	 */
+	libagdb_diff_t *diff;
+
+	/* Value to indicate if the input is open
+	 */
+	int input_is_open;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int diff_handle_initialize(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_free(
+     diff_handle_t **diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_signal_abort(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_open_input(
+     diff_handle_t *diff_handle,
+     const system_character_t *previous_filename,
+     const system_character_t *current_filename,
+     libcerror_error_t **error );
+
+int diff_handle_close_input(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_compare_input(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+int diff_handle_volume_fprint(
+     diff_handle_t *diff_handle,
+     libagdb_file_t *file,
+     int volume_index,
+     libcerror_error_t **error );
+
+int diff_handle_file_path_fprint(
+     diff_handle_t *diff_handle,
+     libagdb_file_t *file,
+     int volume_index,
+     int file_index,
+     libcerror_error_t **error );
+
+int diff_handle_source_fprint(
+     diff_handle_t *diff_handle,
+     libagdb_file_t *file,
+     int source_index,
+     libcerror_error_t **error );
+
+int diff_handle_differences_fprint(
+     diff_handle_t *diff_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DIFF_HANDLE_H ) */
+
@@ -0,0 +1,768 @@
+/*
+ * Generate handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "agdbinput.h"
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+#include "generate_handle.h"
+
+#define GENERATE_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates a generate handle
+ * Make sure the value generate_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_initialize(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_initialize";
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generate_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generate handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*generate_handle = memory_allocate_structure(
+	                    generate_handle_t );
+
+	if( *generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create generate handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *generate_handle,
+	     0,
+	     sizeof( generate_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear generate handle.",
+		 function );
+
+		memory_free(
+		 *generate_handle );
+
+		*generate_handle = NULL;
+
+		return( -1 );
+	}
+	if( libagdb_generator_initialize(
+	     &( ( *generate_handle )->generator ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize generator.",
+		 function );
+
+		goto on_error;
+	}
+	( *generate_handle )->file_type             = LIBAGDB_FILE_TYPE_UNCOMPRESSED;
+	( *generate_handle )->number_of_bits        = 32;
+	( *generate_handle )->number_of_volumes     = 1;
+	( *generate_handle )->number_of_files       = 1;
+	( *generate_handle )->number_of_sub_entries = 1;
+	( *generate_handle )->number_of_sources     = 1;
+	( *generate_handle )->notify_stream         = GENERATE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *generate_handle != NULL )
+	{
+		memory_free(
+		 *generate_handle );
+
+		*generate_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a generate handle
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_free(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_free";
+	int result            = 1;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generate_handle != NULL )
+	{
+		if( libagdb_generator_free(
+		     &( ( *generate_handle )->generator ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free generator.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *generate_handle );
+
+		*generate_handle = NULL;
+	}
+	return( result );
+}
+
+/* Sets the file type
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_file_type(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_file_type";
+	size_t string_length  = 0;
+	uint8_t file_type     = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "win7" ),
+		     4 ) == 0 )
+		{
+			file_type = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7;
+			result    = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "vista" ),
+		     5 ) == 0 )
+		{
+			file_type = LIBAGDB_FILE_TYPE_COMPRESSED_VISTA;
+			result    = 1;
+		}
+	}
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "win8.0" ),
+		     6 ) == 0 )
+		{
+			file_type = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0;
+			result    = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "win8.1" ),
+		          6 ) == 0 )
+		{
+			file_type = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1;
+			result    = 1;
+		}
+	}
+	else if( string_length == 12 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "uncompressed" ),
+		     12 ) == 0 )
+		{
+			file_type = LIBAGDB_FILE_TYPE_UNCOMPRESSED;
+			result    = 1;
+		}
+	}
+	if( result != 0 )
+	{
+		generate_handle->file_type = file_type;
+	}
+	return( result );
+}
+
+/* Sets the number of bits
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_bits(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_bits";
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_determine_number_value(
+	          string,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of bits.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ( value_32bit != 32 )
+		 && ( value_32bit != 64 ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			generate_handle->number_of_bits = (uint8_t) value_32bit;
+		}
+	}
+	return( result );
+}
+
+/* Determines a 32-bit number value from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_determine_number_value(
+     const system_character_t *string,
+     uint32_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_determine_number_value";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	result = agdbinput_determine_decimal_value(
+	          string,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine decimal value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( value_64bit > (uint64_t) UINT32_MAX )
+		{
+			result = 0;
+		}
+		else
+		{
+			*value = (uint32_t) value_64bit;
+		}
+	}
+	return( result );
+}
+
+/* Sets the number of volumes
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_volumes(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_volumes";
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_determine_number_value(
+	          string,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->number_of_volumes = value_32bit;
+	}
+	return( result );
+}
+
+/* Sets the number of files
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_files(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_files";
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_determine_number_value(
+	          string,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of files.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->number_of_files = value_32bit;
+	}
+	return( result );
+}
+
+/* Sets the number of sub entries
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_sub_entries(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_sub_entries";
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_determine_number_value(
+	          string,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of sub entries.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->number_of_sub_entries = value_32bit;
+	}
+	return( result );
+}
+
+/* Sets the number of sources
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int generate_handle_set_number_of_sources(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "generate_handle_set_number_of_sources";
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = generate_handle_determine_number_value(
+	          string,
+	          &value_32bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		generate_handle->number_of_sources = value_32bit;
+	}
+	return( result );
+}
+
+/* Writes a generated file
+ * Returns 1 if successful or -1 on error
+ */
+int generate_handle_write_file(
+     generate_handle_t *generate_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function           = "generate_handle_write_file";
+	size64_t file_size              = 0;
+	uint32_t uncompressed_data_size = 0;
+
+	if( generate_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generate handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_generator_set_file_type(
+	     generate_handle->generator,
+	     generate_handle->file_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_generator_set_number_of_bits(
+	     generate_handle->generator,
+	     generate_handle->number_of_bits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of bits.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_generator_set_number_of_volumes(
+	     generate_handle->generator,
+	     generate_handle->number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_generator_set_number_of_files(
+	     generate_handle->generator,
+	     generate_handle->number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of files.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_generator_set_number_of_sub_entries(
+	     generate_handle->generator,
+	     generate_handle->number_of_sub_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of sub entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_generator_set_number_of_sources(
+	     generate_handle->generator,
+	     generate_handle->number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_generator_get_uncompressed_data_size(
+	     generate_handle->generator,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_generator_get_file_size(
+	     generate_handle->generator,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 generate_handle->notify_stream,
+	 "Generating Windows SuperFetch database file: %" PRIs_SYSTEM "\n",
+	 filename );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tNumber of bits\t\t\t: %" PRIu8 "\n",
+	 generate_handle->number_of_bits );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tNumber of volumes\t\t: %" PRIu32 "\n",
+	 generate_handle->number_of_volumes );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tNumber of files per volume\t: %" PRIu32 "\n",
+	 generate_handle->number_of_files );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tNumber of sub entries\t\t: %" PRIu32 "\n",
+	 generate_handle->number_of_sub_entries );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tNumber of sources\t\t: %" PRIu32 "\n",
+	 generate_handle->number_of_sources );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tUncompressed data size\t\t: %" PRIu32 " bytes\n",
+	 uncompressed_data_size );
+
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\tFile size\t\t\t: %" PRIu64 " bytes\n",
+	 file_size );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libagdb_generator_write_wide(
+	     generate_handle->generator,
+	     filename,
+	     error ) != 1 )
+#else
+	if( libagdb_generator_write(
+	     generate_handle->generator,
+	     filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 generate_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
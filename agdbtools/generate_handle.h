@@ -0,0 +1,126 @@
+/*
+ * Generate handle
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GENERATE_HANDLE_H )
+#define _GENERATE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct generate_handle generate_handle_t;
+
+struct generate_handle
+{
+	/* The libagdb generator
+	 */
+	libagdb_generator_t *generator;
+
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The number of bits
+	 */
+	uint8_t number_of_bits;
+
+	/* The number of volumes
+	 */
+	uint32_t number_of_volumes;
+
+	/* The number of files per volume
+	 */
+	uint32_t number_of_files;
+
+	/* The number of sub entries
+	 */
+	uint32_t number_of_sub_entries;
+
+	/* The number of sources
+	 */
+	uint32_t number_of_sources;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+};
+
+int generate_handle_initialize(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error );
+
+int generate_handle_free(
+     generate_handle_t **generate_handle,
+     libcerror_error_t **error );
+
+int generate_handle_set_file_type(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_bits(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_determine_number_value(
+     const system_character_t *string,
+     uint32_t *value,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_volumes(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_files(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_sub_entries(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_set_number_of_sources(
+     generate_handle_t *generate_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int generate_handle_write_file(
+     generate_handle_t *generate_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GENERATE_HANDLE_H ) */
+
@@ -0,0 +1,1840 @@
+/*
+ * Info batch
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "agdbinput.h"
+#include "agdbtools_libagdb.h"
+#include "agdbtools_libcerror.h"
+#include "agdbtools_libcnotify.h"
+#include "agdbtools_libcthreads.h"
+#include "info_batch.h"
+#include "info_handle.h"
+
+#if defined( HAVE_DIRENT_H ) && defined( HAVE_SYS_STAT_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define INFO_BATCH_HAVE_DIRECTORY_SUPPORT	1
+#endif
+
+#if defined( HAVE_FCNTL_H ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_UNISTD_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && !defined( WINAPI )
+#define INFO_BATCH_HAVE_SIGNATURE_SUPPORT	1
+#endif
+
+/* Creates a job
+ * Make sure the value job is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_job_initialize(
+     info_batch_job_t **job,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_job_initialize";
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*job = memory_allocate_structure(
+	        info_batch_job_t );
+
+	if( *job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *job,
+	     0,
+	     sizeof( info_batch_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear job.",
+		 function );
+
+		memory_free(
+		 *job );
+
+		*job = NULL;
+
+		return( -1 );
+	}
+	( *job )->filename = system_string_allocate(
+	                      filename_length + 1 );
+
+	if( ( *job )->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *job )->filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	( *job )->filename[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( *job != NULL )
+	{
+		if( ( *job )->filename != NULL )
+		{
+			memory_free(
+			 ( *job )->filename );
+		}
+		memory_free(
+		 *job );
+
+		*job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a job
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_job_free(
+     info_batch_job_t **job,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_job_free";
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *job != NULL )
+	{
+		if( ( *job )->output_stream != NULL )
+		{
+			file_stream_close(
+			 ( *job )->output_stream );
+		}
+		if( ( *job )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *job )->error ) );
+		}
+		memory_free(
+		 ( *job )->filename );
+
+		memory_free(
+		 *job );
+
+		*job = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates an info batch
+ * Make sure the value info_batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_initialize(
+     info_batch_t **info_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_initialize";
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*info_batch = memory_allocate_structure(
+	               info_batch_t );
+
+	if( *info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create info batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *info_batch,
+	     0,
+	     sizeof( info_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear info batch.",
+		 function );
+
+		memory_free(
+		 *info_batch );
+
+		*info_batch = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *info_batch )->jobs_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *info_batch )->jobs_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create jobs condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *info_batch )->number_of_threads = 1;
+	( *info_batch )->output_format     = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+	( *info_batch )->output_stream     = stdout;
+
+	return( 1 );
+
+on_error:
+	if( *info_batch != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *info_batch )->jobs_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *info_batch )->jobs_mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *info_batch );
+
+		*info_batch = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an info batch
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_free(
+     info_batch_t **info_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_free";
+	int job_index         = 0;
+	int result            = 1;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_batch != NULL )
+	{
+		if( ( *info_batch )->jobs != NULL )
+		{
+			for( job_index = 0;
+			     job_index < ( *info_batch )->number_of_jobs;
+			     job_index++ )
+			{
+				if( info_batch_job_free(
+				     &( ( *info_batch )->jobs[ job_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free job: %d.",
+					 function,
+					 job_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *info_batch )->jobs );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *info_batch )->jobs_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free jobs condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *info_batch )->jobs_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free jobs mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *info_batch );
+
+		*info_batch = NULL;
+	}
+	return( result );
+}
+
+/* Signals the info batch to abort
+ * Jobs that have not been started are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_signal_abort(
+     info_batch_t *info_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_signal_abort";
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	info_batch->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_batch_set_number_of_threads(
+     info_batch_t *info_batch,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_set_number_of_threads";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	result = agdbinput_determine_decimal_value(
+	          string,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) INFO_BATCH_MAXIMUM_NUMBER_OF_THREADS ) )
+		{
+			result = 0;
+		}
+		else
+		{
+			info_batch->number_of_threads = (int) value_64bit;
+		}
+	}
+	return( result );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_batch_set_output_format(
+     info_batch_t *info_batch,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_set_output_format";
+	int result            = 0;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	result = info_handle_determine_output_format(
+	          string,
+	          &( info_batch->output_format ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine output format.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Appends a file to the jobs
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_append_file(
+     info_batch_t *info_batch,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	info_batch_job_t **reallocation = NULL;
+	info_batch_job_t *job           = NULL;
+	static char *function           = "info_batch_append_file";
+	int number_of_allocated_jobs    = 0;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_batch->number_of_jobs >= info_batch->number_of_allocated_jobs )
+	{
+		if( info_batch->number_of_allocated_jobs >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid info batch - number of allocated jobs value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_jobs = info_batch->number_of_allocated_jobs * 2;
+
+		if( number_of_allocated_jobs == 0 )
+		{
+			number_of_allocated_jobs = 16;
+		}
+		if( (size_t) number_of_allocated_jobs > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( info_batch_job_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated jobs value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (info_batch_job_t **) memory_reallocate(
+		                                      info_batch->jobs,
+		                                      sizeof( info_batch_job_t * ) * number_of_allocated_jobs );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize jobs.",
+			 function );
+
+			return( -1 );
+		}
+		info_batch->jobs                     = reallocation;
+		info_batch->number_of_allocated_jobs = number_of_allocated_jobs;
+	}
+	if( info_batch_job_initialize(
+	     &job,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create job.",
+		 function );
+
+		return( -1 );
+	}
+	info_batch->jobs[ info_batch->number_of_jobs ] = job;
+
+	info_batch->number_of_jobs += 1;
+
+	return( 1 );
+}
+
+#if defined( INFO_BATCH_HAVE_DIRECTORY_SUPPORT )
+
+/* Compares the filenames of two jobs
+ * Returns a value less than, equal to or greater than 0
+ */
+static int info_batch_job_compare(
+            const void *first_value,
+            const void *second_value )
+{
+	const info_batch_job_t *first_job  = *( (info_batch_job_t * const *) first_value );
+	const info_batch_job_t *second_job = *( (info_batch_job_t * const *) second_value );
+
+	return( narrow_string_compare(
+	         first_job->filename,
+	         second_job->filename,
+	         narrow_string_length(
+	          first_job->filename ) + 1 ) );
+}
+
+#endif /* defined( INFO_BATCH_HAVE_DIRECTORY_SUPPORT ) */
+
+/* Appends the regular files in a directory to the jobs
+ * The files are appended sorted by name so the output does not depend on the directory order
+ * Returns 1 if successful, 0 if the path is not a directory or -1 on error
+ */
+int info_batch_append_directory(
+     info_batch_t *info_batch,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+#if defined( INFO_BATCH_HAVE_DIRECTORY_SUPPORT )
+	struct stat file_statistics;
+
+	struct dirent *directory_entry = NULL;
+	DIR *directory                 = NULL;
+	char *filename                 = NULL;
+	static char *function          = "info_batch_append_directory";
+	size_t entry_name_length       = 0;
+	size_t filename_length         = 0;
+	size_t filename_size           = 0;
+	size_t path_length             = 0;
+	int first_job_index            = 0;
+#else
+	static char *function          = "info_batch_append_directory";
+#endif
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( INFO_BATCH_HAVE_DIRECTORY_SUPPORT )
+	if( stat(
+	     path,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	if( !S_ISDIR( file_statistics.st_mode ) )
+	{
+		return( 0 );
+	}
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	path_length = narrow_string_length(
+	               path );
+
+	while( ( path_length > 1 )
+	    && ( path[ path_length - 1 ] == '/' ) )
+	{
+		path_length--;
+	}
+	first_job_index = info_batch->number_of_jobs;
+
+	while( ( directory_entry = readdir( directory ) ) != NULL )
+	{
+		/* Skip hidden files and the . and .. entries
+		 */
+		if( directory_entry->d_name[ 0 ] == '.' )
+		{
+			continue;
+		}
+		entry_name_length = narrow_string_length(
+		                     directory_entry->d_name );
+
+		filename_length = path_length + 1 + entry_name_length;
+
+		if( ( filename_length + 1 ) > filename_size )
+		{
+			if( filename != NULL )
+			{
+				memory_free(
+				 filename );
+			}
+			filename_size = filename_length + 1;
+
+			filename = narrow_string_allocate(
+			            filename_size );
+
+			if( filename == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create filename.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( narrow_string_copy(
+		     filename,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			goto on_error;
+		}
+		filename[ path_length ] = '/';
+
+		if( narrow_string_copy(
+		     &( filename[ path_length + 1 ] ),
+		     directory_entry->d_name,
+		     entry_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		filename[ filename_length ] = 0;
+
+		if( stat(
+		     filename,
+		     &file_statistics ) != 0 )
+		{
+			continue;
+		}
+		if( !S_ISREG( file_statistics.st_mode ) )
+		{
+			continue;
+		}
+		if( info_batch_append_file(
+		     info_batch,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+
+		filename = NULL;
+	}
+	if( closedir(
+	     directory ) != 0 )
+	{
+		directory = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	if( ( info_batch->number_of_jobs - first_job_index ) > 1 )
+	{
+		qsort(
+		 &( info_batch->jobs[ first_job_index ] ),
+		 (size_t) ( info_batch->number_of_jobs - first_job_index ),
+		 sizeof( info_batch_job_t * ),
+		 &info_batch_job_compare );
+	}
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( INFO_BATCH_HAVE_DIRECTORY_SUPPORT ) */
+}
+
+/* Appends a source to the jobs
+ * If the source is a directory the regular files in the directory are appended
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_append_source(
+     info_batch_t *info_batch,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_append_source";
+	int result            = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	result = info_batch_append_directory(
+	          info_batch,
+	          source,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( info_batch_append_file(
+		     info_batch,
+		     source,
+		     system_string_length(
+		      source ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the file type of a job from the signature
+ * Only the file header is read, a file without a supported signature has file type 0
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_job_check_signature(
+     info_batch_job_t *job,
+     libcerror_error_t **error )
+{
+#if defined( INFO_BATCH_HAVE_SIGNATURE_SUPPORT )
+	uint8_t signature[ 8 ];
+	struct stat file_stat;
+
+	ssize_t read_count    = 0;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "info_batch_job_check_signature";
+
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	job->file_type              = 0;
+	job->uncompressed_data_size = 0;
+
+#if defined( INFO_BATCH_HAVE_SIGNATURE_SUPPORT )
+	file_descriptor = open(
+	                   job->filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 job->filename );
+
+		return( -1 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_stat ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine file size.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = pread(
+	              file_descriptor,
+	              signature,
+	              8,
+	              0 );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read signature.",
+		 function );
+
+		goto on_error;
+	}
+	close(
+	 file_descriptor );
+
+	file_descriptor = -1;
+
+	if( read_count == 8 )
+	{
+		if( libagdb_check_file_signature_data(
+		     signature,
+		     8,
+		     (size64_t) file_stat.st_size,
+		     &( job->file_type ),
+		     &( job->uncompressed_data_size ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check signature.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	close(
+	 file_descriptor );
+
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: signature only mode is not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( INFO_BATCH_HAVE_SIGNATURE_SUPPORT ) */
+}
+
+/* Processes a job
+ * When multiple threads are used the output is written to a temporary file
+ * that is copied to the output stream in job order by info_batch_copy_job_output
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_process_job(
+     info_batch_job_t *job,
+     info_batch_t *info_batch )
+{
+	info_handle_t *info_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	static char *function      = "info_batch_process_job";
+	int result                 = 0;
+
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 &( job->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		job->result = -1;
+
+		return( -1 );
+	}
+	if( info_batch->number_of_threads <= 1 )
+	{
+		job->number_of_records = info_batch->number_of_records;
+	}
+	if( info_batch->abort != 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		goto on_error;
+	}
+	/* In signature only mode the file is not opened and the output is written
+	 * by info_batch_process in job order
+	 */
+	if( info_batch->signature_only != 0 )
+	{
+		if( info_batch_job_check_signature(
+		     job,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check signature.",
+			 function );
+
+			goto on_error;
+		}
+		job->result = 1;
+
+		result = 1;
+
+		goto on_processed;
+	}
+	if( info_handle_initialize(
+	     &info_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize info handle.",
+		 function );
+
+		goto on_error;
+	}
+	info_handle->output_format = info_batch->output_format;
+
+	if( info_batch->number_of_threads > 1 )
+	{
+		job->output_stream = tmpfile();
+
+		if( job->output_stream == NULL )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to create temporary output file.",
+			 function );
+
+			goto on_error;
+		}
+		info_handle->notify_stream = job->output_stream;
+	}
+	else
+	{
+		/* Continue the record numbering so records are separated correctly
+		 */
+		info_handle->notify_stream     = info_batch->output_stream;
+		info_handle->number_of_records = info_batch->number_of_records;
+	}
+	if( info_batch->number_of_jobs > 1 )
+	{
+		if( info_handle_input_fprint(
+		     info_handle,
+		     job->filename,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print input.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle_open_input(
+	     info_handle,
+	     job->filename,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		result = info_handle_file_fprint(
+		          info_handle,
+		          &error );
+	}
+	else
+	{
+		result = info_handle_file_json_fprint(
+		          info_handle,
+		          &error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print file information.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_close_input(
+	     info_handle,
+	     &error ) != 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input.",
+		 function );
+
+		goto on_error;
+	}
+	job->number_of_records = info_handle->number_of_records;
+
+	if( info_handle_free(
+	     &info_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free info handle.",
+		 function );
+
+		goto on_error;
+	}
+	job->result = 1;
+
+	result = 1;
+
+	goto on_processed;
+
+on_error:
+	if( info_handle != NULL )
+	{
+		/* Make sure the output of the records written so far is complete
+		 */
+		info_handle_output_flush(
+		 info_handle,
+		 NULL );
+
+		job->number_of_records = info_handle->number_of_records;
+
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	job->error  = error;
+	job->result = -1;
+
+	result = -1;
+
+on_processed:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     info_batch->jobs_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	job->is_processed = 1;
+
+	libcthreads_condition_broadcast(
+	 info_batch->jobs_condition,
+	 NULL );
+
+	libcthreads_mutex_release(
+	 info_batch->jobs_mutex,
+	 NULL );
+#else
+	job->is_processed = 1;
+#endif
+	return( result );
+}
+
+/* Waits for a job to be processed
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_wait_for_job(
+     info_batch_t *info_batch,
+     info_batch_job_t *job,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_wait_for_job";
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     info_batch->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab jobs mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( job->is_processed == 0 )
+	{
+		if( libcthreads_condition_wait(
+		     info_batch->jobs_condition,
+		     info_batch->jobs_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for jobs condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 info_batch->jobs_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     info_batch->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release jobs mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Copies the output of a processed job to the output stream
+ * The output of a job that failed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_copy_job_output(
+     info_batch_t *info_batch,
+     info_batch_job_t *job,
+     libcerror_error_t **error )
+{
+	uint8_t buffer[ 8192 ];
+
+	static char *function = "info_batch_copy_job_output";
+	size_t read_count     = 0;
+	size_t write_count    = 0;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( job->output_stream == NULL )
+	{
+		return( 1 );
+	}
+	if( job->result == 1 )
+	{
+		/* The first record of every job is written without separator
+		 */
+		if( ( info_batch->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+		 && ( info_batch->number_of_records > 0 )
+		 && ( job->number_of_records > 0 ) )
+		{
+			if( fwrite(
+			     ",",
+			     1,
+			     1,
+			     info_batch->output_stream ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write record separator.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		rewind(
+		 job->output_stream );
+
+		do
+		{
+			read_count = fread(
+			              buffer,
+			              sizeof( uint8_t ),
+			              8192,
+			              job->output_stream );
+
+			if( read_count > 0 )
+			{
+				write_count = fwrite(
+				               buffer,
+				               sizeof( uint8_t ),
+				               read_count,
+				               info_batch->output_stream );
+
+				if( write_count != read_count )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write job output.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		while( read_count == 8192 );
+
+		if( ferror( job->output_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read job output.",
+			 function );
+
+			goto on_error;
+		}
+		info_batch->number_of_records += job->number_of_records;
+	}
+	file_stream_close(
+	 job->output_stream );
+
+	job->output_stream = NULL;
+
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 job->output_stream );
+
+	job->output_stream = NULL;
+
+	return( -1 );
+}
+
+/* Processes the jobs
+ * The output of every job is written in job order without interleaving
+ * Returns 1 if successful, 0 if one or more jobs failed or -1 on error
+ */
+int info_batch_process(
+     info_batch_t *info_batch,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	int number_of_threads                  = 0;
+#endif
+	info_batch_job_t *job                  = NULL;
+	info_handle_t *signature_info_handle   = NULL;
+	static char *function                  = "info_batch_process";
+	int job_index                          = 0;
+	int result                             = 1;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	info_batch->number_of_threads = 1;
+#endif
+	info_batch->number_of_records = 0;
+
+	if( info_batch->signature_only != 0 )
+	{
+		if( info_handle_initialize(
+		     &signature_info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize signature info handle.",
+			 function );
+
+			goto on_error;
+		}
+		signature_info_handle->output_format = info_batch->output_format;
+		signature_info_handle->notify_stream = info_batch->output_stream;
+	}
+	if( info_batch->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		if( fwrite(
+		     "[",
+		     1,
+		     1,
+		     info_batch->output_stream ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write array start.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_batch->number_of_threads > 1 )
+	{
+		number_of_threads = info_batch->number_of_threads;
+
+		if( number_of_threads > info_batch->number_of_jobs )
+		{
+			number_of_threads = info_batch->number_of_jobs;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     info_batch->number_of_jobs,
+		     (int (*)(intptr_t *, intptr_t *)) &info_batch_process_job,
+		     (intptr_t *) info_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( job_index = 0;
+		     job_index < info_batch->number_of_jobs;
+		     job_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) info_batch->jobs[ job_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push job: %d onto thread pool.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+	}
+#endif
+	for( job_index = 0;
+	     job_index < info_batch->number_of_jobs;
+	     job_index++ )
+	{
+		job = info_batch->jobs[ job_index ];
+
+		if( info_batch->number_of_threads > 1 )
+		{
+			if( info_batch_wait_for_job(
+			     info_batch,
+			     job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for job: %d.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+			if( info_batch_copy_job_output(
+			     info_batch,
+			     job,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to copy output of job: %d.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			info_batch_process_job(
+			 job,
+			 info_batch );
+
+			info_batch->number_of_records = job->number_of_records;
+		}
+		if( job->result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process source file: %" PRIs_SYSTEM ".\n",
+			 job->filename );
+
+			if( job->error != NULL )
+			{
+				libcnotify_print_error_backtrace(
+				 job->error );
+				libcerror_error_free(
+				 &( job->error ) );
+			}
+			result = 0;
+		}
+		else if( signature_info_handle != NULL )
+		{
+			if( info_handle_signature_fprint(
+			     signature_info_handle,
+			     job->filename,
+			     job->file_type,
+			     job->uncompressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print signature of job: %d.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( signature_info_handle != NULL )
+	{
+		if( info_handle_output_flush(
+		     signature_info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush signature output.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle_free(
+		     &signature_info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free signature info handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_batch->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		if( fwrite(
+		     "\n]\n",
+		     1,
+		     3,
+		     info_batch->output_stream ) != 3 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write array end.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		info_batch_signal_abort(
+		 info_batch,
+		 NULL );
+
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( signature_info_handle != NULL )
+	{
+		info_handle_free(
+		 &signature_info_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,201 @@
+/*
+ * Info batch
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INFO_BATCH_H )
+#define _INFO_BATCH_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "agdbtools_libcerror.h"
+#include "agdbtools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define INFO_BATCH_MAXIMUM_NUMBER_OF_THREADS	64
+
+typedef struct info_batch_job info_batch_job_t;
+
+struct info_batch_job
+{
+	/* The filename
+	 */
+	system_character_t *filename;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* The number of output records
+	 */
+	int number_of_records;
+
+	/* The file type determined from the signature
+	 */
+	uint8_t file_type;
+
+	/* The uncompressed data size determined from the signature
+	 */
+	uint32_t uncompressed_data_size;
+
+	/* The result
+	 */
+	int result;
+
+	/* Value to indicate the job was processed
+	 */
+	int is_processed;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct info_batch info_batch_t;
+
+struct info_batch
+{
+	/* The jobs
+	 */
+	info_batch_job_t **jobs;
+
+	/* The number of jobs
+	 */
+	int number_of_jobs;
+
+	/* The number of allocated jobs
+	 */
+	int number_of_allocated_jobs;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* Value to indicate only the file type should be determined from the signature
+	 */
+	uint8_t signature_only;
+
+	/* The number of output records
+	 */
+	int number_of_records;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The jobs mutex
+	 */
+	libcthreads_mutex_t *jobs_mutex;
+
+	/* The jobs condition
+	 */
+	libcthreads_condition_t *jobs_condition;
+#endif
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int info_batch_job_initialize(
+     info_batch_job_t **job,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int info_batch_job_free(
+     info_batch_job_t **job,
+     libcerror_error_t **error );
+
+int info_batch_initialize(
+     info_batch_t **info_batch,
+     libcerror_error_t **error );
+
+int info_batch_free(
+     info_batch_t **info_batch,
+     libcerror_error_t **error );
+
+int info_batch_signal_abort(
+     info_batch_t *info_batch,
+     libcerror_error_t **error );
+
+int info_batch_set_number_of_threads(
+     info_batch_t *info_batch,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_batch_set_output_format(
+     info_batch_t *info_batch,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_batch_append_file(
+     info_batch_t *info_batch,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int info_batch_append_directory(
+     info_batch_t *info_batch,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int info_batch_append_source(
+     info_batch_t *info_batch,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+int info_batch_job_check_signature(
+     info_batch_job_t *job,
+     libcerror_error_t **error );
+
+int info_batch_process_job(
+     info_batch_job_t *job,
+     info_batch_t *info_batch );
+
+int info_batch_wait_for_job(
+     info_batch_t *info_batch,
+     info_batch_job_t *job,
+     libcerror_error_t **error );
+
+int info_batch_copy_job_output(
+     info_batch_t *info_batch,
+     info_batch_job_t *job,
+     libcerror_error_t **error );
+
+int info_batch_process(
+     info_batch_t *info_batch,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INFO_BATCH_H ) */
+
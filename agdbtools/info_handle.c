@@ -31,10 +31,39 @@
 #include "agdbtools_libcerror.h"
 #include "agdbtools_libfdatetime.h"
 #include "agdbtools_libagdb.h"
+#include "agdbtools_libuna.h"
 #include "info_handle.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
+/* Retrieves a string representation of the file type
+ */
+const char *info_handle_get_file_type_string(
+             uint8_t file_type )
+{
+	switch( file_type )
+	{
+		case LIBAGDB_FILE_TYPE_UNCOMPRESSED:
+			return( "Uncompressed" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_VISTA:
+			return( "Windows Vista compressed (MEMO)" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7:
+			return( "Windows 7 compressed (MEM0)" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0:
+			return( "Windows 8.0 compressed (MEM)" );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1:
+			return( "Windows 8.1 compressed (MAM)" );
+
+		default:
+			break;
+	}
+	return( "Unknown" );
+}
+
 /* Creates an info handle
  * Make sure the value info_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -162,6 +191,16 @@ int info_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *info_handle )->output_buffer != NULL )
+		{
+			memory_free(
+			 ( *info_handle )->output_buffer );
+		}
+		if( ( *info_handle )->value_string != NULL )
+		{
+			memory_free(
+			 ( *info_handle )->value_string );
+		}
 		memory_free(
 		 *info_handle );
 
@@ -252,6 +291,117 @@ int info_handle_set_ascii_codepage(
 	return( result );
 }
 
+/* Determines the output format from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_determine_output_format(
+     const system_character_t *string,
+     int *output_format,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_determine_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output format.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "json" ),
+		     4 ) == 0 )
+		{
+			*output_format = INFO_HANDLE_OUTPUT_FORMAT_JSON;
+			result         = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "text" ),
+		          4 ) == 0 )
+		{
+			*output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+			result         = 1;
+		}
+	}
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "ndjson" ),
+		     6 ) == 0 )
+		{
+			*output_format = INFO_HANDLE_OUTPUT_FORMAT_NDJSON;
+			result         = 1;
+		}
+	}
+	return( result );
+}
+
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_output_format";
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = info_handle_determine_output_format(
+	          string,
+	          &( info_handle->output_format ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine output format.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Opens the input
  * Returns 1 if successful or -1 on error
  */
@@ -335,31 +485,75 @@ int info_handle_close_input(
 	return( 0 );
 }
 
-/* Prints the file information
+/* Resizes the UTF-8 value string
+ * The value string is only reallocated when it needs to grow
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_fprint(
+int info_handle_resize_value_string(
      info_handle_t *info_handle,
+     size_t value_string_size,
      libcerror_error_t **error )
 {
-	system_character_t filetime_string[ 48 ];
+	uint8_t *reallocation = NULL;
+	static char *function = "info_handle_resize_value_string";
 
-	libagdb_source_information_t *source_information = NULL;
-	libagdb_file_information_t *file_information     = NULL;
-	libagdb_volume_information_t *volume_information = NULL;
-	system_character_t *value_string                 = NULL;
-	libfdatetime_filetime_t *filetime                = NULL;
-	static char *function                            = "info_handle_file_fprint";
-	size_t value_string_size                         = 0;
-	uint64_t value_64bit                             = 0;
-	uint32_t value_32bit                             = 0;
-	int file_index                                   = 0;
-	int number_of_files                              = 0;
-	int number_of_sources                            = 0;
-	int number_of_volumes                            = 0;
-	int result                                       = 0;
-	int source_index                                 = 0;
-	int volume_index                                 = 0;
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_string_size == 0 )
+	 || ( value_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_size <= info_handle->value_string_size )
+	{
+		return( 1 );
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            info_handle->value_string,
+	                            sizeof( uint8_t ) * value_string_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize value string.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->value_string      = reallocation;
+	info_handle->value_string_size = value_string_size;
+
+	return( 1 );
+}
+
+/* Flushes the output buffer to the notify stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_flush(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_flush";
+	size_t write_count    = 0;
 
 	if( info_handle == NULL )
 	{
@@ -372,371 +566,2427 @@ int info_handle_file_fprint(
 
 		return( -1 );
 	}
-	if( libfdatetime_filetime_initialize(
-	     &filetime,
-	     error ) != 1 )
+	if( info_handle->output_buffer_offset == 0 )
+	{
+		return( 1 );
+	}
+	write_count = fwrite(
+	               info_handle->output_buffer,
+	               sizeof( uint8_t ),
+	               info_handle->output_buffer_offset,
+	               info_handle->notify_stream );
+
+	if( write_count != info_handle->output_buffer_offset )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create filetime.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output buffer.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "Windows SuperFetch database file information:\n" );
+	info_handle->output_buffer_offset = 0;
 
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
+	return( 1 );
+}
 
-	fprintf(
-	 info_handle->notify_stream,
-	 "Volumes:\n" );
+/* Writes data to the output buffer
+ * The output buffer is flushed to the notify stream when full
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write(
+     info_handle_t *info_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_write";
+	size_t write_count    = 0;
 
-	if( libagdb_file_get_number_of_volumes(
-	     info_handle->input_file,
-	     &number_of_volumes,
-	     error ) != 1 )
+	if( info_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of volumes.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of volumes\t\t: %d\n",
-	 number_of_volumes );
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
 
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
 
-	for( volume_index = 0;
-	     volume_index < number_of_volumes;
-	     volume_index++ )
+		return( -1 );
+	}
+	if( info_handle->output_buffer == NULL )
 	{
-		if( libagdb_file_get_volume_information(
-		     info_handle->input_file,
-		     volume_index,
-		     &volume_information,
+		info_handle->output_buffer = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * INFO_HANDLE_OUTPUT_BUFFER_SIZE );
+
+		if( info_handle->output_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		info_handle->output_buffer_offset = 0;
+	}
+	if( data_size > ( INFO_HANDLE_OUTPUT_BUFFER_SIZE - info_handle->output_buffer_offset ) )
+	{
+		if( info_handle_output_flush(
+		     info_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve volume information.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "Volume: %d information:\n",
-		 volume_index + 1 );
+	}
+	/* Data that does not fit in the output buffer is written directly
+	 */
+	if( data_size > INFO_HANDLE_OUTPUT_BUFFER_SIZE )
+	{
+		write_count = fwrite(
+		               data,
+		               sizeof( uint8_t ),
+		               data_size,
+		               info_handle->notify_stream );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libagdb_volume_information_get_utf16_device_path_size(
-			  volume_information,
-			  &value_string_size,
-			  error );
-#else
-		result = libagdb_volume_information_get_utf8_device_path_size(
-			  volume_information,
-			  &value_string_size,
-			  error );
-#endif
-		if( result != 1 )
+		if( write_count != data_size )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve device path size.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data.",
 			 function );
 
-			goto on_error;
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( memory_copy(
+	     &( info_handle->output_buffer[ info_handle->output_buffer_offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->output_buffer_offset += data_size;
+
+	return( 1 );
+}
+
+/* Writes a narrow string to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write_string(
+     info_handle_t *info_handle,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_write_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_write(
+	     info_handle,
+	     (uint8_t *) string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an unsigned integer as a decimal value to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write_integer(
+     info_handle_t *info_handle,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_string[ 20 ];
+
+	static char *function = "info_handle_output_write_integer";
+	size_t string_index   = 20;
+
+	do
+	{
+		string_index--;
+
+		value_string[ string_index ] = (uint8_t) '0' + (uint8_t) ( value_64bit % 10 );
+
+		value_64bit /= 10;
+	}
+	while( value_64bit > 0 );
+
+	if( info_handle_output_write(
+	     info_handle,
+	     &( value_string[ string_index ] ),
+	     20 - string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write integer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an UTF-8 string as a quoted and escaped JSON string to the output buffer
+ * The string is terminated by the end-of-string character or the string size
+ * Bytes that are not part of a valid UTF-8 sequence are written as the escaped
+ * Unicode replacement character U+FFFD, hence the output is always valid JSON
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write_json_string(
+     info_handle_t *info_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t escaped_character[ 6 ] = { '\\', 'u', '0', '0', 0, 0 };
+
+	const char *hexadecimal_digits  = "0123456789abcdef";
+	static char *function           = "info_handle_output_write_json_string";
+	size_t escaped_character_size   = 0;
+	size_t run_start_index          = 0;
+	size_t sequence_index           = 0;
+	size_t sequence_size            = 0;
+	size_t string_index             = 0;
+	uint8_t character               = 0;
+	uint8_t lower_bound             = 0;
+	uint8_t upper_bound             = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_write(
+	     info_handle,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Runs of characters that do not require escaping are written at once
+	 */
+	while( string_index < utf8_string_size )
+	{
+		character = utf8_string[ string_index ];
+
+		if( character == 0 )
+		{
+			break;
+		}
+		if( ( character >= 0x20 )
+		 && ( character < 0x80 )
+		 && ( character != (uint8_t) '"' )
+		 && ( character != (uint8_t) '\\' ) )
+		{
+			string_index++;
+
+			continue;
+		}
+		if( character >= 0x80 )
+		{
+			/* Determine the size and valid second byte range of the UTF-8 sequence
+			 * overlong forms, surrogates and values beyond U+10FFFF are invalid
+			 */
+			sequence_size = 0;
+			lower_bound   = 0x80;
+			upper_bound   = 0xbf;
+
+			if( ( character >= 0xc2 )
+			 && ( character <= 0xdf ) )
+			{
+				sequence_size = 2;
+			}
+			else if( ( character >= 0xe0 )
+			      && ( character <= 0xef ) )
+			{
+				sequence_size = 3;
+
+				if( character == 0xe0 )
+				{
+					lower_bound = 0xa0;
+				}
+				else if( character == 0xed )
+				{
+					upper_bound = 0x9f;
+				}
+			}
+			else if( ( character >= 0xf0 )
+			      && ( character <= 0xf4 ) )
+			{
+				sequence_size = 4;
+
+				if( character == 0xf0 )
+				{
+					lower_bound = 0x90;
+				}
+				else if( character == 0xf4 )
+				{
+					upper_bound = 0x8f;
+				}
+			}
+			if( ( sequence_size != 0 )
+			 && ( sequence_size <= ( utf8_string_size - string_index ) ) )
+			{
+				for( sequence_index = 1;
+				     sequence_index < sequence_size;
+				     sequence_index++ )
+				{
+					character = utf8_string[ string_index + sequence_index ];
+
+					if( ( character < lower_bound )
+					 || ( character > upper_bound ) )
+					{
+						break;
+					}
+					lower_bound = 0x80;
+					upper_bound = 0xbf;
+				}
+				if( sequence_index == sequence_size )
+				{
+					string_index += sequence_size;
+
+					continue;
+				}
+			}
+			character = utf8_string[ string_index ];
+		}
+		if( string_index > run_start_index )
+		{
+			if( info_handle_output_write(
+			     info_handle,
+			     &( utf8_string[ run_start_index ] ),
+			     string_index - run_start_index,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		escaped_character_size = 2;
+
+		switch( character )
+		{
+			case (uint8_t) '"':
+			case (uint8_t) '\\':
+				escaped_character[ 1 ] = character;
+				break;
+
+			case (uint8_t) '\b':
+				escaped_character[ 1 ] = (uint8_t) 'b';
+				break;
+
+			case (uint8_t) '\f':
+				escaped_character[ 1 ] = (uint8_t) 'f';
+				break;
+
+			case (uint8_t) '\n':
+				escaped_character[ 1 ] = (uint8_t) 'n';
+				break;
+
+			case (uint8_t) '\r':
+				escaped_character[ 1 ] = (uint8_t) 'r';
+				break;
+
+			case (uint8_t) '\t':
+				escaped_character[ 1 ] = (uint8_t) 't';
+				break;
+
+			default:
+				escaped_character[ 1 ] = (uint8_t) 'u';
+
+				if( character >= 0x80 )
+				{
+					escaped_character[ 2 ] = (uint8_t) 'f';
+					escaped_character[ 3 ] = (uint8_t) 'f';
+					escaped_character[ 4 ] = (uint8_t) 'f';
+					escaped_character[ 5 ] = (uint8_t) 'd';
+				}
+				else
+				{
+					escaped_character[ 2 ] = (uint8_t) '0';
+					escaped_character[ 3 ] = (uint8_t) '0';
+					escaped_character[ 4 ] = (uint8_t) hexadecimal_digits[ character >> 4 ];
+					escaped_character[ 5 ] = (uint8_t) hexadecimal_digits[ character & 0x0f ];
+				}
+				escaped_character_size = 6;
+				break;
+		}
+		if( info_handle_output_write(
+		     info_handle,
+		     escaped_character,
+		     escaped_character_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		string_index++;
+
+		run_start_index = string_index;
+	}
+	if( string_index > run_start_index )
+	{
+		if( info_handle_output_write(
+		     info_handle,
+		     &( utf8_string[ run_start_index ] ),
+		     string_index - run_start_index,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( info_handle_output_write(
+	     info_handle,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write JSON string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the start of an output record
+ * Records are separated by a comma in JSON and written one per line in NDJSON
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_begin_record(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_begin_record";
+	const char *separator = "{";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		if( info_handle->number_of_records == 0 )
+		{
+			separator = "\n{";
+		}
+		else
+		{
+			separator = ",\n{";
+		}
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     separator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record start.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the end of an output record
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_end_record(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_end_record";
+	const char *separator = "}";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_NDJSON )
+	{
+		separator = "}\n";
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     separator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record end.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Writes the start of the output document
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_document_begin(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_document_begin";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->number_of_records = 0;
+
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     "[",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write array start.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the end of the output document and flushes the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_document_end(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_document_end";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     "\n]\n",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write array end.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_handle_output_flush(
+	     info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a filename as a quoted and escaped JSON string to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_write_json_filename(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function   = "info_handle_output_write_json_filename";
+	size_t utf8_string_size = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t filename_length  = 0;
+	int result              = 0;
+#endif
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	filename_length = system_string_length(
+	                   filename );
+
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_size_from_utf32(
+	          (libuna_utf32_character_t *) filename,
+	          filename_length + 1,
+	          &utf8_string_size,
+	          error );
+#else
+	result = libuna_utf8_string_size_from_utf16(
+	          (libuna_utf16_character_t *) filename,
+	          filename_length + 1,
+	          &utf8_string_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_resize_value_string(
+	     info_handle,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize value string.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_WCHAR_T == 4
+	result = libuna_utf8_string_copy_from_utf32(
+	          (libuna_utf8_character_t *) info_handle->value_string,
+	          utf8_string_size,
+	          (libuna_utf32_character_t *) filename,
+	          filename_length + 1,
+	          error );
+#else
+	result = libuna_utf8_string_copy_from_utf16(
+	          (libuna_utf8_character_t *) info_handle->value_string,
+	          utf8_string_size,
+	          (libuna_utf16_character_t *) filename,
+	          filename_length + 1,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	utf8_string_size = system_string_length(
+	                    filename ) + 1;
+#endif
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( info_handle_output_write_json_string(
+	     info_handle,
+	     info_handle->value_string,
+	     utf8_string_size,
+	     error ) != 1 )
+#else
+	if( info_handle_output_write_json_string(
+	     info_handle,
+	     (uint8_t *) filename,
+	     utf8_string_size,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write filename.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the input filename
+ * Used to identify the output of an input file when multiple input files are processed
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_input_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_input_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Input file\t\t\t\t: %" PRIs_SYSTEM "\n\n",
+		 filename );
+
+		return( 1 );
+	}
+	if( info_handle_output_begin_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     "\"record_type\":\"input\",\"filename\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_json_filename(
+	     info_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_end_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write input record.",
+	 function );
+
+	return( -1 );
+}
+
+/* Prints the file type determined from the signature of a file
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_signature_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     uint8_t file_type,
+     uint32_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_signature_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "%" PRIs_SYSTEM "\t%s\t%" PRIu32 "\n",
+		 filename,
+		 info_handle_get_file_type_string(
+		  file_type ),
+		 uncompressed_data_size );
+
+		return( 1 );
+	}
+	if( info_handle_output_begin_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     "\"record_type\":\"signature\",\"filename\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_json_filename(
+	     info_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"file_type\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_integer(
+	     info_handle,
+	     (uint64_t) file_type,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"uncompressed_data_size\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_integer(
+	     info_handle,
+	     (uint64_t) uncompressed_data_size,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_end_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write signature record.",
+	 function );
+
+	return( -1 );
+}
+
+/* Prints the file information
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	system_character_t filetime_string[ 48 ];
+
+	libagdb_source_information_t *source_information = NULL;
+	libagdb_file_information_t *file_information     = NULL;
+	libagdb_volume_information_t *volume_information = NULL;
+	system_character_t *value_string                 = NULL;
+	libfdatetime_filetime_t *filetime                = NULL;
+	static char *function                            = "info_handle_file_fprint";
+	size_t value_string_size                         = 0;
+	uint64_t value_64bit                             = 0;
+	uint32_t value_32bit                             = 0;
+	int file_index                                   = 0;
+	int number_of_files                              = 0;
+	int number_of_sources                            = 0;
+	int number_of_volumes                            = 0;
+	int result                                       = 0;
+	int source_index                                 = 0;
+	int volume_index                                 = 0;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	uint8_t *paths_string                            = NULL;
+	size_t *paths_string_offsets                     = NULL;
+	size_t paths_string_size                         = 0;
+#endif
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_initialize(
+	     &filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filetime.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Windows SuperFetch database file information:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Volumes:\n" );
+
+	if( libagdb_file_get_number_of_volumes(
+	     info_handle->input_file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of volumes\t\t: %d\n",
+	 number_of_volumes );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libagdb_file_get_volume_information(
+		     info_handle->input_file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume information.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "Volume: %d information:\n",
+		 volume_index + 1 );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libagdb_volume_information_get_utf16_device_path_size(
+			  volume_information,
+			  &value_string_size,
+			  error );
+#else
+		result = libagdb_volume_information_get_utf8_device_path_size(
+			  volume_information,
+			  &value_string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve device path size.",
+			 function );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			value_string = system_string_allocate(
+					value_string_size );
+
+			if( value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value string.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libagdb_volume_information_get_utf16_device_path(
+				  volume_information,
+				  (uint16_t *) value_string,
+				  value_string_size,
+				  error );
+#else
+			result = libagdb_volume_information_get_utf8_device_path(
+				  volume_information,
+				  (uint8_t *) value_string,
+				  value_string_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve device path.",
+				 function );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tDevice path\t\t\t: %" PRIs_SYSTEM "\n",
+			 value_string );
+
+			memory_free(
+			 value_string );
+
+			value_string = NULL;
+		}
+		if( libagdb_volume_information_get_creation_time(
+		     volume_information,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve creation time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdatetime_filetime_copy_from_64bit(
+		     filetime,
+		     value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy 64-bit value to filetime.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfdatetime_filetime_copy_to_utf16_string(
+			  filetime,
+			  (uint16_t *) filetime_string,
+			  48,
+			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+			  error );
+#else
+		result = libfdatetime_filetime_copy_to_utf8_string(
+			  filetime,
+			  (uint8_t *) filetime_string,
+			  48,
+			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy filetime to string.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tCreation time\t\t\t: %" PRIs_SYSTEM " UTC\n",
+		 filetime_string );
+
+		if( libagdb_volume_information_get_serial_number(
+		     volume_information,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve serial number.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tSerial number\t\t\t: 0x%08" PRIx32 "\n",
+		 value_32bit );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "Files:\n" );
+
+		if( libagdb_volume_information_get_number_of_files(
+		     volume_information,
+		     &number_of_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of files.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNumber of files\t\t\t: %d\n",
+		 number_of_files );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		/* The paths of all the files of the volume are retrieved at once
+		 */
+		if( libagdb_volume_information_get_utf8_paths_size(
+		     volume_information,
+		     &paths_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve paths size.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_files > 0 )
+		{
+			paths_string = (uint8_t *) memory_allocate(
+			                            sizeof( uint8_t ) * paths_string_size );
+
+			if( paths_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create paths string.",
+				 function );
+
+				goto on_error;
+			}
+			paths_string_offsets = (size_t *) memory_allocate(
+			                                   sizeof( size_t ) * number_of_files );
+
+			if( paths_string_offsets == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create paths string offsets.",
+				 function );
+
+				goto on_error;
+			}
+			if( libagdb_volume_information_get_utf8_paths(
+			     volume_information,
+			     paths_string,
+			     paths_string_size,
+			     paths_string_offsets,
+			     number_of_files,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve paths.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		for( file_index = 0;
+		     file_index < number_of_files;
+		     file_index++ )
+		{
+			if( libagdb_volume_information_get_file_information(
+			     volume_information,
+			     file_index,
+			     &file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file information.",
+				 function );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "File: %d information:\n",
+			 file_index + 1 );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libagdb_file_information_get_utf16_path_size(
+				  file_information,
+				  &value_string_size,
+				  error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve path size.",
+				 function );
+
+				goto on_error;
+			}
+			if( value_string_size > 0 )
+			{
+				value_string = system_string_allocate(
+						value_string_size );
+
+				if( value_string == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create value string.",
+					 function );
+
+					goto on_error;
+				}
+				result = libagdb_file_information_get_utf16_path(
+					  file_information,
+					  (uint16_t *) value_string,
+					  value_string_size,
+					  error );
+
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve path.",
+					 function );
+
+					goto on_error;
+				}
+				fprintf(
+				 info_handle->notify_stream,
+				 "\tPath\t\t\t\t: %" PRIs_SYSTEM "\n",
+				 value_string );
+
+				memory_free(
+				 value_string );
+
+				value_string = NULL;
+			}
+#else
+			if( paths_string[ paths_string_offsets[ file_index ] ] != 0 )
+			{
+				fprintf(
+				 info_handle->notify_stream,
+				 "\tPath\t\t\t\t: %s\n",
+				 (char *) &( paths_string[ paths_string_offsets[ file_index ] ] ) );
+			}
+#endif
+			if( libagdb_file_information_free(
+			     &file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file information.",
+				 function );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\n" );
+		}
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( paths_string_offsets != NULL )
+		{
+			memory_free(
+			 paths_string_offsets );
+
+			paths_string_offsets = NULL;
+		}
+		if( paths_string != NULL )
+		{
+			memory_free(
+			 paths_string );
+
+			paths_string = NULL;
+		}
+#endif
+		if( libagdb_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume information.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
+	if( libfdatetime_filetime_free(
+	     &filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free filetime.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Sources:\n" );
+
+	if( libagdb_file_get_number_of_sources(
+	     info_handle->input_file,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of sources\t\t: %d\n",
+	 number_of_sources );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( libagdb_file_get_source_information(
+		     info_handle->input_file,
+		     source_index,
+		     &source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source information.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "Source: %d information:\n",
+		 source_index + 1 );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libagdb_source_information_get_utf16_executable_filename_size(
+			  source_information,
+			  &value_string_size,
+			  error );
+#else
+		result = libagdb_source_information_get_utf8_executable_filename_size(
+			  source_information,
+			  &value_string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve executable filename size.",
+			 function );
+
+			goto on_error;
 		}
 		if( value_string_size > 0 )
 		{
-			value_string = system_string_allocate(
-					value_string_size );
+			value_string = system_string_allocate(
+					value_string_size );
+
+			if( value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value string.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libagdb_source_information_get_utf16_executable_filename(
+				  source_information,
+				  (uint16_t *) value_string,
+				  value_string_size,
+				  error );
+#else
+			result = libagdb_source_information_get_utf8_executable_filename(
+				  source_information,
+				  (uint8_t *) value_string,
+				  value_string_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve executable filename.",
+				 function );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tExecutable filename\t\t: %" PRIs_SYSTEM "\n",
+			 value_string );
+
+			memory_free(
+			 value_string );
+
+			value_string = NULL;
+		}
+		if( libagdb_source_information_free(
+		     &source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free source information.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+
+on_error:
+	if( source_information != NULL )
+	{
+		libagdb_source_information_free(
+		 &source_information,
+		 NULL );
+	}
+	if( volume_information != NULL )
+	{
+		libagdb_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( paths_string_offsets != NULL )
+	{
+		memory_free(
+		 paths_string_offsets );
+	}
+	if( paths_string != NULL )
+	{
+		memory_free(
+		 paths_string );
+	}
+#endif
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( -1 );
+}
+
+
+/* Prints the volume information as a JSON record
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_information_json_fprint(
+     info_handle_t *info_handle,
+     int volume_index,
+     libagdb_volume_information_t *volume_information,
+     libfdatetime_filetime_t *filetime,
+     libcerror_error_t **error )
+{
+	uint8_t filetime_string[ 48 ];
+
+	static char *function   = "info_handle_volume_information_json_fprint";
+	size_t value_string_size = 0;
+	uint64_t value_64bit     = 0;
+	uint32_t value_32bit     = 0;
+	int number_of_files      = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_begin_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     "\"record_type\":\"volume\",\"volume_index\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_integer(
+	     info_handle,
+	     (uint64_t) volume_index,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libagdb_volume_information_get_utf8_device_path_size(
+	     volume_information,
+	     &value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"device_path\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( value_string_size > 0 )
+	{
+		if( info_handle_resize_value_string(
+		     info_handle,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value string.",
+			 function );
+
+			return( -1 );
+		}
+		if( libagdb_volume_information_get_utf8_device_path(
+		     volume_information,
+		     info_handle->value_string,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve device path.",
+			 function );
+
+			return( -1 );
+		}
+		if( info_handle_output_write_json_string(
+		     info_handle,
+		     info_handle->value_string,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	else
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     "null",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( libagdb_volume_information_get_creation_time(
+	     volume_information,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_copy_from_64bit(
+	     filetime,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy 64-bit value to filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_copy_to_utf8_string(
+	     filetime,
+	     filetime_string,
+	     48,
+	     LIBFDATETIME_STRING_FORMAT_TYPE_ISO8601 | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filetime to string.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"creation_time\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_json_string(
+	     info_handle,
+	     filetime_string,
+	     48,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"creation_filetime\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_integer(
+	     info_handle,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libagdb_volume_information_get_serial_number(
+	     volume_information,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve serial number.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"serial_number\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_integer(
+	     info_handle,
+	     (uint64_t) value_32bit,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libagdb_volume_information_get_number_of_files(
+	     volume_information,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"number_of_files\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_integer(
+	     info_handle,
+	     (uint64_t) number_of_files,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_end_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write volume: %d record.",
+	 function,
+	 volume_index );
+
+	return( -1 );
+}
+
+/* Prints the file information as a JSON record
+ * The path is retrieved for all the files of a volume at once by the caller
+ * using libagdb_volume_information_get_utf8_paths, where an empty path is printed as null
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_information_json_fprint(
+     info_handle_t *info_handle,
+     int volume_index,
+     int file_index,
+     const uint8_t *utf8_path,
+     size_t utf8_path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_file_information_json_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_begin_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     "\"record_type\":\"file\",\"volume_index\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_integer(
+	     info_handle,
+	     (uint64_t) volume_index,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"file_index\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_integer(
+	     info_handle,
+	     (uint64_t) file_index,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"path\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( ( utf8_path != NULL )
+	 && ( utf8_path_size > 0 )
+	 && ( utf8_path[ 0 ] != 0 ) )
+	{
+		if( info_handle_output_write_json_string(
+		     info_handle,
+		     utf8_path,
+		     utf8_path_size,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	else
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     "null",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( info_handle_output_end_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
 
-			if( value_string == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
-				 function );
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write volume: %d file: %d record.",
+	 function,
+	 volume_index,
+	 file_index );
 
-				goto on_error;
-			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libagdb_volume_information_get_utf16_device_path(
-				  volume_information,
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  error );
-#else
-			result = libagdb_volume_information_get_utf8_device_path(
-				  volume_information,
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve device path.",
-				 function );
+	return( -1 );
+}
 
-				goto on_error;
-			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tDevice path\t\t\t: %" PRIs_SYSTEM "\n",
-			 value_string );
+/* Prints the source information as a JSON record
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_source_information_json_fprint(
+     info_handle_t *info_handle,
+     int source_index,
+     libagdb_source_information_t *source_information,
+     libcerror_error_t **error )
+{
+	static char *function    = "info_handle_source_information_json_fprint";
+	size_t value_string_size = 0;
 
-			memory_free(
-			 value_string );
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
 
-			value_string = NULL;
-		}
-		if( libagdb_volume_information_get_creation_time(
-		     volume_information,
-		     &value_64bit,
+		return( -1 );
+	}
+	if( info_handle_output_begin_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     "\"record_type\":\"source\",\"source_index\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_output_write_integer(
+	     info_handle,
+	     (uint64_t) source_index,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( libagdb_source_information_get_utf8_executable_filename_size(
+	     source_information,
+	     &value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_write_string(
+	     info_handle,
+	     ",\"executable_filename\":",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( value_string_size > 0 )
+	{
+		if( info_handle_resize_value_string(
+		     info_handle,
+		     value_string_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve creation time.",
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize value string.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfdatetime_filetime_copy_from_64bit(
-		     filetime,
-		     value_64bit,
+		if( libagdb_source_information_get_utf8_executable_filename(
+		     source_information,
+		     info_handle->value_string,
+		     value_string_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy 64-bit value to filetime.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve executable filename.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfdatetime_filetime_copy_to_utf16_string(
-			  filetime,
-			  (uint16_t *) filetime_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#else
-		result = libfdatetime_filetime_copy_to_utf8_string(
-			  filetime,
-			  (uint8_t *) filetime_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#endif
-		if( result != 1 )
+		if( info_handle_output_write_json_string(
+		     info_handle,
+		     info_handle->value_string,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	else
+	{
+		if( info_handle_output_write_string(
+		     info_handle,
+		     "null",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( info_handle_output_end_record(
+	     info_handle,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to write source: %d record.",
+	 function,
+	 source_index );
+
+	return( -1 );
+}
+
+/* Prints the file information as JSON or NDJSON records
+ * Every volume, file and source is written as a separate record through the output buffer
+ * The records are written between info_handle_output_document_begin and info_handle_output_document_end
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_json_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libagdb_source_information_t *source_information = NULL;
+	libagdb_volume_information_t *volume_information = NULL;
+	libfdatetime_filetime_t *filetime                = NULL;
+	uint8_t *paths_string                            = NULL;
+	size_t *paths_string_offsets                     = NULL;
+	static char *function                            = "info_handle_file_json_fprint";
+	size_t paths_string_size                         = 0;
+	int file_index                                   = 0;
+	int number_of_files                              = 0;
+	int number_of_sources                            = 0;
+	int number_of_volumes                            = 0;
+	int source_index                                 = 0;
+	int volume_index                                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_handle->output_format != INFO_HANDLE_OUTPUT_FORMAT_JSON )
+	 && ( info_handle->output_format != INFO_HANDLE_OUTPUT_FORMAT_NDJSON ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid info handle - unsupported output format.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdatetime_filetime_initialize(
+	     &filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filetime.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_get_number_of_volumes(
+	     info_handle->input_file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libagdb_file_get_volume_information(
+		     info_handle->input_file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy filetime to string.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tCreation time\t\t\t: %" PRIs_SYSTEM " UTC\n",
-		 filetime_string );
-
-		if( libagdb_volume_information_get_serial_number(
+		if( info_handle_volume_information_json_fprint(
+		     info_handle,
+		     volume_index,
 		     volume_information,
-		     &value_32bit,
+		     filetime,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve serial number.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print volume: %d information.",
+			 function,
+			 volume_index );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tSerial number\t\t\t: 0x%08" PRIx32 "\n",
-		 value_32bit );
-
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
-
-		fprintf(
-		 info_handle->notify_stream,
-		 "Files:\n" );
-
 		if( libagdb_volume_information_get_number_of_files(
 		     volume_information,
 		     &number_of_files,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of files.",
-			 function );
-
-			goto on_error;
-		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tNumber of files\t\t\t: %d\n",
-		 number_of_files );
-
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of files.",
+			 function );
 
-		for( file_index = 0;
-		     file_index < number_of_files;
-		     file_index++ )
+			goto on_error;
+		}
+		if( number_of_files > 0 )
 		{
-			if( libagdb_volume_information_get_file_information(
+			/* The paths of all the files of the volume are retrieved at once
+			 */
+			if( libagdb_volume_information_get_utf8_paths_size(
 			     volume_information,
-			     file_index,
-			     &file_information,
+			     &paths_string_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve file information.",
+				 "%s: unable to retrieve paths size.",
 				 function );
 
 				goto on_error;
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "File: %d information:\n",
-			 file_index + 1 );
+			paths_string = (uint8_t *) memory_allocate(
+			                            sizeof( uint8_t ) * paths_string_size );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libagdb_file_information_get_utf16_path_size(
-				  file_information,
-				  &value_string_size,
-				  error );
-#else
-			result = libagdb_file_information_get_utf8_path_size(
-				  file_information,
-				  &value_string_size,
-				  error );
-#endif
-			if( result != 1 )
+			if( paths_string == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve path size.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create paths string.",
 				 function );
 
 				goto on_error;
 			}
-			if( value_string_size > 0 )
-			{
-				value_string = system_string_allocate(
-						value_string_size );
-
-				if( value_string == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create value string.",
-					 function );
-
-					goto on_error;
-				}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libagdb_file_information_get_utf16_path(
-					  file_information,
-					  (uint16_t *) value_string,
-					  value_string_size,
-					  error );
-#else
-				result = libagdb_file_information_get_utf8_path(
-					  file_information,
-					  (uint8_t *) value_string,
-					  value_string_size,
-					  error );
-#endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve path.",
-					 function );
-
-					goto on_error;
-				}
-				fprintf(
-				 info_handle->notify_stream,
-				 "\tPath\t\t\t\t: %" PRIs_SYSTEM "\n",
-				 value_string );
+			paths_string_offsets = (size_t *) memory_allocate(
+			                                   sizeof( size_t ) * number_of_files );
 
-				memory_free(
-				 value_string );
+			if( paths_string_offsets == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create paths string offsets.",
+				 function );
 
-				value_string = NULL;
+				goto on_error;
 			}
-			if( libagdb_file_information_free(
-			     &file_information,
+			if( libagdb_volume_information_get_utf8_paths(
+			     volume_information,
+			     paths_string,
+			     paths_string_size,
+			     paths_string_offsets,
+			     number_of_files,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free file information.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve paths.",
 				 function );
 
 				goto on_error;
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\n" );
+		}
+		for( file_index = 0;
+		     file_index < number_of_files;
+		     file_index++ )
+		{
+			if( info_handle_file_information_json_fprint(
+			     info_handle,
+			     volume_index,
+			     file_index,
+			     &( paths_string[ paths_string_offsets[ file_index ] ] ),
+			     paths_string_size - paths_string_offsets[ file_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print file: %d information.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		if( paths_string_offsets != NULL )
+		{
+			memory_free(
+			 paths_string_offsets );
+
+			paths_string_offsets = NULL;
+		}
+		if( paths_string != NULL )
+		{
+			memory_free(
+			 paths_string );
+
+			paths_string = NULL;
 		}
 		if( libagdb_volume_information_free(
 		     &volume_information,
@@ -751,27 +3001,7 @@ int info_handle_file_fprint(
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
-	}
-	if( libfdatetime_filetime_free(
-	     &filetime,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free filetime.",
-		 function );
-
-		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "Sources:\n" );
-
 	if( libagdb_file_get_number_of_sources(
 	     info_handle->input_file,
 	     &number_of_sources,
@@ -786,15 +3016,6 @@ int info_handle_file_fprint(
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of sources\t\t: %d\n",
-	 number_of_sources );
-
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
 	for( source_index = 0;
 	     source_index < number_of_sources;
 	     source_index++ )
@@ -809,88 +3030,28 @@ int info_handle_file_fprint(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve source information.",
-			 function );
+			 "%s: unable to retrieve source: %d information.",
+			 function,
+			 source_index );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "Source: %d information:\n",
-		 source_index + 1 );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libagdb_source_information_get_utf16_executable_filename_size(
-			  source_information,
-			  &value_string_size,
-			  error );
-#else
-		result = libagdb_source_information_get_utf8_executable_filename_size(
-			  source_information,
-			  &value_string_size,
-			  error );
-#endif
-		if( result != 1 )
+		if( info_handle_source_information_json_fprint(
+		     info_handle,
+		     source_index,
+		     source_information,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve executable filename size.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print source: %d information.",
+			 function,
+			 source_index );
 
 			goto on_error;
 		}
-		if( value_string_size > 0 )
-		{
-			value_string = system_string_allocate(
-					value_string_size );
-
-			if( value_string == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libagdb_source_information_get_utf16_executable_filename(
-				  source_information,
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  error );
-#else
-			result = libagdb_source_information_get_utf8_executable_filename(
-				  source_information,
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve executable filename.",
-				 function );
-
-				goto on_error;
-			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tExecutable filename\t\t: %" PRIs_SYSTEM "\n",
-			 value_string );
-
-			memory_free(
-			 value_string );
-
-			value_string = NULL;
-		}
 		if( libagdb_source_information_free(
 		     &source_information,
 		     error ) != 1 )
@@ -904,9 +3065,32 @@ int info_handle_file_fprint(
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+	}
+	if( info_handle_output_flush(
+	     info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdatetime_filetime_free(
+	     &filetime,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free filetime.",
+		 function );
+
+		goto on_error;
 	}
 	return( 1 );
 
@@ -917,17 +3101,22 @@ on_error:
 		 &source_information,
 		 NULL );
 	}
+	if( paths_string_offsets != NULL )
+	{
+		memory_free(
+		 paths_string_offsets );
+	}
+	if( paths_string != NULL )
+	{
+		memory_free(
+		 paths_string );
+	}
 	if( volume_information != NULL )
 	{
 		libagdb_volume_information_free(
 		 &volume_information,
 		 NULL );
 	}
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
 	if( filetime != NULL )
 	{
 		libfdatetime_filetime_free(
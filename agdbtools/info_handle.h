@@ -28,11 +28,23 @@
 
 #include "agdbtools_libagdb.h"
 #include "agdbtools_libcerror.h"
+#include "agdbtools_libfdatetime.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+#define INFO_HANDLE_OUTPUT_BUFFER_SIZE		65536
+
+/* The output formats
+ */
+enum INFO_HANDLE_OUTPUT_FORMATS
+{
+	INFO_HANDLE_OUTPUT_FORMAT_TEXT			= 0,
+	INFO_HANDLE_OUTPUT_FORMAT_JSON			= 1,
+	INFO_HANDLE_OUTPUT_FORMAT_NDJSON		= 2
+};
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -45,6 +57,30 @@ struct info_handle
 	 */
 	int ascii_codepage;
 
+	/* The output format
+	 */
+	int output_format;
+
+	/* The output buffer
+	 */
+	uint8_t *output_buffer;
+
+	/* The output buffer offset
+	 */
+	size_t output_buffer_offset;
+
+	/* The number of output records
+	 */
+	int number_of_records;
+
+	/* The UTF-8 value string
+	 */
+	uint8_t *value_string;
+
+	/* The UTF-8 value string size
+	 */
+	size_t value_string_size;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -57,6 +93,9 @@ struct info_handle
 const char *info_handle_get_stream_type(
              uint32_t stream_type );
 
+const char *info_handle_get_file_type_string(
+             uint8_t file_type );
+
 int info_handle_initialize(
      info_handle_t **info_handle,
      libcerror_error_t **error );
@@ -74,6 +113,16 @@ int info_handle_set_ascii_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int info_handle_determine_output_format(
+     const system_character_t *string,
+     int *output_format,
+     libcerror_error_t **error );
+
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -83,10 +132,99 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_resize_value_string(
+     info_handle_t *info_handle,
+     size_t value_string_size,
+     libcerror_error_t **error );
+
+int info_handle_output_flush(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_output_write(
+     info_handle_t *info_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int info_handle_output_write_string(
+     info_handle_t *info_handle,
+     const char *string,
+     libcerror_error_t **error );
+
+int info_handle_output_write_integer(
+     info_handle_t *info_handle,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int info_handle_output_write_json_string(
+     info_handle_t *info_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int info_handle_output_begin_record(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_output_end_record(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_output_document_begin(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_output_document_end(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_output_write_json_filename(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int info_handle_input_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int info_handle_signature_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     uint8_t file_type,
+     uint32_t uncompressed_data_size,
+     libcerror_error_t **error );
+
 int info_handle_file_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_volume_information_json_fprint(
+     info_handle_t *info_handle,
+     int volume_index,
+     libagdb_volume_information_t *volume_information,
+     libfdatetime_filetime_t *filetime,
+     libcerror_error_t **error );
+
+int info_handle_file_information_json_fprint(
+     info_handle_t *info_handle,
+     int volume_index,
+     int file_index,
+     const uint8_t *utf8_path,
+     size_t utf8_path_size,
+     libcerror_error_t **error );
+
+int info_handle_source_information_json_fprint(
+     info_handle_t *info_handle,
+     int source_index,
+     libagdb_source_information_t *source_information,
+     libcerror_error_t **error );
+
+int info_handle_file_json_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
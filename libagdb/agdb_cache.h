@@ -0,0 +1,179 @@
+/*
+ * The parsed database cache definition of a Windows SuperFetch database file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _AGDB_CACHE_H )
+#define _AGDB_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The cache consists of the cache header, followed by the volume records,
+ * the file records, the source records and the string data
+ * All values are stored in little-endian
+ */
+typedef struct agdb_cache_header agdb_cache_header_t;
+
+struct agdb_cache_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * "AGDBcach"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_size[ 4 ];
+
+	/* The cache size
+	 * Consists of 8 bytes
+	 */
+	uint8_t cache_size[ 8 ];
+
+	/* The (original) file size
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The (original) file type
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_type[ 4 ];
+
+	/* The (original) uncompressed data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t uncompressed_data_size[ 4 ];
+
+	/* The number of volumes
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_volumes[ 4 ];
+
+	/* The number of files of all volumes
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_files[ 4 ];
+
+	/* The number of sources
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_sources[ 4 ];
+
+	/* The string data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t string_data_size[ 4 ];
+};
+
+typedef struct agdb_cache_volume_record agdb_cache_volume_record_t;
+
+struct agdb_cache_volume_record
+{
+	/* The (volume) creation time
+	 * Consists of 8 bytes
+	 */
+	uint8_t creation_time[ 8 ];
+
+	/* The (volume) serial number
+	 * Consists of 4 bytes
+	 */
+	uint8_t serial_number[ 4 ];
+
+	/* The index of the first file record of the volume
+	 * Consists of 4 bytes
+	 */
+	uint8_t first_file_index[ 4 ];
+
+	/* The number of files
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_files[ 4 ];
+
+	/* The device path offset
+	 * Consists of 4 bytes
+	 * The offset is relative to the start of the string data
+	 */
+	uint8_t device_path_offset[ 4 ];
+
+	/* The device path size
+	 * Consists of 4 bytes
+	 */
+	uint8_t device_path_size[ 4 ];
+};
+
+typedef struct agdb_cache_file_record agdb_cache_file_record_t;
+
+struct agdb_cache_file_record
+{
+	/* The path offset
+	 * Consists of 4 bytes
+	 * The offset is relative to the start of the string data
+	 */
+	uint8_t path_offset[ 4 ];
+
+	/* The path size
+	 * Consists of 4 bytes
+	 */
+	uint8_t path_size[ 4 ];
+
+	/* The number of (sub) entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+};
+
+typedef struct agdb_cache_source_record agdb_cache_source_record_t;
+
+struct agdb_cache_source_record
+{
+	/* The prefetch hash
+	 * Consists of 4 bytes
+	 */
+	uint8_t prefetch_hash[ 4 ];
+
+	/* The executable filename size
+	 * Consists of 4 bytes
+	 */
+	uint8_t executable_filename_size[ 4 ];
+
+	/* The executable filename
+	 * Consists of 16 bytes
+	 */
+	uint8_t executable_filename[ 16 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _AGDB_CACHE_H ) */
+
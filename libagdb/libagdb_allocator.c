@@ -0,0 +1,185 @@
+/*
+ * Memory allocator functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_allocator.h"
+#include "libagdb_libcerror.h"
+
+/* The allocate function
+ */
+static void *(*libagdb_allocator_allocate_function)(
+                 intptr_t *allocator_data,
+                 size_t size ) = NULL;
+
+/* The reallocate function
+ */
+static void *(*libagdb_allocator_reallocate_function)(
+                 intptr_t *allocator_data,
+                 void *buffer,
+                 size_t size ) = NULL;
+
+/* The free function
+ */
+static void (*libagdb_allocator_free_function)(
+               intptr_t *allocator_data,
+               void *buffer ) = NULL;
+
+/* The allocator data
+ */
+static intptr_t *libagdb_allocator_data = NULL;
+
+/* Value to indicate the library has allocated memory
+ */
+static int libagdb_allocator_is_used = 0;
+
+/* Sets the memory allocator
+ * The allocate, reallocate and free functions are used for all memory allocated by the library itself,
+ * memory allocated by the dependent libraries is not affected. Use NULL for all functions
+ * to restore the default allocator. The allocator is process wide and can only be set before
+ * the library has allocated any memory, hence before any object is created. This function
+ * is not thread-safe and must be called before the library is used by multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_set_allocator(
+     void *(*allocate_function)(
+              intptr_t *allocator_data,
+              size_t size ),
+     void *(*reallocate_function)(
+              intptr_t *allocator_data,
+              void *buffer,
+              size_t size ),
+     void (*free_function)(
+            intptr_t *allocator_data,
+            void *buffer ),
+     intptr_t *allocator_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_set_allocator";
+
+	if( libagdb_allocator_is_used != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid allocator - memory already allocated by library.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( allocate_function == NULL )
+	  != ( reallocate_function == NULL ) )
+	 || ( ( allocate_function == NULL )
+	  != ( free_function == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocate, reallocate and free function all need to be set or all need to be NULL.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocate_function == NULL )
+	 && ( allocator_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator data value set without functions.",
+		 function );
+
+		return( -1 );
+	}
+	libagdb_allocator_allocate_function   = allocate_function;
+	libagdb_allocator_reallocate_function = reallocate_function;
+	libagdb_allocator_free_function       = free_function;
+	libagdb_allocator_data                = allocator_data;
+
+	return( 1 );
+}
+
+/* Allocates memory
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libagdb_allocator_allocate(
+       size_t size )
+{
+	libagdb_allocator_is_used = 1;
+
+	if( libagdb_allocator_allocate_function != NULL )
+	{
+		return( libagdb_allocator_allocate_function(
+		         libagdb_allocator_data,
+		         size ) );
+	}
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocates memory
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *libagdb_allocator_reallocate(
+       void *buffer,
+       size_t size )
+{
+	libagdb_allocator_is_used = 1;
+
+	if( libagdb_allocator_reallocate_function != NULL )
+	{
+		return( libagdb_allocator_reallocate_function(
+		         libagdb_allocator_data,
+		         buffer,
+		         size ) );
+	}
+	return( memory_reallocate(
+	         buffer,
+	         size ) );
+}
+
+/* Frees memory
+ */
+void libagdb_allocator_free(
+      void *buffer )
+{
+	if( buffer == NULL )
+	{
+		return;
+	}
+	if( libagdb_allocator_free_function != NULL )
+	{
+		libagdb_allocator_free_function(
+		 libagdb_allocator_data,
+		 buffer );
+	}
+	else
+	{
+		memory_free(
+		 buffer );
+	}
+}
+
@@ -0,0 +1,68 @@
+/*
+ * Memory allocator functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_ALLOCATOR_H )
+#define _LIBAGDB_ALLOCATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_extern.h"
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define libagdb_allocator_allocate_structure( type ) \
+	(type *) libagdb_allocator_allocate( sizeof( type ) )
+
+LIBAGDB_EXTERN \
+int libagdb_set_allocator(
+     void *(*allocate_function)(
+              intptr_t *allocator_data,
+              size_t size ),
+     void *(*reallocate_function)(
+              intptr_t *allocator_data,
+              void *buffer,
+              size_t size ),
+     void (*free_function)(
+            intptr_t *allocator_data,
+            void *buffer ),
+     intptr_t *allocator_data,
+     libcerror_error_t **error );
+
+void *libagdb_allocator_allocate(
+       size_t size );
+
+void *libagdb_allocator_reallocate(
+       void *buffer,
+       size_t size );
+
+void libagdb_allocator_free(
+      void *buffer );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_ALLOCATOR_H ) */
+
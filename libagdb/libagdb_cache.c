@@ -0,0 +1,1156 @@
+/*
+ * Parsed database cache functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_cache.h"
+#include "libagdb_definitions.h"
+#include "libagdb_file_information.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libcdata.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_source_information.h"
+#include "libagdb_volume_information.h"
+
+#include "agdb_cache.h"
+
+const char *agdb_cache_signature = "AGDBcach";
+
+/* Retrieves the size of the cache data of the volumes and sources
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_cache_get_data_size(
+     libcdata_array_t *volumes_array,
+     libcdata_array_t *sources_array,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_information_t *internal_file_information     = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_cache_get_data_size";
+	size64_t safe_data_size                                            = 0;
+	size64_t string_data_size                                          = 0;
+	int file_index                                                     = 0;
+	int number_of_files                                                = 0;
+	int number_of_sources                                              = 0;
+	int number_of_volumes                                              = 0;
+	int volume_index                                                   = 0;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     volumes_array,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_size = sizeof( agdb_cache_header_t )
+	               + ( (size64_t) number_of_volumes * sizeof( agdb_cache_volume_record_t ) )
+	               + ( (size64_t) number_of_sources * sizeof( agdb_cache_source_record_t ) );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     volumes_array,
+		     volume_index,
+		     (intptr_t **) &internal_volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		if( internal_volume_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing volume: %d information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_get_number_of_entries(
+		     internal_volume_information->files_array,
+		     &number_of_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of files of volume: %d.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		safe_data_size   += (size64_t) number_of_files * sizeof( agdb_cache_file_record_t );
+		string_data_size += internal_volume_information->device_path_size;
+
+		for( file_index = 0;
+		     file_index < number_of_files;
+		     file_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_volume_information->files_array,
+			     file_index,
+			     (intptr_t **) &internal_file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d file: %d information.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				return( -1 );
+			}
+			if( internal_file_information == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing volume: %d file: %d information.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				return( -1 );
+			}
+			string_data_size += internal_file_information->path_size;
+		}
+	}
+	/* The string data offsets are stored as 32-bit values
+	 */
+	if( string_data_size > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_size += string_data_size;
+
+	if( safe_data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = (size_t) safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes the cache data of the volumes and sources
+ * The data size must be the size returned by libagdb_cache_get_data_size
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_cache_write_data(
+     libagdb_io_handle_t *io_handle,
+     libcdata_array_t *volumes_array,
+     libcdata_array_t *sources_array,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	agdb_cache_file_record_t *file_record                              = NULL;
+	agdb_cache_header_t *cache_header                                  = NULL;
+	agdb_cache_source_record_t *source_record                          = NULL;
+	agdb_cache_volume_record_t *volume_record                          = NULL;
+	libagdb_internal_file_information_t *internal_file_information     = NULL;
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_cache_write_data";
+	size_t file_records_offset                                         = 0;
+	size_t required_data_size                                          = 0;
+	size_t source_records_offset                                       = 0;
+	size_t string_data_offset                                          = 0;
+	uint32_t file_record_index                                         = 0;
+	uint32_t string_offset                                             = 0;
+	int file_index                                                     = 0;
+	int number_of_files                                                = 0;
+	int number_of_sources                                              = 0;
+	int number_of_volumes                                              = 0;
+	int source_index                                                   = 0;
+	int volume_index                                                   = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_cache_get_data_size(
+	     volumes_array,
+	     sources_array,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     volumes_array,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of file records is determined by the volume records
+	 * hence the file records offset is determined first
+	 */
+	file_records_offset = sizeof( agdb_cache_header_t )
+	                    + ( (size_t) number_of_volumes * sizeof( agdb_cache_volume_record_t ) );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     volumes_array,
+		     volume_index,
+		     (intptr_t **) &internal_volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_get_number_of_entries(
+		     internal_volume_information->files_array,
+		     &number_of_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of files of volume: %d.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		file_record_index += (uint32_t) number_of_files;
+	}
+	source_records_offset = file_records_offset
+	                      + ( (size_t) file_record_index * sizeof( agdb_cache_file_record_t ) );
+
+	string_data_offset = source_records_offset
+	                   + ( (size_t) number_of_sources * sizeof( agdb_cache_source_record_t ) );
+
+	cache_header = (agdb_cache_header_t *) data;
+
+	if( memory_copy(
+	     cache_header->signature,
+	     agdb_cache_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 cache_header->format_version,
+	 LIBAGDB_CACHE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 cache_header->header_size,
+	 (uint32_t) sizeof( agdb_cache_header_t ) );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 cache_header->cache_size,
+	 (uint64_t) data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 cache_header->file_size,
+	 (uint64_t) io_handle->file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 cache_header->file_type,
+	 (uint32_t) io_handle->file_type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 cache_header->uncompressed_data_size,
+	 io_handle->uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 cache_header->number_of_volumes,
+	 (uint32_t) number_of_volumes );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 cache_header->number_of_files,
+	 file_record_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 cache_header->number_of_sources,
+	 (uint32_t) number_of_sources );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 cache_header->string_data_size,
+	 (uint32_t) ( data_size - string_data_offset ) );
+
+	volume_record     = (agdb_cache_volume_record_t *) &( data[ sizeof( agdb_cache_header_t ) ] );
+	file_record       = (agdb_cache_file_record_t *) &( data[ file_records_offset ] );
+	file_record_index = 0;
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     volumes_array,
+		     volume_index,
+		     (intptr_t **) &internal_volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_get_number_of_entries(
+		     internal_volume_information->files_array,
+		     &number_of_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of files of volume: %d.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 volume_record->creation_time,
+		 internal_volume_information->creation_time );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 volume_record->serial_number,
+		 internal_volume_information->serial_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 volume_record->first_file_index,
+		 file_record_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 volume_record->number_of_files,
+		 (uint32_t) number_of_files );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 volume_record->device_path_offset,
+		 string_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 volume_record->device_path_size,
+		 internal_volume_information->device_path_size );
+
+		if( internal_volume_information->device_path_size > 0 )
+		{
+			if( memory_copy(
+			     &( data[ string_data_offset + string_offset ] ),
+			     internal_volume_information->device_path,
+			     (size_t) internal_volume_information->device_path_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy volume: %d device path.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			string_offset += internal_volume_information->device_path_size;
+		}
+		for( file_index = 0;
+		     file_index < number_of_files;
+		     file_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_volume_information->files_array,
+			     file_index,
+			     (intptr_t **) &internal_file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d file: %d information.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 file_record->path_offset,
+			 string_offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 file_record->path_size,
+			 internal_file_information->path_size );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 file_record->number_of_entries,
+			 internal_file_information->number_of_entries );
+
+			if( internal_file_information->path_size > 0 )
+			{
+				if( memory_copy(
+				     &( data[ string_data_offset + string_offset ] ),
+				     internal_file_information->path,
+				     (size_t) internal_file_information->path_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy volume: %d file: %d path.",
+					 function,
+					 volume_index,
+					 file_index );
+
+					return( -1 );
+				}
+				string_offset += internal_file_information->path_size;
+			}
+			file_record++;
+		}
+		file_record_index += (uint32_t) number_of_files;
+
+		volume_record++;
+	}
+	source_record = (agdb_cache_source_record_t *) &( data[ source_records_offset ] );
+
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     sources_array,
+		     source_index,
+		     (intptr_t **) &internal_source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d information.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		if( internal_source_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing source: %d information.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		if( internal_source_information->executable_filename_size > 16 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid source: %d information - executable filename size value out of bounds.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 source_record->prefetch_hash,
+		 internal_source_information->prefetch_hash );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 source_record->executable_filename_size,
+		 internal_source_information->executable_filename_size );
+
+		if( memory_copy(
+		     source_record->executable_filename,
+		     internal_source_information->executable_filename,
+		     (size_t) internal_source_information->executable_filename_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source: %d executable filename.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+		source_record++;
+	}
+	return( 1 );
+}
+
+/* Reads the volumes and sources from cache data
+ * The volume device paths and file paths reference the cache data
+ * hence the data must remain available until the volumes and sources are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_cache_read_data(
+     libagdb_io_handle_t *io_handle,
+     libcdata_array_t *volumes_array,
+     libcdata_array_t *sources_array,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const agdb_cache_file_record_t *file_record                        = NULL;
+	const agdb_cache_header_t *cache_header                            = NULL;
+	const agdb_cache_source_record_t *source_record                    = NULL;
+	const agdb_cache_volume_record_t *volume_record                    = NULL;
+	libagdb_file_information_t *file_information                       = NULL;
+	libagdb_internal_file_information_t *internal_file_information     = NULL;
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	libagdb_source_information_t *source_information                   = NULL;
+	libagdb_volume_information_t *volume_information                   = NULL;
+	const uint8_t *string_data                                         = NULL;
+	static char *function                                              = "libagdb_cache_read_data";
+	size64_t cache_size                                                = 0;
+	size64_t required_data_size                                        = 0;
+	uint32_t device_path_offset                                        = 0;
+	uint32_t file_index                                                = 0;
+	uint32_t file_record_index                                         = 0;
+	uint32_t file_type                                                 = 0;
+	uint32_t first_file_index                                          = 0;
+	uint32_t format_version                                            = 0;
+	uint32_t header_size                                               = 0;
+	uint32_t number_of_files                                           = 0;
+	uint32_t number_of_sources                                         = 0;
+	uint32_t number_of_volume_files                                    = 0;
+	uint32_t number_of_volumes                                         = 0;
+	uint32_t path_offset                                               = 0;
+	uint32_t source_index                                              = 0;
+	uint32_t string_data_size                                          = 0;
+	uint32_t volume_index                                              = 0;
+	int entry_index                                                    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( agdb_cache_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	cache_header = (const agdb_cache_header_t *) data;
+
+	if( memory_compare(
+	     cache_header->signature,
+	     agdb_cache_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid cache signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 cache_header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 cache_header->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 cache_header->cache_size,
+	 cache_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 cache_header->file_type,
+	 file_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 cache_header->number_of_volumes,
+	 number_of_volumes );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 cache_header->number_of_files,
+	 number_of_files );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 cache_header->number_of_sources,
+	 number_of_sources );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 cache_header->string_data_size,
+	 string_data_size );
+
+	if( format_version != LIBAGDB_CACHE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( header_size != (uint32_t) sizeof( agdb_cache_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache header size: %" PRIu32 ".",
+		 function,
+		 header_size );
+
+		return( -1 );
+	}
+	if( ( file_type < LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	 || ( file_type > LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type: %" PRIu32 ".",
+		 function,
+		 file_type );
+
+		return( -1 );
+	}
+	required_data_size = (size64_t) header_size
+	                   + ( (size64_t) number_of_volumes * sizeof( agdb_cache_volume_record_t ) )
+	                   + ( (size64_t) number_of_files * sizeof( agdb_cache_file_record_t ) )
+	                   + ( (size64_t) number_of_sources * sizeof( agdb_cache_source_record_t ) )
+	                   + string_data_size;
+
+	if( ( cache_size != (size64_t) data_size )
+	 || ( required_data_size != cache_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	volume_record = (const agdb_cache_volume_record_t *) &( data[ header_size ] );
+	file_record   = (const agdb_cache_file_record_t *) &( volume_record[ number_of_volumes ] );
+	source_record = (const agdb_cache_source_record_t *) &( file_record[ number_of_files ] );
+	string_data   = (const uint8_t *) &( source_record[ number_of_sources ] );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libagdb_volume_information_initialize(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create volume: %" PRIu32 " information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_ALLOCATIONS ] += 1;
+		io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_SIZE ]        += sizeof( libagdb_internal_volume_information_t );
+
+		internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 volume_record->creation_time,
+		 internal_volume_information->creation_time );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 volume_record->serial_number,
+		 internal_volume_information->serial_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 volume_record->first_file_index,
+		 first_file_index );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 volume_record->number_of_files,
+		 number_of_volume_files );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 volume_record->device_path_offset,
+		 device_path_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 volume_record->device_path_size,
+		 internal_volume_information->device_path_size );
+
+		/* The file records of the volumes are stored consecutively
+		 */
+		if( ( first_file_index != file_record_index )
+		 || ( number_of_volume_files > ( number_of_files - file_record_index ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volume: %" PRIu32 " file records value out of bounds.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( ( device_path_offset > string_data_size )
+		 || ( internal_volume_information->device_path_size > ( string_data_size - device_path_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volume: %" PRIu32 " device path value out of bounds.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		internal_volume_information->number_of_files = number_of_volume_files;
+
+		if( internal_volume_information->device_path_size > 0 )
+		{
+			/* The device path references the cache data and is not freed
+			 */
+			internal_volume_information->device_path           = (uint8_t *) &( string_data[ device_path_offset ] );
+			internal_volume_information->device_path_is_mapped = 1;
+		}
+		for( file_index = 0;
+		     file_index < number_of_volume_files;
+		     file_index++ )
+		{
+			if( libagdb_file_information_initialize(
+			     &file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create volume: %" PRIu32 " file: %" PRIu32 " information.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				goto on_error;
+			}
+			io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_ALLOCATIONS ] += 1;
+			io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_SIZE ]        += sizeof( libagdb_internal_file_information_t );
+
+			internal_file_information = (libagdb_internal_file_information_t *) file_information;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 file_record->path_offset,
+			 path_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 file_record->path_size,
+			 internal_file_information->path_size );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 file_record->number_of_entries,
+			 internal_file_information->number_of_entries );
+
+			if( ( path_offset > string_data_size )
+			 || ( internal_file_information->path_size > ( string_data_size - path_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " file: %" PRIu32 " path value out of bounds.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				goto on_error;
+			}
+			if( internal_file_information->path_size > 0 )
+			{
+				/* The path references the cache data and is not freed
+				 */
+				internal_file_information->path           = (uint8_t *) &( string_data[ path_offset ] );
+				internal_file_information->path_is_mapped = 1;
+			}
+			if( libcdata_array_append_entry(
+			     internal_volume_information->files_array,
+			     &entry_index,
+			     (intptr_t *) file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append volume: %" PRIu32 " file: %" PRIu32 " information to array.",
+				 function,
+				 volume_index,
+				 file_index );
+
+				goto on_error;
+			}
+			file_information = NULL;
+
+			file_record++;
+		}
+		file_record_index += number_of_volume_files;
+
+		if( libcdata_array_append_entry(
+		     volumes_array,
+		     &entry_index,
+		     (intptr_t *) volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume: %" PRIu32 " information to array.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		volume_information = NULL;
+
+		volume_record++;
+	}
+	if( file_record_index != number_of_files )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of files value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( libagdb_source_information_initialize(
+		     &source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create source: %" PRIu32 " information.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_ALLOCATIONS ] += 1;
+		io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_SIZE ]        += sizeof( libagdb_internal_source_information_t );
+
+		internal_source_information = (libagdb_internal_source_information_t *) source_information;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 source_record->prefetch_hash,
+		 internal_source_information->prefetch_hash );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 source_record->executable_filename_size,
+		 internal_source_information->executable_filename_size );
+
+		if( internal_source_information->executable_filename_size > 16 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid source: %" PRIu32 " executable filename size value out of bounds.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_source_information->executable_filename,
+		     source_record->executable_filename,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source: %" PRIu32 " executable filename.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     sources_array,
+		     &entry_index,
+		     (intptr_t *) source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source: %" PRIu32 " information to array.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		source_information = NULL;
+
+		source_record++;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 cache_header->file_size,
+	 io_handle->file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 cache_header->uncompressed_data_size,
+	 io_handle->uncompressed_data_size );
+
+	io_handle->file_type = (uint8_t) file_type;
+
+	return( 1 );
+
+on_error:
+	if( source_information != NULL )
+	{
+		libagdb_internal_source_information_free(
+		 (libagdb_internal_source_information_t **) &source_information,
+		 NULL );
+	}
+	if( file_information != NULL )
+	{
+		libagdb_internal_file_information_free(
+		 (libagdb_internal_file_information_t **) &file_information,
+		 NULL );
+	}
+	if( volume_information != NULL )
+	{
+		libagdb_internal_volume_information_free(
+		 (libagdb_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
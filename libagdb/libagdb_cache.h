@@ -0,0 +1,69 @@
+/*
+ * Parsed database cache functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_CACHE_H )
+#define _LIBAGDB_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_io_handle.h"
+#include "libagdb_libcdata.h"
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The cache format version, increased on every incompatible change
+ */
+#define LIBAGDB_CACHE_FORMAT_VERSION	1
+
+extern const char *agdb_cache_signature;
+
+int libagdb_cache_get_data_size(
+     libcdata_array_t *volumes_array,
+     libcdata_array_t *sources_array,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libagdb_cache_write_data(
+     libagdb_io_handle_t *io_handle,
+     libcdata_array_t *volumes_array,
+     libcdata_array_t *sources_array,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libagdb_cache_read_data(
+     libagdb_io_handle_t *io_handle,
+     libcdata_array_t *volumes_array,
+     libcdata_array_t *sources_array,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_CACHE_H ) */
+
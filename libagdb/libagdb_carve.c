@@ -0,0 +1,552 @@
+/*
+ * Carve functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_carve.h"
+#include "libagdb_definitions.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libcerror.h"
+
+#include "agdb_database_header.h"
+
+/* The maximum size of a compressed block of a Windows 7 or 8.0 compressed file
+ */
+#define LIBAGDB_CARVE_MAXIMUM_COMPRESSED_BLOCK_SIZE	( 2 * 65536 )
+
+/* Lookup table of the first byte values of the supported signatures
+ * Used to reject most offsets with a single table lookup
+ */
+static const uint8_t libagdb_carve_first_byte_table[ 256 ] = {
+	0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+/* Checks if the data contains a plausible AGDB file header
+ * The data must contain at least LIBAGDB_CARVE_SIGNATURE_DATA_SIZE bytes
+ * Besides the signature the uncompressed data size and the size of the
+ * first compressed block are checked
+ * Returns 1 if the data contains a plausible file header or 0 if not
+ */
+int libagdb_carve_check_signature(
+     const uint8_t *data,
+     uint8_t *file_type,
+     uint32_t *uncompressed_data_size )
+{
+	uint32_t compressed_block_size       = 0;
+	uint32_t safe_uncompressed_data_size = 0;
+	uint32_t value_32bit                 = 0;
+	uint16_t value_16bit                 = 0;
+	uint8_t safe_file_type               = 0;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 safe_uncompressed_data_size );
+
+	if( ( safe_uncompressed_data_size < (uint32_t) sizeof( agdb_database_header_t ) )
+	 || ( (size_t) safe_uncompressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     data,
+	     agdb_mem_file_signature_vista,
+	     4 ) == 0 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ 8 ] ),
+		 value_16bit );
+
+		/* The first block starts with a LZNT1 chunk header
+		 */
+		if( ( ( value_16bit & 0x7000 ) != 0x3000 )
+		 || ( ( value_16bit & 0x0fff ) == 0 ) )
+		{
+			return( 0 );
+		}
+		safe_file_type = LIBAGDB_FILE_TYPE_COMPRESSED_VISTA;
+	}
+	else if( memory_compare(
+	          data,
+	          agdb_mem_file_signature_win7,
+	          4 ) == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 8 ] ),
+		 compressed_block_size );
+
+		if( ( compressed_block_size == 0 )
+		 || ( compressed_block_size > LIBAGDB_CARVE_MAXIMUM_COMPRESSED_BLOCK_SIZE ) )
+		{
+			return( 0 );
+		}
+		safe_file_type = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7;
+	}
+	else if( memory_compare(
+	          data,
+	          agdb_mem_file_signature_win8_0,
+	          4 ) == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 12 ] ),
+		 compressed_block_size );
+
+		if( ( compressed_block_size == 0 )
+		 || ( compressed_block_size > LIBAGDB_CARVE_MAXIMUM_COMPRESSED_BLOCK_SIZE ) )
+		{
+			return( 0 );
+		}
+		safe_file_type = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0;
+	}
+	else if( memory_compare(
+	          data,
+	          agdb_mam_file_signature_win8_1,
+	          4 ) == 0 )
+	{
+		safe_file_type = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1;
+	}
+	else
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 data,
+		 value_32bit );
+
+		if( ( value_32bit != 0x00000005UL )
+		 && ( value_32bit != 0x0000000eUL )
+		 && ( value_32bit != 0x0000000fUL ) )
+		{
+			return( 0 );
+		}
+		safe_file_type = LIBAGDB_FILE_TYPE_UNCOMPRESSED;
+	}
+	*file_type              = safe_file_type;
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Scans data for the file header of an AGDB file
+ * The data offset is the offset of the data relative to the start of the source,
+ * only source offsets that are a multiple of the alignment are checked
+ * The scan starts at scan_offset, on return scan_offset contains the offset of
+ * the file header or if none was found the offset where the scan stopped
+ * At least LIBAGDB_CARVE_SIGNATURE_DATA_SIZE bytes of the data after scan_offset
+ * are needed to check for a file header, hence data after scan_offset should
+ * be retained when the scan is continued with additional data
+ * Returns 1 if a file header was found, 0 if not or -1 on error
+ */
+int libagdb_carve_scan_data(
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     size_t alignment,
+     size_t *scan_offset,
+     uint8_t *file_type,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_carve_scan_data";
+	size_t alignment_size = 0;
+	size_t offset         = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alignment == 0 )
+	 || ( alignment > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid alignment value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_offset > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	*file_type              = 0;
+	*uncompressed_data_size = 0;
+
+	offset = *scan_offset;
+
+	if( alignment > 1 )
+	{
+		alignment_size = (size_t) ( ( (size64_t) data_offset + offset ) % alignment );
+
+		if( alignment_size != 0 )
+		{
+			offset += alignment - alignment_size;
+		}
+	}
+	if( data_size >= LIBAGDB_CARVE_SIGNATURE_DATA_SIZE )
+	{
+		while( offset <= ( data_size - LIBAGDB_CARVE_SIGNATURE_DATA_SIZE ) )
+		{
+			if( libagdb_carve_first_byte_table[ data[ offset ] ] != 0 )
+			{
+				if( libagdb_carve_check_signature(
+				     &( data[ offset ] ),
+				     file_type,
+				     uncompressed_data_size ) == 1 )
+				{
+					*scan_offset = offset;
+
+					return( 1 );
+				}
+			}
+			offset += alignment;
+		}
+	}
+	if( offset > data_size )
+	{
+		offset = data_size;
+	}
+	*scan_offset = offset;
+
+	return( 0 );
+}
+
+/* Retrieves the maximum size of a file with a specific uncompressed data size
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_carve_get_maximum_file_size(
+     uint8_t file_type,
+     uint32_t uncompressed_data_size,
+     size64_t *maximum_file_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libagdb_carve_get_maximum_file_size";
+	size64_t number_of_blocks  = 0;
+	uint32_t block_size        = 0;
+	uint32_t file_header_size  = 0;
+
+	if( maximum_file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum file size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( file_type )
+	{
+		case LIBAGDB_FILE_TYPE_UNCOMPRESSED:
+			*maximum_file_size = (size64_t) uncompressed_data_size;
+
+			return( 1 );
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_VISTA:
+			file_header_size = 8;
+			block_size       = 4096;
+			break;
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7:
+			file_header_size = 8;
+			block_size       = 65536;
+			break;
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0:
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1:
+			file_header_size = 12;
+			block_size       = 65536;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported file type.",
+			 function );
+
+			return( -1 );
+	}
+	number_of_blocks = ( (size64_t) uncompressed_data_size + block_size - 1 ) / block_size;
+
+	/* A compressed block can be larger than its uncompressed data, for example
+	 * due to the LZXPRESS Huffman table and the LZNT1 flag bytes
+	 */
+	*maximum_file_size = file_header_size
+	                   + ( number_of_blocks * ( block_size + ( block_size / 8 ) + 264 ) );
+
+	return( 1 );
+}
+
+/* Retrieves the size of a file from its file header and compressed block headers
+ * The data should start with the file header
+ * The compressed size of a Windows 8.1 compressed file is not stored, hence
+ * the maximum file size that fits in the data is returned
+ * Returns 1 if successful, 0 if the size cannot be determined from the data or -1 on error
+ */
+int libagdb_carve_get_file_size(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type,
+     uint32_t uncompressed_data_size,
+     size64_t *file_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libagdb_carve_get_file_size";
+	size64_t maximum_file_size       = 0;
+	size_t data_offset               = 0;
+	uint32_t compressed_block_size   = 0;
+	uint32_t uncompressed_block_size = 0;
+	uint16_t value_16bit             = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_carve_get_maximum_file_size(
+	     file_type,
+	     uncompressed_data_size,
+	     &maximum_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum file size.",
+		 function );
+
+		return( -1 );
+	}
+	*file_size = 0;
+
+	if( data_size < LIBAGDB_CARVE_SIGNATURE_DATA_SIZE )
+	{
+		return( 0 );
+	}
+	if( file_type == LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	{
+		if( (size64_t) data_size < maximum_file_size )
+		{
+			return( 0 );
+		}
+		*file_size = maximum_file_size;
+
+		return( 1 );
+	}
+	if( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1 )
+	{
+		if( (size64_t) data_size < maximum_file_size )
+		{
+			maximum_file_size = (size64_t) data_size;
+		}
+		*file_size = maximum_file_size;
+
+		return( 1 );
+	}
+	if( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
+	{
+		data_offset             = 8;
+		uncompressed_block_size = 4096;
+	}
+	else if( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 )
+	{
+		data_offset             = 8;
+		uncompressed_block_size = 65536;
+	}
+	else
+	{
+		data_offset             = 12;
+		uncompressed_block_size = 65536;
+	}
+	while( uncompressed_data_size > 0 )
+	{
+		if( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
+		{
+			if( data_offset > ( data_size - 2 ) )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data[ data_offset ] ),
+			 value_16bit );
+
+			if( ( ( value_16bit & 0x7000 ) != 0x3000 )
+			 || ( ( value_16bit & 0x0fff ) == 0 ) )
+			{
+				return( 0 );
+			}
+			compressed_block_size = (uint32_t) ( value_16bit & 0x0fff ) + 3;
+		}
+		else
+		{
+			if( data_offset > ( data_size - 4 ) )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 compressed_block_size );
+
+			data_offset += 4;
+
+			if( ( compressed_block_size == 0 )
+			 || ( compressed_block_size > LIBAGDB_CARVE_MAXIMUM_COMPRESSED_BLOCK_SIZE ) )
+			{
+				return( 0 );
+			}
+		}
+		if( (size_t) compressed_block_size > ( data_size - data_offset ) )
+		{
+			return( 0 );
+		}
+		data_offset += compressed_block_size;
+
+		if( uncompressed_data_size < uncompressed_block_size )
+		{
+			uncompressed_data_size = 0;
+		}
+		else
+		{
+			uncompressed_data_size -= uncompressed_block_size;
+		}
+	}
+	*file_size = (size64_t) data_offset;
+
+	return( 1 );
+}
+
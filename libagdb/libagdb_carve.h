@@ -0,0 +1,72 @@
+/*
+ * Carve functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_CARVE_H )
+#define _LIBAGDB_CARVE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_extern.h"
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libagdb_carve_check_signature(
+     const uint8_t *data,
+     uint8_t *file_type,
+     uint32_t *uncompressed_data_size );
+
+LIBAGDB_EXTERN \
+int libagdb_carve_scan_data(
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     size_t alignment,
+     size_t *scan_offset,
+     uint8_t *file_type,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_carve_get_maximum_file_size(
+     uint8_t file_type,
+     uint32_t uncompressed_data_size,
+     size64_t *maximum_file_size,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_carve_get_file_size(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t file_type,
+     uint32_t uncompressed_data_size,
+     size64_t *file_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_CARVE_H ) */
+
@@ -24,7 +24,9 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libagdb_allocator.h"
 #include "libagdb_compressed_block.h"
+#include "libagdb_content_fingerprint.h"
 #include "libagdb_definitions.h"
 #include "libagdb_file.h"
 #include "libagdb_io_handle.h"
@@ -33,6 +35,7 @@
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
 #include "libagdb_libfwnt.h"
+#include "libagdb_trace.h"
 #include "libagdb_unused.h"
 
 /* Creates compressed block
@@ -80,7 +83,7 @@ int libagdb_compressed_block_initialize(
 
 		return( -1 );
 	}
-	*compressed_block = memory_allocate_structure(
+	*compressed_block = libagdb_allocator_allocate_structure(
 	                     libagdb_compressed_block_t );
 
 	if( *compressed_block == NULL )
@@ -108,7 +111,7 @@ int libagdb_compressed_block_initialize(
 
 		goto on_error;
 	}
-	( *compressed_block )->data = (uint8_t *) memory_allocate(
+	( *compressed_block )->data = (uint8_t *) libagdb_allocator_allocate(
 	                                           sizeof( uint8_t ) * data_size );
 
 	if( ( *compressed_block )->data == NULL )
@@ -129,7 +132,7 @@ int libagdb_compressed_block_initialize(
 on_error:
 	if( *compressed_block != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *compressed_block );
 
 		*compressed_block = NULL;
@@ -161,10 +164,10 @@ int libagdb_compressed_block_free(
 	{
 		if( ( *compressed_block )->data != NULL )
 		{
-			memory_free(
+			libagdb_allocator_free(
 			 ( *compressed_block )->data );
 		}
-		memory_free(
+		libagdb_allocator_free(
 		 *compressed_block );
 
 		*compressed_block = NULL;
@@ -183,10 +186,13 @@ int libagdb_compressed_block_read(
      size_t compressed_block_size,
      libcerror_error_t **error )
 {
-	uint8_t *compressed_data = NULL;
-        static char *function    = "libagdb_compressed_block_read";
-	ssize_t read_count       = 0;
-	int result               = 0;
+	const uint8_t *compressed_data = NULL;
+	uint8_t *compressed_buffer     = NULL;
+        static char *function          = "libagdb_compressed_block_read";
+	uint64_t end_time              = 0;
+	uint64_t start_time            = 0;
+	ssize_t read_count             = 0;
+	int result                     = 0;
 
 	if( compressed_block == NULL )
 	{
@@ -199,6 +205,17 @@ int libagdb_compressed_block_read(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( compressed_block_size == 0 )
 	 || ( compressed_block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
@@ -211,40 +228,93 @@ int libagdb_compressed_block_read(
 
 		return( -1 );
 	}
-	compressed_data = (uint8_t *) memory_allocate(
-	                               sizeof( uint8_t ) * compressed_block_size );
+	/* If the file is memory mapped the block is decompressed directly
+	 * from the mapped data otherwise the compressed data is read into a buffer
+	 */
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          compressed_block_offset,
+	          compressed_block_size,
+	          &compressed_data,
+	          error );
 
-	if( compressed_data == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create compressed data.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped compressed block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 compressed_block_offset,
+		 compressed_block_offset );
 
 		goto on_error;
 	}
-	read_count = libbfio_handle_read_buffer_at_offset(
-		      file_io_handle,
-		      compressed_data,
-		      compressed_block_size,
-		      compressed_block_offset,
-		      error );
+	else if( result != 0 )
+	{
+		read_count = (ssize_t) compressed_block_size;
+
+		io_handle->statistics[ LIBAGDB_STATISTIC_MAPPED_BYTES_READ ] += (uint64_t) read_count;
+		io_handle->statistics[ LIBAGDB_STATISTIC_MAPPED_READ_CALLS ] += 1;
+	}
+	else
+	{
+		compressed_buffer = (uint8_t *) libagdb_allocator_allocate(
+		                                 sizeof( uint8_t ) * compressed_block_size );
+
+		if( compressed_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+			      file_io_handle,
+			      compressed_buffer,
+			      compressed_block_size,
+			      compressed_block_offset,
+			      error );
+
+		if( read_count != (ssize_t) compressed_block_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 compressed_block_offset,
+			 compressed_block_offset );
+
+			goto on_error;
+		}
+		compressed_data = compressed_buffer;
 
-	if( read_count != (ssize_t) compressed_block_size )
+		io_handle->statistics[ LIBAGDB_STATISTIC_BYTES_READ ] += (uint64_t) read_count;
+		io_handle->statistics[ LIBAGDB_STATISTIC_READ_CALLS ] += 1;
+	}
+
+	if( libagdb_io_handle_get_current_time(
+	     &start_time,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 compressed_block_size,
-		 compressed_block_size );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decompression start time.",
+		 function );
 
 		goto on_error;
 	}
+	result = 0;
+
 	if( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
 	{
 		result = libfwnt_lznt1_decompress(
@@ -276,18 +346,37 @@ int libagdb_compressed_block_read(
 
 		goto on_error;
 	}
-	memory_free(
-	 compressed_data );
+	if( libagdb_io_handle_get_current_time(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decompression end time.",
+		 function );
 
-	compressed_data = NULL;
+		goto on_error;
+	}
+	if( end_time > start_time )
+	{
+		io_handle->statistics[ LIBAGDB_STATISTIC_DECOMPRESSION_TIME ] += end_time - start_time;
+	}
+	io_handle->statistics[ LIBAGDB_STATISTIC_DECOMPRESSED_BLOCKS ] += 1;
 
+	if( compressed_buffer != NULL )
+	{
+		libagdb_allocator_free(
+		 compressed_buffer );
+	}
 	return( 1 );
 
 on_error:
-	if( compressed_data != NULL )
+	if( compressed_buffer != NULL )
 	{
-		memory_free(
-		 compressed_data );
+		libagdb_allocator_free(
+		 compressed_buffer );
 	}
 	return( -1 );
 }
@@ -311,6 +400,7 @@ int libagdb_compressed_block_read_element_data(
 	libagdb_compressed_block_t *compressed_block = NULL;
 	static char *function                        = "libagdb_compressed_block_read_element_data";
 	size64_t uncompressed_size                   = 0;
+	int element_index                            = 0;
 	int result                                   = 0;
 
 	LIBAGDB_UNREFERENCED_PARAMETER( element_file_index )
@@ -377,6 +467,20 @@ int libagdb_compressed_block_read_element_data(
 
 		goto on_error;
 	}
+	if( libfdata_list_element_get_element_index(
+	     element,
+	     &element_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list element index.",
+		 function );
+
+		goto on_error;
+	}
 	if( ( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
 	 || ( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 )
 	 || ( io_handle->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0 ) )
@@ -393,6 +497,11 @@ int libagdb_compressed_block_read_element_data(
 			return( -1 );
 		}
 	}
+	/* The compressed blocks list only reads the element data if the compressed block
+	 * is not in the compressed blocks cache
+	 */
+	io_handle->statistics[ LIBAGDB_STATISTIC_CACHE_MISSES ] += 1;
+
 	if( libagdb_compressed_block_initialize(
 	     &compressed_block,
 	     (size_t) uncompressed_size,
@@ -407,6 +516,14 @@ int libagdb_compressed_block_read_element_data(
 
 		goto on_error;
 	}
+	libagdb_trace_begin(
+	 &( io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 (uint32_t) element_index,
+	 io_handle->file_type,
+	 compressed_block_offset,
+	 compressed_block_size );
+
 	result = libagdb_compressed_block_read(
 	          compressed_block,
 	          io_handle,
@@ -415,6 +532,13 @@ int libagdb_compressed_block_read_element_data(
 	          (size_t) compressed_block_size,
 	          error );
 
+	libagdb_trace_end(
+	 &( io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 (uint32_t) element_index,
+	 result,
+	 uncompressed_size );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -438,6 +562,28 @@ int libagdb_compressed_block_read_element_data(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
+	/* Hash the uncompressed data while it is available, so that the content
+	 * fingerprint does not need to read the compressed block again
+	 */
+	if( io_handle->content_fingerprint != NULL )
+	{
+		if( libagdb_content_fingerprint_update(
+		     io_handle->content_fingerprint,
+		     (off64_t) element_index * io_handle->uncompressed_block_size,
+		     compressed_block->data,
+		     compressed_block->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update content fingerprint.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libfdata_list_element_set_element_value(
 	     element,
 	     (intptr_t *) file_io_handle,
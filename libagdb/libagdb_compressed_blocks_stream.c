@@ -34,6 +34,7 @@
  */
 int libagdb_compressed_blocks_stream_initialize(
      libfdata_stream_t **compressed_blocks_stream,
+     libagdb_io_handle_t *io_handle,
      libfdata_list_t *compressed_blocks_list,
      libfcache_cache_t *compressed_blocks_cache,
      libcerror_error_t **error )
@@ -92,6 +93,7 @@ int libagdb_compressed_blocks_stream_initialize(
 
 		goto on_error;
 	}
+	data_handle->io_handle               = io_handle;
 	data_handle->compressed_blocks_list  = compressed_blocks_list;
 	data_handle->compressed_blocks_cache = compressed_blocks_cache;
 
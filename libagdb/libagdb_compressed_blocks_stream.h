@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libagdb_io_handle.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
@@ -35,6 +36,7 @@ extern "C" {
 
 int libagdb_compressed_blocks_stream_initialize(
      libfdata_stream_t **compressed_blocks_stream,
+     libagdb_io_handle_t *io_handle,
      libfdata_list_t *compressed_blocks_list,
      libfcache_cache_t *compressed_blocks_cache,
      libcerror_error_t **error );
@@ -23,8 +23,11 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libagdb_allocator.h"
 #include "libagdb_compressed_block.h"
 #include "libagdb_compressed_blocks_stream_data_handle.h"
+#include "libagdb_definitions.h"
+#include "libagdb_io_handle.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfdata.h"
 #include "libagdb_unused.h"
@@ -61,7 +64,7 @@ int libagdb_compressed_blocks_stream_data_handle_initialize(
 
 		return( -1 );
 	}
-	*data_handle = memory_allocate_structure(
+	*data_handle = libagdb_allocator_allocate_structure(
 	                libagdb_compressed_blocks_stream_data_handle_t );
 
 	if( *data_handle == NULL )
@@ -87,7 +90,7 @@ int libagdb_compressed_blocks_stream_data_handle_initialize(
 		 "%s: unable to clear data handle.",
 		 function );
 
-		memory_free(
+		libagdb_allocator_free(
 		 *data_handle );
 
 		*data_handle = NULL;
@@ -99,7 +102,7 @@ int libagdb_compressed_blocks_stream_data_handle_initialize(
 on_error:
 	if( *data_handle != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *data_handle );
 
 		*data_handle = NULL;
@@ -130,9 +133,9 @@ int libagdb_compressed_blocks_stream_data_handle_free(
 	}
 	if( *data_handle != NULL )
 	{
-		/* The compressed_blocks_list and compressed_blocks_cache values are referenced and freed elsewhere
+		/* The io_handle, compressed_blocks_list and compressed_blocks_cache values are referenced and freed elsewhere
 		 */
-		memory_free(
+		libagdb_allocator_free(
 		 *data_handle );
 
 		*data_handle = NULL;
@@ -159,6 +162,7 @@ ssize_t libagdb_compressed_blocks_stream_data_handle_read_segment_data(
 	static char *function                        = "libagdb_compressed_blocks_stream_data_handle_read_segment_data";
 	off64_t segment_data_offset                  = 0;
 	ssize_t read_count                           = 0;
+	uint64_t number_of_cache_misses              = 0;
 
 	LIBAGDB_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBAGDB_UNREFERENCED_PARAMETER( segment_flags )
@@ -196,6 +200,10 @@ ssize_t libagdb_compressed_blocks_stream_data_handle_read_segment_data(
 
 		return( -1 );
 	}
+	if( data_handle->io_handle != NULL )
+	{
+		number_of_cache_misses = data_handle->io_handle->statistics[ LIBAGDB_STATISTIC_CACHE_MISSES ];
+	}
 	if( libfdata_list_get_element_value_at_offset(
 	     data_handle->compressed_blocks_list,
 	     (intptr_t *) file_io_handle,
@@ -229,6 +237,15 @@ ssize_t libagdb_compressed_blocks_stream_data_handle_read_segment_data(
 
 		return( -1 );
 	}
+	/* The cache misses are counted when the compressed block is read
+	 */
+	if( data_handle->io_handle != NULL )
+	{
+		if( data_handle->io_handle->statistics[ LIBAGDB_STATISTIC_CACHE_MISSES ] == number_of_cache_misses )
+		{
+			data_handle->io_handle->statistics[ LIBAGDB_STATISTIC_CACHE_HITS ] += 1;
+		}
+	}
 	if( ( segment_data_offset < 0 )
 	 || ( segment_data_offset >= (off64_t) compressed_block->data_size ) )
 	{
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libagdb_io_handle.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
@@ -41,6 +42,10 @@ struct libagdb_compressed_blocks_stream_data_handle
 	 */
 	off64_t current_offset;
 
+	/* The IO handle
+	 */
+	libagdb_io_handle_t *io_handle;
+
 	/* The compressed blocks list
 	 */
 	libfdata_list_t *compressed_blocks_list;
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libagdb_allocator.h"
 #include "libagdb_compressed_file_header.h"
 #include "libagdb_definitions.h"
 #include "libagdb_io_handle.h"
@@ -63,7 +64,7 @@ int libagdb_compressed_file_header_initialize(
 
 		return( -1 );
 	}
-	*compressed_file_header = memory_allocate_structure(
+	*compressed_file_header = libagdb_allocator_allocate_structure(
 	                           libagdb_compressed_file_header_t );
 
 	if( *compressed_file_header == NULL )
@@ -96,7 +97,7 @@ int libagdb_compressed_file_header_initialize(
 on_error:
 	if( *compressed_file_header != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *compressed_file_header );
 
 		*compressed_file_header = NULL;
@@ -126,7 +127,7 @@ int libagdb_compressed_file_header_free(
 	}
 	if( *compressed_file_header != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *compressed_file_header );
 
 		*compressed_file_header = NULL;
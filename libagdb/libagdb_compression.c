@@ -0,0 +1,430 @@
+/*
+ * Compression functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_compression.h"
+#include "libagdb_libcerror.h"
+
+/* Retrieves the size of a LZNT1 compressed chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compression_get_lznt1_chunk_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compression_get_lznt1_chunk_size";
+
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > 4096 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_data_size = 2 + uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Compresses data into a single LZNT1 chunk
+ * The data is stored as an uncompressed chunk, which every LZNT1 decompressor supports
+ * On return compressed_data_size contains the size of the compressed chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compression_lznt1_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_compression_lznt1_compress_chunk";
+	size_t chunk_size     = 0;
+	uint16_t chunk_header = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_compression_get_lznt1_chunk_size(
+	     uncompressed_data_size,
+	     &chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size < chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunk header consists of:
+	 * bits 0 - 11: the chunk data size - 1
+	 * bits 12 - 14: the signature value 3
+	 * bit 15: the compressed flag, which is not set
+	 */
+	chunk_header = (uint16_t) ( 0x3000 | ( uncompressed_data_size - 1 ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 compressed_data,
+	 chunk_header );
+
+	if( memory_copy(
+	     &( compressed_data[ 2 ] ),
+	     uncompressed_data,
+	     uncompressed_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	*compressed_data_size = chunk_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of a LZXPRESS Huffman compressed chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compression_get_lzxpress_huffman_chunk_size(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t is_last_chunk,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libagdb_compression_get_lzxpress_huffman_chunk_size";
+	size_t number_of_bits           = 0;
+	size_t uncompressed_data_offset = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > 65536 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Byte value 0xff and the end-of-stream symbol are encoded with 9 bits
+	 * and the other byte values with 8 bits
+	 */
+	number_of_bits = uncompressed_data_size * 8;
+
+	for( uncompressed_data_offset = 0;
+	     uncompressed_data_offset < uncompressed_data_size;
+	     uncompressed_data_offset++ )
+	{
+		if( uncompressed_data[ uncompressed_data_offset ] == 0xff )
+		{
+			number_of_bits += 1;
+		}
+	}
+	if( is_last_chunk != 0 )
+	{
+		number_of_bits += 9;
+	}
+	/* The bit stream is stored in 16-bit values and is followed by an additional
+	 * 16-bit value, since the decoder reads 16 bits ahead of the current symbol
+	 */
+	*compressed_data_size = 256 + ( ( ( number_of_bits + 15 ) / 16 ) + 1 ) * 2;
+
+	return( 1 );
+}
+
+/* Compresses data into a single LZXPRESS Huffman chunk
+ * The data is encoded with a Huffman table that only uses literals, which
+ * every LZXPRESS Huffman decompressor supports
+ * On return compressed_data_size contains the size of the compressed chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_compression_lzxpress_huffman_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t is_last_chunk,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libagdb_compression_lzxpress_huffman_compress_chunk";
+	size_t chunk_size               = 0;
+	size_t compressed_data_offset   = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t bit_buffer             = 0;
+	uint8_t bit_buffer_size         = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_compression_get_lzxpress_huffman_chunk_size(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     is_last_chunk,
+	     &chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve chunk size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size < chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The Huffman table contains 4-bit code sizes of the 512 symbols.
+	 * Symbols 0 - 254 use 8-bit codes, symbols 255 and 256 (end-of-stream)
+	 * use 9-bit codes and the match symbols are unused. The corresponding
+	 * canonical codes of symbols 0 - 254 are the literal byte values and
+	 * those of symbols 255 and 256 are 0x1fe and 0x1ff.
+	 */
+	if( memory_set(
+	     compressed_data,
+	     0x88,
+	     127 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to set Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data[ 127 ] = 0x98;
+	compressed_data[ 128 ] = 0x09;
+
+	if( memory_set(
+	     &( compressed_data[ 129 ] ),
+	     0,
+	     127 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to set Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_data_offset = 256;
+
+	/* The bit stream is stored most significant bit first in 16-bit little-endian values
+	 */
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		if( uncompressed_data[ uncompressed_data_offset ] == 0xff )
+		{
+			bit_buffer     <<= 9;
+			bit_buffer      |= 0x000001feUL;
+			bit_buffer_size += 9;
+		}
+		else
+		{
+			bit_buffer     <<= 8;
+			bit_buffer      |= uncompressed_data[ uncompressed_data_offset ];
+			bit_buffer_size += 8;
+		}
+		uncompressed_data_offset++;
+
+		if( bit_buffer_size >= 16 )
+		{
+			bit_buffer_size -= 16;
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 (uint16_t) ( bit_buffer >> bit_buffer_size ) );
+
+			compressed_data_offset += 2;
+		}
+	}
+	if( is_last_chunk != 0 )
+	{
+		bit_buffer     <<= 9;
+		bit_buffer      |= 0x000001ffUL;
+		bit_buffer_size += 9;
+
+		if( bit_buffer_size >= 16 )
+		{
+			bit_buffer_size -= 16;
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 (uint16_t) ( bit_buffer >> bit_buffer_size ) );
+
+			compressed_data_offset += 2;
+		}
+	}
+	if( bit_buffer_size > 0 )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 (uint16_t) ( bit_buffer << ( 16 - bit_buffer_size ) ) );
+
+		compressed_data_offset += 2;
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( compressed_data[ compressed_data_offset ] ),
+	 0 );
+
+	compressed_data_offset += 2;
+
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+}
+
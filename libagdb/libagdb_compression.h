@@ -0,0 +1,66 @@
+/*
+ * Compression functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_COMPRESSION_H )
+#define _LIBAGDB_COMPRESSION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libagdb_compression_get_lznt1_chunk_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int libagdb_compression_lznt1_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int libagdb_compression_get_lzxpress_huffman_chunk_size(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t is_last_chunk,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int libagdb_compression_lzxpress_huffman_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t is_last_chunk,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_COMPRESSION_H ) */
+
@@ -0,0 +1,475 @@
+/*
+ * Content fingerprint functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_allocator.h"
+#include "libagdb_content_fingerprint.h"
+#include "libagdb_definitions.h"
+#include "libagdb_hash.h"
+#include "libagdb_libcerror.h"
+
+/* Creates a content fingerprint
+ * Make sure the value content_fingerprint is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_content_fingerprint_initialize(
+     libagdb_content_fingerprint_t **content_fingerprint,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libagdb_content_fingerprint_initialize";
+	size_t bitmap_size        = 0;
+	uint64_t number_of_blocks = 0;
+
+	if( content_fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *content_fingerprint != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid content fingerprint value already set.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks = data_size / LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE;
+
+	if( ( data_size % LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE ) != 0 )
+	{
+		number_of_blocks += 1;
+	}
+	if( number_of_blocks > (uint64_t) ( (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE * 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bitmap_size = (size_t) ( ( number_of_blocks + 7 ) / 8 );
+
+	*content_fingerprint = libagdb_allocator_allocate_structure(
+	                        libagdb_content_fingerprint_t );
+
+	if( *content_fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create content fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *content_fingerprint,
+	     0,
+	     sizeof( libagdb_content_fingerprint_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear content fingerprint.",
+		 function );
+
+		libagdb_allocator_free(
+		 *content_fingerprint );
+
+		*content_fingerprint = NULL;
+
+		return( -1 );
+	}
+	if( bitmap_size > 0 )
+	{
+		( *content_fingerprint )->hashed_blocks_bitmap = (uint8_t *) libagdb_allocator_allocate(
+		                                                              sizeof( uint8_t ) * bitmap_size );
+
+		if( ( *content_fingerprint )->hashed_blocks_bitmap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hashed blocks bitmap.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     ( *content_fingerprint )->hashed_blocks_bitmap,
+		     0,
+		     sizeof( uint8_t ) * bitmap_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear hashed blocks bitmap.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *content_fingerprint )->data_size        = data_size;
+	( *content_fingerprint )->number_of_blocks = number_of_blocks;
+
+	return( 1 );
+
+on_error:
+	if( *content_fingerprint != NULL )
+	{
+		if( ( *content_fingerprint )->hashed_blocks_bitmap != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *content_fingerprint )->hashed_blocks_bitmap );
+		}
+		libagdb_allocator_free(
+		 *content_fingerprint );
+
+		*content_fingerprint = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a content fingerprint
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_content_fingerprint_free(
+     libagdb_content_fingerprint_t **content_fingerprint,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_content_fingerprint_free";
+
+	if( content_fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( *content_fingerprint != NULL )
+	{
+		if( ( *content_fingerprint )->hashed_blocks_bitmap != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *content_fingerprint )->hashed_blocks_bitmap );
+		}
+		libagdb_allocator_free(
+		 *content_fingerprint );
+
+		*content_fingerprint = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the content fingerprint with uncompressed data
+ * The data offset must be a multiple of LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE.
+ * Every block that is fully contained in the data and was not hashed before
+ * is hashed using the block number as seed, partial blocks are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_content_fingerprint_update(
+     libagdb_content_fingerprint_t *content_fingerprint,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libagdb_content_fingerprint_update";
+	size64_t block_offset     = 0;
+	size64_t data_end_offset  = 0;
+	size_t block_data_offset  = 0;
+	size_t block_size         = 0;
+	uint64_t block_number     = 0;
+	uint64_t hash_value_lower = 0;
+	uint64_t hash_value_upper = 0;
+	uint8_t block_bit         = 0;
+
+	if( content_fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( ( data_offset % LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	block_offset    = (size64_t) data_offset;
+	data_end_offset = block_offset + data_size;
+
+	/* Uncompressed data beyond the data size, such as the padding of the last block, is ignored
+	 */
+	if( data_end_offset > content_fingerprint->data_size )
+	{
+		data_end_offset = content_fingerprint->data_size;
+	}
+	block_number = block_offset / LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE;
+
+	while( block_offset < data_end_offset )
+	{
+		block_size = LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE;
+
+		if( (size64_t) block_size > ( content_fingerprint->data_size - block_offset ) )
+		{
+			block_size = (size_t) ( content_fingerprint->data_size - block_offset );
+		}
+		if( (size64_t) block_size > ( data_end_offset - block_offset ) )
+		{
+			break;
+		}
+		block_bit = (uint8_t) ( 1 << ( block_number % 8 ) );
+
+		if( ( content_fingerprint->hashed_blocks_bitmap[ block_number / 8 ] & block_bit ) == 0 )
+		{
+			if( libagdb_hash_calculate_128bit(
+			     &hash_value_upper,
+			     &hash_value_lower,
+			     &( data[ block_data_offset ] ),
+			     block_size,
+			     block_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to calculate hash of block: %" PRIu64 ".",
+				 function,
+				 block_number );
+
+				return( -1 );
+			}
+			content_fingerprint->sum_value_upper += hash_value_upper;
+			content_fingerprint->sum_value_lower += hash_value_lower;
+
+			content_fingerprint->hashed_blocks_bitmap[ block_number / 8 ] |= block_bit;
+
+			content_fingerprint->number_of_hashed_blocks += 1;
+		}
+		block_offset      += block_size;
+		block_data_offset += block_size;
+		block_number      += 1;
+	}
+	return( 1 );
+}
+
+/* Determines if a block was hashed
+ * Returns 1 if the block was hashed, 0 if not or -1 on error
+ */
+int libagdb_content_fingerprint_is_block_hashed(
+     libagdb_content_fingerprint_t *content_fingerprint,
+     uint64_t block_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_content_fingerprint_is_block_hashed";
+
+	if( content_fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number >= content_fingerprint->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( content_fingerprint->hashed_blocks_bitmap[ block_number / 8 ] & ( 1 << ( block_number % 8 ) ) ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Finalizes the content fingerprint
+ * The block hashes are combined by addition, so the order in which the blocks
+ * are hashed does not matter, after which the sum is hashed with the data size
+ * All blocks must have been hashed
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_content_fingerprint_finalize(
+     libagdb_content_fingerprint_t *content_fingerprint,
+     uint8_t *fingerprint,
+     size_t fingerprint_size,
+     libcerror_error_t **error )
+{
+	uint8_t summary_data[ 24 ];
+
+	static char *function     = "libagdb_content_fingerprint_finalize";
+	uint64_t hash_value_lower = 0;
+	uint64_t hash_value_upper = 0;
+
+	if( content_fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid content fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fingerprint_size < LIBAGDB_CONTENT_FINGERPRINT_SIZE )
+	 || ( fingerprint_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid fingerprint size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( content_fingerprint->number_of_hashed_blocks != content_fingerprint->number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid content fingerprint - missing block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( summary_data[ 0 ] ),
+	 content_fingerprint->sum_value_lower );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( summary_data[ 8 ] ),
+	 content_fingerprint->sum_value_upper );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( summary_data[ 16 ] ),
+	 (uint64_t) content_fingerprint->data_size );
+
+	if( libagdb_hash_calculate_128bit(
+	     &hash_value_upper,
+	     &hash_value_lower,
+	     summary_data,
+	     24,
+	     content_fingerprint->number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash of block hashes.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( fingerprint[ 0 ] ),
+	 hash_value_lower );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( fingerprint[ 8 ] ),
+	 hash_value_upper );
+
+	return( 1 );
+}
+
@@ -0,0 +1,96 @@
+/*
+ * Content fingerprint functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_CONTENT_FINGERPRINT_H )
+#define _LIBAGDB_CONTENT_FINGERPRINT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_definitions.h"
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_content_fingerprint libagdb_content_fingerprint_t;
+
+struct libagdb_content_fingerprint
+{
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The number of hashed blocks
+	 */
+	uint64_t number_of_hashed_blocks;
+
+	/* The hashed blocks bitmap, a bit is set if the corresponding block was hashed
+	 */
+	uint8_t *hashed_blocks_bitmap;
+
+	/* The sum of the lower 64-bit of the block hashes
+	 */
+	uint64_t sum_value_lower;
+
+	/* The sum of the upper 64-bit of the block hashes
+	 */
+	uint64_t sum_value_upper;
+};
+
+int libagdb_content_fingerprint_initialize(
+     libagdb_content_fingerprint_t **content_fingerprint,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libagdb_content_fingerprint_free(
+     libagdb_content_fingerprint_t **content_fingerprint,
+     libcerror_error_t **error );
+
+int libagdb_content_fingerprint_update(
+     libagdb_content_fingerprint_t *content_fingerprint,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libagdb_content_fingerprint_is_block_hashed(
+     libagdb_content_fingerprint_t *content_fingerprint,
+     uint64_t block_number,
+     libcerror_error_t **error );
+
+int libagdb_content_fingerprint_finalize(
+     libagdb_content_fingerprint_t *content_fingerprint,
+     uint8_t *fingerprint,
+     size_t fingerprint_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_CONTENT_FINGERPRINT_H ) */
+
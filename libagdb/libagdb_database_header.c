@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libagdb_allocator.h"
 #include "libagdb_database_header.h"
 #include "libagdb_definitions.h"
 #include "libagdb_io_handle.h"
@@ -65,7 +66,7 @@ int libagdb_database_header_initialize(
 
 		return( -1 );
 	}
-	*database_header = memory_allocate_structure(
+	*database_header = libagdb_allocator_allocate_structure(
 	                    libagdb_database_header_t );
 
 	if( *database_header == NULL )
@@ -98,7 +99,7 @@ int libagdb_database_header_initialize(
 on_error:
 	if( *database_header != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *database_header );
 
 		*database_header = NULL;
@@ -128,7 +129,7 @@ int libagdb_database_header_free(
 	}
 	if( *database_header != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *database_header );
 
 		*database_header = NULL;
@@ -189,7 +190,7 @@ int libagdb_database_header_read_stream(
 
 		goto on_error;
 	}
-	data = (uint8_t *) memory_allocate(
+	data = (uint8_t *) libagdb_allocator_allocate(
 	                    sizeof( uint8_t ) * data_size );
 
 	if( data == NULL )
@@ -515,7 +516,7 @@ int libagdb_database_header_read_stream(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	memory_free(
+	libagdb_allocator_free(
 	 data );
 
 	data = NULL;
@@ -525,7 +526,7 @@ int libagdb_database_header_read_stream(
 on_error:
 	if( data != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 data );
 	}
 	return( -1 );
@@ -25,6 +25,7 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libagdb_allocator.h"
 #include "libagdb_debug.h"
 #include "libagdb_libbfio.h"
 #include "libagdb_libcerror.h"
@@ -239,7 +240,7 @@ int libagdb_debug_print_string_value(
 	 value_name,
 	 string );
 
-	memory_free(
+	libagdb_allocator_free(
 	 string );
 
 	return( 1 );
@@ -247,7 +248,7 @@ int libagdb_debug_print_string_value(
 on_error:
 	if( string != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 string );
 	}
 	return( -1 );
@@ -365,7 +366,7 @@ int libagdb_debug_print_utf16_string_value(
 	 value_name,
 	 string );
 
-	memory_free(
+	libagdb_allocator_free(
 	 string );
 
 	return( 1 );
@@ -373,7 +374,7 @@ int libagdb_debug_print_utf16_string_value(
 on_error:
 	if( string != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 string );
 	}
 	return( -1 );
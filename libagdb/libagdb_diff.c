@@ -0,0 +1,1852 @@
+/*
+ * Snapshot diff functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_allocator.h"
+#include "libagdb_definitions.h"
+#include "libagdb_diff.h"
+#include "libagdb_file.h"
+#include "libagdb_file_information.h"
+#include "libagdb_hash.h"
+#include "libagdb_libcdata.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_source_information.h"
+#include "libagdb_volume_information.h"
+
+/* Creates a diff
+ * Make sure the value diff is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_initialize(
+     libagdb_diff_t **diff,
+     libcerror_error_t **error )
+{
+	libagdb_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libagdb_diff_initialize";
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diff value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = libagdb_allocator_allocate_structure(
+	                 libagdb_internal_diff_t );
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_diff,
+	     0,
+	     sizeof( libagdb_internal_diff_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear diff.",
+		 function );
+
+		libagdb_allocator_free(
+		 internal_diff );
+
+		return( -1 );
+	}
+	*diff = (libagdb_diff_t *) internal_diff;
+
+	return( 1 );
+}
+
+/* Frees a diff
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_free(
+     libagdb_diff_t **diff,
+     libcerror_error_t **error )
+{
+	libagdb_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libagdb_diff_free";
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff != NULL )
+	{
+		internal_diff = (libagdb_internal_diff_t *) *diff;
+		*diff         = NULL;
+
+		if( internal_diff->differences != NULL )
+		{
+			libagdb_allocator_free(
+			 internal_diff->differences );
+		}
+		libagdb_allocator_free(
+		 internal_diff );
+	}
+	return( 1 );
+}
+
+/* Compares a previous and a current file
+ * The differences of a previous comparison are discarded
+ * Volumes are matched by serial number and device path, files of matching volumes
+ * by path and sources by prefetch hash and executable filename
+ * The files of added or removed volumes are not compared
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_compare_files(
+     libagdb_diff_t *diff,
+     libagdb_file_t *previous_file,
+     libagdb_file_t *current_file,
+     libcerror_error_t **error )
+{
+	libagdb_diff_key_t *current_keys                                   = NULL;
+	libagdb_diff_key_t *previous_keys                                  = NULL;
+	libagdb_internal_diff_t *internal_diff                             = NULL;
+	libagdb_internal_file_t *current_internal_file                     = NULL;
+	libagdb_internal_file_t *previous_internal_file                    = NULL;
+	libagdb_internal_volume_information_t *current_volume_information  = NULL;
+	libagdb_internal_volume_information_t *previous_volume_information = NULL;
+	static char *function                                              = "libagdb_diff_compare_files";
+	int *current_matches                                               = NULL;
+	int *previous_matches                                              = NULL;
+	int entry_index                                                    = 0;
+	int number_of_current_keys                                         = 0;
+	int number_of_previous_keys                                        = 0;
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libagdb_internal_diff_t *) diff;
+
+	if( previous_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous file.",
+		 function );
+
+		return( -1 );
+	}
+	previous_internal_file = (libagdb_internal_file_t *) previous_file;
+
+	if( current_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current file.",
+		 function );
+
+		return( -1 );
+	}
+	current_internal_file = (libagdb_internal_file_t *) current_file;
+
+	internal_diff->number_of_differences = 0;
+
+	/* Join the volumes
+	 */
+	if( libagdb_diff_get_volume_keys(
+	     previous_internal_file->volumes_array,
+	     &previous_keys,
+	     &number_of_previous_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous volume keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_diff_get_volume_keys(
+	     current_internal_file->volumes_array,
+	     &current_keys,
+	     &number_of_current_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current volume keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_diff_get_matches(
+	     previous_keys,
+	     number_of_previous_keys,
+	     current_keys,
+	     number_of_current_keys,
+	     &previous_matches,
+	     &current_matches,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to match volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_previous_keys;
+	     entry_index++ )
+	{
+		if( previous_matches[ entry_index ] != -1 )
+		{
+			continue;
+		}
+		if( libagdb_internal_diff_append_difference(
+		     internal_diff,
+		     LIBAGDB_DIFFERENCE_TYPE_VOLUME_REMOVED,
+		     entry_index,
+		     -1,
+		     -1,
+		     -1,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append removed volume: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_current_keys;
+	     entry_index++ )
+	{
+		if( current_matches[ entry_index ] == -1 )
+		{
+			if( libagdb_internal_diff_append_difference(
+			     internal_diff,
+			     LIBAGDB_DIFFERENCE_TYPE_VOLUME_ADDED,
+			     -1,
+			     -1,
+			     entry_index,
+			     -1,
+			     0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append added volume: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     previous_internal_file->volumes_array,
+		     current_matches[ entry_index ],
+		     (intptr_t **) &previous_volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous volume: %d information.",
+			 function,
+			 current_matches[ entry_index ] );
+
+			goto on_error;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     current_internal_file->volumes_array,
+		     entry_index,
+		     (intptr_t **) &current_volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current volume: %d information.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libagdb_internal_diff_compare_volume_files(
+		     internal_diff,
+		     previous_volume_information,
+		     current_matches[ entry_index ],
+		     current_volume_information,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare files of volume: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	libagdb_allocator_free(
+	 current_matches );
+
+	current_matches = NULL;
+
+	libagdb_allocator_free(
+	 previous_matches );
+
+	previous_matches = NULL;
+
+	if( current_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 current_keys );
+
+		current_keys = NULL;
+	}
+	if( previous_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 previous_keys );
+
+		previous_keys = NULL;
+	}
+	/* Join the sources
+	 */
+	if( libagdb_diff_get_source_keys(
+	     previous_internal_file->sources_array,
+	     &previous_keys,
+	     &number_of_previous_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous source keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_diff_get_source_keys(
+	     current_internal_file->sources_array,
+	     &current_keys,
+	     &number_of_current_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current source keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_diff_get_matches(
+	     previous_keys,
+	     number_of_previous_keys,
+	     current_keys,
+	     number_of_current_keys,
+	     &previous_matches,
+	     &current_matches,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to match sources.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_previous_keys;
+	     entry_index++ )
+	{
+		if( previous_matches[ entry_index ] != -1 )
+		{
+			continue;
+		}
+		if( libagdb_internal_diff_append_difference(
+		     internal_diff,
+		     LIBAGDB_DIFFERENCE_TYPE_SOURCE_REMOVED,
+		     -1,
+		     entry_index,
+		     -1,
+		     -1,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append removed source: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_current_keys;
+	     entry_index++ )
+	{
+		if( current_matches[ entry_index ] != -1 )
+		{
+			continue;
+		}
+		if( libagdb_internal_diff_append_difference(
+		     internal_diff,
+		     LIBAGDB_DIFFERENCE_TYPE_SOURCE_ADDED,
+		     -1,
+		     -1,
+		     -1,
+		     entry_index,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append added source: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	libagdb_allocator_free(
+	 current_matches );
+
+	libagdb_allocator_free(
+	 previous_matches );
+
+	if( current_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 current_keys );
+	}
+	if( previous_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 previous_keys );
+	}
+	return( 1 );
+
+on_error:
+	if( current_matches != NULL )
+	{
+		libagdb_allocator_free(
+		 current_matches );
+	}
+	if( previous_matches != NULL )
+	{
+		libagdb_allocator_free(
+		 previous_matches );
+	}
+	if( current_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 current_keys );
+	}
+	if( previous_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 previous_keys );
+	}
+	internal_diff->number_of_differences = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the number of differences
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_get_number_of_differences(
+     libagdb_diff_t *diff,
+     int *number_of_differences,
+     libcerror_error_t **error )
+{
+	libagdb_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libagdb_diff_get_number_of_differences";
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libagdb_internal_diff_t *) diff;
+
+	if( number_of_differences == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of differences.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_differences = internal_diff->number_of_differences;
+
+	return( 1 );
+}
+
+/* Retrieves a specific difference
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_get_difference(
+     libagdb_diff_t *diff,
+     int difference_index,
+     libagdb_difference_t *difference,
+     libcerror_error_t **error )
+{
+	libagdb_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libagdb_diff_get_difference";
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libagdb_internal_diff_t *) diff;
+
+	if( ( difference_index < 0 )
+	 || ( difference_index >= internal_diff->number_of_differences ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid difference index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( difference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid difference.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     difference,
+	     &( internal_diff->differences[ difference_index ] ),
+	     sizeof( libagdb_difference_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy difference: %d.",
+		 function,
+		 difference_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a key
+ * The hash value is calculated from the data, the same as the name hash, and the value
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_key_set(
+     libagdb_diff_key_t *key,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_diff_key_set";
+	uint32_t hash_value   = 0;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( libagdb_hash_calculate(
+		     &hash_value,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	key->data       = data;
+	key->data_size  = data_size;
+	key->value      = value;
+	key->hash_value = hash_value ^ ( value * 0x9e3779b1UL );
+
+	return( 1 );
+}
+
+/* Joins the previous and current keys using a hash table of the previous keys
+ * Each key is matched at most once, duplicate keys are matched in order
+ * The matches contain the index of the matching key in the other keys or -1 if none
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_join_keys(
+     const libagdb_diff_key_t *previous_keys,
+     int number_of_previous_keys,
+     const libagdb_diff_key_t *current_keys,
+     int number_of_current_keys,
+     int *previous_matches,
+     int *current_matches,
+     libcerror_error_t **error )
+{
+	const libagdb_diff_key_t *current_key  = NULL;
+	const libagdb_diff_key_t *previous_key = NULL;
+	int *buckets                           = NULL;
+	int *next_entries                      = NULL;
+	static char *function                  = "libagdb_diff_join_keys";
+	int bucket_index                       = 0;
+	int current_index                      = 0;
+	int number_of_buckets                  = 1;
+	int previous_index                     = 0;
+
+	if( ( number_of_previous_keys < 0 )
+	 || ( (size_t) number_of_previous_keys > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( int ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of previous keys value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_current_keys < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of current keys value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_previous_keys > 0 )
+	 && ( ( previous_keys == NULL )
+	  || ( previous_matches == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous keys or matches.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_current_keys > 0 )
+	 && ( ( current_keys == NULL )
+	  || ( current_matches == NULL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current keys or matches.",
+		 function );
+
+		return( -1 );
+	}
+	for( previous_index = 0;
+	     previous_index < number_of_previous_keys;
+	     previous_index++ )
+	{
+		previous_matches[ previous_index ] = -1;
+	}
+	for( current_index = 0;
+	     current_index < number_of_current_keys;
+	     current_index++ )
+	{
+		current_matches[ current_index ] = -1;
+	}
+	if( ( number_of_previous_keys == 0 )
+	 || ( number_of_current_keys == 0 ) )
+	{
+		return( 1 );
+	}
+	/* Use at least twice the number of keys as buckets to keep the chains short
+	 */
+	while( number_of_buckets < number_of_previous_keys )
+	{
+		number_of_buckets *= 2;
+	}
+	number_of_buckets *= 2;
+
+	buckets = (int *) libagdb_allocator_allocate(
+	                   sizeof( int ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	next_entries = (int *) libagdb_allocator_allocate(
+	                        sizeof( int ) * number_of_previous_keys );
+
+	if( next_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create next entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		buckets[ bucket_index ] = -1;
+	}
+	/* Build the hash table in reverse order so that the chains are in key order
+	 */
+	for( previous_index = number_of_previous_keys - 1;
+	     previous_index >= 0;
+	     previous_index-- )
+	{
+		bucket_index = (int) ( previous_keys[ previous_index ].hash_value & (uint32_t) ( number_of_buckets - 1 ) );
+
+		next_entries[ previous_index ] = buckets[ bucket_index ];
+		buckets[ bucket_index ]        = previous_index;
+	}
+	/* Probe the hash table with the current keys
+	 */
+	for( current_index = 0;
+	     current_index < number_of_current_keys;
+	     current_index++ )
+	{
+		current_key  = &( current_keys[ current_index ] );
+		bucket_index = (int) ( current_key->hash_value & (uint32_t) ( number_of_buckets - 1 ) );
+
+		previous_index = buckets[ bucket_index ];
+
+		while( previous_index != -1 )
+		{
+			previous_key = &( previous_keys[ previous_index ] );
+
+			if( ( previous_matches[ previous_index ] == -1 )
+			 && ( previous_key->hash_value == current_key->hash_value )
+			 && ( previous_key->value == current_key->value )
+			 && ( previous_key->data_size == current_key->data_size ) )
+			{
+				if( ( current_key->data_size == 0 )
+				 || ( memory_compare(
+				       previous_key->data,
+				       current_key->data,
+				       current_key->data_size ) == 0 ) )
+				{
+					previous_matches[ previous_index ] = current_index;
+					current_matches[ current_index ]   = previous_index;
+
+					break;
+				}
+			}
+			previous_index = next_entries[ previous_index ];
+		}
+	}
+	libagdb_allocator_free(
+	 next_entries );
+
+	libagdb_allocator_free(
+	 buckets );
+
+	return( 1 );
+
+on_error:
+	if( next_entries != NULL )
+	{
+		libagdb_allocator_free(
+		 next_entries );
+	}
+	if( buckets != NULL )
+	{
+		libagdb_allocator_free(
+		 buckets );
+	}
+	return( -1 );
+}
+
+/* Retrieves the keys of the volumes
+ * The volumes are keyed by serial number and device path
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_get_volume_keys(
+     libcdata_array_t *volumes_array,
+     libagdb_diff_key_t **keys,
+     int *number_of_keys,
+     libcerror_error_t **error )
+{
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_diff_get_volume_keys";
+	int number_of_volumes                                              = 0;
+	int volume_index                                                   = 0;
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( *keys != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid keys value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     volumes_array,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_volumes < 0 )
+	 || ( (size_t) number_of_volumes > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libagdb_diff_key_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of volumes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_volumes > 0 )
+	{
+		*keys = (libagdb_diff_key_t *) libagdb_allocator_allocate(
+		                                sizeof( libagdb_diff_key_t ) * number_of_volumes );
+
+		if( *keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create keys.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     volumes_array,
+		     volume_index,
+		     (intptr_t **) &internal_volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libagdb_diff_key_set(
+		     &( ( *keys )[ volume_index ] ),
+		     internal_volume_information->device_path,
+		     (size_t) internal_volume_information->device_path_size,
+		     internal_volume_information->serial_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set volume: %d key.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+	}
+	*number_of_keys = number_of_volumes;
+
+	return( 1 );
+
+on_error:
+	if( *keys != NULL )
+	{
+		libagdb_allocator_free(
+		 *keys );
+
+		*keys = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the keys of the files of a volume
+ * The files are keyed by path
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_get_file_keys(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     libagdb_diff_key_t **keys,
+     int *number_of_keys,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_information_t *internal_file_information = NULL;
+	static char *function                                          = "libagdb_diff_get_file_keys";
+	int file_index                                                 = 0;
+	int number_of_files                                            = 0;
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( *keys != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid keys value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume_information->files_array,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_files < 0 )
+	 || ( (size_t) number_of_files > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libagdb_diff_key_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of files value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_files > 0 )
+	{
+		*keys = (libagdb_diff_key_t *) libagdb_allocator_allocate(
+		                                sizeof( libagdb_diff_key_t ) * number_of_files );
+
+		if( *keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create keys.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_volume_information->files_array,
+		     file_index,
+		     (intptr_t **) &internal_file_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d information.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libagdb_diff_key_set(
+		     &( ( *keys )[ file_index ] ),
+		     internal_file_information->path,
+		     (size_t) internal_file_information->path_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file: %d key.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+	*number_of_keys = number_of_files;
+
+	return( 1 );
+
+on_error:
+	if( *keys != NULL )
+	{
+		libagdb_allocator_free(
+		 *keys );
+
+		*keys = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the keys of the sources
+ * The sources are keyed by prefetch hash and executable filename
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_get_source_keys(
+     libcdata_array_t *sources_array,
+     libagdb_diff_key_t **keys,
+     int *number_of_keys,
+     libcerror_error_t **error )
+{
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	static char *function                                              = "libagdb_diff_get_source_keys";
+	int number_of_sources                                              = 0;
+	int source_index                                                   = 0;
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( *keys != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid keys value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_sources < 0 )
+	 || ( (size_t) number_of_sources > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libagdb_diff_key_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sources value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sources > 0 )
+	{
+		*keys = (libagdb_diff_key_t *) libagdb_allocator_allocate(
+		                                sizeof( libagdb_diff_key_t ) * number_of_sources );
+
+		if( *keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create keys.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     sources_array,
+		     source_index,
+		     (intptr_t **) &internal_source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d information.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		if( internal_source_information->executable_filename_size > 16 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid source: %d executable filename size value out of bounds.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		if( libagdb_diff_key_set(
+		     &( ( *keys )[ source_index ] ),
+		     internal_source_information->executable_filename,
+		     (size_t) internal_source_information->executable_filename_size,
+		     internal_source_information->prefetch_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set source: %d key.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+	}
+	*number_of_keys = number_of_sources;
+
+	return( 1 );
+
+on_error:
+	if( *keys != NULL )
+	{
+		libagdb_allocator_free(
+		 *keys );
+
+		*keys = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the matches of the previous and current keys
+ * The matches are allocated with at least one entry each
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_diff_get_matches(
+     const libagdb_diff_key_t *previous_keys,
+     int number_of_previous_keys,
+     const libagdb_diff_key_t *current_keys,
+     int number_of_current_keys,
+     int **previous_matches,
+     int **current_matches,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_diff_get_matches";
+
+	if( ( number_of_previous_keys < 0 )
+	 || ( (size_t) number_of_previous_keys >= ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of previous keys value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_current_keys < 0 )
+	 || ( (size_t) number_of_current_keys >= ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of current keys value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous matches.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current matches.",
+		 function );
+
+		return( -1 );
+	}
+	*previous_matches = (int *) libagdb_allocator_allocate(
+	                             sizeof( int ) * ( number_of_previous_keys + 1 ) );
+
+	if( *previous_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create previous matches.",
+		 function );
+
+		goto on_error;
+	}
+	*current_matches = (int *) libagdb_allocator_allocate(
+	                            sizeof( int ) * ( number_of_current_keys + 1 ) );
+
+	if( *current_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current matches.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_diff_join_keys(
+	     previous_keys,
+	     number_of_previous_keys,
+	     current_keys,
+	     number_of_current_keys,
+	     *previous_matches,
+	     *current_matches,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to join keys.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *current_matches != NULL )
+	{
+		libagdb_allocator_free(
+		 *current_matches );
+
+		*current_matches = NULL;
+	}
+	if( *previous_matches != NULL )
+	{
+		libagdb_allocator_free(
+		 *previous_matches );
+
+		*previous_matches = NULL;
+	}
+	return( -1 );
+}
+
+/* Appends a difference
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_diff_append_difference(
+     libagdb_internal_diff_t *internal_diff,
+     uint8_t type,
+     int previous_volume_index,
+     int previous_entry_index,
+     int current_volume_index,
+     int current_entry_index,
+     uint32_t previous_number_of_entries,
+     uint32_t current_number_of_entries,
+     libcerror_error_t **error )
+{
+	libagdb_difference_t *difference  = NULL;
+	libagdb_difference_t *differences = NULL;
+	static char *function             = "libagdb_internal_diff_append_difference";
+	int maximum_number_of_differences = 0;
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_diff->number_of_differences >= internal_diff->maximum_number_of_differences )
+	{
+		maximum_number_of_differences = internal_diff->maximum_number_of_differences;
+
+		if( maximum_number_of_differences == 0 )
+		{
+			maximum_number_of_differences = 64;
+		}
+		else if( (size_t) maximum_number_of_differences < ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libagdb_difference_t ) ) ) )
+		{
+			maximum_number_of_differences *= 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of differences value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		differences = (libagdb_difference_t *) libagdb_allocator_reallocate(
+		                                        internal_diff->differences,
+		                                        sizeof( libagdb_difference_t ) * maximum_number_of_differences );
+
+		if( differences == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize differences.",
+			 function );
+
+			return( -1 );
+		}
+		internal_diff->differences                   = differences;
+		internal_diff->maximum_number_of_differences = maximum_number_of_differences;
+	}
+	difference = &( internal_diff->differences[ internal_diff->number_of_differences ] );
+
+	difference->previous_volume_index      = previous_volume_index;
+	difference->previous_entry_index       = previous_entry_index;
+	difference->current_volume_index       = current_volume_index;
+	difference->current_entry_index        = current_entry_index;
+	difference->previous_number_of_entries = previous_number_of_entries;
+	difference->current_number_of_entries  = current_number_of_entries;
+	difference->type                       = type;
+
+	internal_diff->number_of_differences += 1;
+
+	return( 1 );
+}
+
+/* Compares the files of a previous and a current volume
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_diff_compare_volume_files(
+     libagdb_internal_diff_t *internal_diff,
+     libagdb_internal_volume_information_t *previous_volume_information,
+     int previous_volume_index,
+     libagdb_internal_volume_information_t *current_volume_information,
+     int current_volume_index,
+     libcerror_error_t **error )
+{
+	libagdb_diff_key_t *current_keys                               = NULL;
+	libagdb_diff_key_t *previous_keys                              = NULL;
+	libagdb_internal_file_information_t *current_file_information  = NULL;
+	libagdb_internal_file_information_t *previous_file_information = NULL;
+	static char *function                                          = "libagdb_internal_diff_compare_volume_files";
+	int *current_matches                                           = NULL;
+	int *previous_matches                                          = NULL;
+	int file_index                                                 = 0;
+	int number_of_current_keys                                     = 0;
+	int number_of_previous_keys                                    = 0;
+
+	if( previous_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_diff_get_file_keys(
+	     previous_volume_information,
+	     &previous_keys,
+	     &number_of_previous_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve previous file keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_diff_get_file_keys(
+	     current_volume_information,
+	     &current_keys,
+	     &number_of_current_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current file keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_diff_get_matches(
+	     previous_keys,
+	     number_of_previous_keys,
+	     current_keys,
+	     number_of_current_keys,
+	     &previous_matches,
+	     &current_matches,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to match files.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_index = 0;
+	     file_index < number_of_previous_keys;
+	     file_index++ )
+	{
+		if( previous_matches[ file_index ] != -1 )
+		{
+			continue;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     previous_volume_information->files_array,
+		     file_index,
+		     (intptr_t **) &previous_file_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous file: %d information.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libagdb_internal_diff_append_difference(
+		     internal_diff,
+		     LIBAGDB_DIFFERENCE_TYPE_FILE_REMOVED,
+		     previous_volume_index,
+		     file_index,
+		     current_volume_index,
+		     -1,
+		     previous_file_information->number_of_entries,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append removed file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+	for( file_index = 0;
+	     file_index < number_of_current_keys;
+	     file_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     current_volume_information->files_array,
+		     file_index,
+		     (intptr_t **) &current_file_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current file: %d information.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( current_matches[ file_index ] == -1 )
+		{
+			if( libagdb_internal_diff_append_difference(
+			     internal_diff,
+			     LIBAGDB_DIFFERENCE_TYPE_FILE_ADDED,
+			     previous_volume_index,
+			     -1,
+			     current_volume_index,
+			     file_index,
+			     0,
+			     current_file_information->number_of_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append added file: %d.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     previous_volume_information->files_array,
+		     current_matches[ file_index ],
+		     (intptr_t **) &previous_file_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous file: %d information.",
+			 function,
+			 current_matches[ file_index ] );
+
+			goto on_error;
+		}
+		if( previous_file_information->number_of_entries == current_file_information->number_of_entries )
+		{
+			continue;
+		}
+		if( libagdb_internal_diff_append_difference(
+		     internal_diff,
+		     LIBAGDB_DIFFERENCE_TYPE_FILE_CHANGED,
+		     previous_volume_index,
+		     current_matches[ file_index ],
+		     current_volume_index,
+		     file_index,
+		     previous_file_information->number_of_entries,
+		     current_file_information->number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append changed file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+	libagdb_allocator_free(
+	 current_matches );
+
+	libagdb_allocator_free(
+	 previous_matches );
+
+	if( current_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 current_keys );
+	}
+	if( previous_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 previous_keys );
+	}
+	return( 1 );
+
+on_error:
+	if( current_matches != NULL )
+	{
+		libagdb_allocator_free(
+		 current_matches );
+	}
+	if( previous_matches != NULL )
+	{
+		libagdb_allocator_free(
+		 previous_matches );
+	}
+	if( current_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 current_keys );
+	}
+	if( previous_keys != NULL )
+	{
+		libagdb_allocator_free(
+		 previous_keys );
+	}
+	return( -1 );
+}
+
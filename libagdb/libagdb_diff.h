@@ -0,0 +1,173 @@
+/*
+ * Snapshot diff functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_DIFF_H )
+#define _LIBAGDB_DIFF_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_extern.h"
+#include "libagdb_libcdata.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_types.h"
+#include "libagdb_volume_information.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_diff_key libagdb_diff_key_t;
+
+struct libagdb_diff_key
+{
+	/* The key data
+	 */
+	const uint8_t *data;
+
+	/* The key data size
+	 */
+	size_t data_size;
+
+	/* The key value, such as a serial number or prefetch hash
+	 */
+	uint32_t value;
+
+	/* The hash value of the key data and value
+	 */
+	uint32_t hash_value;
+};
+
+typedef struct libagdb_internal_diff libagdb_internal_diff_t;
+
+struct libagdb_internal_diff
+{
+	/* The differences
+	 */
+	libagdb_difference_t *differences;
+
+	/* The number of differences
+	 */
+	int number_of_differences;
+
+	/* The maximum number of differences that fit in the differences
+	 */
+	int maximum_number_of_differences;
+};
+
+LIBAGDB_EXTERN \
+int libagdb_diff_initialize(
+     libagdb_diff_t **diff,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_diff_free(
+     libagdb_diff_t **diff,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_diff_compare_files(
+     libagdb_diff_t *diff,
+     libagdb_file_t *previous_file,
+     libagdb_file_t *current_file,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_diff_get_number_of_differences(
+     libagdb_diff_t *diff,
+     int *number_of_differences,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_diff_get_difference(
+     libagdb_diff_t *diff,
+     int difference_index,
+     libagdb_difference_t *difference,
+     libcerror_error_t **error );
+
+int libagdb_diff_key_set(
+     libagdb_diff_key_t *key,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t value,
+     libcerror_error_t **error );
+
+int libagdb_diff_join_keys(
+     const libagdb_diff_key_t *previous_keys,
+     int number_of_previous_keys,
+     const libagdb_diff_key_t *current_keys,
+     int number_of_current_keys,
+     int *previous_matches,
+     int *current_matches,
+     libcerror_error_t **error );
+
+int libagdb_diff_get_volume_keys(
+     libcdata_array_t *volumes_array,
+     libagdb_diff_key_t **keys,
+     int *number_of_keys,
+     libcerror_error_t **error );
+
+int libagdb_diff_get_file_keys(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     libagdb_diff_key_t **keys,
+     int *number_of_keys,
+     libcerror_error_t **error );
+
+int libagdb_diff_get_source_keys(
+     libcdata_array_t *sources_array,
+     libagdb_diff_key_t **keys,
+     int *number_of_keys,
+     libcerror_error_t **error );
+
+int libagdb_diff_get_matches(
+     const libagdb_diff_key_t *previous_keys,
+     int number_of_previous_keys,
+     const libagdb_diff_key_t *current_keys,
+     int number_of_current_keys,
+     int **previous_matches,
+     int **current_matches,
+     libcerror_error_t **error );
+
+int libagdb_internal_diff_append_difference(
+     libagdb_internal_diff_t *internal_diff,
+     uint8_t type,
+     int previous_volume_index,
+     int previous_entry_index,
+     int current_volume_index,
+     int current_entry_index,
+     uint32_t previous_number_of_entries,
+     uint32_t current_number_of_entries,
+     libcerror_error_t **error );
+
+int libagdb_internal_diff_compare_volume_files(
+     libagdb_internal_diff_t *internal_diff,
+     libagdb_internal_volume_information_t *previous_volume_information,
+     int previous_volume_index,
+     libagdb_internal_volume_information_t *current_volume_information,
+     int current_volume_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_DIFF_H ) */
+
@@ -25,9 +25,12 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libagdb_allocator.h"
+#include "libagdb_cache.h"
 #include "libagdb_compressed_block.h"
 #include "libagdb_compressed_blocks_stream.h"
 #include "libagdb_compressed_file_header.h"
+#include "libagdb_content_fingerprint.h"
 #include "libagdb_debug.h"
 #include "libagdb_definitions.h"
 #include "libagdb_io_handle.h"
@@ -39,7 +42,10 @@
 #include "libagdb_libcnotify.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_memory_map.h"
 #include "libagdb_source_information.h"
+#include "libagdb_trace.h"
+#include "libagdb_volume_index.h"
 #include "libagdb_volume_information.h"
 
 /* Creates a file
@@ -75,7 +81,7 @@ int libagdb_file_initialize(
 
 		return( -1 );
 	}
-	internal_file = memory_allocate_structure(
+	internal_file = libagdb_allocator_allocate_structure(
 	                 libagdb_internal_file_t );
 
 	if( internal_file == NULL )
@@ -101,7 +107,7 @@ int libagdb_file_initialize(
 		 "%s: unable to clear file.",
 		 function );
 
-		memory_free(
+		libagdb_allocator_free(
 		 internal_file );
 
 		return( -1 );
@@ -147,6 +153,21 @@ int libagdb_file_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*file = (libagdb_file_t *) internal_file;
 
 	return( 1 );
@@ -154,6 +175,12 @@ int libagdb_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
+		if( internal_file->io_handle != NULL )
+		{
+			libagdb_io_handle_free(
+			 &( internal_file->io_handle ),
+			 NULL );
+		}
 		if( internal_file->sources_array != NULL )
 		{
 			libcdata_array_free(
@@ -168,7 +195,7 @@ on_error:
 			 NULL,
 			 NULL );
 		}
-		memory_free(
+		libagdb_allocator_free(
 		 internal_file );
 	}
 	return( -1 );
@@ -200,7 +227,8 @@ int libagdb_file_free(
 	{
 		internal_file = (libagdb_internal_file_t *) *file;
 
-		if( internal_file->file_io_handle != NULL )
+		if( ( internal_file->file_io_handle != NULL )
+		 || ( internal_file->memory_data_is_open != 0 ) )
 		{
 			if( libagdb_file_close(
 			     *file,
@@ -218,6 +246,40 @@ int libagdb_file_free(
 		}
 		*file = NULL;
 
+		/* The compressed blocks list and cache can be retained by libagdb_file_reset
+		 */
+		if( internal_file->compressed_blocks_list != NULL )
+		{
+			if( libfdata_list_free(
+			     &( internal_file->compressed_blocks_list ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compressed blocks list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file->compressed_blocks_cache != NULL )
+		{
+			if( libfcache_cache_free(
+			     &( internal_file->compressed_blocks_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compressed blocks cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libcdata_array_free(
 		     &( internal_file->volumes_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
@@ -259,7 +321,22 @@ int libagdb_file_free(
 
 			result = -1;
 		}
-		memory_free(
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		libagdb_allocator_free(
 		 internal_file );
 	}
 	return( result );
@@ -304,19 +381,16 @@ int libagdb_file_signal_abort(
 	return( 1 );
 }
 
-/* Opens a file
+/* Retrieves the validation level
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_open(
+int libagdb_file_get_validation_level(
      libagdb_file_t *file,
-     const char *filename,
-     int access_flags,
+     int *validation_level,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle       = NULL;
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_open";
-	size_t filename_length                 = 0;
+	static char *function                  = "libagdb_file_get_validation_level";
 
 	if( file == NULL )
 	{
@@ -331,132 +405,198 @@ int libagdb_file_open(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( validation_level == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid validation level.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) == 0 ) )
+	*validation_level = internal_file->io_handle->validation_level;
+
+	return( 1 );
+}
+
+/* Sets the validation level
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_set_validation_level(
+     libagdb_file_t *file,
+     int validation_level,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_set_validation_level";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) != 0 )
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->memory_data_is_open != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	if( ( validation_level != LIBAGDB_VALIDATION_LEVEL_NONE )
+	 && ( validation_level != LIBAGDB_VALIDATION_LEVEL_FAST )
+	 && ( validation_level != LIBAGDB_VALIDATION_LEVEL_STRICT ) )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported validation level.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-	filename_length = narrow_string_length(
-	                   filename );
+	internal_file->io_handle->validation_level = validation_level;
 
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Sets the trace callbacks
+ * The begin callback is called before and the end callback after a phase, where
+ * trace_phase contains a LIBAGDB_TRACE_PHASES value. Use NULL to disable a callback
+ * The callbacks are called with the file, hence different files can be traced concurrently
+ * The callbacks are retained when the file is closed or reset
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_set_trace_callbacks(
+     libagdb_file_t *file,
+     void (*begin_callback)(
+            intptr_t *callback_data,
+            libagdb_file_t *file,
+            int trace_phase,
+            uint32_t trace_index,
+            uint8_t file_type,
+            off64_t offset,
+            size64_t size ),
+     void (*end_callback)(
+            intptr_t *callback_data,
+            libagdb_file_t *file,
+            int trace_phase,
+            uint32_t trace_index,
+            int result,
+            size64_t size ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_set_trace_callbacks";
+
+	if( file == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libagdb_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle_created_in_library = 1;
-
-	return( 1 );
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->memory_data_is_open != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
+		 function );
 
-on_error:
-	if( file_io_handle != NULL )
+		return( -1 );
+	}
+	if( libagdb_trace_callbacks_set(
+	     &( internal_file->io_handle->trace_callbacks ),
+	     file,
+	     begin_callback,
+	     end_callback,
+	     callback_data,
+	     error ) != 1 )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace callbacks.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
 /* Opens a file
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_open_wide(
+int libagdb_file_open(
      libagdb_file_t *file,
-     const wchar_t *filename,
+     const char *filename,
      int access_flags,
      libcerror_error_t **error )
 {
 	libbfio_handle_t *file_io_handle       = NULL;
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_open_wide";
+	static char *function                  = "libagdb_file_open";
 	size_t filename_length                 = 0;
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -471,6 +611,29 @@ int libagdb_file_open_wide(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
+	if( internal_file->memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->memory_data_is_open != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
+		 function );
+
+		return( -1 );
+	}
 	if( filename == NULL )
 	{
 		libcerror_error_set(
@@ -505,45 +668,113 @@ int libagdb_file_open_wide(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+	/* The file is memory mapped if possible, in which case the data is read
+	 * directly from the memory map and no file IO handle is opened
+	 */
+	if( libagdb_memory_map_initialize(
+	     &( internal_file->memory_map ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 "%s: unable to create memory map.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	result = libagdb_memory_map_open(
+	          internal_file->memory_map,
+	          filename,
+	          error );
+
+	if( result == -1 )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open memory map.",
+		 function );
 
 		goto on_error;
 	}
-#endif
-	filename_length = wide_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+	else if( result != 0 )
 	{
-                libcerror_error_set(
+		if( libagdb_file_open_memory(
+		     file,
+		     internal_file->memory_map->data,
+		     (size_t) internal_file->memory_map->data_size,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	/* If memory mapping is not supported the data is read using a file IO handle
+	 */
+	if( libagdb_memory_map_free(
+	     &( internal_file->memory_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
                  error,
                  LIBCERROR_ERROR_DOMAIN_RUNTIME,
                  LIBCERROR_RUNTIME_ERROR_SET_FAILED,
@@ -562,7 +793,7 @@ int libagdb_file_open_wide(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
+		 "%s: unable to open file: %s.",
 		 function,
 		 filename );
 
@@ -573,6 +804,18 @@ int libagdb_file_open_wide(
 	return( 1 );
 
 on_error:
+	if( internal_file->memory_map != NULL )
+	{
+		libagdb_io_handle_set_mapped_data(
+		 internal_file->io_handle,
+		 NULL,
+		 0,
+		 NULL );
+
+		libagdb_memory_map_free(
+		 &( internal_file->memory_map ),
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -582,21 +825,22 @@ on_error:
 	return( -1 );
 }
 
-#endif
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Opens a file using a Basic File IO (bfio) handle
+/* Opens a file
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_open_file_io_handle(
+int libagdb_file_open_wide(
      libagdb_file_t *file,
-     libbfio_handle_t *file_io_handle,
+     const wchar_t *filename,
      int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle       = NULL;
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_open_file_io_handle";
-	int bfio_access_flags                  = 0;
-	int file_io_handle_is_open             = 0;
+	static char *function                  = "libagdb_file_open_wide";
+	size_t filename_length                 = 0;
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -611,24 +855,36 @@ int libagdb_file_open_file_io_handle(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
-	if( internal_file->file_io_handle != NULL )
+	if( internal_file->memory_map != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file IO handle already set.",
+		 "%s: invalid file - memory map value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->memory_data_is_open != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
@@ -656,87 +912,178 @@ int libagdb_file_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) != 0 )
+	/* The file is memory mapped if possible, in which case the data is read
+	 * directly from the memory map and no file IO handle is opened
+	 */
+	if( libagdb_memory_map_initialize(
+	     &( internal_file->memory_map ),
+	     error ) != 1 )
 	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	internal_file->file_io_handle = file_io_handle;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory map.",
+		 function );
 
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          internal_file->file_io_handle,
-	                          error );
+		goto on_error;
+	}
+	result = libagdb_memory_map_open_wide(
+	          internal_file->memory_map,
+	          filename,
+	          error );
 
-	if( file_io_handle_is_open == -1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 "%s: unable to open memory map.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+	else if( result != 0 )
 	{
-		if( libbfio_handle_open(
-		     internal_file->file_io_handle,
-		     bfio_access_flags,
+		if( libagdb_file_open_memory(
+		     file,
+		     internal_file->memory_map->data,
+		     (size_t) internal_file->memory_map->data_size,
+		     access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+			 "%s: unable to open file: %ls.",
+			 function,
+			 filename );
 
 			goto on_error;
 		}
-		internal_file->file_io_handle_opened_in_library = 1;
+		return( 1 );
 	}
-	if( libagdb_file_open_read(
-	     internal_file,
+	/* If memory mapping is not supported the data is read using a file IO handle
+	 */
+	if( libagdb_memory_map_free(
+	     &( internal_file->memory_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_open_file_io_handle(
+	     file,
 	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file handle.",
-		 function );
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
 
 		goto on_error;
 	}
-	internal_file->file_io_handle = file_io_handle;
+	internal_file->file_io_handle_created_in_library = 1;
 
 	return( 1 );
 
 on_error:
-	if( ( file_io_handle_is_open == 0 )
-	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
+	if( internal_file->memory_map != NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libagdb_io_handle_set_mapped_data(
+		 internal_file->io_handle,
+		 NULL,
+		 0,
+		 NULL );
 
-		internal_file->file_io_handle_opened_in_library = 0;
+		libagdb_memory_map_free(
+		 &( internal_file->memory_map ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
-	internal_file->file_io_handle = NULL;
-
 	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+#endif
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
  */
-int libagdb_file_close(
+int libagdb_file_open_file_io_handle(
      libagdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
      libcerror_error_t **error )
 {
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_close";
+	static char *function                  = "libagdb_file_open_file_io_handle";
+	int bfio_access_flags                  = 0;
+	int file_io_handle_is_open             = 0;
 	int result                             = 0;
 
 	if( file == NULL )
@@ -752,192 +1099,156 @@ int libagdb_file_close(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( file_io_handle == NULL )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libagdb_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	if( ( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
-	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
-	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_created_in_library = 0;
+		return( -1 );
 	}
-	internal_file->file_io_handle = NULL;
-
-	if( libagdb_io_handle_clear(
-	     internal_file->io_handle,
-	     error ) != 1 )
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( internal_file->compressed_blocks_list != NULL )
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) != 0 )
 	{
-		if( libfdata_list_free(
-		     &( internal_file->compressed_blocks_list ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed blocks list.",
-			 function );
-
-			result = -1;
-		}
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
-	if( internal_file->compressed_blocks_cache != NULL )
+	internal_file->file_io_handle = file_io_handle;
+
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          internal_file->file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
 	{
-		if( libfcache_cache_free(
-		     &( internal_file->compressed_blocks_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed blocks cache.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
 
-			result = -1;
-		}
+		goto on_error;
 	}
-	if( internal_file->uncompressed_data_stream != NULL )
+	else if( file_io_handle_is_open == 0 )
 	{
-		if( libfdata_stream_free(
-		     &( internal_file->uncompressed_data_stream ),
+		if( libbfio_handle_open(
+		     internal_file->file_io_handle,
+		     bfio_access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free uncompressed data strea,.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
+		internal_file->file_io_handle_opened_in_library = 1;
 	}
-	if( libcdata_array_resize(
-	     internal_file->volumes_array,
-	     0,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
-	     error ) != 1 )
+	libagdb_trace_begin(
+	 &( internal_file->io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_OPEN_READ,
+	 0,
+	 0,
+	 0,
+	 0 );
+
+	result = libagdb_file_open_read(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	libagdb_trace_end(
+	 &( internal_file->io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_OPEN_READ,
+	 0,
+	 result,
+	 internal_file->io_handle->uncompressed_data_size );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize volumes array.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_array_resize(
-	     internal_file->sources_array,
-	     0,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_source_information_free,
-	     error ) != 1 )
+	internal_file->file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( ( file_io_handle_is_open == 0 )
+	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize sources array.",
-		 function );
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
 
-		result = -1;
+		internal_file->file_io_handle_opened_in_library = 0;
 	}
-	return( result );
+	internal_file->file_io_handle = NULL;
+
+	return( -1 );
 }
 
-/* Opens a file for reading
+/* Opens a file from memory data
+ * The data is not copied and must remain available until the file is closed
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_open_read(
-     libagdb_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+int libagdb_file_open_memory(
+     libagdb_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
      libcerror_error_t **error )
 {
-	uint8_t alignment_padding_data[ 8 ];
-
-	libagdb_compressed_file_header_t *compressed_file_header = NULL;
-	libagdb_file_header_t *file_header                       = NULL;
-	libagdb_source_information_t *source_information         = NULL;
-	libagdb_volume_information_t *volume_information         = NULL;
-	static char *function                                    = "libagdb_file_open_read";
-	ssize64_t read_count                                     = 0;
-	size_t alignment_padding_size                            = 0;
-	off64_t file_offset                                      = 0;
-	uint32_t source_index                                    = 0;
-	uint32_t volume_index                                    = 0;
-	int entry_index                                          = 0;
-	int segment_index                                        = 0;
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_open_memory";
+	int result                             = 0;
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -948,519 +1259,4132 @@ int libagdb_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->memory_data_is_open != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_blocks_list != NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed blocks list value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_blocks_cache != NULL )
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed blocks cache value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle->abort != 0 )
+	if( ( ( access_flags & LIBAGDB_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		internal_file->io_handle->abort = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( access_flags & LIBAGDB_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libagdb_compressed_file_header_initialize(
-	     &compressed_file_header,
+	/* The data is read directly from memory, hence no file IO handle is needed
+	 */
+	if( libagdb_io_handle_set_mapped_data(
+	     internal_file->io_handle,
+	     data,
+	     (size64_t) data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create compressed file header.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set mapped data in IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( libagdb_compressed_file_header_read_file_io_handle(
-	     compressed_file_header,
-	     file_io_handle,
-	     error ) != 1 )
+	internal_file->memory_data_is_open = 1;
+
+	libagdb_trace_begin(
+	 &( internal_file->io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_OPEN_READ,
+	 0,
+	 0,
+	 0,
+	 (size64_t) data_size );
+
+	result = libagdb_file_open_read(
+	          internal_file,
+	          NULL,
+	          error );
+
+	libagdb_trace_end(
+	 &( internal_file->io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_OPEN_READ,
+	 0,
+	 result,
+	 internal_file->io_handle->uncompressed_data_size );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read compressed file header.",
+		 "%s: unable to read from memory data.",
 		 function );
 
 		goto on_error;
 	}
-	internal_file->io_handle->file_type               = compressed_file_header->file_type;
-	internal_file->io_handle->file_size               = compressed_file_header->file_size;
-	internal_file->io_handle->uncompressed_block_size = compressed_file_header->uncompressed_block_size;
-	internal_file->io_handle->uncompressed_data_size  = compressed_file_header->uncompressed_data_size;
+	return( 1 );
 
-	if( libagdb_compressed_file_header_free(
-	     &compressed_file_header,
-	     error ) != 1 )
+on_error:
+	libagdb_io_handle_set_mapped_data(
+	 internal_file->io_handle,
+	 NULL,
+	 0,
+	 NULL );
+
+	internal_file->memory_data_is_open = 0;
+
+	return( -1 );
+}
+
+/* Writes the parsed information of an open file to a cache file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_write_cache(
+     libagdb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libagdb_file_write_cache";
+	size_t filename_length           = 0;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free compressed file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_file->io_handle->file_type != LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	if( filename == NULL )
 	{
-		if( libfdata_list_initialize(
-		     &( internal_file->compressed_blocks_list ),
-		     (intptr_t *) internal_file->io_handle,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_write_cache_file_io_handle(
+	     file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write cache file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the parsed information of an open file to a cache file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_write_cache_wide(
+     libagdb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libagdb_file_write_cache_wide";
+	size_t filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_write_cache_file_io_handle(
+	     file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write cache file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the parsed information of an open file to a cache file using a Basic File IO (bfio) handle
+ * The file IO handle is opened for writing if it is not already open
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_write_cache_file_io_handle(
+     libagdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	uint8_t *cache_data                    = NULL;
+	static char *function                  = "libagdb_file_write_cache_file_io_handle";
+	size_t cache_data_size                 = 0;
+	ssize_t write_count                    = 0;
+	int file_io_handle_is_open             = 0;
+	int file_io_handle_opened_in_library   = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( ( internal_file->file_io_handle == NULL )
+	 && ( internal_file->memory_data_is_open == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_cache_get_data_size(
+	     internal_file->volumes_array,
+	     internal_file->sources_array,
+	     &cache_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache data size.",
+		 function );
+
+		goto on_error;
+	}
+	cache_data = (uint8_t *) libagdb_allocator_allocate(
+	                          cache_data_size );
+
+	if( cache_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_cache_write_data(
+	     internal_file->io_handle,
+	     internal_file->volumes_array,
+	     internal_file->sources_array,
+	     cache_data,
+	     cache_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write cache data.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               cache_data,
+	               cache_data_size,
+	               error );
+
+	if( write_count != (ssize_t) cache_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	libagdb_allocator_free(
+	 cache_data );
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( cache_data != NULL )
+	{
+		libagdb_allocator_free(
+		 cache_data );
+	}
+	return( -1 );
+}
+
+/* Opens a cache file
+ * The cache file is memory mapped if possible, if not the cache data is read into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_open_cache(
+     libagdb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_open_cache";
+	size_t filename_length                 = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->memory_data_is_open != 0 )
+	 || ( internal_file->memory_map != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_memory_map_initialize(
+	     &( internal_file->memory_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	result = libagdb_memory_map_open(
+	          internal_file->memory_map,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open memory map.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libagdb_internal_file_open_cache_data(
+		     internal_file,
+		     internal_file->memory_map->data,
+		     internal_file->memory_map->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open cache file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libagdb_memory_map_free(
+	     &( internal_file->memory_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_open_cache_file_io_handle(
+	     file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open cache file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->memory_data_is_open != 0 )
+	{
+		libagdb_internal_file_close(
+		 internal_file,
+		 0,
+		 NULL );
+	}
+	if( internal_file->memory_map != NULL )
+	{
+		libagdb_memory_map_free(
+		 &( internal_file->memory_map ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a cache file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_open_cache_wide(
+     libagdb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libagdb_file_open_cache_wide";
+	size_t filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_open_cache_file_io_handle(
+	     file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open cache file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a cache file using a Basic File IO (bfio) handle
+ * The cache data is read into memory, hence the file IO handle is not needed after open
+ * The file IO handle is opened for reading if it is not already open
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_open_cache_file_io_handle(
+     libagdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_open_cache_file_io_handle";
+	size64_t cache_file_size               = 0;
+	ssize_t read_count                     = 0;
+	int file_io_handle_is_open             = 0;
+	int file_io_handle_opened_in_library   = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->memory_data_is_open != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->cache_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - cache data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &cache_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( cache_file_size == 0 )
+	 || ( cache_file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->cache_data = (uint8_t *) libagdb_allocator_allocate(
+	                                         (size_t) cache_file_size );
+
+	if( internal_file->cache_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              internal_file->cache_data,
+	              (size_t) cache_file_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) cache_file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libagdb_internal_file_open_cache_data(
+	     internal_file,
+	     internal_file->cache_data,
+	     (size_t) cache_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open cache data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( internal_file->cache_data != NULL )
+	{
+		libagdb_allocator_free(
+		 internal_file->cache_data );
+
+		internal_file->cache_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens cache data
+ * The volume device paths and file paths reference the cache data
+ * hence the data must remain available until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_open_cache_memory(
+     libagdb_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_open_cache_memory";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( ( internal_file->file_io_handle != NULL )
+	 || ( internal_file->memory_data_is_open != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_file_open_cache_data(
+	     internal_file,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open cache data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens cache data
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_open_cache_data(
+     libagdb_internal_file_t *internal_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_file_open_cache_data";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_cache_read_data(
+	     internal_file->io_handle,
+	     internal_file->volumes_array,
+	     internal_file->sources_array,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_internal_file_read_volume_index(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cache data is read directly from memory, hence no file IO handle is needed
+	 */
+	internal_file->memory_data_is_open = 1;
+
+	return( 1 );
+
+on_error:
+	libcdata_array_resize(
+	 internal_file->volumes_array,
+	 0,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
+	 NULL );
+
+	libcdata_array_resize(
+	 internal_file->sources_array,
+	 0,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_source_information_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libagdb_file_close(
+     libagdb_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_file_close";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	return( libagdb_internal_file_close(
+	         (libagdb_internal_file_t *) file,
+	         0,
+	         error ) );
+}
+
+/* Resets a file so it can be reused to open another file
+ * The file is closed if open. The volumes and sources arrays, the compressed blocks
+ * list and the compressed blocks cache are emptied but retained, so that a subsequent
+ * open reuses them instead of creating them anew. The validation level is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_reset(
+     libagdb_file_t *file,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_reset";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( ( internal_file->file_io_handle == NULL )
+	 && ( internal_file->memory_data_is_open == 0 ) )
+	{
+		return( 1 );
+	}
+	if( libagdb_internal_file_close(
+	     internal_file,
+	     1,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases the IO resources of an open file
+ * All volume, file and source information is read when the file is opened, after which
+ * the compressed blocks list, the compressed blocks cache and the uncompressed data stream
+ * are no longer needed. If LIBAGDB_RELEASE_FLAG_CLOSE_FILE_IO_HANDLE is set the file IO handle
+ * is closed as well, if it was opened by the library. The file remains open and its information
+ * remains available until the file is closed. A memory mapping is retained since information
+ * can reference the mapped data
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_release_io_resources(
+     libagdb_file_t *file,
+     uint8_t release_flags,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_release_io_resources";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( ( release_flags & ~( LIBAGDB_RELEASE_FLAG_CLOSE_FILE_IO_HANDLE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported release flags: 0x%02" PRIx8 ".",
+		 function,
+		 release_flags );
+
+		return( -1 );
+	}
+	if( ( internal_file->file_io_handle == NULL )
+	 && ( internal_file->memory_data_is_open == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - file not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data_stream != NULL )
+	{
+		if( libfdata_stream_free(
+		     &( internal_file->uncompressed_data_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free uncompressed data stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_file->compressed_blocks_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		if( libfdata_list_free(
+		     &( internal_file->compressed_blocks_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The file IO handle itself is retained until close so the file remains open
+	 */
+	if( ( ( release_flags & LIBAGDB_RELEASE_FLAG_CLOSE_FILE_IO_HANDLE ) != 0 )
+	 && ( internal_file->file_io_handle_opened_in_library != 0 ) )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	return( 1 );
+}
+
+/* Closes a file
+ * If retain_containers is set the compressed blocks list and cache are emptied instead of freed
+ * Returns 0 if successful or -1 on error
+ */
+int libagdb_internal_file_close(
+     libagdb_internal_file_t *internal_file,
+     uint8_t retain_containers,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_file_close";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->file_io_handle == NULL )
+	 && ( internal_file->memory_data_is_open == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libagdb_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	internal_file->file_io_handle      = NULL;
+	internal_file->memory_data_is_open = 0;
+
+	if( internal_file->memory_map != NULL )
+	{
+		if( libagdb_memory_map_free(
+		     &( internal_file->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libagdb_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		if( retain_containers != 0 )
+		{
+			if( libfdata_list_empty(
+			     internal_file->compressed_blocks_list,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to empty compressed blocks list.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( libfdata_list_free(
+		          &( internal_file->compressed_blocks_list ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		if( retain_containers != 0 )
+		{
+			if( libfcache_cache_empty(
+			     internal_file->compressed_blocks_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to empty compressed blocks cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( libfcache_cache_free(
+		          &( internal_file->compressed_blocks_cache ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->uncompressed_data_stream != NULL )
+	{
+		if( libfdata_stream_free(
+		     &( internal_file->uncompressed_data_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free uncompressed data strea,.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdata_array_resize(
+	     internal_file->volumes_array,
+	     0,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize volumes array.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->volume_index != NULL )
+	{
+		if( libagdb_volume_index_free(
+		     &( internal_file->volume_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->source_index != NULL )
+	{
+		if( libagdb_source_index_free(
+		     &( internal_file->source_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free source index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdata_array_resize(
+	     internal_file->sources_array,
+	     0,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_source_information_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sources array.",
+		 function );
+
+		result = -1;
+	}
+	/* The cache data is freed after the volumes and sources that reference it
+	 */
+	if( internal_file->cache_data != NULL )
+	{
+		libagdb_allocator_free(
+		 internal_file->cache_data );
+
+		internal_file->cache_data = NULL;
+	}
+	internal_file->content_fingerprint_is_set = 0;
+
+	return( result );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_open_read(
+     libagdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t alignment_padding_data[ 8 ];
+
+	libagdb_compressed_file_header_t *compressed_file_header = NULL;
+	libagdb_file_header_t *file_header                       = NULL;
+	libagdb_source_information_t *source_information         = NULL;
+	libagdb_volume_information_t *volume_information         = NULL;
+	const uint8_t *mapped_data                               = NULL;
+	static char *function                                    = "libagdb_file_open_read";
+	ssize64_t read_count                                     = 0;
+	size_t alignment_padding_size                            = 0;
+	off64_t file_offset                                      = 0;
+	uint32_t source_index                                    = 0;
+	uint32_t volume_index                                    = 0;
+	int entry_index                                          = 0;
+	int result                                               = 0;
+	int segment_index                                        = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - uncompressed data stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->abort != 0 )
+	{
+		internal_file->io_handle->abort = 0;
+	}
+	if( internal_file->memory_map != NULL )
+	{
+		if( libagdb_io_handle_set_mapped_data(
+		     internal_file->io_handle,
+		     internal_file->memory_map->data,
+		     internal_file->memory_map->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set mapped data in IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libagdb_compressed_file_header_initialize(
+	     &compressed_file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed file header.",
+		 function );
+
+		goto on_error;
+	}
+	libagdb_trace_begin(
+	 &( internal_file->io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_FILE_HEADER,
+	 0,
+	 0,
+	 0,
+	 12 );
+
+	result = libagdb_io_handle_get_mapped_data(
+	          internal_file->io_handle,
+	          0,
+	          12,
+	          &mapped_data,
+	          error );
+
+	if( result == 1 )
+	{
+		compressed_file_header->file_size = internal_file->io_handle->mapped_data_size;
+
+		result = libagdb_compressed_file_header_read_data(
+		          compressed_file_header,
+		          mapped_data,
+		          12,
+		          error );
+
+		internal_file->io_handle->statistics[ LIBAGDB_STATISTIC_MAPPED_BYTES_READ ] += 12;
+		internal_file->io_handle->statistics[ LIBAGDB_STATISTIC_MAPPED_READ_CALLS ] += 1;
+	}
+	else if( result == 0 )
+	{
+		/* The compressed file header is read with a single 12 byte read
+		 */
+		result = libagdb_compressed_file_header_read_file_io_handle(
+		          compressed_file_header,
+		          file_io_handle,
+		          error );
+
+		internal_file->io_handle->statistics[ LIBAGDB_STATISTIC_BYTES_READ ] += 12;
+		internal_file->io_handle->statistics[ LIBAGDB_STATISTIC_READ_CALLS ] += 1;
+	}
+
+	libagdb_trace_end(
+	 &( internal_file->io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_FILE_HEADER,
+	 0,
+	 result,
+	 12 );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed file header.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->file_type               = compressed_file_header->file_type;
+	internal_file->io_handle->file_size               = compressed_file_header->file_size;
+	internal_file->io_handle->uncompressed_block_size = compressed_file_header->uncompressed_block_size;
+	internal_file->io_handle->uncompressed_data_size  = compressed_file_header->uncompressed_data_size;
+
+	if( libagdb_compressed_file_header_free(
+	     &compressed_file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed file header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The content fingerprint is updated by the compressed blocks list
+	 * while the file is read
+	 */
+	if( libagdb_content_fingerprint_initialize(
+	     &( internal_file->io_handle->content_fingerprint ),
+	     (size64_t) internal_file->io_handle->uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create content fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->io_handle->file_type != LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	{
+		/* The compressed blocks list and cache are retained by libagdb_file_reset
+		 */
+		if( internal_file->compressed_blocks_list == NULL )
+		{
+			if( libfdata_list_initialize(
+			     &( internal_file->compressed_blocks_list ),
+			     (intptr_t *) internal_file->io_handle,
+			     NULL,
+			     NULL,
+			     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_compressed_block_read_element_data,
+			     NULL,
+			     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create compressed blocks list.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading compressed blocks:\n" );
+		}
+#endif
+		libagdb_trace_begin(
+		 &( internal_file->io_handle->trace_callbacks ),
+		 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCKS,
+		 0,
+		 internal_file->io_handle->file_type,
+		 12,
+		 (size64_t) internal_file->io_handle->file_size );
+
+		result = libagdb_io_handle_read_compressed_blocks(
+		          internal_file->io_handle,
+		          file_io_handle,
+		          internal_file->compressed_blocks_list,
+		          error );
+
+		libagdb_trace_end(
+		 &( internal_file->io_handle->trace_callbacks ),
+		 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCKS,
+		 0,
+		 result,
+		 (size64_t) internal_file->io_handle->file_size );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed blocks.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_file->compressed_blocks_cache == NULL )
+		{
+			if( libfcache_cache_initialize(
+			     &( internal_file->compressed_blocks_cache ),
+			     LIBAGDB_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create compressed blocks cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libagdb_compressed_blocks_stream_initialize(
+		     &( internal_file->uncompressed_data_stream ),
+		     internal_file->io_handle,
+		     internal_file->compressed_blocks_list,
+		     internal_file->compressed_blocks_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libfdata_stream_initialize(
+		     &( internal_file->uncompressed_data_stream ),
+		     (intptr_t *) internal_file->io_handle,
+		     NULL,
 		     NULL,
 		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_compressed_block_read_element_data,
+		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_io_handle_read_segment_data,
 		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libagdb_io_handle_seek_segment_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create uncompressed data stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_stream_append_segment(
+		     internal_file->uncompressed_data_stream,
+		     &segment_index,
+		     0,
+		     0,
+		     (size64_t) internal_file->io_handle->uncompressed_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append uncompressed data stream segment: 0.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libagdb_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	libagdb_trace_begin(
+	 &( internal_file->io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_FILE_HEADER,
+	 0,
+	 internal_file->io_handle->file_type,
+	 0,
+	 0 );
+
+	result = libagdb_file_header_read_stream(
+	          file_header,
+	          internal_file->io_handle,
+	          internal_file->uncompressed_data_stream,
+	          file_io_handle,
+	          error );
+
+	libagdb_trace_end(
+	 &( internal_file->io_handle->trace_callbacks ),
+	 LIBAGDB_TRACE_PHASE_FILE_HEADER,
+	 0,
+	 result,
+	 (size64_t) file_header->size );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->file_header_signature = file_header->signature;
+
+	/* The entry layouts are determined once instead of for every entry
+	 */
+	if( libagdb_io_handle_set_layouts(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry layouts in IO handle.",
+		 function );
+
+		goto on_error;
+	}
+
+	file_offset = (off64_t) file_header->size;
+
+	for( volume_index = 0;
+	     volume_index < file_header->number_of_volumes;
+	     volume_index++ )
+	{
+		alignment_padding_size = (size_t) ( file_offset % 8 );
+
+		if( alignment_padding_size != 0 )
+		{
+			alignment_padding_size = 8 - alignment_padding_size;
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: alignment padding size\t\t\t\t: %" PRIzd "\n",
+				 function,
+				 alignment_padding_size );
+			}
+#endif
+			if( internal_file->io_handle->validation_level == LIBAGDB_VALIDATION_LEVEL_STRICT )
+			{
+				read_count = libfdata_stream_read_buffer(
+				              internal_file->uncompressed_data_stream,
+				              (intptr_t *) internal_file->file_io_handle,
+				              alignment_padding_data,
+				              alignment_padding_size,
+				              0,
+				              error );
+
+				if( read_count != (ssize_t) alignment_padding_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read alignment padding data.",
+					 function );
+
+					goto on_error;
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: alignment padding data:\n",
+					 function );
+					libcnotify_print_data(
+					 alignment_padding_data,
+					 alignment_padding_size,
+					 0 );
+				}
+#endif
+				if( libagdb_io_handle_check_padding_data(
+				     alignment_padding_data,
+				     alignment_padding_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: invalid alignment padding data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				/* The alignment padding is skipped without reading it
+				 */
+				read_count = (ssize_t) alignment_padding_size;
+
+				if( libfdata_stream_seek_offset(
+				     internal_file->uncompressed_data_stream,
+				     file_offset + read_count,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek alignment padding.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			file_offset += read_count;
+		}
+		if( libagdb_volume_information_initialize(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create volume: %" PRIu32 " information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		internal_file->io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_ALLOCATIONS ] += 1;
+		internal_file->io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_SIZE ]        += sizeof( libagdb_internal_volume_information_t );
+
+		libagdb_trace_begin(
+		 &( internal_file->io_handle->trace_callbacks ),
+		 LIBAGDB_TRACE_PHASE_VOLUME_INFORMATION,
+		 volume_index,
+		 internal_file->io_handle->file_type,
+		 file_offset,
+		 (size64_t) internal_file->io_handle->volume_information_entry_size );
+
+		read_count = libagdb_internal_volume_information_read_file_io_handle(
+		              (libagdb_internal_volume_information_t *) volume_information,
+		              internal_file->io_handle,
+		              internal_file->uncompressed_data_stream,
+		              internal_file->file_io_handle,
+		              file_offset,
+		              volume_index,
+		              error );
+
+		libagdb_trace_end(
+		 &( internal_file->io_handle->trace_callbacks ),
+		 LIBAGDB_TRACE_PHASE_VOLUME_INFORMATION,
+		 volume_index,
+		 ( read_count == -1 ) ? -1 : 1,
+		 ( read_count == -1 ) ? 0 : (size64_t) read_count );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volume: %" PRIu32 " information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		file_offset += read_count;
+
+		if( libcdata_array_append_entry(
+		     internal_file->volumes_array,
+		     &entry_index,
+		     (intptr_t *) volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume: %" PRIu32 " information to array.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		volume_information = NULL;
+	}
+	for( source_index = 0;
+	     source_index < file_header->number_of_sources;
+	     source_index++ )
+	{
+		if( libagdb_source_information_initialize(
+		     &source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create source: %" PRIu32 " information.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		internal_file->io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_ALLOCATIONS ] += 1;
+		internal_file->io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_SIZE ]        += sizeof( libagdb_internal_source_information_t );
+
+		libagdb_trace_begin(
+		 &( internal_file->io_handle->trace_callbacks ),
+		 LIBAGDB_TRACE_PHASE_SOURCE_INFORMATION,
+		 source_index,
+		 internal_file->io_handle->file_type,
+		 file_offset,
+		 (size64_t) internal_file->io_handle->source_information_entry_size );
+
+		read_count = libagdb_source_information_read(
+		              (libagdb_internal_source_information_t *) source_information,
+		              internal_file->io_handle,
+		              internal_file->uncompressed_data_stream,
+		              internal_file->file_io_handle,
+		              source_index,
+		              file_offset,
+		              error );
+
+		libagdb_trace_end(
+		 &( internal_file->io_handle->trace_callbacks ),
+		 LIBAGDB_TRACE_PHASE_SOURCE_INFORMATION,
+		 source_index,
+		 ( read_count == -1 ) ? -1 : 1,
+		 ( read_count == -1 ) ? 0 : (size64_t) read_count );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read source: %" PRIu32 " information.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		file_offset += read_count;
+
+		if( libcdata_array_append_entry(
+		     internal_file->sources_array,
+		     &entry_index,
+		     (intptr_t *) source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source: %" PRIu32 " information to array.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		source_information = NULL;
+	}
+	if( libagdb_internal_file_read_volume_index(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_header_free(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file header.",
+		 function );
+
+		goto on_error;
+	}
+/* TODO remove use offset instead */
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		uint8_t trailing_data[ 128 ];
+
+		read_count = libfdata_stream_read_buffer(
+			      internal_file->uncompressed_data_stream,
+			      (intptr_t *) internal_file->file_io_handle,
+			      trailing_data,
+			      128,
+			      0,
+			      error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read trailing data.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count > 0 )
+		{
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 trailing_data,
+			 read_count,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+	}
+#endif
+	if( libagdb_internal_file_read_content_fingerprint(
+	     internal_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read content fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_content_fingerprint_free(
+	     &( internal_file->io_handle->content_fingerprint ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free content fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->io_handle->content_fingerprint != NULL )
+	{
+		libagdb_content_fingerprint_free(
+		 &( internal_file->io_handle->content_fingerprint ),
+		 NULL );
+	}
+	if( internal_file->volume_index != NULL )
+	{
+		libagdb_volume_index_free(
+		 &( internal_file->volume_index ),
+		 NULL );
+	}
+	if( source_information != NULL )
+	{
+		libagdb_internal_source_information_free(
+		 (libagdb_internal_source_information_t **) &source_information,
+		 NULL );
+	}
+	if( volume_information != NULL )
+	{
+		libagdb_internal_volume_information_free(
+		 (libagdb_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	/* The volumes and sources that were read can reference the mapped data
+	 * hence they are freed before the caller releases the memory map
+	 */
+	libcdata_array_empty(
+	 internal_file->volumes_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
+	 NULL );
+
+	libcdata_array_empty(
+	 internal_file->sources_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_source_information_free,
+	 NULL );
+
+	if( internal_file->uncompressed_data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &( internal_file->uncompressed_data_stream ),
+		 NULL );
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->compressed_blocks_cache ),
+		 NULL );
+	}
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &( internal_file->compressed_blocks_list ),
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libagdb_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	if( compressed_file_header != NULL )
+	{
+		libagdb_compressed_file_header_free(
+		 &compressed_file_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file type
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_file_type(
+     libagdb_file_t *file,
+     uint8_t *file_type,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_file_type";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	*file_type = internal_file->io_handle->file_type;
+
+	return( 1 );
+}
+
+/* Retrieves the uncompressed data size
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_uncompressed_data_size(
+     libagdb_file_t *file,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_uncompressed_data_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = internal_file->io_handle->uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the statistics
+ * The statistics are indexed by the LIBAGDB_STATISTICS definitions and are accumulated
+ * since the file was opened, the decompression time is in nano seconds
+ * Values beyond LIBAGDB_NUMBER_OF_STATISTICS are set to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_statistics(
+     libagdb_file_t *file,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_statistics";
+	int statistic_index                    = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_statistics <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of statistics value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( statistic_index = 0;
+	     statistic_index < number_of_statistics;
+	     statistic_index++ )
+	{
+		if( statistic_index < LIBAGDB_NUMBER_OF_STATISTICS )
+		{
+			statistics[ statistic_index ] = internal_file->io_handle->statistics[ statistic_index ];
+		}
+		else
+		{
+			statistics[ statistic_index ] = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the content fingerprint
+ * The fingerprint is a 128-bit non-cryptographic hash of the uncompressed data
+ * and is the same for files with the same content regardless of the compression format
+ * The fingerprint is calculated when the file is opened and is retained after
+ * the IO resources are released
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_content_fingerprint(
+     libagdb_file_t *file,
+     uint8_t *fingerprint,
+     size_t fingerprint_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_content_fingerprint";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( fingerprint_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid fingerprint size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( fingerprint_size < LIBAGDB_CONTENT_FINGERPRINT_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid fingerprint size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->content_fingerprint_is_set == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing content fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     fingerprint,
+	     internal_file->content_fingerprint,
+	     LIBAGDB_CONTENT_FINGERPRINT_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy content fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the content fingerprint
+ * The uncompressed data that was decompressed while reading the file has already
+ * been hashed by the compressed blocks list, only the remaining blocks are read
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_read_content_fingerprint(
+     libagdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *block_data         = NULL;
+	const uint8_t *mapped_data  = NULL;
+	static char *function       = "libagdb_internal_file_read_content_fingerprint";
+	size64_t data_size          = 0;
+	size_t read_size            = 0;
+	ssize_t read_count          = 0;
+	off64_t data_offset         = 0;
+	uint64_t block_number       = 0;
+	int result                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->content_fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - invalid IO handle - missing content fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing uncompressed data stream.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = (size64_t) internal_file->io_handle->uncompressed_data_size;
+
+	while( (size64_t) data_offset < data_size )
+	{
+		if( internal_file->io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		read_size = LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE;
+
+		if( read_size > (size_t) ( data_size - data_offset ) )
+		{
+			read_size = (size_t) ( data_size - data_offset );
+		}
+		result = libagdb_content_fingerprint_is_block_hashed(
+		          internal_file->io_handle->content_fingerprint,
+		          block_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if block: %" PRIu64 " was hashed.",
+			 function,
+			 block_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* The uncompressed data of an uncompressed file can be hashed
+			 * directly from the memory mapped file data
+			 */
+			if( internal_file->io_handle->file_type == LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+			{
+				result = libagdb_io_handle_get_mapped_data(
+				          internal_file->io_handle,
+				          data_offset,
+				          read_size,
+				          &mapped_data,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve mapped data of block: %" PRIu64 ".",
+					 function,
+					 block_number );
+
+					goto on_error;
+				}
+			}
+			if( result == 0 )
+			{
+				if( block_data == NULL )
+				{
+					block_data = (uint8_t *) libagdb_allocator_allocate(
+					                          LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE );
+
+					if( block_data == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to create block data.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				/* Reading a compressed block that is not cached hashes all the blocks it contains
+				 */
+				read_count = libfdata_stream_read_buffer_at_offset(
+				              internal_file->uncompressed_data_stream,
+				              (intptr_t *) file_io_handle,
+				              block_data,
+				              read_size,
+				              data_offset,
+				              0,
+				              error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read block: %" PRIu64 " data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 block_number,
+					 data_offset,
+					 data_offset );
+
+					goto on_error;
+				}
+				mapped_data = block_data;
+			}
+			if( libagdb_content_fingerprint_update(
+			     internal_file->io_handle->content_fingerprint,
+			     data_offset,
+			     mapped_data,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update content fingerprint with block: %" PRIu64 ".",
+				 function,
+				 block_number );
+
+				goto on_error;
+			}
+		}
+		data_offset  += (off64_t) read_size;
+		block_number += 1;
+	}
+	if( block_data != NULL )
+	{
+		libagdb_allocator_free(
+		 block_data );
+
+		block_data = NULL;
+	}
+	if( libagdb_content_fingerprint_finalize(
+	     internal_file->io_handle->content_fingerprint,
+	     internal_file->content_fingerprint,
+	     LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize content fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->content_fingerprint_is_set = 1;
+
+	return( 1 );
+
+on_error:
+	if( block_data != NULL )
+	{
+		libagdb_allocator_free(
+		 block_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of volumes
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_number_of_volumes(
+     libagdb_file_t *file,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_number_of_volumes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
+	     number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific volume information
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_volume_information(
+     libagdb_file_t *file,
+     int volume_index,
+     libagdb_volume_information_t **volume_information,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_volume_information";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->volumes_array,
+	     volume_index,
+	     (intptr_t **) volume_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d information.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the volume index
+ * The volume index maps the serial number and device path of the volumes to their index
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_read_volume_index(
+     libagdb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	libagdb_volume_index_t *safe_volume_index                          = NULL;
+	static char *function                                              = "libagdb_internal_file_read_volume_index";
+	size_t device_path_utf8_string_size                                = 0;
+	size_t utf8_string_offset                                          = 0;
+	size_t utf8_string_size                                            = 0;
+	int number_of_volumes                                              = 0;
+	int volume_index                                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->volume_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - volume index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	/* The device paths are converted once here, so that lookups by device path
+	 * do not need to convert the device path of every volume
+	 */
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->volumes_array,
+		     volume_index,
+		     (intptr_t **) &internal_volume_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks list.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( internal_volume_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		/* A volume without a device path is represented by an empty string
+		 */
+		if( ( internal_volume_information->device_path == NULL )
+		 || ( internal_volume_information->device_path_size == 0 ) )
+		{
+			device_path_utf8_string_size = 1;
+		}
+		else if( libagdb_volume_information_get_utf8_device_path_size(
+		          (libagdb_volume_information_t *) internal_volume_information,
+		          &device_path_utf8_string_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d device path UTF-8 string size.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( device_path_utf8_string_size > ( (size_t) SSIZE_MAX - utf8_string_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string size value exceeds maximum.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		utf8_string_size += device_path_utf8_string_size;
+	}
+	if( libagdb_volume_index_initialize(
+	     &safe_volume_index,
+	     number_of_volumes,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume index.",
+		 function );
+
+		goto on_error;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->volumes_array,
+		     volume_index,
+		     (intptr_t **) &internal_volume_information,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "Reading compressed blocks:\n" );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
 		}
-#endif
-		if( libagdb_io_handle_read_compressed_blocks(
-		     internal_file->io_handle,
-		     file_io_handle,
-		     internal_file->compressed_blocks_list,
+		safe_volume_index->utf8_string_offsets[ volume_index ] = utf8_string_offset;
+
+		if( ( internal_volume_information->device_path == NULL )
+		 || ( internal_volume_information->device_path_size == 0 ) )
+		{
+			device_path_utf8_string_size = 1;
+
+			safe_volume_index->utf8_string[ utf8_string_offset ] = 0;
+		}
+		else
+		{
+			if( libagdb_volume_information_get_utf8_device_path_size(
+			     (libagdb_volume_information_t *) internal_volume_information,
+			     &device_path_utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d device path UTF-8 string size.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+			if( device_path_utf8_string_size > ( utf8_string_size - utf8_string_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %d device path UTF-8 string size value out of bounds.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+			if( libagdb_volume_information_get_utf8_device_path(
+			     (libagdb_volume_information_t *) internal_volume_information,
+			     &( safe_volume_index->utf8_string[ utf8_string_offset ] ),
+			     device_path_utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d device path UTF-8 string.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+		}
+		utf8_string_offset += device_path_utf8_string_size;
+	}
+	/* Insert the volumes last to first so that lookups return the first matching volume
+	 */
+	for( volume_index = number_of_volumes - 1;
+	     volume_index >= 0;
+	     volume_index-- )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->volumes_array,
+		     volume_index,
+		     (intptr_t **) &internal_volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libagdb_volume_index_insert_entry(
+		     safe_volume_index,
+		     volume_index,
+		     internal_volume_information->serial_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert volume: %d into index.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+	}
+	internal_file->volume_index = safe_volume_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_volume_index != NULL )
+	{
+		libagdb_volume_index_free(
+		 &safe_volume_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the volume information with a specific serial number
+ * If multiple volumes have the same serial number the first one is retrieved
+ * Returns 1 if successful, 0 if no such volume information or -1 on error
+ */
+int libagdb_file_get_volume_information_by_serial_number(
+     libagdb_file_t *file,
+     uint32_t serial_number,
+     libagdb_volume_information_t **volume_information,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_volume_information_by_serial_number";
+	int result                             = 0;
+	int volume_index                       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libagdb_volume_index_get_entry_index_by_serial_number(
+	          internal_file->volume_index,
+	          serial_number,
+	          &volume_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume index by serial number.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->volumes_array,
+		     volume_index,
+		     (intptr_t **) volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the volume information with a specific UTF-8 encoded device path
+ * The comparison is case insensitive for ASCII characters
+ * If multiple volumes have the same device path the first one is retrieved
+ * Returns 1 if successful, 0 if no such volume information or -1 on error
+ */
+int libagdb_file_get_volume_information_by_utf8_device_path(
+     libagdb_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libagdb_volume_information_t **volume_information,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_volume_information_by_utf8_device_path";
+	int result                             = 0;
+	int volume_index                       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( internal_file->volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libagdb_volume_index_get_entry_index_by_utf8_device_path(
+	          internal_file->volume_index,
+	          utf8_string,
+	          utf8_string_length,
+	          &volume_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume index by device path.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->volumes_array,
+		     volume_index,
+		     (intptr_t **) volume_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed blocks.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfcache_cache_initialize(
-		     &( internal_file->compressed_blocks_cache ),
-		     LIBAGDB_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS,
+	}
+	return( result );
+}
+
+/* Retrieves summaries of the volumes
+ * At most number_of_volume_summaries summaries are stored and number_of_volumes
+ * is set to the total number of volumes
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_volume_summaries(
+     libagdb_file_t *file,
+     libagdb_volume_summary_t *volume_summaries,
+     int number_of_volume_summaries,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file                             = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_file_get_volume_summaries";
+	int number_of_files                                                = 0;
+	int safe_number_of_volumes                                         = 0;
+	int volume_index                                                   = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( number_of_volume_summaries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of volume summaries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_summaries == NULL )
+	 && ( number_of_volume_summaries > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume summaries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->volumes_array,
+	     &safe_number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	for( volume_index = 0;
+	     ( volume_index < safe_number_of_volumes ) && ( volume_index < number_of_volume_summaries );
+	     volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->volumes_array,
+		     volume_index,
+		     (intptr_t **) &internal_volume_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks cache.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libagdb_compressed_blocks_stream_initialize(
-		     &( internal_file->uncompressed_data_stream ),
-		     internal_file->compressed_blocks_list,
-		     internal_file->compressed_blocks_cache,
-		     error ) != 1 )
+		if( internal_volume_information == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks stream.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing volume: %d information.",
+			 function,
+			 volume_index );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	else
-	{
-		if( libfdata_stream_initialize(
-		     &( internal_file->uncompressed_data_stream ),
-		     NULL,
-		     NULL,
-		     NULL,
-		     NULL,
-		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libagdb_io_handle_read_segment_data,
-		     NULL,
-		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libagdb_io_handle_seek_segment_offset,
-		     0,
-		     error ) != 1 )
+		/* A volume without a device path is represented by an empty string
+		 */
+		if( ( internal_volume_information->device_path == NULL )
+		 || ( internal_volume_information->device_path_size == 0 ) )
+		{
+			volume_summaries[ volume_index ].utf8_device_path_size = 1;
+		}
+		else if( libagdb_volume_information_get_utf8_device_path_size(
+		          (libagdb_volume_information_t *) internal_volume_information,
+		          &( volume_summaries[ volume_index ].utf8_device_path_size ),
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create uncompressed data stream.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d device path UTF-8 string size.",
+			 function,
+			 volume_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfdata_stream_append_segment(
-		     internal_file->uncompressed_data_stream,
-		     &segment_index,
-		     0,
-		     0,
-		     (size64_t) internal_file->io_handle->uncompressed_data_size,
-		     0,
+		if( libcdata_array_get_number_of_entries(
+		     internal_volume_information->files_array,
+		     &number_of_files,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append uncompressed data stream segment: 0.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d number of files.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		volume_summaries[ volume_index ].creation_time   = internal_volume_information->creation_time;
+		volume_summaries[ volume_index ].serial_number   = internal_volume_information->serial_number;
+		volume_summaries[ volume_index ].number_of_files = (uint32_t) number_of_files;
+	}
+	*number_of_volumes = safe_number_of_volumes;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sources
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_number_of_sources(
+     libagdb_file_t *file,
+     int *number_of_sources,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_number_of_sources";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sources_array,
+	     number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific source information
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_source_information(
+     libagdb_file_t *file,
+     int source_index,
+     libagdb_source_information_t **source_information,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file = NULL;
+	static char *function                  = "libagdb_file_get_source_information";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( source_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->sources_array,
+	     source_index,
+	     (intptr_t **) source_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source: %d information.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves summaries of the sources
+ * At most number_of_source_summaries summaries are stored and number_of_sources
+ * is set to the total number of sources
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_file_get_source_summaries(
+     libagdb_file_t *file,
+     libagdb_source_summary_t *source_summaries,
+     int number_of_source_summaries,
+     int *number_of_sources,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_t *internal_file                             = NULL;
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	static char *function                                              = "libagdb_file_get_source_summaries";
+	int safe_number_of_sources                                         = 0;
+	int source_index                                                   = 0;
 
-			goto on_error;
-		}
-	}
-	if( libagdb_file_header_initialize(
-	     &file_header,
-	     error ) != 1 )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libagdb_file_header_read_stream(
-	     file_header,
-	     internal_file->io_handle,
-	     internal_file->uncompressed_data_stream,
-	     file_io_handle,
-	     error ) != 1 )
+	internal_file = (libagdb_internal_file_t *) file;
+
+	if( number_of_source_summaries < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of source summaries value less than zero.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->io_handle->file_header_signature = file_header->signature;
-
-	file_offset = (off64_t) file_header->size;
-
-	for( volume_index = 0;
-	     volume_index < file_header->number_of_volumes;
-	     volume_index++ )
+	if( ( source_summaries == NULL )
+	 && ( number_of_source_summaries > 0 ) )
 	{
-		alignment_padding_size = (size_t) ( file_offset % 8 );
-
-		if( alignment_padding_size != 0 )
-		{
-			alignment_padding_size = 8 - alignment_padding_size;
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: alignment padding size\t\t\t\t: %" PRIzd "\n",
-				 function,
-				 alignment_padding_size );
-			}
-#endif
-			read_count = libfdata_stream_read_buffer(
-			              internal_file->uncompressed_data_stream,
-			              (intptr_t *) internal_file->file_io_handle,
-			              alignment_padding_data,
-			              alignment_padding_size,
-			              0,
-			              error );
-
-			if( read_count != (ssize_t) alignment_padding_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read alignment padding data.",
-				 function );
-
-				goto on_error;
-			}
-			file_offset += read_count;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: alignment padding data:\n",
-				 function );
-				libcnotify_print_data(
-				 alignment_padding_data,
-				 alignment_padding_size,
-				 0 );
-			}
-#endif
-		}
-		if( libagdb_volume_information_initialize(
-		     &volume_information,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create volume: %" PRIu32 " information.",
-			 function,
-			 volume_index );
-
-			goto on_error;
-		}
-		read_count = libagdb_internal_volume_information_read_file_io_handle(
-		              (libagdb_internal_volume_information_t *) volume_information,
-		              internal_file->io_handle,
-		              internal_file->uncompressed_data_stream,
-		              internal_file->file_io_handle,
-		              file_offset,
-		              volume_index,
-		              error );
-
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read volume: %" PRIu32 " information.",
-			 function,
-			 volume_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source summaries.",
+		 function );
 
-			goto on_error;
-		}
-		file_offset += read_count;
+		return( -1 );
+	}
+	if( number_of_sources == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sources.",
+		 function );
 
-		if( libcdata_array_append_entry(
-		     internal_file->volumes_array,
-		     &entry_index,
-		     (intptr_t *) volume_information,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append volume: %" PRIu32 " information to array.",
-			 function,
-			 volume_index );
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sources_array,
+	     &safe_number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
 
-			goto on_error;
-		}
-		volume_information = NULL;
+		return( -1 );
 	}
 	for( source_index = 0;
-	     source_index < file_header->number_of_sources;
+	     ( source_index < safe_number_of_sources ) && ( source_index < number_of_source_summaries );
 	     source_index++ )
 	{
-		if( libagdb_source_information_initialize(
-		     &source_information,
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sources_array,
+		     source_index,
+		     (intptr_t **) &internal_source_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create source: %" PRIu32 " information.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d information.",
 			 function,
 			 source_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		read_count = libagdb_source_information_read(
-		              (libagdb_internal_source_information_t *) source_information,
-		              internal_file->io_handle,
-		              internal_file->uncompressed_data_stream,
-		              internal_file->file_io_handle,
-		              source_index,
-		              file_offset,
-		              error );
-
-		if( read_count == -1 )
+		if( internal_source_information == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read source: %" PRIu32 " information.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing source: %d information.",
 			 function,
 			 source_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		file_offset += read_count;
-
-		if( libcdata_array_append_entry(
-		     internal_file->sources_array,
-		     &entry_index,
-		     (intptr_t *) source_information,
-		     error ) != 1 )
+		/* A source without an executable filename is represented by an empty string
+		 */
+		if( internal_source_information->executable_filename_size == 0 )
+		{
+			source_summaries[ source_index ].utf8_executable_filename_size = 1;
+		}
+		else if( libagdb_source_information_get_utf8_executable_filename_size(
+		          (libagdb_source_information_t *) internal_source_information,
+		          &( source_summaries[ source_index ].utf8_executable_filename_size ),
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append source: %" PRIu32 " information to array.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d executable filename UTF-8 string size.",
 			 function,
 			 source_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		source_information = NULL;
+		source_summaries[ source_index ].prefetch_hash = internal_source_information->prefetch_hash;
 	}
-	if( libagdb_file_header_free(
-	     &file_header,
+	*number_of_sources = safe_number_of_sources;
+
+	return( 1 );
+}
+
+/* Builds the source index
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_file_build_source_index(
+     libagdb_internal_file_t *internal_file,
+     libagdb_source_index_t **source_index,
+     libcerror_error_t **error )
+{
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	libagdb_source_index_t *safe_source_index                          = NULL;
+	static char *function                                              = "libagdb_internal_file_build_source_index";
+	size_t executable_filename_length                                  = 0;
+	int number_of_sources                                              = 0;
+	int source_index_value                                             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->sources_array,
+	     &number_of_sources,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file header.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
 		 function );
 
 		goto on_error;
 	}
-/* TODO remove use offset instead */
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libagdb_source_index_initialize(
+	     &safe_source_index,
+	     number_of_sources,
+	     error ) != 1 )
 	{
-		uint8_t trailing_data[ 128 ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source index.",
+		 function );
 
-		read_count = libfdata_stream_read_buffer(
-			      internal_file->uncompressed_data_stream,
-			      (intptr_t *) internal_file->file_io_handle,
-			      trailing_data,
-			      128,
-			      0,
-			      error );
+		goto on_error;
+	}
+	/* Insert the sources last to first so that lookups return the first matching source
+	 */
+	for( source_index_value = number_of_sources - 1;
+	     source_index_value >= 0;
+	     source_index_value-- )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sources_array,
+		     source_index_value,
+		     (intptr_t **) &internal_source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d information.",
+			 function,
+			 source_index_value );
 
-		if( read_count == -1 )
+			goto on_error;
+		}
+		if( internal_source_information == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read trailing data.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing source: %d information.",
+			 function,
+			 source_index_value );
 
 			goto on_error;
 		}
-		if( read_count > 0 )
+		/* The executable filename size includes the end of string character
+		 */
+		executable_filename_length = 0;
+
+		if( internal_source_information->executable_filename_size > 0 )
 		{
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 trailing_data,
-			 read_count,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			executable_filename_length = (size_t) internal_source_information->executable_filename_size - 1;
+		}
+		if( executable_filename_length > 16 )
+		{
+			executable_filename_length = 16;
+		}
+		if( libagdb_source_index_insert_entry(
+		     safe_source_index,
+		     source_index_value,
+		     internal_source_information->prefetch_hash,
+		     internal_source_information->executable_filename,
+		     executable_filename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert source: %d into index.",
+			 function,
+			 source_index_value );
+
+			goto on_error;
 		}
 	}
-#endif
+	*source_index = safe_source_index;
+
 	return( 1 );
 
 on_error:
-	if( source_information != NULL )
-	{
-		libagdb_internal_source_information_free(
-		 (libagdb_internal_source_information_t **) &source_information,
-		 NULL );
-	}
-	if( volume_information != NULL )
-	{
-		libagdb_internal_volume_information_free(
-		 (libagdb_internal_volume_information_t **) &volume_information,
-		 NULL );
-	}
-	if( internal_file->uncompressed_data_stream != NULL )
-	{
-		libfdata_stream_free(
-		 &( internal_file->uncompressed_data_stream ),
-		 NULL );
-	}
-	if( internal_file->compressed_blocks_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &( internal_file->compressed_blocks_cache ),
-		 NULL );
-	}
-	if( internal_file->compressed_blocks_list != NULL )
-	{
-		libfdata_list_free(
-		 &( internal_file->compressed_blocks_list ),
-		 NULL );
-	}
-	if( file_header != NULL )
-	{
-		libagdb_file_header_free(
-		 &file_header,
-		 NULL );
-	}
-	if( compressed_file_header != NULL )
+	if( safe_source_index != NULL )
 	{
-		libagdb_compressed_file_header_free(
-		 &compressed_file_header,
+		libagdb_source_index_free(
+		 &safe_source_index,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the number of volumes
+/* Retrieves the source index
+ * The source index is built on first use, while holding the write lock
+ * since the file can be shared by multiple threads
  * Returns 1 if successful or -1 on error
  */
-int libagdb_file_get_number_of_volumes(
-     libagdb_file_t *file,
-     int *number_of_volumes,
+int libagdb_internal_file_get_source_index(
+     libagdb_internal_file_t *internal_file,
+     libagdb_source_index_t **source_index,
      libcerror_error_t **error )
 {
-	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_get_number_of_volumes";
+	libagdb_source_index_t *safe_source_index = NULL;
+	static char *function                     = "libagdb_internal_file_get_source_index";
+	int result                                = 1;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1471,36 +5395,129 @@ int libagdb_file_get_number_of_volumes(
 
 		return( -1 );
 	}
-	internal_file = (libagdb_internal_file_t *) file;
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->volumes_array,
-	     number_of_volumes,
+		return( -1 );
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of volumes.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_source_index = internal_file->source_index;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
+#endif
+	if( safe_source_index == NULL )
+	{
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		/* Another thread can have built the source index in the meantime
+		 */
+		if( internal_file->source_index == NULL )
+		{
+			result = libagdb_internal_file_build_source_index(
+			          internal_file,
+			          &( internal_file->source_index ),
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build source index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		safe_source_index = internal_file->source_index;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_file->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	*source_index = safe_source_index;
+
 	return( 1 );
 }
 
-/* Retrieves a specific volume information
- * Returns 1 if successful or -1 on error
+/* Retrieves the source information with a specific prefetch hash
+ * If multiple sources have the same prefetch hash the first one is retrieved
+ * Returns 1 if successful, 0 if no such source information or -1 on error
  */
-int libagdb_file_get_volume_information(
+int libagdb_file_get_source_information_by_prefetch_hash(
      libagdb_file_t *file,
-     int volume_index,
-     libagdb_volume_information_t **volume_information,
+     uint32_t prefetch_hash,
+     libagdb_source_information_t **source_information,
      libcerror_error_t **error )
 {
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_get_volume_information";
+	libagdb_source_index_t *source_index   = NULL;
+	static char *function                  = "libagdb_file_get_source_information_by_prefetch_hash";
+	int result                             = 0;
+	int source_index_value                 = 0;
 
 	if( file == NULL )
 	{
@@ -1515,57 +5532,98 @@ int libagdb_file_get_volume_information(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
-	if( volume_information == NULL )
+	if( source_information == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume information.",
+		 "%s: invalid source information.",
 		 function );
 
 		return( -1 );
 	}
-	if( *volume_information != NULL )
+	if( *source_information != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume information value already set.",
+		 "%s: invalid source information value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->volumes_array,
-	     volume_index,
-	     (intptr_t **) volume_information,
+	if( libagdb_internal_file_get_source_index(
+	     internal_file,
+	     &source_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume: %d information.",
-		 function,
-		 volume_index );
+		 "%s: unable to retrieve source index.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	result = libagdb_source_index_get_entry_index_by_prefetch_hash(
+	          source_index,
+	          prefetch_hash,
+	          &source_index_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source index by prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sources_array,
+		     source_index_value,
+		     (intptr_t **) source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d information.",
+			 function,
+			 source_index_value );
+
+			return( -1 );
+		}
+	}
+	return( result );
 }
 
-/* Retrieves the number of sources
- * Returns 1 if successful or -1 on error
+/* Retrieves the source information with a specific UTF-8 encoded executable filename
+ * The comparison is case insensitive for ASCII characters
+ * If multiple sources have the same executable filename the first one is retrieved
+ * Returns 1 if successful, 0 if no such source information or -1 on error
  */
-int libagdb_file_get_number_of_sources(
+int libagdb_file_get_source_information_by_utf8_executable_filename(
      libagdb_file_t *file,
-     int *number_of_sources,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libagdb_source_information_t **source_information,
      libcerror_error_t **error )
 {
 	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_get_number_of_sources";
+	libagdb_source_index_t *source_index   = NULL;
+	static char *function                  = "libagdb_file_get_source_information_by_utf8_executable_filename";
+	int result                             = 0;
+	int source_index_value                 = 0;
 
 	if( file == NULL )
 	{
@@ -1580,48 +5638,28 @@ int libagdb_file_get_number_of_sources(
 	}
 	internal_file = (libagdb_internal_file_t *) file;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->sources_array,
-	     number_of_sources,
-	     error ) != 1 )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sources.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific source information
- * Returns 1 if successful or -1 on error
- */
-int libagdb_file_get_source_information(
-     libagdb_file_t *file,
-     int source_index,
-     libagdb_source_information_t **source_information,
-     libcerror_error_t **error )
-{
-	libagdb_internal_file_t *internal_file = NULL;
-	static char *function                  = "libagdb_file_get_source_information";
-
-	if( file == NULL )
+	if( utf8_string_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libagdb_internal_file_t *) file;
-
 	if( source_information == NULL )
 	{
 		libcerror_error_set(
@@ -1644,22 +5682,57 @@ int libagdb_file_get_source_information(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->sources_array,
-	     source_index,
-	     (intptr_t **) source_information,
+	if( libagdb_internal_file_get_source_index(
+	     internal_file,
+	     &source_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve source: %d information.",
-		 function,
-		 source_index );
+		 "%s: unable to retrieve source index.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	result = libagdb_source_index_get_entry_index_by_executable_filename(
+	          source_index,
+	          utf8_string,
+	          utf8_string_length,
+	          &source_index_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source index by executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->sources_array,
+		     source_index_value,
+		     (intptr_t **) source_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d information.",
+			 function,
+			 source_index_value );
+
+			return( -1 );
+		}
+	}
+	return( result );
 }
 
@@ -25,14 +25,19 @@
 #include <common.h>
 #include <types.h>
 
+#include "libagdb_definitions.h"
 #include "libagdb_extern.h"
 #include "libagdb_io_handle.h"
 #include "libagdb_libbfio.h"
 #include "libagdb_libcdata.h"
 #include "libagdb_libcerror.h"
+#include "libagdb_libcthreads.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_memory_map.h"
+#include "libagdb_source_index.h"
 #include "libagdb_types.h"
+#include "libagdb_volume_index.h"
 
 #if defined( _MSC_VER ) || defined( __BORLANDC__ ) || defined( __MINGW32__ )
 
@@ -66,6 +71,18 @@ struct libagdb_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The memory map
+	 */
+	libagdb_memory_map_t *memory_map;
+
+	/* Value to indicate if the file was opened from memory data
+	 */
+	uint8_t memory_data_is_open;
+
+	/* The cache data, if read into memory by the library
+	 */
+	uint8_t *cache_data;
+
 	/* The compressed blocks list
 	 */
 	libfdata_list_t *compressed_blocks_list;
@@ -78,13 +95,35 @@ struct libagdb_internal_file
 	 */
 	libfdata_stream_t *uncompressed_data_stream;
 
+	/* The content fingerprint
+	 */
+	uint8_t content_fingerprint[ LIBAGDB_CONTENT_FINGERPRINT_SIZE ];
+
+	/* Value to indicate the content fingerprint was calculated
+	 */
+	uint8_t content_fingerprint_is_set;
+
 	/* The volumes array
 	 */
 	libcdata_array_t *volumes_array;
 
+	/* The volume index
+	 */
+	libagdb_volume_index_t *volume_index;
+
 	/* The sources array
 	 */
 	libcdata_array_t *sources_array;
+
+	/* The source index
+	 */
+	libagdb_source_index_t *source_index;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBAGDB_EXTERN \
@@ -102,6 +141,39 @@ int libagdb_file_signal_abort(
      libagdb_file_t *file,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_file_get_validation_level(
+     libagdb_file_t *file,
+     int *validation_level,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_set_validation_level(
+     libagdb_file_t *file,
+     int validation_level,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_set_trace_callbacks(
+     libagdb_file_t *file,
+     void (*begin_callback)(
+            intptr_t *callback_data,
+            libagdb_file_t *file,
+            int trace_phase,
+            uint32_t trace_index,
+            uint8_t file_type,
+            off64_t offset,
+            size64_t size ),
+     void (*end_callback)(
+            intptr_t *callback_data,
+            libagdb_file_t *file,
+            int trace_phase,
+            uint32_t trace_index,
+            int result,
+            size64_t size ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_file_open(
      libagdb_file_t *file,
@@ -127,16 +199,128 @@ int libagdb_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_file_open_memory(
+     libagdb_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_write_cache(
+     libagdb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBAGDB_EXTERN \
+int libagdb_file_write_cache_wide(
+     libagdb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBAGDB_EXTERN \
+int libagdb_file_write_cache_file_io_handle(
+     libagdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_open_cache(
+     libagdb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBAGDB_EXTERN \
+int libagdb_file_open_cache_wide(
+     libagdb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBAGDB_EXTERN \
+int libagdb_file_open_cache_file_io_handle(
+     libagdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_open_cache_memory(
+     libagdb_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libagdb_internal_file_open_cache_data(
+     libagdb_internal_file_t *internal_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_file_close(
      libagdb_file_t *file,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_file_reset(
+     libagdb_file_t *file,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_release_io_resources(
+     libagdb_file_t *file,
+     uint8_t release_flags,
+     libcerror_error_t **error );
+
+int libagdb_internal_file_close(
+     libagdb_internal_file_t *internal_file,
+     uint8_t retain_containers,
+     libcerror_error_t **error );
+
 int libagdb_file_open_read(
      libagdb_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_file_get_file_type(
+     libagdb_file_t *file,
+     uint8_t *file_type,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_uncompressed_data_size(
+     libagdb_file_t *file,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_statistics(
+     libagdb_file_t *file,
+     uint64_t *statistics,
+     int number_of_statistics,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_content_fingerprint(
+     libagdb_file_t *file,
+     uint8_t *fingerprint,
+     size_t fingerprint_size,
+     libcerror_error_t **error );
+
+int libagdb_internal_file_read_content_fingerprint(
+     libagdb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_file_get_number_of_volumes(
      libagdb_file_t *file,
@@ -150,6 +334,33 @@ int libagdb_file_get_volume_information(
      libagdb_volume_information_t **volume_information,
      libcerror_error_t **error );
 
+int libagdb_internal_file_read_volume_index(
+     libagdb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_volume_information_by_serial_number(
+     libagdb_file_t *file,
+     uint32_t serial_number,
+     libagdb_volume_information_t **volume_information,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_volume_information_by_utf8_device_path(
+     libagdb_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libagdb_volume_information_t **volume_information,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_volume_summaries(
+     libagdb_file_t *file,
+     libagdb_volume_summary_t *volume_summaries,
+     int number_of_volume_summaries,
+     int *number_of_volumes,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_file_get_number_of_sources(
      libagdb_file_t *file,
@@ -163,6 +374,39 @@ int libagdb_file_get_source_information(
      libagdb_source_information_t **source_information,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_file_get_source_summaries(
+     libagdb_file_t *file,
+     libagdb_source_summary_t *source_summaries,
+     int number_of_source_summaries,
+     int *number_of_sources,
+     libcerror_error_t **error );
+
+int libagdb_internal_file_build_source_index(
+     libagdb_internal_file_t *internal_file,
+     libagdb_source_index_t **source_index,
+     libcerror_error_t **error );
+
+int libagdb_internal_file_get_source_index(
+     libagdb_internal_file_t *internal_file,
+     libagdb_source_index_t **source_index,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_source_information_by_prefetch_hash(
+     libagdb_file_t *file,
+     uint32_t prefetch_hash,
+     libagdb_source_information_t **source_information,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_file_get_source_information_by_utf8_executable_filename(
+     libagdb_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libagdb_source_information_t **source_information,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libagdb_allocator.h"
 #include "libagdb_database_header.h"
 #include "libagdb_file_header.h"
 #include "libagdb_definitions.h"
@@ -66,7 +67,7 @@ int libagdb_file_header_initialize(
 
 		return( -1 );
 	}
-	*file_header = memory_allocate_structure(
+	*file_header = libagdb_allocator_allocate_structure(
 	                libagdb_file_header_t );
 
 	if( *file_header == NULL )
@@ -99,7 +100,7 @@ int libagdb_file_header_initialize(
 on_error:
 	if( *file_header != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *file_header );
 
 		*file_header = NULL;
@@ -129,7 +130,7 @@ int libagdb_file_header_free(
 	}
 	if( *file_header != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *file_header );
 
 		*file_header = NULL;
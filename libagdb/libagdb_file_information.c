@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libagdb_allocator.h"
 #include "libagdb_debug.h"
 #include "libagdb_definitions.h"
 #include "libagdb_file_information.h"
@@ -35,6 +36,7 @@
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
 #include "libagdb_libuna.h"
+#include "libagdb_string.h"
 
 #include "agdb_file_information.h"
 
@@ -71,7 +73,7 @@ int libagdb_file_information_initialize(
 
 		return( -1 );
 	}
-	internal_file_information = memory_allocate_structure(
+	internal_file_information = libagdb_allocator_allocate_structure(
 	                             libagdb_internal_file_information_t );
 
 	if( internal_file_information == NULL )
@@ -106,7 +108,7 @@ int libagdb_file_information_initialize(
 on_error:
 	if( internal_file_information != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 internal_file_information );
 	}
 	return( -1 );
@@ -161,12 +163,13 @@ int libagdb_internal_file_information_free(
 	}
 	if( *internal_file_information != NULL )
 	{
-		if( ( *internal_file_information )->path != NULL )
+		if( ( ( *internal_file_information )->path != NULL )
+		 && ( ( *internal_file_information )->path_is_mapped == 0 ) )
 		{
-			memory_free(
+			libagdb_allocator_free(
 			 ( *internal_file_information )->path );
 		}
-		memory_free(
+		libagdb_allocator_free(
 		 *internal_file_information );
 
 		*internal_file_information = NULL;
@@ -256,7 +259,7 @@ int libagdb_internal_file_information_read_path_data(
 
 			goto on_error;
 		}
-		internal_file_information->path = (uint8_t *) memory_allocate(
+		internal_file_information->path = (uint8_t *) libagdb_allocator_allocate(
 		                                               sizeof( uint8_t ) * internal_file_information->path_size );
 
 		if( internal_file_information->path == NULL )
@@ -290,7 +293,7 @@ int libagdb_internal_file_information_read_path_data(
 on_error:
 	if( internal_file_information->path != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 internal_file_information->path );
 
 		internal_file_information->path = NULL;
@@ -311,11 +314,12 @@ int libagdb_internal_file_information_read_data(
      uint8_t number_of_bits,
      libcerror_error_t **error )
 {
-	static char *function = "libagdb_internal_file_information_read_data";
+	const libagdb_file_information_layout_t *layout = NULL;
+	static char *function                           = "libagdb_internal_file_information_read_data";
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit  = 0;
-	uint32_t value_32bit  = 0;
+	uint64_t value_64bit                            = 0;
+	uint32_t value_32bit                            = 0;
 #endif
 
 	if( internal_file_information == NULL )
@@ -351,6 +355,20 @@ int libagdb_internal_file_information_read_data(
 
 		return( -1 );
 	}
+	if( io_handle->file_information_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file information entry size: %" PRIu32 ".",
+		 function,
+		 io_handle->file_information_entry_size );
+
+		return( -1 );
+	}
+	layout = io_handle->file_information_layout;
+
 	if( ( data_size < io_handle->file_information_entry_size )
 	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
@@ -388,67 +406,14 @@ int libagdb_internal_file_information_read_data(
 		 0 );
 	}
 #endif
-	switch( io_handle->file_header_signature )
-	{
-		case 0x00000003UL:
-		case 0x0000000fUL:
-			if( ( io_handle->file_information_entry_size == 48 )
-			 || ( io_handle->file_information_entry_size == 72 ) )
-			{
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_48_32bit_t *) data )->number_of_entries,
-				 internal_file_information->number_of_entries );
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ layout->number_of_entries_offset ] ),
+	 internal_file_information->number_of_entries );
 
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_48_32bit_t *) data )->path_number_of_characters,
-				 internal_file_information->path_size );
-			}
-			else if( io_handle->file_information_entry_size == 56 )
-			{
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_56_64bit_t *) data )->path_number_of_characters,
-				 internal_file_information->path_size );
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ layout->path_number_of_characters_offset ] ),
+	 internal_file_information->path_size );
 
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_56_64bit_t *) data )->number_of_entries,
-				 internal_file_information->number_of_entries );
-			}
-			else if( ( io_handle->file_information_entry_size == 80 )
-			      || ( io_handle->file_information_entry_size == 112 ) )
-			{
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_80_64bit_t *) data )->path_number_of_characters,
-				 internal_file_information->path_size );
-
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_80_64bit_t *) data )->number_of_entries,
-				 internal_file_information->number_of_entries );
-			}
-			break;
-
-		case 0x0000000eUL:
-			if( number_of_bits == 32 )
-			{
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_36_32bit_t *) data )->number_of_entries,
-				 internal_file_information->number_of_entries );
-
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_36_32bit_t *) data )->path_number_of_characters,
-				 internal_file_information->path_size );
-			}
-			else if( number_of_bits == 64 )
-			{
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_64_64bit_t *) data )->number_of_entries,
-				 internal_file_information->number_of_entries );
-
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (agdb_file_information_64_64bit_t *) data )->path_number_of_characters,
-				 internal_file_information->path_size );
-			}
-			break;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -876,18 +841,21 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 	uint8_t alignment_padding_data[ 8 ];
 	uint8_t sub_entry_data[ 32 ];
 
+	const uint8_t *entry_data      = NULL;
+	const uint8_t *mapped_data     = NULL;
 	uint8_t *file_information_data = NULL;
 	static char *function          = "libagdb_internal_file_information_read_file_io_handle";
 	size_t alignment_padding_size  = 0;
 	size_t alignment_size          = 0;
 	ssize_t read_count             = 0;
 	ssize_t total_read_count       = 0;
-	uint32_t calculated_hash_value = 0;
 	uint32_t entry_index           = 0;
 	uint32_t sub_entry_data_size   = 0;
 	uint8_t number_of_bits         = 0;
+	int result                     = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t calculated_hash_value = 0;
 	uint32_t value_32bit           = 0;
 	uint16_t value_16bit           = 0;
 #endif
@@ -937,53 +905,7 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 		return( -1 );
 	}
-	switch( io_handle->file_header_signature )
-	{
-		case 0x00000003UL:
-			if( ( io_handle->file_information_entry_size == 48 )
-			 || ( io_handle->file_information_entry_size == 72 ) )
-			{
-				number_of_bits = 32;
-			}
-			else if( ( io_handle->file_information_entry_size == 56 )
-			      || ( io_handle->file_information_entry_size == 80 )
-			      || ( io_handle->file_information_entry_size == 112 ) )
-			{
-				number_of_bits = 64;
-			}
-			break;
-
-		case 0x0000000eUL:
-			if( ( io_handle->file_information_entry_size == 36 )
-			 || ( io_handle->file_information_entry_size == 52 )
-			 || ( io_handle->file_information_entry_size == 72 ) )
-			{
-				number_of_bits = 32;
-			}
-			else if( ( io_handle->file_information_entry_size == 64 )
-			      || ( io_handle->file_information_entry_size == 88 )
-			      || ( io_handle->file_information_entry_size == 112 ) )
-			{
-				number_of_bits = 64;
-			}
-			break;
-
-		case 0x0000000fUL:
-			if( io_handle->file_information_entry_size == 72 )
-			{
-				number_of_bits = 32;
-			}
-			else if( io_handle->file_information_entry_size == 112 )
-			{
-				number_of_bits = 64;
-			}
-			break;
-
-		default:
-			break;
-
-	}
-	if( number_of_bits == 0 )
+	if( io_handle->file_information_layout == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -995,61 +917,118 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 		return( -1 );
 	}
-	file_information_data = (uint8_t *) memory_allocate(
-	                                     sizeof( uint8_t ) * (size_t) io_handle->file_information_entry_size );
-
-	if( file_information_data == NULL )
+	number_of_bits = io_handle->file_information_layout->number_of_bits;
+	/* For uncompressed files that are memory mapped the file information
+	 * is read directly from the mapped data
+	 */
+	if( io_handle->file_type == LIBAGDB_FILE_TYPE_UNCOMPRESSED )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create file information data.",
-		 function );
+		result = libagdb_io_handle_get_mapped_data(
+		          io_handle,
+		          file_offset,
+		          (size_t) io_handle->file_information_entry_size,
+		          &entry_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped file: %" PRIu32 " information data.",
+			 function,
+			 file_index );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( result != 0 )
 	{
-		libcnotify_printf(
-		 "%s: reading file: %" PRIu32 " information at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_index,
-		 file_offset,
-		 file_offset );
+		read_count = (ssize_t) io_handle->file_information_entry_size;
 	}
-#endif
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              data_stream,
-	              (intptr_t *) file_io_handle,
-	              file_information_data,
-	              (size_t) io_handle->file_information_entry_size,
-	              file_offset,
-	              0,
-	              error );
-
-	if( read_count != (ssize_t) io_handle->file_information_entry_size )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_index,
-		 file_offset,
-		 file_offset );
+		file_information_data = (uint8_t *) libagdb_allocator_allocate(
+		                                     sizeof( uint8_t ) * (size_t) io_handle->file_information_entry_size );
 
-		goto on_error;
+		if( file_information_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file information data.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading file: %" PRIu32 " information at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 file_index,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              data_stream,
+		              (intptr_t *) file_io_handle,
+		              file_information_data,
+		              (size_t) io_handle->file_information_entry_size,
+		              file_offset,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) io_handle->file_information_entry_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		entry_data = file_information_data;
 	}
 	total_read_count += read_count;
 	file_offset      += read_count;
 
+	if( result != 0 )
+	{
+		/* Keep the data stream offset in sync with the data read from the mapped data
+		 */
+		if( libfdata_stream_seek_offset(
+		     data_stream,
+		     file_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file: %" PRIu32 " path data offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+	}
 	if( libagdb_internal_file_information_read_data(
 	     internal_file_information,
 	     io_handle,
-	     file_information_data,
+	     entry_data,
 	     (size_t) io_handle->file_information_entry_size,
 	     number_of_bits,
 	     error ) != 1 )
@@ -1064,11 +1043,13 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 		goto on_error;
 	}
-	memory_free(
-	 file_information_data );
-
-	file_information_data = NULL;
+	if( file_information_data != NULL )
+	{
+		libagdb_allocator_free(
+		 file_information_data );
 
+		file_information_data = NULL;
+	}
 	if( internal_file_information->path_size > 0 )
 	{
 		if( internal_file_information->path_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
@@ -1082,43 +1063,99 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 			goto on_error;
 		}
-		internal_file_information->path = (uint8_t *) memory_allocate(
-		                                               sizeof( uint8_t ) * internal_file_information->path_size );
-
-		if( internal_file_information->path == NULL )
+		if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create path.",
-			 function );
+			if( libagdb_io_handle_get_mapped_data(
+			     io_handle,
+			     file_offset,
+			     (size_t) internal_file_information->path_size,
+			     &mapped_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve mapped file: %" PRIu32 " path data.",
+				 function,
+				 file_index );
 
-			goto on_error;
-		}
-		read_count = libfdata_stream_read_buffer(
-		              data_stream,
-		              (intptr_t *) file_io_handle,
-		              internal_file_information->path,
-		              internal_file_information->path_size,
-		              0,
-		              error );
+				goto on_error;
+			}
+			/* The path references the mapped data and is not freed
+			 */
+			internal_file_information->path           = (uint8_t *) mapped_data;
+			internal_file_information->path_is_mapped = 1;
 
-		if( read_count != (ssize_t) internal_file_information->path_size )
+			read_count = (ssize_t) internal_file_information->path_size;
+		}
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read file: %" PRIu32 " path data.",
-			 function,
-			 file_index );
+			internal_file_information->path = (uint8_t *) libagdb_allocator_allocate(
+			                                               sizeof( uint8_t ) * internal_file_information->path_size );
 
-			goto on_error;
+			if( internal_file_information->path == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create path.",
+				 function );
+
+				goto on_error;
+			}
+			io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_ALLOCATIONS ] += 1;
+			io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_SIZE ]        += internal_file_information->path_size;
+
+			read_count = libfdata_stream_read_buffer(
+			              data_stream,
+			              (intptr_t *) file_io_handle,
+			              internal_file_information->path,
+			              internal_file_information->path_size,
+			              0,
+			              error );
+
+			if( read_count != (ssize_t) internal_file_information->path_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file: %" PRIu32 " path data.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
 		}
 		total_read_count += read_count;
 		file_offset      += read_count;
 
+		if( result != 0 )
+		{
+			/* Keep the data stream offset in sync with the data read from the mapped data
+			 */
+			if( libfdata_stream_seek_offset(
+			     data_stream,
+			     file_offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek file: %" PRIu32 " alignment padding offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_index,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+		}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -1132,24 +1169,42 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 			 0 );
 		}
 #endif
-		if( libagdb_hash_calculate(
-		     &calculated_hash_value,
-		     internal_file_information->path,
-		     internal_file_information->path_size - 2,
-		     error ) != 1 )
+		if( io_handle->validation_level == LIBAGDB_VALIDATION_LEVEL_STRICT )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve path hash value.",
-			 function );
+			if( ( internal_file_information->path[ internal_file_information->path_size - 2 ] != 0 )
+			 || ( internal_file_information->path[ internal_file_information->path_size - 1 ] != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid file: %" PRIu32 " path - missing end-of-string character.",
+				 function,
+				 file_index );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
+			/* The path hash value is only calculated for the debug output
+			 */
+			if( libagdb_hash_calculate(
+			     &calculated_hash_value,
+			     internal_file_information->path,
+			     internal_file_information->path_size - 2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve path hash value.",
+				 function );
+
+				goto on_error;
+			}
 			if( libagdb_debug_print_utf16_string_value(
 			     function,
 			     "file path\t\t",
@@ -1177,14 +1232,7 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( number_of_bits == 32 )
-		{
-			alignment_size = 4;
-		}
-		else if( number_of_bits == 64 )
-		{
-			alignment_size = 8;
-		}
+		alignment_size         = (size_t) io_handle->file_information_layout->alignment_size;
 		alignment_padding_size = (size_t) ( file_offset % alignment_size );
 
 		if( alignment_padding_size != 0 )
@@ -1200,74 +1248,145 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 				 alignment_padding_size );
 			}
 #endif
-			read_count = libfdata_stream_read_buffer(
-			              data_stream,
-			              (intptr_t *) file_io_handle,
-			              alignment_padding_data,
-			              alignment_padding_size,
-			              0,
-			              error );
+			if( io_handle->validation_level == LIBAGDB_VALIDATION_LEVEL_STRICT )
+			{
+				read_count = libfdata_stream_read_buffer(
+				              data_stream,
+				              (intptr_t *) file_io_handle,
+				              alignment_padding_data,
+				              alignment_padding_size,
+				              0,
+				              error );
+
+				if( read_count != (ssize_t) alignment_padding_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read file: %" PRIu32 " alignment padding data.",
+					 function,
+					 file_index );
+
+					goto on_error;
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: file: %" PRIu32 " alignment padding data:\n",
+					 function,
+					 file_index );
+					libcnotify_print_data(
+					 alignment_padding_data,
+					 alignment_padding_size,
+					 0 );
+				}
+#endif
+				if( libagdb_io_handle_check_padding_data(
+				     alignment_padding_data,
+				     alignment_padding_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: invalid file: %" PRIu32 " alignment padding data.",
+					 function,
+					 file_index );
 
-			if( read_count != (ssize_t) alignment_padding_size )
+					goto on_error;
+				}
+			}
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read file: %" PRIu32 " alignment padding data.",
-				 function,
-				 file_index );
+				/* The alignment padding is skipped without reading it
+				 */
+				read_count = (ssize_t) alignment_padding_size;
+
+				if( libfdata_stream_seek_offset(
+				     data_stream,
+				     file_offset + read_count,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek file: %" PRIu32 " alignment padding.",
+					 function,
+					 file_index );
 
-				goto on_error;
+					goto on_error;
+				}
 			}
 			total_read_count += read_count;
 			file_offset      += read_count;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: file: %" PRIu32 " alignment padding data:\n",
-				 function,
-				 file_index );
-				libcnotify_print_data(
-				 alignment_padding_data,
-				 alignment_padding_size,
-				 0 );
-			}
-#endif
 		}
 	}
 	if( internal_file_information->number_of_entries > 0 )
 	{
-		if( ( io_handle->file_information_sub_entry_type1_size != 16 )
-		 && ( io_handle->file_information_sub_entry_type1_size != 24 ) )
+		/* The bounds of the sub entry sizes are checked regardless of the validation level
+		 */
+		if( ( io_handle->file_information_sub_entry_type1_size < 8 )
+		 || ( io_handle->file_information_sub_entry_type1_size > 32 ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported file information sub entry type 1 size: %" PRIu32 ".",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file information sub entry type 1 size: %" PRIu32 " value out of bounds.",
 			 function,
 			 io_handle->file_information_sub_entry_type1_size );
 
 			return( -1 );
 		}
-		if( ( io_handle->file_information_sub_entry_type2_size != 16 )
-		 && ( io_handle->file_information_sub_entry_type2_size != 20 )
-		 && ( io_handle->file_information_sub_entry_type2_size != 24 )
-		 && ( io_handle->file_information_sub_entry_type2_size != 32 ) )
+		if( ( io_handle->file_information_sub_entry_type2_size < 8 )
+		 || ( io_handle->file_information_sub_entry_type2_size > 32 ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported file information sub entry type 2 size: %" PRIu32 ".",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file information sub entry type 2 size: %" PRIu32 " value out of bounds.",
 			 function,
 			 io_handle->file_information_sub_entry_type2_size );
 
 			return( -1 );
 		}
+		if( io_handle->validation_level != LIBAGDB_VALIDATION_LEVEL_NONE )
+		{
+			if( ( io_handle->file_information_sub_entry_type1_size != 16 )
+			 && ( io_handle->file_information_sub_entry_type1_size != 24 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported file information sub entry type 1 size: %" PRIu32 ".",
+				 function,
+				 io_handle->file_information_sub_entry_type1_size );
+
+				return( -1 );
+			}
+			if( ( io_handle->file_information_sub_entry_type2_size != 16 )
+			 && ( io_handle->file_information_sub_entry_type2_size != 20 )
+			 && ( io_handle->file_information_sub_entry_type2_size != 24 )
+			 && ( io_handle->file_information_sub_entry_type2_size != 32 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported file information sub entry type 2 size: %" PRIu32 ".",
+				 function,
+				 io_handle->file_information_sub_entry_type2_size );
+
+				return( -1 );
+			}
+		}
 		for( entry_index = 0;
 		     entry_index < internal_file_information->number_of_entries;
 		     entry_index++ )
@@ -1292,8 +1411,7 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 
 				goto on_error;
 			}
-			if( ( io_handle->file_header_signature == 0x0000000eUL )
-			 && ( ( sub_entry_data[ 4 ] & 0x20 ) != 0 ) )
+			if( ( sub_entry_data[ 4 ] & io_handle->file_information_layout->sub_entry_type2_flag ) != 0 )
 			{
 				sub_entry_data_size = io_handle->file_information_sub_entry_type2_size;
 			}
@@ -1402,16 +1520,19 @@ ssize_t libagdb_internal_file_information_read_file_io_handle(
 on_error:
 	if( internal_file_information->path != NULL )
 	{
-		memory_free(
-		 internal_file_information->path );
-
+		if( internal_file_information->path_is_mapped == 0 )
+		{
+			libagdb_allocator_free(
+			 internal_file_information->path );
+		}
 		internal_file_information->path = NULL;
 	}
-	internal_file_information->path_size = 0;
+	internal_file_information->path_size      = 0;
+	internal_file_information->path_is_mapped = 0;
 
 	if( file_information_data != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 file_information_data );
 	}
 	return( -1 );
@@ -1442,10 +1563,9 @@ int libagdb_file_information_get_utf8_path_size(
 	}
 	internal_file_information = (libagdb_internal_file_information_t *) file_information;
 
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libagdb_string_get_utf8_string_size_from_utf16_stream(
 	     internal_file_information->path,
-	     internal_file_information->path_size,
-	     LIBUNA_ENDIAN_LITTLE,
+	     (size_t) internal_file_information->path_size,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -1473,6 +1593,7 @@ int libagdb_file_information_get_utf8_path(
 {
 	libagdb_internal_file_information_t *internal_file_information = NULL;
 	static char *function                                          = "libagdb_file_information_get_utf8_path";
+	size_t utf8_string_index                                       = 0;
 
 	if( file_information == NULL )
 	{
@@ -1487,12 +1608,12 @@ int libagdb_file_information_get_utf8_path(
 	}
 	internal_file_information = (libagdb_internal_file_information_t *) file_information;
 
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libagdb_string_copy_utf8_string_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
+	     &utf8_string_index,
 	     internal_file_information->path,
-	     internal_file_information->path_size,
-	     LIBUNA_ENDIAN_LITTLE,
+	     (size_t) internal_file_information->path_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1597,3 +1718,64 @@ int libagdb_file_information_get_utf16_path(
 	return( 1 );
 }
 
+/* Retrieves the path data
+ * The data contains an UTF-16 little-endian string with end-of-string character
+ * If the file is memory mapped the data references the mapped file data
+ * The data remains valid until the file is closed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libagdb_file_information_get_path_data(
+     libagdb_file_information_t *file_information,
+     const uint8_t **path_data,
+     size_t *path_data_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_information_t *internal_file_information = NULL;
+	static char *function                                          = "libagdb_file_information_get_path_data";
+
+	if( file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_information = (libagdb_internal_file_information_t *) file_information;
+
+	if( path_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path data.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_information->path == NULL )
+	 || ( internal_file_information->path_size == 0 ) )
+	{
+		return( 0 );
+	}
+	*path_data      = internal_file_information->path;
+	*path_data_size = (size_t) internal_file_information->path_size;
+
+	return( 1 );
+}
+
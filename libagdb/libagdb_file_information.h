@@ -49,6 +49,10 @@ struct libagdb_internal_file_information
 	 */
 	uint32_t path_size;
 
+	/* Value to indicate the path references the mapped file data
+	 */
+	uint8_t path_is_mapped;
+
 	/* The number of entries
 	 */
 	uint32_t number_of_entries;
@@ -116,6 +120,13 @@ int libagdb_file_information_get_utf16_path(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_file_information_get_path_data(
+     libagdb_file_information_t *file_information,
+     const uint8_t **path_data,
+     size_t *path_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,2579 @@
+/*
+ * Generator functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libagdb_allocator.h"
+#include "libagdb_compression.h"
+#include "libagdb_definitions.h"
+#include "libagdb_generator.h"
+#include "libagdb_hash.h"
+#include "libagdb_io_handle.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+
+#include "agdb_database_header.h"
+#include "agdb_file_header.h"
+#include "agdb_file_information.h"
+#include "agdb_source_information.h"
+#include "agdb_volume_information.h"
+
+/* Creates a generator
+ * Make sure the value generator is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_initialize(
+     libagdb_generator_t **generator,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_initialize";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = libagdb_allocator_allocate_structure(
+	                      libagdb_internal_generator_t );
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create generator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_generator,
+	     0,
+	     sizeof( libagdb_internal_generator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear generator.",
+		 function );
+
+		goto on_error;
+	}
+	internal_generator->file_type             = LIBAGDB_FILE_TYPE_UNCOMPRESSED;
+	internal_generator->number_of_bits        = 32;
+	internal_generator->number_of_volumes     = 1;
+	internal_generator->number_of_files       = 1;
+	internal_generator->number_of_sub_entries = 1;
+	internal_generator->number_of_sources     = 1;
+
+	*generator = (libagdb_generator_t *) internal_generator;
+
+	return( 1 );
+
+on_error:
+	if( internal_generator != NULL )
+	{
+		libagdb_allocator_free(
+		 internal_generator );
+	}
+	return( -1 );
+}
+
+/* Frees a generator
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_free(
+     libagdb_generator_t **generator,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_free";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generator != NULL )
+	{
+		internal_generator = (libagdb_internal_generator_t *) *generator;
+		*generator         = NULL;
+
+		if( internal_generator->block_data != NULL )
+		{
+			libagdb_allocator_free(
+			 internal_generator->block_data );
+		}
+		if( internal_generator->compressed_block_data != NULL )
+		{
+			libagdb_allocator_free(
+			 internal_generator->compressed_block_data );
+		}
+		libagdb_allocator_free(
+		 internal_generator );
+	}
+	return( 1 );
+}
+
+/* Sets the file type
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_set_file_type(
+     libagdb_generator_t *generator,
+     uint8_t file_type,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_set_file_type";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = (libagdb_internal_generator_t *) generator;
+
+	if( ( file_type != LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	 && ( file_type != LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
+	 && ( file_type != LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 )
+	 && ( file_type != LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0 )
+	 && ( file_type != LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator->file_type = file_type;
+
+	return( 1 );
+}
+
+/* Sets the number of bits of the entry layouts
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_set_number_of_bits(
+     libagdb_generator_t *generator,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_set_number_of_bits";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = (libagdb_internal_generator_t *) generator;
+
+	if( ( number_of_bits != 32 )
+	 && ( number_of_bits != 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of bits.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator->number_of_bits = number_of_bits;
+
+	return( 1 );
+}
+
+/* Sets the number of volumes
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_set_number_of_volumes(
+     libagdb_generator_t *generator,
+     uint32_t number_of_volumes,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_set_number_of_volumes";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = (libagdb_internal_generator_t *) generator;
+
+	internal_generator->number_of_volumes = number_of_volumes;
+
+	return( 1 );
+}
+
+/* Sets the number of files per volume
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_set_number_of_files(
+     libagdb_generator_t *generator,
+     uint32_t number_of_files,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_set_number_of_files";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = (libagdb_internal_generator_t *) generator;
+
+	internal_generator->number_of_files = number_of_files;
+
+	return( 1 );
+}
+
+/* Sets the number of sub entries per file and source
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_set_number_of_sub_entries(
+     libagdb_generator_t *generator,
+     uint32_t number_of_sub_entries,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_set_number_of_sub_entries";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = (libagdb_internal_generator_t *) generator;
+
+	internal_generator->number_of_sub_entries = number_of_sub_entries;
+
+	return( 1 );
+}
+
+/* Sets the number of sources
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_set_number_of_sources(
+     libagdb_generator_t *generator,
+     uint32_t number_of_sources,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_set_number_of_sources";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = (libagdb_internal_generator_t *) generator;
+
+	internal_generator->number_of_sources = number_of_sources;
+
+	return( 1 );
+}
+
+/* Sets the file header signature, entry sizes and block size based on the file type and number of bits
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_set_layout(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_generator_set_layout";
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_generator->number_of_bits != 32 )
+	 && ( internal_generator->number_of_bits != 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of bits.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_generator->file_type )
+	{
+		case LIBAGDB_FILE_TYPE_UNCOMPRESSED:
+		case LIBAGDB_FILE_TYPE_COMPRESSED_VISTA:
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7:
+			internal_generator->file_header_signature = 0x0000000eUL;
+
+			if( internal_generator->number_of_bits == 32 )
+			{
+				internal_generator->volume_information_entry_size         = 56;
+				internal_generator->file_information_entry_size           = 36;
+				internal_generator->source_information_entry_size         = 100;
+				internal_generator->file_information_sub_entry_type1_size = 16;
+				internal_generator->file_information_sub_entry_type2_size = 24;
+			}
+			else
+			{
+				internal_generator->volume_information_entry_size         = 72;
+				internal_generator->file_information_entry_size           = 64;
+				internal_generator->source_information_entry_size         = 144;
+				internal_generator->file_information_sub_entry_type1_size = 24;
+				internal_generator->file_information_sub_entry_type2_size = 24;
+			}
+			break;
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0:
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1:
+			internal_generator->file_header_signature = 0x00000003UL;
+
+			if( internal_generator->number_of_bits == 32 )
+			{
+				internal_generator->volume_information_entry_size         = 72;
+				internal_generator->file_information_entry_size           = 48;
+				internal_generator->source_information_entry_size         = 60;
+				internal_generator->file_information_sub_entry_type1_size = 16;
+				internal_generator->file_information_sub_entry_type2_size = 24;
+			}
+			else
+			{
+				internal_generator->volume_information_entry_size         = 96;
+				internal_generator->file_information_entry_size           = 56;
+				internal_generator->source_information_entry_size         = 80;
+				internal_generator->file_information_sub_entry_type1_size = 24;
+				internal_generator->file_information_sub_entry_type2_size = 24;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported file type.",
+			 function );
+
+			return( -1 );
+	}
+	if( internal_generator->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
+	{
+		internal_generator->block_size = 4096;
+	}
+	else
+	{
+		internal_generator->block_size = 65536;
+	}
+	return( 1 );
+}
+
+/* Writes data to the file IO handle
+ * If no file IO handle is set only the file size is updated
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_write_data(
+     libagdb_internal_generator_t *internal_generator,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_generator_write_data";
+	ssize_t write_count   = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->file_io_handle != NULL )
+	{
+		write_count = libbfio_handle_write_buffer(
+		               internal_generator->file_io_handle,
+		               data,
+		               data_size,
+		               error );
+
+		if( write_count != (ssize_t) data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_generator->file_size,
+			 internal_generator->file_size );
+
+			return( -1 );
+		}
+	}
+	internal_generator->file_size += data_size;
+
+	return( 1 );
+}
+
+/* Compresses and writes the uncompressed block data
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_flush_block(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error )
+{
+	uint8_t compressed_block_size_data[ 4 ];
+
+	static char *function          = "libagdb_internal_generator_flush_block";
+	size_t compressed_block_size   = 0;
+	uint8_t is_last_chunk          = 0;
+	int result                     = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid generator - missing block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->block_data_offset == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_generator->file_type == LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	{
+		if( libagdb_internal_generator_write_data(
+		     internal_generator,
+		     internal_generator->block_data,
+		     internal_generator->block_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_generator->block_data_offset = 0;
+
+		return( 1 );
+	}
+	if( internal_generator->compressed_block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid generator - missing compressed block data.",
+		 function );
+
+		return( -1 );
+	}
+	compressed_block_size = internal_generator->compressed_block_data_size;
+
+	if( internal_generator->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_VISTA )
+	{
+		result = libagdb_compression_lznt1_compress_chunk(
+		          internal_generator->block_data,
+		          internal_generator->block_data_offset,
+		          internal_generator->compressed_block_data,
+		          &compressed_block_size,
+		          error );
+	}
+	else
+	{
+		/* A full block is decompressed up to the block size, only a partial
+		 * (last) block needs the end-of-stream symbol
+		 */
+		if( internal_generator->block_data_offset < internal_generator->block_size )
+		{
+			is_last_chunk = 1;
+		}
+		result = libagdb_compression_lzxpress_huffman_compress_chunk(
+		          internal_generator->block_data,
+		          internal_generator->block_data_offset,
+		          is_last_chunk,
+		          internal_generator->compressed_block_data,
+		          &compressed_block_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress block.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_generator->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 )
+	 || ( internal_generator->file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0 ) )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 compressed_block_size_data,
+		 (uint32_t) compressed_block_size );
+
+		if( libagdb_internal_generator_write_data(
+		     internal_generator,
+		     compressed_block_size_data,
+		     4,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write compressed block size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libagdb_internal_generator_write_data(
+	     internal_generator,
+	     internal_generator->compressed_block_data,
+	     compressed_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write compressed block data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator->block_data_offset = 0;
+
+	return( 1 );
+}
+
+/* Appends data to the uncompressed data
+ * If no block data is set only the uncompressed data offset is updated
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_append_data(
+     libagdb_internal_generator_t *internal_generator,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_generator_append_data";
+	size_t data_offset    = 0;
+	size_t copy_size      = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->block_data == NULL )
+	{
+		internal_generator->uncompressed_data_offset += data_size;
+
+		return( 1 );
+	}
+	while( data_offset < data_size )
+	{
+		copy_size = internal_generator->block_size - internal_generator->block_data_offset;
+
+		if( copy_size > ( data_size - data_offset ) )
+		{
+			copy_size = data_size - data_offset;
+		}
+		if( memory_copy(
+		     &( internal_generator->block_data[ internal_generator->block_data_offset ] ),
+		     &( data[ data_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_generator->block_data_offset        += copy_size;
+		internal_generator->uncompressed_data_offset += copy_size;
+		data_offset                                  += copy_size;
+
+		if( internal_generator->block_data_offset >= internal_generator->block_size )
+		{
+			if( libagdb_internal_generator_flush_block(
+			     internal_generator,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush block.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Appends alignment padding to the uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_append_alignment_padding(
+     libagdb_internal_generator_t *internal_generator,
+     size_t alignment_size,
+     libcerror_error_t **error )
+{
+	uint8_t alignment_padding_data[ 8 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0 };
+
+	static char *function         = "libagdb_internal_generator_append_alignment_padding";
+	size_t alignment_padding_size = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alignment_size == 0 )
+	 || ( alignment_size > 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid alignment size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	alignment_padding_size = (size_t) ( internal_generator->uncompressed_data_offset % alignment_size );
+
+	if( alignment_padding_size != 0 )
+	{
+		alignment_padding_size = alignment_size - alignment_padding_size;
+
+		if( libagdb_internal_generator_append_data(
+		     internal_generator,
+		     alignment_padding_data,
+		     alignment_padding_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append alignment padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Copies an ASCII string to an UTF-16 little-endian string including the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_copy_utf16_string(
+     const char *string,
+     size_t string_length,
+     uint8_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_generator_copy_utf16_string";
+	size_t string_index   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length >= ( (size_t) SSIZE_MAX / 2 ) )
+	 || ( utf16_string_size < ( ( string_length + 1 ) * 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-16 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		utf16_string[ string_index * 2 ]       = (uint8_t) string[ string_index ];
+		utf16_string[ ( string_index * 2 ) + 1 ] = 0;
+	}
+	utf16_string[ string_length * 2 ]         = 0;
+	utf16_string[ ( string_length * 2 ) + 1 ] = 0;
+
+	return( 1 );
+}
+
+/* Appends the file header and database header
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_append_file_header(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ sizeof( agdb_file_header_t ) + sizeof( agdb_database_header_t ) ];
+
+	agdb_database_header_t *database_header = NULL;
+	static char *function                   = "libagdb_internal_generator_append_file_header";
+	uint64_t number_of_files                = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_files = (uint64_t) internal_generator->number_of_volumes * internal_generator->number_of_files;
+
+	if( number_of_files > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     file_header_data,
+	     0,
+	     sizeof( agdb_file_header_t ) + sizeof( agdb_database_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (agdb_file_header_t *) file_header_data )->signature,
+	 internal_generator->file_header_signature );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (agdb_file_header_t *) file_header_data )->data_size,
+	 (uint32_t) internal_generator->uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (agdb_file_header_t *) file_header_data )->header_size,
+	 (uint32_t) ( sizeof( agdb_file_header_t ) + sizeof( agdb_database_header_t ) ) );
+
+	database_header = (agdb_database_header_t *) &( file_header_data[ sizeof( agdb_file_header_t ) ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_header->database_type,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( database_header->database_parameters[ 0 ] ),
+	 internal_generator->volume_information_entry_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( database_header->database_parameters[ 4 ] ),
+	 internal_generator->file_information_entry_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( database_header->database_parameters[ 8 ] ),
+	 internal_generator->source_information_entry_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( database_header->database_parameters[ 12 ] ),
+	 internal_generator->file_information_sub_entry_type1_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( database_header->database_parameters[ 16 ] ),
+	 internal_generator->file_information_sub_entry_type2_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_header->number_of_volumes,
+	 internal_generator->number_of_volumes );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_header->number_of_files,
+	 (uint32_t) number_of_files );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 database_header->number_of_sources,
+	 internal_generator->number_of_sources );
+
+	if( libagdb_internal_generator_append_data(
+	     internal_generator,
+	     file_header_data,
+	     sizeof( agdb_file_header_t ) + sizeof( agdb_database_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file header data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a volume information entry, its device path and its file information entries
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_append_volume_information(
+     libagdb_internal_generator_t *internal_generator,
+     uint32_t volume_index,
+     libcerror_error_t **error )
+{
+	uint8_t volume_information_data[ 96 ];
+	uint8_t device_path_data[ 128 ];
+	char device_path[ 64 ];
+
+	static char *function     = "libagdb_internal_generator_append_volume_information";
+	size_t alignment_size     = 0;
+	size_t device_path_length = 0;
+	uint64_t creation_time    = 0;
+	uint32_t file_index       = 0;
+	uint32_t serial_number    = 0;
+	int print_count           = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->volume_information_entry_size > 96 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid generator - volume information entry size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               device_path,
+	               64,
+	               "\\DEVICE\\HARDDISKVOLUME%" PRIu32 "",
+	               volume_index + 1 );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set device path.",
+		 function );
+
+		return( -1 );
+	}
+	device_path_length = (size_t) print_count;
+
+	if( libagdb_generator_copy_utf16_string(
+	     device_path,
+	     device_path_length,
+	     device_path_data,
+	     128,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set device path data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     volume_information_data,
+	     0,
+	     96 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume information data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use a FILETIME in 2015 and a distinct serial number per volume
+	 */
+	creation_time = 0x01d0271ca5c20000ULL + ( (uint64_t) volume_index * 864000000000ULL );
+	serial_number = 0x5a5a0000UL + volume_index;
+
+	if( internal_generator->number_of_bits == 32 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (agdb_volume_information_56_32bit_t *) volume_information_data )->number_of_files,
+		 internal_generator->number_of_files );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (agdb_volume_information_56_32bit_t *) volume_information_data )->creation_time,
+		 creation_time );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (agdb_volume_information_56_32bit_t *) volume_information_data )->serial_number,
+		 serial_number );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (agdb_volume_information_56_32bit_t *) volume_information_data )->device_path_number_of_characters,
+		 (uint16_t) device_path_length );
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (agdb_volume_information_72_64bit_t *) volume_information_data )->number_of_files,
+		 internal_generator->number_of_files );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (agdb_volume_information_72_64bit_t *) volume_information_data )->creation_time,
+		 creation_time );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (agdb_volume_information_72_64bit_t *) volume_information_data )->serial_number,
+		 serial_number );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 ( (agdb_volume_information_72_64bit_t *) volume_information_data )->device_path_number_of_characters,
+		 (uint16_t) device_path_length );
+	}
+	if( libagdb_internal_generator_append_data(
+	     internal_generator,
+	     volume_information_data,
+	     (size_t) internal_generator->volume_information_entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append volume: %" PRIu32 " information data.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( libagdb_internal_generator_append_data(
+	     internal_generator,
+	     device_path_data,
+	     ( device_path_length + 1 ) * 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append volume: %" PRIu32 " device path data.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	if( internal_generator->volume_information_entry_size == 56 )
+	{
+		alignment_size = 4;
+	}
+	else
+	{
+		alignment_size = 8;
+	}
+	if( libagdb_internal_generator_append_alignment_padding(
+	     internal_generator,
+	     alignment_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append volume: %" PRIu32 " alignment padding.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < internal_generator->number_of_files;
+	     file_index++ )
+	{
+		if( libagdb_internal_generator_append_file_information(
+		     internal_generator,
+		     volume_index,
+		     file_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume: %" PRIu32 " file: %" PRIu32 " information.",
+			 function,
+			 volume_index,
+			 file_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a file information entry, its path and its sub entries
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_append_file_information(
+     libagdb_internal_generator_t *internal_generator,
+     uint32_t volume_index,
+     uint32_t file_index,
+     libcerror_error_t **error )
+{
+	uint8_t file_information_data[ 64 ];
+	uint8_t path_data[ 256 ];
+	char path[ 128 ];
+
+	static char *function = "libagdb_internal_generator_append_file_information";
+	size_t path_length    = 0;
+	uint32_t hash_value   = 0;
+	int print_count       = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->file_information_entry_size > 64 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid generator - file information entry size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               path,
+	               128,
+	               "\\DEVICE\\HARDDISKVOLUME%" PRIu32 "\\WINDOWS\\SYSTEM32\\FILE%08" PRIX32 ".DLL",
+	               volume_index + 1,
+	               file_index );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 128 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = (size_t) print_count;
+
+	if( libagdb_generator_copy_utf16_string(
+	     path,
+	     path_length,
+	     path_data,
+	     256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set path data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_hash_calculate(
+	     &hash_value,
+	     path_data,
+	     path_length * 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path hash value.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     file_information_data,
+	     0,
+	     64 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file information data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The path number of characters value is stored in the upper 30 bits
+	 */
+	if( internal_generator->file_header_signature == 0x0000000eUL )
+	{
+		if( internal_generator->number_of_bits == 32 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_36_32bit_t *) file_information_data )->name_hash,
+			 hash_value );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_36_32bit_t *) file_information_data )->number_of_entries,
+			 internal_generator->number_of_sub_entries );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_36_32bit_t *) file_information_data )->path_number_of_characters,
+			 (uint32_t) ( path_length << 2 ) );
+		}
+		else
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 ( (agdb_file_information_64_64bit_t *) file_information_data )->name_hash,
+			 (uint64_t) hash_value );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_64_64bit_t *) file_information_data )->number_of_entries,
+			 internal_generator->number_of_sub_entries );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_64_64bit_t *) file_information_data )->path_number_of_characters,
+			 (uint32_t) ( path_length << 2 ) );
+		}
+	}
+	else
+	{
+		if( internal_generator->number_of_bits == 32 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_48_32bit_t *) file_information_data )->name_hash,
+			 hash_value );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_48_32bit_t *) file_information_data )->number_of_entries,
+			 internal_generator->number_of_sub_entries );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_48_32bit_t *) file_information_data )->path_number_of_characters,
+			 (uint32_t) ( path_length << 2 ) );
+		}
+		else
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 ( (agdb_file_information_56_64bit_t *) file_information_data )->name_hash,
+			 (uint64_t) hash_value );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_56_64bit_t *) file_information_data )->number_of_entries,
+			 internal_generator->number_of_sub_entries );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (agdb_file_information_56_64bit_t *) file_information_data )->path_number_of_characters,
+			 (uint32_t) ( path_length << 2 ) );
+		}
+	}
+	if( libagdb_internal_generator_append_data(
+	     internal_generator,
+	     file_information_data,
+	     (size_t) internal_generator->file_information_entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file information data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_generator_append_data(
+	     internal_generator,
+	     path_data,
+	     ( path_length + 1 ) * 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_generator_append_alignment_padding(
+	     internal_generator,
+	     (size_t) ( internal_generator->number_of_bits / 8 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append alignment padding.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_generator_append_sub_entries(
+	     internal_generator,
+	     internal_generator->file_information_sub_entry_type1_size,
+	     internal_generator->file_information_sub_entry_type2_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append sub entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a source information entry and its sub entries
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_append_source_information(
+     libagdb_internal_generator_t *internal_generator,
+     uint32_t source_index,
+     libcerror_error_t **error )
+{
+	uint8_t source_information_data[ 144 ];
+	char executable_filename[ 16 ];
+
+	static char *function              = "libagdb_internal_generator_append_source_information";
+	size_t name_offset                 = 0;
+	size_t number_of_entries_offset    = 0;
+	size_t prefetch_hash_offset        = 0;
+	uint32_t hash_value                = 0;
+	int print_count                    = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->source_information_entry_size > 144 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid generator - source information entry size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               executable_filename,
+	               16,
+	               "APP%08" PRIX32 ".EXE",
+	               source_index );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_hash_calculate(
+	     &hash_value,
+	     (uint8_t *) executable_filename,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename hash value.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     source_information_data,
+	     0,
+	     144 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear source information data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->number_of_bits == 32 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (agdb_source_information_60_32bit_t *) source_information_data )->name_hash,
+		 hash_value );
+	}
+	else
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (agdb_source_information_88_64bit_t *) source_information_data )->name_hash,
+		 (uint64_t) hash_value );
+	}
+	/* Only some of the source information entry layouts contain the number
+	 * of sub entries, the prefetch hash and the executable filename
+	 */
+	if( internal_generator->file_header_signature == 0x0000000eUL )
+	{
+		if( internal_generator->number_of_bits == 32 )
+		{
+			number_of_entries_offset = 8;
+			prefetch_hash_offset     = 36;
+			name_offset              = 44;
+		}
+		else
+		{
+			number_of_entries_offset = 16;
+			prefetch_hash_offset     = 56;
+			name_offset              = 72;
+		}
+	}
+	else if( internal_generator->source_information_entry_size == 80 )
+	{
+		number_of_entries_offset = 56;
+	}
+	if( number_of_entries_offset > 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( source_information_data[ number_of_entries_offset ] ),
+		 internal_generator->number_of_sub_entries );
+	}
+	if( prefetch_hash_offset > 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( source_information_data[ prefetch_hash_offset ] ),
+		 hash_value );
+	}
+	if( name_offset > 0 )
+	{
+		if( memory_copy(
+		     &( source_information_data[ name_offset ] ),
+		     executable_filename,
+		     (size_t) print_count + 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy executable filename.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libagdb_internal_generator_append_data(
+	     internal_generator,
+	     source_information_data,
+	     (size_t) internal_generator->source_information_entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source information data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries_offset > 0 )
+	{
+		if( libagdb_internal_generator_append_sub_entries(
+		     internal_generator,
+		     internal_generator->file_information_sub_entry_type2_size,
+		     internal_generator->file_information_sub_entry_type2_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends sub entries
+ * For signature 0x0000000e every other sub entry is of type 2
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_append_sub_entries(
+     libagdb_internal_generator_t *internal_generator,
+     uint32_t sub_entry_type1_size,
+     uint32_t sub_entry_type2_size,
+     libcerror_error_t **error )
+{
+	uint8_t sub_entry_data[ 32 ];
+
+	static char *function        = "libagdb_internal_generator_append_sub_entries";
+	uint32_t entry_index         = 0;
+	uint32_t sub_entry_data_size = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_entry_type1_size < 8 )
+	 || ( sub_entry_type1_size > 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub entry type 1 size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_entry_type2_size < 8 )
+	 || ( sub_entry_type2_size > 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub entry type 2 size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_generator->number_of_sub_entries;
+	     entry_index++ )
+	{
+		if( memory_set(
+		     sub_entry_data,
+		     0,
+		     32 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear sub entry data.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 sub_entry_data,
+		 entry_index );
+
+		if( ( internal_generator->file_header_signature == 0x0000000eUL )
+		 && ( ( entry_index % 2 ) != 0 ) )
+		{
+			sub_entry_data[ 4 ] = 0x20;
+			sub_entry_data_size = sub_entry_type2_size;
+		}
+		else
+		{
+			sub_entry_data_size = sub_entry_type1_size;
+		}
+		if( libagdb_internal_generator_append_data(
+		     internal_generator,
+		     sub_entry_data,
+		     (size_t) sub_entry_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sub entry: %" PRIu32 " data.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Generates the uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_generate(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_generator_generate";
+	uint32_t source_index = 0;
+	uint32_t volume_index = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator->uncompressed_data_offset = 0;
+	internal_generator->block_data_offset        = 0;
+
+	if( libagdb_internal_generator_append_file_header(
+	     internal_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file header.",
+		 function );
+
+		return( -1 );
+	}
+	for( volume_index = 0;
+	     volume_index < internal_generator->number_of_volumes;
+	     volume_index++ )
+	{
+		if( libagdb_internal_generator_append_alignment_padding(
+		     internal_generator,
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume: %" PRIu32 " alignment padding.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		if( libagdb_internal_generator_append_volume_information(
+		     internal_generator,
+		     volume_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume: %" PRIu32 " information.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+	}
+	for( source_index = 0;
+	     source_index < internal_generator->number_of_sources;
+	     source_index++ )
+	{
+		if( libagdb_internal_generator_append_source_information(
+		     internal_generator,
+		     source_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source: %" PRIu32 " information.",
+			 function,
+			 source_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calculates the uncompressed data size
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_calculate_uncompressed_data_size(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_internal_generator_calculate_uncompressed_data_size";
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->block_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generator - block data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_generator_set_layout(
+	     internal_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set layout.",
+		 function );
+
+		return( -1 );
+	}
+	/* Without block data the generated data is only counted
+	 */
+	if( libagdb_internal_generator_generate(
+	     internal_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to generate data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_generator->uncompressed_data_offset > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator->uncompressed_data_size = internal_generator->uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Writes the generated file using a Basic File IO (bfio) handle
+ * If the file IO handle is NULL only the file size is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_generator_write_file_io_handle(
+     libagdb_internal_generator_t *internal_generator,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t compressed_file_header_data[ 12 ];
+
+	static char *function                 = "libagdb_internal_generator_write_file_io_handle";
+	const char *signature                 = NULL;
+	size_t compressed_file_header_size    = 0;
+
+	if( internal_generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_generator_calculate_uncompressed_data_size(
+	     internal_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate uncompressed data size.",
+		 function );
+
+		goto on_error;
+	}
+	internal_generator->block_data = (uint8_t *) libagdb_allocator_allocate(
+	                                              sizeof( uint8_t ) * internal_generator->block_size );
+
+	if( internal_generator->block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_generator->file_type != LIBAGDB_FILE_TYPE_UNCOMPRESSED )
+	{
+		/* The size is sufficient for both a LZNT1 chunk and a LZXPRESS Huffman chunk
+		 */
+		internal_generator->compressed_block_data_size = ( internal_generator->block_size * 2 ) + 512;
+
+		internal_generator->compressed_block_data = (uint8_t *) libagdb_allocator_allocate(
+		                                                         sizeof( uint8_t ) * internal_generator->compressed_block_data_size );
+
+		if( internal_generator->compressed_block_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressed block data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_generator->file_io_handle = file_io_handle;
+	internal_generator->file_size      = 0;
+
+	switch( internal_generator->file_type )
+	{
+		case LIBAGDB_FILE_TYPE_COMPRESSED_VISTA:
+			signature                   = agdb_mem_file_signature_vista;
+			compressed_file_header_size = 8;
+			break;
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7:
+			signature                   = agdb_mem_file_signature_win7;
+			compressed_file_header_size = 8;
+			break;
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0:
+			signature                   = agdb_mem_file_signature_win8_0;
+			compressed_file_header_size = 12;
+			break;
+
+		case LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1:
+			signature                   = agdb_mam_file_signature_win8_1;
+			compressed_file_header_size = 12;
+			break;
+
+		default:
+			break;
+	}
+	if( signature != NULL )
+	{
+		if( memory_set(
+		     compressed_file_header_data,
+		     0,
+		     12 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear compressed file header data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     compressed_file_header_data,
+		     signature,
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy signature.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( compressed_file_header_data[ 4 ] ),
+		 (uint32_t) internal_generator->uncompressed_data_size );
+
+		if( libagdb_internal_generator_write_data(
+		     internal_generator,
+		     compressed_file_header_data,
+		     compressed_file_header_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write compressed file header.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libagdb_internal_generator_generate(
+	     internal_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to generate data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_internal_generator_flush_block(
+	     internal_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush block.",
+		 function );
+
+		goto on_error;
+	}
+	internal_generator->file_io_handle = NULL;
+
+	if( internal_generator->compressed_block_data != NULL )
+	{
+		libagdb_allocator_free(
+		 internal_generator->compressed_block_data );
+
+		internal_generator->compressed_block_data = NULL;
+	}
+	libagdb_allocator_free(
+	 internal_generator->block_data );
+
+	internal_generator->block_data = NULL;
+
+	return( 1 );
+
+on_error:
+	internal_generator->file_io_handle = NULL;
+
+	if( internal_generator->compressed_block_data != NULL )
+	{
+		libagdb_allocator_free(
+		 internal_generator->compressed_block_data );
+
+		internal_generator->compressed_block_data = NULL;
+	}
+	if( internal_generator->block_data != NULL )
+	{
+		libagdb_allocator_free(
+		 internal_generator->block_data );
+
+		internal_generator->block_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the uncompressed data size
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_get_uncompressed_data_size(
+     libagdb_generator_t *generator,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_get_uncompressed_data_size";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = (libagdb_internal_generator_t *) generator;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_generator_calculate_uncompressed_data_size(
+	     internal_generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = (uint32_t) internal_generator->uncompressed_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the generated file
+ * For the compressed file types this requires the data to be compressed
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_get_file_size(
+     libagdb_generator_t *generator,
+     size64_t *file_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_get_file_size";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = (libagdb_internal_generator_t *) generator;
+
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_generator_write_file_io_handle(
+	     internal_generator,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file size.",
+		 function );
+
+		return( -1 );
+	}
+	*file_size = internal_generator->file_size;
+
+	return( 1 );
+}
+
+/* Writes the generated file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_write(
+     libagdb_generator_t *generator,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libagdb_generator_write";
+	size_t filename_length           = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_generator_write_file_io_handle(
+	     generator,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes the generated file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_write_wide(
+     libagdb_generator_t *generator,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libagdb_generator_write_wide";
+	size_t filename_length           = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_generator_write_file_io_handle(
+	     generator,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes the generated file using a Basic File IO (bfio) handle
+ * The file IO handle is opened for writing if it is not already open
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_generator_write_file_io_handle(
+     libagdb_generator_t *generator,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libagdb_internal_generator_t *internal_generator = NULL;
+	static char *function                            = "libagdb_generator_write_file_io_handle";
+	int file_io_handle_is_open                       = 0;
+	int file_io_handle_opened_in_library             = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_generator = (libagdb_internal_generator_t *) generator;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_WRITE_TRUNCATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libagdb_internal_generator_write_file_io_handle(
+	     internal_generator,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write to file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
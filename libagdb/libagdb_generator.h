@@ -0,0 +1,282 @@
+/*
+ * Generator functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_GENERATOR_H )
+#define _LIBAGDB_GENERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_extern.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_internal_generator libagdb_internal_generator_t;
+
+struct libagdb_internal_generator
+{
+	/* The file type
+	 */
+	uint8_t file_type;
+
+	/* The number of bits of the entry layouts
+	 */
+	uint8_t number_of_bits;
+
+	/* The number of volumes
+	 */
+	uint32_t number_of_volumes;
+
+	/* The number of files per volume
+	 */
+	uint32_t number_of_files;
+
+	/* The number of sub entries per file and source
+	 */
+	uint32_t number_of_sub_entries;
+
+	/* The number of sources
+	 */
+	uint32_t number_of_sources;
+
+	/* The file header signature
+	 */
+	uint32_t file_header_signature;
+
+	/* The volume information entry size
+	 */
+	uint32_t volume_information_entry_size;
+
+	/* The file information entry size
+	 */
+	uint32_t file_information_entry_size;
+
+	/* The source information entry size
+	 */
+	uint32_t source_information_entry_size;
+
+	/* The file information sub entry type 1 size
+	 */
+	uint32_t file_information_sub_entry_type1_size;
+
+	/* The file information sub entry type 2 size
+	 */
+	uint32_t file_information_sub_entry_type2_size;
+
+	/* The uncompressed data size
+	 */
+	size64_t uncompressed_data_size;
+
+	/* The current uncompressed data offset
+	 */
+	size64_t uncompressed_data_offset;
+
+	/* The uncompressed block size
+	 */
+	size_t block_size;
+
+	/* The uncompressed block data
+	 */
+	uint8_t *block_data;
+
+	/* The uncompressed block data offset
+	 */
+	size_t block_data_offset;
+
+	/* The compressed block data
+	 */
+	uint8_t *compressed_block_data;
+
+	/* The compressed block data size
+	 */
+	size_t compressed_block_data_size;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The file size
+	 */
+	size64_t file_size;
+};
+
+LIBAGDB_EXTERN \
+int libagdb_generator_initialize(
+     libagdb_generator_t **generator,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_free(
+     libagdb_generator_t **generator,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_set_file_type(
+     libagdb_generator_t *generator,
+     uint8_t file_type,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_set_number_of_bits(
+     libagdb_generator_t *generator,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_set_number_of_volumes(
+     libagdb_generator_t *generator,
+     uint32_t number_of_volumes,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_set_number_of_files(
+     libagdb_generator_t *generator,
+     uint32_t number_of_files,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_set_number_of_sub_entries(
+     libagdb_generator_t *generator,
+     uint32_t number_of_sub_entries,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_set_number_of_sources(
+     libagdb_generator_t *generator,
+     uint32_t number_of_sources,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_set_layout(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_write_data(
+     libagdb_internal_generator_t *internal_generator,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_flush_block(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_append_data(
+     libagdb_internal_generator_t *internal_generator,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_append_alignment_padding(
+     libagdb_internal_generator_t *internal_generator,
+     size_t alignment_size,
+     libcerror_error_t **error );
+
+int libagdb_generator_copy_utf16_string(
+     const char *string,
+     size_t string_length,
+     uint8_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_append_file_header(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_append_volume_information(
+     libagdb_internal_generator_t *internal_generator,
+     uint32_t volume_index,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_append_file_information(
+     libagdb_internal_generator_t *internal_generator,
+     uint32_t volume_index,
+     uint32_t file_index,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_append_source_information(
+     libagdb_internal_generator_t *internal_generator,
+     uint32_t source_index,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_append_sub_entries(
+     libagdb_internal_generator_t *internal_generator,
+     uint32_t sub_entry_type1_size,
+     uint32_t sub_entry_type2_size,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_generate(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_calculate_uncompressed_data_size(
+     libagdb_internal_generator_t *internal_generator,
+     libcerror_error_t **error );
+
+int libagdb_internal_generator_write_file_io_handle(
+     libagdb_internal_generator_t *internal_generator,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_get_uncompressed_data_size(
+     libagdb_generator_t *generator,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_get_file_size(
+     libagdb_generator_t *generator,
+     size64_t *file_size,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_write(
+     libagdb_generator_t *generator,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBAGDB_EXTERN \
+int libagdb_generator_write_wide(
+     libagdb_generator_t *generator,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBAGDB_EXTERN \
+int libagdb_generator_write_file_io_handle(
+     libagdb_generator_t *generator,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_GENERATOR_H ) */
+
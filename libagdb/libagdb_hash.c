@@ -20,11 +20,22 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <types.h>
 
 #include "libagdb_hash.h"
 #include "libagdb_libcerror.h"
 
+#define libagdb_hash_rotate_left64( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 64 - ( number_of_bits ) ) ) )
+
+#define libagdb_hash_finalize64( value ) \
+	( value ) ^= ( value ) >> 33; \
+	( value ) *= 0xff51afd7ed558ccdULL; \
+	( value ) ^= ( value ) >> 33; \
+	( value ) *= 0xc4ceb9fe1a85ec53ULL; \
+	( value ) ^= ( value ) >> 33;
+
 /* Calculates the hash of the data
  * Returns 1 if successful or -1 on error
  */
@@ -102,3 +113,156 @@ int libagdb_hash_calculate(
 	return( 1 );
 }
 
+/* Calculates the 128-bit hash of the data
+ * This is a fast non-cryptographic hash that uses the 128-bit MurmurHash3 (x64) algorithm
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_hash_calculate_128bit(
+     uint64_t *hash_value_upper,
+     uint64_t *hash_value_lower,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t seed,
+     libcerror_error_t **error )
+{
+	static char *function   = "libagdb_hash_calculate_128bit";
+	size_t data_offset      = 0;
+	size_t remaining_size   = 0;
+	uint64_t lower_value    = 0;
+	uint64_t upper_value    = 0;
+	uint64_t value_64bit    = 0;
+	uint64_t value_64bit_2  = 0;
+
+	if( hash_value_upper == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash value upper.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_value_lower == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash value lower.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	lower_value = seed;
+	upper_value = seed;
+
+	for( data_offset = 0;
+	     ( data_offset + 16 ) <= data_size;
+	     data_offset += 16 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 value_64bit_2 );
+
+		value_64bit *= 0x87c37b91114253d5ULL;
+		value_64bit  = libagdb_hash_rotate_left64( value_64bit, 31 );
+		value_64bit *= 0x4cf5ad432745937fULL;
+		lower_value ^= value_64bit;
+
+		lower_value  = libagdb_hash_rotate_left64( lower_value, 27 );
+		lower_value += upper_value;
+		lower_value  = ( lower_value * 5 ) + 0x52dce729UL;
+
+		value_64bit_2 *= 0x4cf5ad432745937fULL;
+		value_64bit_2  = libagdb_hash_rotate_left64( value_64bit_2, 33 );
+		value_64bit_2 *= 0x87c37b91114253d5ULL;
+		upper_value   ^= value_64bit_2;
+
+		upper_value  = libagdb_hash_rotate_left64( upper_value, 31 );
+		upper_value += lower_value;
+		upper_value  = ( upper_value * 5 ) + 0x38495ab5UL;
+	}
+	remaining_size = data_size - data_offset;
+
+	if( remaining_size > 8 )
+	{
+		value_64bit_2 = 0;
+
+		while( remaining_size > 8 )
+		{
+			remaining_size--;
+
+			value_64bit_2 <<= 8;
+			value_64bit_2  |= data[ data_offset + remaining_size ];
+		}
+		value_64bit_2 *= 0x4cf5ad432745937fULL;
+		value_64bit_2  = libagdb_hash_rotate_left64( value_64bit_2, 33 );
+		value_64bit_2 *= 0x87c37b91114253d5ULL;
+		upper_value   ^= value_64bit_2;
+	}
+	if( remaining_size > 0 )
+	{
+		value_64bit = 0;
+
+		while( remaining_size > 0 )
+		{
+			remaining_size--;
+
+			value_64bit <<= 8;
+			value_64bit  |= data[ data_offset + remaining_size ];
+		}
+		value_64bit *= 0x87c37b91114253d5ULL;
+		value_64bit  = libagdb_hash_rotate_left64( value_64bit, 31 );
+		value_64bit *= 0x4cf5ad432745937fULL;
+		lower_value ^= value_64bit;
+	}
+	lower_value ^= (uint64_t) data_size;
+	upper_value ^= (uint64_t) data_size;
+
+	lower_value += upper_value;
+	upper_value += lower_value;
+
+	libagdb_hash_finalize64(
+	 lower_value );
+
+	libagdb_hash_finalize64(
+	 upper_value );
+
+	lower_value += upper_value;
+	upper_value += lower_value;
+
+	*hash_value_upper = upper_value;
+	*hash_value_lower = lower_value;
+
+	return( 1 );
+}
+
@@ -37,6 +37,14 @@ int libagdb_hash_calculate(
      size_t data_size,
      libcerror_error_t **error );
 
+int libagdb_hash_calculate_128bit(
+     uint64_t *hash_value_upper,
+     uint64_t *hash_value_lower,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t seed,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,9 +24,19 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#if defined( HAVE_TIME_H ) || defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libagdb_allocator.h"
 #include "libagdb_debug.h"
 #include "libagdb_definitions.h"
 #include "libagdb_io_handle.h"
+#include "libagdb_layout.h"
 #include "libagdb_libbfio.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libcnotify.h"
@@ -71,7 +81,7 @@ int libagdb_io_handle_initialize(
 
 		return( -1 );
 	}
-	*io_handle = memory_allocate_structure(
+	*io_handle = libagdb_allocator_allocate_structure(
 	              libagdb_io_handle_t );
 
 	if( *io_handle == NULL )
@@ -99,12 +109,14 @@ int libagdb_io_handle_initialize(
 
 		goto on_error;
 	}
+	( *io_handle )->validation_level = LIBAGDB_VALIDATION_LEVEL_FAST;
+
 	return( 1 );
 
 on_error:
 	if( *io_handle != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *io_handle );
 
 		*io_handle = NULL;
@@ -134,7 +146,7 @@ int libagdb_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *io_handle );
 
 		*io_handle = NULL;
@@ -149,7 +161,10 @@ int libagdb_io_handle_clear(
      libagdb_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
+	libagdb_trace_callbacks_t trace_callbacks;
+
 	static char *function = "libagdb_io_handle_clear";
+	int validation_level  = 0;
 
 	if( io_handle == NULL )
 	{
@@ -162,6 +177,11 @@ int libagdb_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The validation level and trace callbacks are settings and are retained
+	 */
+	validation_level = io_handle->validation_level;
+	trace_callbacks  = io_handle->trace_callbacks;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -176,9 +196,419 @@ int libagdb_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->validation_level = validation_level;
+	io_handle->trace_callbacks  = trace_callbacks;
+
+	return( 1 );
+}
+
+/* Sets the entry layouts based on the file header signature and the entry sizes
+ * A layout is set to NULL if its entry size is not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_io_handle_set_layouts(
+     libagdb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_io_handle_set_layouts";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_layout_get_volume_information_layout(
+	     io_handle->file_header_signature,
+	     io_handle->volume_information_entry_size,
+	     &( io_handle->volume_information_layout ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume information layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_layout_get_file_information_layout(
+	     io_handle->file_header_signature,
+	     io_handle->file_information_entry_size,
+	     &( io_handle->file_information_layout ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file information layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_layout_get_source_information_layout(
+	     io_handle->file_header_signature,
+	     io_handle->source_information_entry_size,
+	     &( io_handle->source_information_layout ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source information layout.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Checks if the padding data only contains 0-byte values
+ * Returns 1 if the padding data is empty, 0 if not or -1 on error
+ */
+int libagdb_io_handle_check_padding_data(
+     const uint8_t *padding_data,
+     size_t padding_data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libagdb_io_handle_check_padding_data";
+	size_t padding_data_index = 0;
+
+	if( padding_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid padding data.",
+		 function );
+
+		return( -1 );
+	}
+	if( padding_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid padding data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( padding_data_index = 0;
+	     padding_data_index < padding_data_size;
+	     padding_data_index++ )
+	{
+		if( padding_data[ padding_data_index ] != 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the current time of a monotonic clock in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_io_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+#else
+	struct timeval time_value;
+#endif
+
+	static char *function = "libagdb_io_handle_get_current_time";
+
+	if( current_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 )
+	 || ( frequency.QuadPart == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = (uint64_t) ( ( counter.QuadPart / frequency.QuadPart ) * 1000000000 )
+	              + (uint64_t) ( ( ( counter.QuadPart % frequency.QuadPart ) * 1000000000 ) / frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock time.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_value.tv_sec * 1000000000 )
+	              + (uint64_t) time_value.tv_nsec;
+
+#else
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve time of day.",
+		 function );
+
+		return( -1 );
+	}
+	*current_time = ( (uint64_t) time_value.tv_sec * 1000000000 )
+	              + ( (uint64_t) time_value.tv_usec * 1000 );
+
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+}
+
+/* Sets the memory mapped file data
+ * The mapped data is not managed by the IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_io_handle_set_mapped_data(
+     libagdb_io_handle_t *io_handle,
+     const uint8_t *mapped_data,
+     size64_t mapped_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_io_handle_set_mapped_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mapped_data == NULL )
+	 && ( mapped_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid mapped data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->mapped_data        = mapped_data;
+	io_handle->mapped_data_size   = mapped_data_size;
+	io_handle->mapped_data_offset = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a pointer to memory mapped file data
+ * Returns 1 if successful, 0 if no mapped data is available or -1 on error
+ */
+int libagdb_io_handle_get_mapped_data(
+     libagdb_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_io_handle_get_mapped_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->mapped_data == NULL )
+	{
+		return( 0 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > io_handle->mapped_data_size )
+	 || ( (size64_t) size > ( io_handle->mapped_data_size - (size64_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset: %" PRIi64 " and size: %" PRIzd " value out of bounds.",
+		 function,
+		 offset,
+		 size );
+
+		return( -1 );
+	}
+	*data = &( io_handle->mapped_data[ offset ] );
+
 	return( 1 );
 }
 
+/* Reads data at a specific offset into a buffer
+ * The data is copied from the memory mapped file data if available
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libagdb_io_handle_read_buffer_at_offset(
+         libagdb_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	const uint8_t *mapped_data = NULL;
+	static char *function      = "libagdb_io_handle_read_buffer_at_offset";
+	ssize_t read_count         = 0;
+	int result                 = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          offset,
+	          size,
+	          &mapped_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( memory_copy(
+		     buffer,
+		     mapped_data,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy mapped data.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) size;
+
+		io_handle->statistics[ LIBAGDB_STATISTIC_MAPPED_BYTES_READ ] += (uint64_t) read_count;
+		io_handle->statistics[ LIBAGDB_STATISTIC_MAPPED_READ_CALLS ] += 1;
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		io_handle->statistics[ LIBAGDB_STATISTIC_BYTES_READ ] += (uint64_t) read_count;
+		io_handle->statistics[ LIBAGDB_STATISTIC_READ_CALLS ] += 1;
+	}
+	return( read_count );
+}
+
 /* Reads the compressed blocks
  * Returns 1 if successful or -1 on error
  */
@@ -259,7 +689,8 @@ int libagdb_io_handle_read_compressed_blocks(
 			 file_offset );
 		}
 #endif
-		read_count = libbfio_handle_read_buffer_at_offset(
+		read_count = libagdb_io_handle_read_buffer_at_offset(
+		              io_handle,
 		              file_io_handle,
 		              compressed_block_data,
 		              read_size,
@@ -415,7 +846,7 @@ int libagdb_io_handle_read_compressed_blocks(
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libagdb_io_handle_read_segment_data(
-         intptr_t *data_handle LIBAGDB_ATTRIBUTE_UNUSED,
+         libagdb_io_handle_t *io_handle,
          intptr_t *file_io_handle,
          int segment_index,
          int segment_file_index LIBAGDB_ATTRIBUTE_UNUSED,
@@ -428,11 +859,21 @@ ssize_t libagdb_io_handle_read_segment_data(
 	static char *function = "libagdb_io_handle_read_segment_data";
 	ssize_t read_count    = 0;
 
-	LIBAGDB_UNREFERENCED_PARAMETER( data_handle )
 	LIBAGDB_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBAGDB_UNREFERENCED_PARAMETER( segment_flags )
 	LIBAGDB_UNREFERENCED_PARAMETER( read_flags )
 
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( segment_data_size > (size64_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
@@ -444,11 +885,29 @@ ssize_t libagdb_io_handle_read_segment_data(
 
 		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
-	              (libbfio_handle_t *) file_io_handle,
-	              segment_data,
-	              segment_data_size,
-	              error );
+	if( io_handle->mapped_data != NULL )
+	{
+		read_count = libagdb_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              (libbfio_handle_t *) file_io_handle,
+		              segment_data,
+		              segment_data_size,
+		              io_handle->mapped_data_offset,
+		              error );
+
+		if( read_count > 0 )
+		{
+			io_handle->mapped_data_offset += (off64_t) read_count;
+		}
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer(
+		              (libbfio_handle_t *) file_io_handle,
+		              segment_data,
+		              segment_data_size,
+		              error );
+	}
 
 	if( read_count != (ssize_t) segment_data_size )
 	{
@@ -462,6 +921,13 @@ ssize_t libagdb_io_handle_read_segment_data(
 
 		return( -1 );
 	}
+	/* Reads of mapped data are counted by libagdb_io_handle_read_buffer_at_offset
+	 */
+	if( io_handle->mapped_data == NULL )
+	{
+		io_handle->statistics[ LIBAGDB_STATISTIC_BYTES_READ ] += (uint64_t) read_count;
+		io_handle->statistics[ LIBAGDB_STATISTIC_READ_CALLS ] += 1;
+	}
 	return( read_count );
 }
 
@@ -470,7 +936,7 @@ ssize_t libagdb_io_handle_read_segment_data(
  * Returns the offset if seek is successful or -1 on error
  */
 off64_t libagdb_io_handle_seek_segment_offset(
-         intptr_t *data_handle LIBAGDB_ATTRIBUTE_UNUSED,
+         libagdb_io_handle_t *io_handle,
          intptr_t *file_io_handle,
          int segment_index,
          int segment_file_index LIBAGDB_ATTRIBUTE_UNUSED,
@@ -479,9 +945,38 @@ off64_t libagdb_io_handle_seek_segment_offset(
 {
 	static char *function = "libagdb_io_handle_seek_segment_offset";
 
-	LIBAGDB_UNREFERENCED_PARAMETER( data_handle )
 	LIBAGDB_UNREFERENCED_PARAMETER( segment_file_index )
 
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reading from the memory mapped file data does not require a seek
+	 */
+	if( io_handle->mapped_data != NULL )
+	{
+		io_handle->mapped_data_offset = segment_offset;
+
+		return( segment_offset );
+	}
 	if( libbfio_handle_seek_offset(
 	     (libbfio_handle_t *) file_io_handle,
 	     segment_offset,
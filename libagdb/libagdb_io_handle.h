@@ -25,11 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libagdb_content_fingerprint.h"
+#include "libagdb_definitions.h"
 #include "libagdb_extern.h"
+#include "libagdb_layout.h"
 #include "libagdb_libbfio.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_trace.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -95,6 +99,46 @@ struct libagdb_io_handle
 	 */
 	uint32_t file_information_sub_entry_type2_size;
 
+	/* The validation level
+	 */
+	int validation_level;
+
+	/* The trace callbacks
+	 */
+	libagdb_trace_callbacks_t trace_callbacks;
+
+	/* The volume information layout
+	 */
+	const libagdb_volume_information_layout_t *volume_information_layout;
+
+	/* The file information layout
+	 */
+	const libagdb_file_information_layout_t *file_information_layout;
+
+	/* The source information layout
+	 */
+	const libagdb_source_information_layout_t *source_information_layout;
+
+	/* The memory mapped file data
+	 */
+	const uint8_t *mapped_data;
+
+	/* The memory mapped file data size
+	 */
+	size64_t mapped_data_size;
+
+	/* The current offset in the memory mapped file data
+	 */
+	off64_t mapped_data_offset;
+
+	/* The content fingerprint that is updated while the file is opened
+	 */
+	libagdb_content_fingerprint_t *content_fingerprint;
+
+	/* The statistics
+	 */
+	uint64_t statistics[ LIBAGDB_NUMBER_OF_STATISTICS ];
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -112,6 +156,40 @@ int libagdb_io_handle_clear(
      libagdb_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libagdb_io_handle_set_layouts(
+     libagdb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libagdb_io_handle_check_padding_data(
+     const uint8_t *padding_data,
+     size_t padding_data_size,
+     libcerror_error_t **error );
+
+int libagdb_io_handle_get_current_time(
+     uint64_t *current_time,
+     libcerror_error_t **error );
+
+int libagdb_io_handle_set_mapped_data(
+     libagdb_io_handle_t *io_handle,
+     const uint8_t *mapped_data,
+     size64_t mapped_data_size,
+     libcerror_error_t **error );
+
+int libagdb_io_handle_get_mapped_data(
+     libagdb_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+ssize_t libagdb_io_handle_read_buffer_at_offset(
+         libagdb_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 int libagdb_io_handle_read_compressed_blocks(
      libagdb_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -119,7 +197,7 @@ int libagdb_io_handle_read_compressed_blocks(
      libcerror_error_t **error );
 
 ssize_t libagdb_io_handle_read_segment_data(
-         intptr_t *data_handle,
+         libagdb_io_handle_t *io_handle,
          intptr_t *file_io_handle,
          int segment_index,
          int segment_file_index,
@@ -130,7 +208,7 @@ ssize_t libagdb_io_handle_read_segment_data(
          libcerror_error_t **error );
 
 off64_t libagdb_io_handle_seek_segment_offset(
-         intptr_t *data_handle,
+         libagdb_io_handle_t *io_handle,
          intptr_t *file_io_handle,
          int segment_index,
          int segment_file_index,
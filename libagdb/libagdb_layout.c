@@ -0,0 +1,192 @@
+/*
+ * Entry layout functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_layout.h"
+#include "libagdb_libcerror.h"
+
+/* The layouts are matched by the (uncompressed) file header signature
+ * and the entry size as stored in the database header
+ */
+
+#define LIBAGDB_VOLUME_INFORMATION_LAYOUTS_NUMBER_OF_LAYOUTS	6
+
+static const libagdb_volume_information_layout_t libagdb_volume_information_layouts[ LIBAGDB_VOLUME_INFORMATION_LAYOUTS_NUMBER_OF_LAYOUTS ] = {
+	{ 0x00000003UL, 72, 32, 8, 8, 24, 32, 44 },
+	{ 0x00000003UL, 96, 64, 8, 16, 32, 40, 56 },
+	{ 0x0000000eUL, 56, 32, 4, 8, 24, 32, 44 },
+	{ 0x0000000eUL, 72, 64, 8, 16, 32, 40, 56 },
+	{ 0x0000000fUL, 56, 32, 4, 8, 24, 32, 44 },
+	{ 0x0000000fUL, 72, 64, 8, 16, 32, 40, 56 } };
+
+#define LIBAGDB_FILE_INFORMATION_LAYOUTS_NUMBER_OF_LAYOUTS	13
+
+static const libagdb_file_information_layout_t libagdb_file_information_layouts[ LIBAGDB_FILE_INFORMATION_LAYOUTS_NUMBER_OF_LAYOUTS ] = {
+	{ 0x00000003UL, 48, 32, 4, 44, 8, 0 },
+	{ 0x00000003UL, 56, 64, 8, 32, 16, 0 },
+	{ 0x00000003UL, 72, 32, 4, 44, 8, 0 },
+	{ 0x00000003UL, 80, 64, 8, 76, 16, 0 },
+	{ 0x00000003UL, 112, 64, 8, 76, 16, 0 },
+	{ 0x0000000eUL, 36, 32, 4, 8, 28, 0x20 },
+	{ 0x0000000eUL, 52, 32, 4, 8, 28, 0x20 },
+	{ 0x0000000eUL, 64, 64, 8, 16, 48, 0x20 },
+	{ 0x0000000eUL, 72, 32, 4, 8, 28, 0x20 },
+	{ 0x0000000eUL, 88, 64, 8, 16, 48, 0x20 },
+	{ 0x0000000eUL, 112, 64, 8, 16, 48, 0x20 },
+	{ 0x0000000fUL, 72, 32, 4, 44, 8, 0 },
+	{ 0x0000000fUL, 112, 64, 8, 76, 16, 0 } };
+
+#define LIBAGDB_SOURCE_INFORMATION_LAYOUTS_NUMBER_OF_LAYOUTS	9
+
+static const libagdb_source_information_layout_t libagdb_source_information_layouts[ LIBAGDB_SOURCE_INFORMATION_LAYOUTS_NUMBER_OF_LAYOUTS ] = {
+	{ 0x00000003UL, 60, 32, 0, 0, 4 },
+	{ 0x00000003UL, 80, 64, 56, 0, 8 },
+	{ 0x00000003UL, 88, 64, 0, 0, 8 },
+	{ 0x0000000eUL, 60, 32, 8, 0, 4 },
+	{ 0x0000000eUL, 88, 64, 16, 0, 8 },
+	{ 0x0000000eUL, 100, 32, 8, 44, 36 },
+	{ 0x0000000eUL, 144, 64, 16, 72, 56 },
+	{ 0x0000000fUL, 100, 32, 0, 24, 16 },
+	{ 0x0000000fUL, 144, 64, 0, 40, 24 } };
+
+/* Retrieves the volume information layout
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libagdb_layout_get_volume_information_layout(
+     uint32_t file_header_signature,
+     uint32_t entry_size,
+     const libagdb_volume_information_layout_t **layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_layout_get_volume_information_layout";
+	int layout_index      = 0;
+
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	for( layout_index = 0;
+	     layout_index < LIBAGDB_VOLUME_INFORMATION_LAYOUTS_NUMBER_OF_LAYOUTS;
+	     layout_index++ )
+	{
+		if( ( libagdb_volume_information_layouts[ layout_index ].file_header_signature == file_header_signature )
+		 && ( libagdb_volume_information_layouts[ layout_index ].entry_size == entry_size ) )
+		{
+			*layout = &( libagdb_volume_information_layouts[ layout_index ] );
+
+			return( 1 );
+		}
+	}
+	*layout = NULL;
+
+	return( 0 );
+}
+
+/* Retrieves the file information layout
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libagdb_layout_get_file_information_layout(
+     uint32_t file_header_signature,
+     uint32_t entry_size,
+     const libagdb_file_information_layout_t **layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_layout_get_file_information_layout";
+	int layout_index      = 0;
+
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	for( layout_index = 0;
+	     layout_index < LIBAGDB_FILE_INFORMATION_LAYOUTS_NUMBER_OF_LAYOUTS;
+	     layout_index++ )
+	{
+		if( ( libagdb_file_information_layouts[ layout_index ].file_header_signature == file_header_signature )
+		 && ( libagdb_file_information_layouts[ layout_index ].entry_size == entry_size ) )
+		{
+			*layout = &( libagdb_file_information_layouts[ layout_index ] );
+
+			return( 1 );
+		}
+	}
+	*layout = NULL;
+
+	return( 0 );
+}
+
+/* Retrieves the source information layout
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libagdb_layout_get_source_information_layout(
+     uint32_t file_header_signature,
+     uint32_t entry_size,
+     const libagdb_source_information_layout_t **layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_layout_get_source_information_layout";
+	int layout_index      = 0;
+
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	for( layout_index = 0;
+	     layout_index < LIBAGDB_SOURCE_INFORMATION_LAYOUTS_NUMBER_OF_LAYOUTS;
+	     layout_index++ )
+	{
+		if( ( libagdb_source_information_layouts[ layout_index ].file_header_signature == file_header_signature )
+		 && ( libagdb_source_information_layouts[ layout_index ].entry_size == entry_size ) )
+		{
+			*layout = &( libagdb_source_information_layouts[ layout_index ] );
+
+			return( 1 );
+		}
+	}
+	*layout = NULL;
+
+	return( 0 );
+}
+
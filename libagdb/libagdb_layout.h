@@ -0,0 +1,161 @@
+/*
+ * Entry layout functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBAGDB_LAYOUT_H )
+#define _LIBAGDB_LAYOUT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_volume_information_layout libagdb_volume_information_layout_t;
+
+struct libagdb_volume_information_layout
+{
+	/* The (uncompressed) file header signature
+	 */
+	uint32_t file_header_signature;
+
+	/* The entry size
+	 */
+	uint32_t entry_size;
+
+	/* The number of bits
+	 */
+	uint8_t number_of_bits;
+
+	/* The alignment size
+	 */
+	uint8_t alignment_size;
+
+	/* The offset of the number of files (32-bit)
+	 */
+	uint8_t number_of_files_offset;
+
+	/* The offset of the creation time (64-bit)
+	 */
+	uint8_t creation_time_offset;
+
+	/* The offset of the serial number (32-bit)
+	 */
+	uint8_t serial_number_offset;
+
+	/* The offset of the device path number of characters (16-bit)
+	 */
+	uint8_t device_path_number_of_characters_offset;
+};
+
+typedef struct libagdb_file_information_layout libagdb_file_information_layout_t;
+
+struct libagdb_file_information_layout
+{
+	/* The (uncompressed) file header signature
+	 */
+	uint32_t file_header_signature;
+
+	/* The entry size
+	 */
+	uint32_t entry_size;
+
+	/* The number of bits
+	 */
+	uint8_t number_of_bits;
+
+	/* The alignment size
+	 */
+	uint8_t alignment_size;
+
+	/* The offset of the number of entries (32-bit)
+	 */
+	uint8_t number_of_entries_offset;
+
+	/* The offset of the path number of characters (32-bit)
+	 */
+	uint8_t path_number_of_characters_offset;
+
+	/* The sub entry flag that indicates a sub entry of type 2
+	 * or 0 if all sub entries are of type 1
+	 */
+	uint8_t sub_entry_type2_flag;
+};
+
+typedef struct libagdb_source_information_layout libagdb_source_information_layout_t;
+
+struct libagdb_source_information_layout
+{
+	/* The (uncompressed) file header signature
+	 */
+	uint32_t file_header_signature;
+
+	/* The entry size
+	 */
+	uint32_t entry_size;
+
+	/* The number of bits
+	 */
+	uint8_t number_of_bits;
+
+	/* The offset of the number of entries (32-bit)
+	 * or 0 if not available
+	 */
+	uint8_t number_of_entries_offset;
+
+	/* The offset of the executable filename (16 bytes)
+	 * or 0 if not available
+	 */
+	uint8_t executable_filename_offset;
+
+	/* The offset of the prefetch hash (32-bit)
+	 * the name hash is used if the entry has no separate prefetch hash
+	 */
+	uint8_t prefetch_hash_offset;
+};
+
+int libagdb_layout_get_volume_information_layout(
+     uint32_t file_header_signature,
+     uint32_t entry_size,
+     const libagdb_volume_information_layout_t **layout,
+     libcerror_error_t **error );
+
+int libagdb_layout_get_file_information_layout(
+     uint32_t file_header_signature,
+     uint32_t entry_size,
+     const libagdb_file_information_layout_t **layout,
+     libcerror_error_t **error );
+
+int libagdb_layout_get_source_information_layout(
+     uint32_t file_header_signature,
+     uint32_t entry_size,
+     const libagdb_source_information_layout_t **layout,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_LAYOUT_H ) */
+
@@ -0,0 +1,557 @@
+/*
+ * Memory map functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libagdb_allocator.h"
+#include "libagdb_memory_map.h"
+
+#if defined( LIBAGDB_HAVE_MEMORY_MAP )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libagdb_libcerror.h"
+#include "libagdb_libclocale.h"
+#include "libagdb_libcnotify.h"
+#include "libagdb_libuna.h"
+
+/* Creates a memory map
+ * Make sure the value memory_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_memory_map_initialize(
+     libagdb_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_memory_map_initialize";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_map = libagdb_allocator_allocate_structure(
+	               libagdb_memory_map_t );
+
+	if( *memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_map,
+	     0,
+	     sizeof( libagdb_memory_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *memory_map != NULL )
+	{
+		libagdb_allocator_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory map
+ * The mapped data is unmapped if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_memory_map_free(
+     libagdb_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_memory_map_free";
+	int result            = 1;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		if( libagdb_memory_map_close(
+		     *memory_map,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close memory map.",
+			 function );
+
+			result = -1;
+		}
+		libagdb_allocator_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( result );
+}
+
+/* Maps a file into memory for reading
+ * Returns 1 if successful, 0 if the file could not be mapped or -1 on error
+ */
+int libagdb_memory_map_open(
+     libagdb_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( LIBAGDB_HAVE_MEMORY_MAP )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libagdb_memory_map_open";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBAGDB_HAVE_MEMORY_MAP )
+	/* Failing to map the file is not considered an error, the caller
+	 * is expected to fall back to reading the file
+	 */
+#if defined( O_CLOEXEC )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY | O_CLOEXEC );
+#else
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+#endif
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	if( ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	data = mmap(
+	        NULL,
+	        (size_t) file_statistics.st_size,
+	        PROT_READ,
+	        MAP_PRIVATE,
+	        file_descriptor,
+	        0 );
+
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	if( data == MAP_FAILED )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to map file: %s falling back to read.\n",
+			 function,
+			 filename );
+		}
+#endif
+		return( 0 );
+	}
+	memory_map->data      = (uint8_t *) data;
+	memory_map->data_size = (size64_t) file_statistics.st_size;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( LIBAGDB_HAVE_MEMORY_MAP ) */
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Maps a file into memory for reading
+ * The filename is converted into a narrow string using the narrow system string codepage
+ * Returns 1 if successful, 0 if the file could not be mapped or -1 on error
+ */
+int libagdb_memory_map_open_wide(
+     libagdb_memory_map_t *memory_map,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( LIBAGDB_HAVE_MEMORY_MAP )
+	char *narrow_filename       = NULL;
+	size_t filename_length      = 0;
+	size_t narrow_filename_size = 0;
+	int codepage                = 0;
+	int result                  = 0;
+#endif
+	static char *function       = "libagdb_memory_map_open_wide";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBAGDB_HAVE_MEMORY_MAP )
+	if( libclocale_codepage_get(
+	     &codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve codepage.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) filename,
+		          filename_length + 1,
+		          &narrow_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) filename,
+		          filename_length + 1,
+		          &narrow_filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) filename,
+		          filename_length + 1,
+		          codepage,
+		          &narrow_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) filename,
+		          filename_length + 1,
+		          codepage,
+		          &narrow_filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( narrow_filename_size == 0 )
+	 || ( narrow_filename_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid narrow filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	narrow_filename = (char *) libagdb_allocator_allocate(
+	                            sizeof( char ) * narrow_filename_size );
+
+	if( narrow_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create narrow filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) narrow_filename,
+		          narrow_filename_size,
+		          (libuna_utf32_character_t *) filename,
+		          filename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) narrow_filename,
+		          narrow_filename_size,
+		          (libuna_utf16_character_t *) filename,
+		          filename_length + 1,
+		          error );
+#endif
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) narrow_filename,
+		          narrow_filename_size,
+		          codepage,
+		          (libuna_utf32_character_t *) filename,
+		          filename_length + 1,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) narrow_filename,
+		          narrow_filename_size,
+		          codepage,
+		          (libuna_utf16_character_t *) filename,
+		          filename_length + 1,
+		          error );
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow filename.",
+		 function );
+
+		goto on_error;
+	}
+	result = libagdb_memory_map_open(
+	          memory_map,
+	          narrow_filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	libagdb_allocator_free(
+	 narrow_filename );
+
+	return( result );
+
+on_error:
+	if( narrow_filename != NULL )
+	{
+		libagdb_allocator_free(
+		 narrow_filename );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif /* defined( LIBAGDB_HAVE_MEMORY_MAP ) */
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Unmaps the mapped data
+ * Returns 0 if successful or -1 on error
+ */
+int libagdb_memory_map_close(
+     libagdb_memory_map_t *memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_memory_map_close";
+	int result            = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBAGDB_HAVE_MEMORY_MAP )
+	if( memory_map->data != NULL )
+	{
+		if( munmap(
+		     (void *) memory_map->data,
+		     (size_t) memory_map->data_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to unmap data.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	memory_map->data      = NULL;
+	memory_map->data_size = 0;
+
+	return( result );
+}
+
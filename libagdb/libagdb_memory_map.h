@@ -0,0 +1,82 @@
+/*
+ * Memory map functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_MEMORY_MAP_H )
+#define _LIBAGDB_MEMORY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_FCNTL_H ) && defined( HAVE_SYS_STAT_H ) && !defined( WINAPI )
+#define LIBAGDB_HAVE_MEMORY_MAP		1
+#endif
+
+typedef struct libagdb_memory_map libagdb_memory_map_t;
+
+struct libagdb_memory_map
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size64_t data_size;
+};
+
+int libagdb_memory_map_initialize(
+     libagdb_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libagdb_memory_map_free(
+     libagdb_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libagdb_memory_map_open(
+     libagdb_memory_map_t *memory_map,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libagdb_memory_map_open_wide(
+     libagdb_memory_map_t *memory_map,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libagdb_memory_map_close(
+     libagdb_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_MEMORY_MAP_H ) */
+
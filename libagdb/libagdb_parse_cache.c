@@ -0,0 +1,2335 @@
+/*
+ * Parse cache functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libagdb_parse_cache.h"
+
+#if defined( LIBAGDB_HAVE_FILE_IDENTITY )
+#include <sys/stat.h>
+#endif
+
+#include "libagdb_allocator.h"
+#include "libagdb_content_fingerprint.h"
+#include "libagdb_definitions.h"
+#include "libagdb_file.h"
+#include "libagdb_libbfio.h"
+#include "libagdb_libcdata.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libcthreads.h"
+
+/* Frees a parse cache entry
+ * The file of the entry is closed and freed before the file data it references
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_entry_free(
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_parse_cache_entry_free";
+	int result            = 1;
+
+	if( parse_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parse_cache_entry != NULL )
+	{
+		if( ( *parse_cache_entry )->file != NULL )
+		{
+			if( libagdb_file_free(
+			     &( ( *parse_cache_entry )->file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *parse_cache_entry )->data != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *parse_cache_entry )->data );
+		}
+		libagdb_allocator_free(
+		 *parse_cache_entry );
+
+		*parse_cache_entry = NULL;
+	}
+	return( result );
+}
+
+/* Reads the data of a file into a new parse cache entry and calculates its fingerprint
+ * The data is copied into memory owned by the entry, instead of memory mapping the file,
+ * hence the cached file does not depend on the file on disk, which can be truncated or replaced
+ * The data is not parsed, which allows a file with the same data to be looked up first
+ * This function does not use the parse cache hence no lock needs to be held
+ * Make sure the value parse_cache_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_entry_read_data(
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libagdb_content_fingerprint_t *data_fingerprint     = NULL;
+	libagdb_parse_cache_entry_t *safe_parse_cache_entry = NULL;
+	libbfio_handle_t *file_io_handle                    = NULL;
+	static char *function                               = "libagdb_parse_cache_entry_read_data";
+	size64_t file_size                                  = 0;
+	size_t filename_length                              = 0;
+	ssize_t read_count                                  = 0;
+
+	if( parse_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parse_cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parse cache entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	safe_parse_cache_entry = libagdb_allocator_allocate_structure(
+	                          libagdb_parse_cache_entry_t );
+
+	if( safe_parse_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_parse_cache_entry,
+	     0,
+	     sizeof( libagdb_parse_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		libagdb_allocator_free(
+		 safe_parse_cache_entry );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_parse_cache_entry->data = (uint8_t *) libagdb_allocator_allocate(
+	                                            (size_t) file_size );
+
+	if( safe_parse_cache_entry->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	safe_parse_cache_entry->data_size = (size_t) file_size;
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              safe_parse_cache_entry->data,
+	              safe_parse_cache_entry->data_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) safe_parse_cache_entry->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The fingerprint is calculated over the file data as stored, since the content
+	 * fingerprint of a compressed file is only known after its data was decompressed
+	 */
+	if( libagdb_content_fingerprint_initialize(
+	     &data_fingerprint,
+	     (size64_t) safe_parse_cache_entry->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_content_fingerprint_update(
+	     data_fingerprint,
+	     0,
+	     safe_parse_cache_entry->data,
+	     safe_parse_cache_entry->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update data fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_content_fingerprint_finalize(
+	     data_fingerprint,
+	     safe_parse_cache_entry->data_fingerprint,
+	     LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to finalize data fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_content_fingerprint_free(
+	     &data_fingerprint,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	*parse_cache_entry = safe_parse_cache_entry;
+
+	return( 1 );
+
+on_error:
+	if( data_fingerprint != NULL )
+	{
+		libagdb_content_fingerprint_free(
+		 &data_fingerprint,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( safe_parse_cache_entry != NULL )
+	{
+		libagdb_parse_cache_entry_free(
+		 &safe_parse_cache_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Parses the file data of a parse cache entry
+ * The values of the file that are not copied reference the data owned by the entry
+ * This function does not use the parse cache hence no lock needs to be held
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_entry_parse_file(
+     libagdb_parse_cache_entry_t *parse_cache_entry,
+     libcerror_error_t **error )
+{
+	uint64_t statistics[ LIBAGDB_NUMBER_OF_STATISTICS ];
+
+	static char *function = "libagdb_parse_cache_entry_parse_file";
+
+	if( parse_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_cache_entry->file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parse cache entry - file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_file_initialize(
+	     &( parse_cache_entry->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_open_memory(
+	     parse_cache_entry->file,
+	     parse_cache_entry->data,
+	     parse_cache_entry->data_size,
+	     LIBAGDB_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The parsed information remains available after the IO resources are released
+	 * hence a cached file does not retain decompressed data
+	 */
+	if( libagdb_file_release_io_resources(
+	     parse_cache_entry->file,
+	     LIBAGDB_RELEASE_FLAG_CLOSE_FILE_IO_HANDLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release IO resources of file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_file_get_statistics(
+	     parse_cache_entry->file,
+	     statistics,
+	     LIBAGDB_NUMBER_OF_STATISTICS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics of file.",
+		 function );
+
+		goto on_error;
+	}
+	parse_cache_entry->memory_size = sizeof( libagdb_parse_cache_entry_t )
+	                               + sizeof( libagdb_internal_file_t )
+	                               + statistics[ LIBAGDB_STATISTIC_METADATA_SIZE ]
+	                               + parse_cache_entry->data_size;
+
+	return( 1 );
+
+on_error:
+	if( parse_cache_entry->file != NULL )
+	{
+		libagdb_file_free(
+		 &( parse_cache_entry->file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a parse cache identity
+ * The entry of the identity is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_identity_free(
+     libagdb_parse_cache_identity_t **parse_cache_identity,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_parse_cache_identity_free";
+
+	if( parse_cache_identity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache identity.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parse_cache_identity != NULL )
+	{
+		libagdb_allocator_free(
+		 *parse_cache_identity );
+
+		*parse_cache_identity = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the identity of a file: the device identifier, inode number, file size and modification time
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_get_file_identity(
+     const char *filename,
+     libagdb_parse_cache_identity_t *file_identity,
+     libcerror_error_t **error )
+{
+#if defined( LIBAGDB_HAVE_FILE_IDENTITY )
+	struct stat file_statistics;
+#endif
+	static char *function = "libagdb_parse_cache_get_file_identity";
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_identity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file identity.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBAGDB_HAVE_FILE_IDENTITY )
+	if( stat(
+	     filename,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to retrieve file statistics of: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	if( S_ISREG( file_statistics.st_mode ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type of: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	file_identity->device_identifier = (uint64_t) file_statistics.st_dev;
+	file_identity->inode_number      = (uint64_t) file_statistics.st_ino;
+	file_identity->file_size         = (size64_t) file_statistics.st_size;
+	file_identity->modification_time = (int64_t) file_statistics.st_mtime;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: file identity not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( LIBAGDB_HAVE_FILE_IDENTITY ) */
+}
+
+
+/* Creates a parse cache
+ * Make sure the value parse_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_initialize(
+     libagdb_parse_cache_t **parse_cache,
+     libcerror_error_t **error )
+{
+	libagdb_internal_parse_cache_t *internal_parse_cache = NULL;
+	static char *function                                = "libagdb_parse_cache_initialize";
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parse_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parse cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = libagdb_allocator_allocate_structure(
+	                        libagdb_internal_parse_cache_t );
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parse cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_parse_cache,
+	     0,
+	     sizeof( libagdb_internal_parse_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parse cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_parse_cache->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_parse_cache->identities_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create identities array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_parse_cache->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_parse_cache->maximum_memory_size = LIBAGDB_PARSE_CACHE_DEFAULT_MAXIMUM_MEMORY_SIZE;
+
+	*parse_cache = (libagdb_parse_cache_t *) internal_parse_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_parse_cache != NULL )
+	{
+		if( internal_parse_cache->identities_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_parse_cache->identities_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_parse_cache->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_parse_cache->entries_array ),
+			 NULL,
+			 NULL );
+		}
+		libagdb_allocator_free(
+		 internal_parse_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a parse cache
+ * All files must have been released
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_free(
+     libagdb_parse_cache_t **parse_cache,
+     libcerror_error_t **error )
+{
+	libagdb_internal_parse_cache_t *internal_parse_cache = NULL;
+	libagdb_parse_cache_entry_t *parse_cache_entry       = NULL;
+	static char *function                                = "libagdb_parse_cache_free";
+	int entry_index                                      = 0;
+	int number_of_entries                                = 0;
+	int result                                           = 1;
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parse_cache == NULL )
+	{
+		return( 1 );
+	}
+	internal_parse_cache = (libagdb_internal_parse_cache_t *) *parse_cache;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_parse_cache->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	/* A file that is still referenced cannot be freed without invalidating the reference
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_parse_cache->entries_array,
+		     entry_index,
+		     (intptr_t **) &parse_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( parse_cache_entry != NULL )
+		 && ( parse_cache_entry->reference_count > 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid parse cache - entry: %d file still referenced.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	*parse_cache = NULL;
+
+	if( libcdata_array_free(
+	     &( internal_parse_cache->identities_array ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_parse_cache_identity_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free identities array.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_free(
+	     &( internal_parse_cache->entries_array ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_parse_cache_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entries array.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_free(
+	     &( internal_parse_cache->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read/write lock.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	libagdb_allocator_free(
+	 internal_parse_cache );
+
+	return( result );
+}
+
+/* Sets the maximum memory size of the cached files
+ * Least recently used files that are no longer referenced are freed
+ * when the memory size of the cached files exceeds the maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_set_maximum_memory_size(
+     libagdb_parse_cache_t *parse_cache,
+     size64_t maximum_memory_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_parse_cache_t *internal_parse_cache = NULL;
+	static char *function                                = "libagdb_parse_cache_set_maximum_memory_size";
+	int result                                           = 1;
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = (libagdb_internal_parse_cache_t *) parse_cache;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_parse_cache->maximum_memory_size = maximum_memory_size;
+
+	if( libagdb_internal_parse_cache_evict_entries(
+	     internal_parse_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to evict entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the memory size of the cached files
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_get_memory_size(
+     libagdb_parse_cache_t *parse_cache,
+     size64_t *memory_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_parse_cache_t *internal_parse_cache = NULL;
+	static char *function                                = "libagdb_parse_cache_get_memory_size";
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = (libagdb_internal_parse_cache_t *) parse_cache;
+
+	if( memory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*memory_size = internal_parse_cache->memory_size;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of cached files
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_get_number_of_files(
+     libagdb_parse_cache_t *parse_cache,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libagdb_internal_parse_cache_t *internal_parse_cache = NULL;
+	static char *function                                = "libagdb_parse_cache_get_number_of_files";
+	int result                                           = 1;
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = (libagdb_internal_parse_cache_t *) parse_cache;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_parse_cache->entries_array,
+	     number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a file using the parse cache
+ * If the file is unchanged since it was last opened by the parse cache, the previously
+ * parsed file is shared instead of being read again. The file is identified by its device
+ * identifier, inode number, size and modification time. A file that is read again, such as
+ * a copy, shares a previously parsed file with the same data fingerprint, which is calculated
+ * before the file is parsed. The file identity is then added so that the file is not read again
+ * The file data is read into memory owned by the parse cache, hence a cached file
+ * does not depend on the file on disk
+ * The file is looked up while holding the read lock and parsed without holding a lock,
+ * the write lock is only held to reference or insert the entry
+ * The file is shared and must be released with libagdb_parse_cache_release_file
+ * instead of being closed or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_open_file(
+     libagdb_parse_cache_t *parse_cache,
+     const char *filename,
+     libagdb_file_t **file,
+     libcerror_error_t **error )
+{
+	libagdb_parse_cache_identity_t file_identity;
+
+	libagdb_internal_parse_cache_t *internal_parse_cache = NULL;
+	libagdb_parse_cache_entry_t *parse_cache_entry       = NULL;
+	static char *function                                = "libagdb_parse_cache_open_file";
+	int result                                           = 0;
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = (libagdb_internal_parse_cache_t *) parse_cache;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &file_identity,
+	     0,
+	     sizeof( libagdb_parse_cache_identity_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file identity.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_parse_cache_get_file_identity(
+	     filename,
+	     &file_identity,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file identity.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libagdb_internal_parse_cache_get_entry_by_identity(
+	          internal_parse_cache,
+	          &file_identity,
+	          &parse_cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry by file identity.",
+		 function );
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	/* The entry found while holding the read lock is only referenced while holding
+	 * the write lock, hence it is not used here
+	 */
+	parse_cache_entry = NULL;
+
+	/* The file data is read and its fingerprint is looked up before the file is parsed,
+	 * hence a file with the same data as a cached file is not parsed. The cached entry
+	 * can be removed before the write lock is grabbed in which case the file is read after all
+	 */
+	do
+	{
+		if( result == 0 )
+		{
+			if( parse_cache_entry == NULL )
+			{
+				if( libagdb_parse_cache_entry_read_data(
+				     &parse_cache_entry,
+				     filename,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read file: %s.",
+					 function,
+					 filename );
+
+					goto on_error;
+				}
+			}
+			else if( libagdb_parse_cache_entry_parse_file(
+			          parse_cache_entry,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to parse file: %s.",
+				 function,
+				 filename );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_parse_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		result = libagdb_internal_parse_cache_open_file(
+		          internal_parse_cache,
+		          &file_identity,
+		          &parse_cache_entry,
+		          file,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+		}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_parse_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+	}
+	while( result == 0 );
+
+	/* The entry that was read is not used if a file with the same data was cached,
+	 * including by a concurrent open
+	 */
+	if( parse_cache_entry != NULL )
+	{
+		if( libagdb_parse_cache_entry_free(
+		     &parse_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( parse_cache_entry != NULL )
+	{
+		libagdb_parse_cache_entry_free(
+		 &parse_cache_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the entry of an unchanged file
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libagdb_internal_parse_cache_get_entry_by_identity(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     const libagdb_parse_cache_identity_t *file_identity,
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     libcerror_error_t **error )
+{
+	libagdb_parse_cache_identity_t *parse_cache_identity = NULL;
+	static char *function                                = "libagdb_internal_parse_cache_get_entry_by_identity";
+	int identity_index                                   = 0;
+	int number_of_identities                             = 0;
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_identity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file identity.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_parse_cache->identities_array,
+	     &number_of_identities,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of identities.",
+		 function );
+
+		return( -1 );
+	}
+	for( identity_index = 0;
+	     identity_index < number_of_identities;
+	     identity_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_parse_cache->identities_array,
+		     identity_index,
+		     (intptr_t **) &parse_cache_identity,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identity: %d.",
+			 function,
+			 identity_index );
+
+			return( -1 );
+		}
+		if( parse_cache_identity == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing identity: %d.",
+			 function,
+			 identity_index );
+
+			return( -1 );
+		}
+		if( ( parse_cache_identity->device_identifier == file_identity->device_identifier )
+		 && ( parse_cache_identity->inode_number == file_identity->inode_number )
+		 && ( parse_cache_identity->file_size == file_identity->file_size )
+		 && ( parse_cache_identity->modification_time == file_identity->modification_time ) )
+		{
+			*parse_cache_entry = parse_cache_identity->parse_cache_entry;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the entry of a file with a specific data fingerprint
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libagdb_internal_parse_cache_get_entry_by_data_fingerprint(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     const uint8_t *data_fingerprint,
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     libcerror_error_t **error )
+{
+	libagdb_parse_cache_entry_t *safe_parse_cache_entry = NULL;
+	static char *function                               = "libagdb_internal_parse_cache_get_entry_by_data_fingerprint";
+	int entry_index                                     = 0;
+	int number_of_entries                               = 0;
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_parse_cache->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_parse_cache->entries_array,
+		     entry_index,
+		     (intptr_t **) &safe_parse_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_parse_cache_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     safe_parse_cache_entry->data_fingerprint,
+		     data_fingerprint,
+		     LIBAGDB_CONTENT_FINGERPRINT_SIZE ) == 0 )
+		{
+			*parse_cache_entry = safe_parse_cache_entry;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Sets the entry of a file identity
+ * A file is identified by its device identifier and inode number, hence the identity
+ * of a file that has changed since it was parsed is updated to reference the entry
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_parse_cache_set_identity(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     const libagdb_parse_cache_identity_t *file_identity,
+     libagdb_parse_cache_entry_t *parse_cache_entry,
+     libcerror_error_t **error )
+{
+	libagdb_parse_cache_identity_t *parse_cache_identity = NULL;
+	static char *function                                = "libagdb_internal_parse_cache_set_identity";
+	int identity_index                                   = 0;
+	int number_of_identities                             = 0;
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_identity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file identity.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_parse_cache->identities_array,
+	     &number_of_identities,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of identities.",
+		 function );
+
+		return( -1 );
+	}
+	for( identity_index = 0;
+	     identity_index < number_of_identities;
+	     identity_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_parse_cache->identities_array,
+		     identity_index,
+		     (intptr_t **) &parse_cache_identity,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identity: %d.",
+			 function,
+			 identity_index );
+
+			return( -1 );
+		}
+		if( ( parse_cache_identity != NULL )
+		 && ( parse_cache_identity->device_identifier == file_identity->device_identifier )
+		 && ( parse_cache_identity->inode_number == file_identity->inode_number ) )
+		{
+			parse_cache_identity->file_size         = file_identity->file_size;
+			parse_cache_identity->modification_time = file_identity->modification_time;
+			parse_cache_identity->parse_cache_entry = parse_cache_entry;
+
+			return( 1 );
+		}
+	}
+	parse_cache_identity = libagdb_allocator_allocate_structure(
+	                        libagdb_parse_cache_identity_t );
+
+	if( parse_cache_identity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create identity.",
+		 function );
+
+		return( -1 );
+	}
+	parse_cache_identity->device_identifier = file_identity->device_identifier;
+	parse_cache_identity->inode_number      = file_identity->inode_number;
+	parse_cache_identity->file_size         = file_identity->file_size;
+	parse_cache_identity->modification_time = file_identity->modification_time;
+	parse_cache_identity->parse_cache_entry = parse_cache_entry;
+
+	if( libcdata_array_append_entry(
+	     internal_parse_cache->identities_array,
+	     &identity_index,
+	     (intptr_t *) parse_cache_identity,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append identity to array.",
+		 function );
+
+		libagdb_allocator_free(
+		 parse_cache_identity );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a file using the parse cache
+ * The file is shared if it was cached, including by a concurrent open, otherwise
+ * the entry that was read is inserted and the parse cache takes ownership of it
+ * Returns 1 if successful, 0 if the entry needs to be read or parsed first or -1 on error
+ */
+int libagdb_internal_parse_cache_open_file(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     const libagdb_parse_cache_identity_t *file_identity,
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     libagdb_file_t **file,
+     libcerror_error_t **error )
+{
+	libagdb_parse_cache_entry_t *matching_parse_cache_entry = NULL;
+	static char *function                                   = "libagdb_internal_parse_cache_open_file";
+	int entry_index                                         = 0;
+	int is_inserted                                         = 0;
+	int result                                              = 0;
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( parse_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache->access_counter += 1;
+
+	/* The entry is looked up again since the parse cache can have changed
+	 * after it was looked up while holding the read lock
+	 */
+	result = libagdb_internal_parse_cache_get_entry_by_identity(
+	          internal_parse_cache,
+	          file_identity,
+	          &matching_parse_cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry by file identity.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( *parse_cache_entry == NULL )
+		{
+			return( 0 );
+		}
+		/* A file with the same data, such as a copy or a file that was only touched,
+		 * shares the previously parsed file
+		 */
+		result = libagdb_internal_parse_cache_get_entry_by_data_fingerprint(
+		          internal_parse_cache,
+		          ( *parse_cache_entry )->data_fingerprint,
+		          &matching_parse_cache_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry by data fingerprint.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( ( *parse_cache_entry )->file == NULL )
+			{
+				return( 0 );
+			}
+			( *parse_cache_entry )->last_access     = internal_parse_cache->access_counter;
+			( *parse_cache_entry )->reference_count = 1;
+
+			if( libcdata_array_append_entry(
+			     internal_parse_cache->entries_array,
+			     &entry_index,
+			     (intptr_t *) *parse_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append entry to array.",
+				 function );
+
+				return( -1 );
+			}
+			internal_parse_cache->memory_size += ( *parse_cache_entry )->memory_size;
+
+			matching_parse_cache_entry = *parse_cache_entry;
+			is_inserted                = 1;
+
+			*parse_cache_entry = NULL;
+		}
+		/* The identity is set so that the next open of the file does not read it again
+		 */
+		if( libagdb_internal_parse_cache_set_identity(
+		     internal_parse_cache,
+		     file_identity,
+		     matching_parse_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file identity.",
+			 function );
+
+			/* An inserted entry is not returned hence it is no longer referenced
+			 */
+			if( is_inserted != 0 )
+			{
+				matching_parse_cache_entry->reference_count = 0;
+			}
+			return( -1 );
+		}
+	}
+	if( is_inserted == 0 )
+	{
+		matching_parse_cache_entry->reference_count += 1;
+		matching_parse_cache_entry->last_access      = internal_parse_cache->access_counter;
+	}
+	*file = matching_parse_cache_entry->file;
+
+	/* The new entry is referenced hence it is not evicted
+	 */
+	if( is_inserted != 0 )
+	{
+		if( libagdb_internal_parse_cache_evict_entries(
+		     internal_parse_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases a file opened using the parse cache
+ * The file remains cached until it is evicted or the parse cache is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_parse_cache_release_file(
+     libagdb_parse_cache_t *parse_cache,
+     libagdb_file_t **file,
+     libcerror_error_t **error )
+{
+	libagdb_internal_parse_cache_t *internal_parse_cache = NULL;
+	static char *function                                = "libagdb_parse_cache_release_file";
+	int result                                           = 0;
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = (libagdb_internal_parse_cache_t *) parse_cache;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libagdb_internal_parse_cache_release_file(
+	          internal_parse_cache,
+	          file,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release file.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_parse_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a file opened using the parse cache
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_parse_cache_release_file(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     libagdb_file_t **file,
+     libcerror_error_t **error )
+{
+	libagdb_parse_cache_entry_t *parse_cache_entry = NULL;
+	static char *function                          = "libagdb_internal_parse_cache_release_file";
+	int entry_index                                = 0;
+	int number_of_entries                          = 0;
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file == NULL )
+	 || ( *file == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_parse_cache->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_parse_cache->entries_array,
+		     entry_index,
+		     (intptr_t **) &parse_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( parse_cache_entry != NULL )
+		 && ( parse_cache_entry->file == *file )
+		 && ( parse_cache_entry->reference_count > 0 ) )
+		{
+			break;
+		}
+	}
+	if( entry_index >= number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - not opened using parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	parse_cache_entry->reference_count -= 1;
+
+	*file = NULL;
+
+	if( libagdb_internal_parse_cache_evict_entries(
+	     internal_parse_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to evict entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes an entry, the identities that reference it and frees its file
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_parse_cache_remove_entry(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libagdb_parse_cache_entry_t *parse_cache_entry       = NULL;
+	libagdb_parse_cache_identity_t *parse_cache_identity = NULL;
+	static char *function                                = "libagdb_internal_parse_cache_remove_entry";
+	int identity_index                                   = 0;
+	int number_of_identities                             = 0;
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_remove_entry(
+	     internal_parse_cache->entries_array,
+	     entry_index,
+	     (intptr_t **) &parse_cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove entry: %d from array.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( parse_cache_entry == NULL )
+	{
+		return( 1 );
+	}
+	if( parse_cache_entry->memory_size < internal_parse_cache->memory_size )
+	{
+		internal_parse_cache->memory_size -= parse_cache_entry->memory_size;
+	}
+	else
+	{
+		internal_parse_cache->memory_size = 0;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_parse_cache->identities_array,
+	     &number_of_identities,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of identities.",
+		 function );
+
+		goto on_error;
+	}
+	/* The identities are iterated in reverse so that they can be removed
+	 */
+	for( identity_index = number_of_identities - 1;
+	     identity_index >= 0;
+	     identity_index-- )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_parse_cache->identities_array,
+		     identity_index,
+		     (intptr_t **) &parse_cache_identity,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identity: %d.",
+			 function,
+			 identity_index );
+
+			goto on_error;
+		}
+		if( ( parse_cache_identity == NULL )
+		 || ( parse_cache_identity->parse_cache_entry != parse_cache_entry ) )
+		{
+			continue;
+		}
+		if( libcdata_array_remove_entry(
+		     internal_parse_cache->identities_array,
+		     identity_index,
+		     (intptr_t **) &parse_cache_identity,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove identity: %d from array.",
+			 function,
+			 identity_index );
+
+			goto on_error;
+		}
+		if( libagdb_parse_cache_identity_free(
+		     &parse_cache_identity,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free identity: %d.",
+			 function,
+			 identity_index );
+
+			goto on_error;
+		}
+	}
+	if( libagdb_parse_cache_entry_free(
+	     &parse_cache_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	/* The entry is not freed since an identity can still reference it
+	 */
+	return( -1 );
+}
+
+/* Removes the least recently used unreferenced entries until the memory size
+ * of the cached files no longer exceeds the maximum
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_parse_cache_evict_entries(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     libcerror_error_t **error )
+{
+	libagdb_parse_cache_entry_t *parse_cache_entry = NULL;
+	static char *function                          = "libagdb_internal_parse_cache_evict_entries";
+	uint64_t least_recent_access                   = 0;
+	int entry_index                                = 0;
+	int least_recent_entry_index                   = 0;
+	int number_of_entries                          = 0;
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_parse_cache->memory_size > internal_parse_cache->maximum_memory_size )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_parse_cache->entries_array,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries.",
+			 function );
+
+			return( -1 );
+		}
+		least_recent_entry_index = -1;
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_parse_cache->entries_array,
+			     entry_index,
+			     (intptr_t **) &parse_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( ( parse_cache_entry == NULL )
+			 || ( parse_cache_entry->reference_count > 0 ) )
+			{
+				continue;
+			}
+			if( ( least_recent_entry_index == -1 )
+			 || ( parse_cache_entry->last_access < least_recent_access ) )
+			{
+				least_recent_entry_index = entry_index;
+				least_recent_access      = parse_cache_entry->last_access;
+			}
+		}
+		/* Referenced entries cannot be evicted
+		 */
+		if( least_recent_entry_index == -1 )
+		{
+			break;
+		}
+		if( libagdb_internal_parse_cache_remove_entry(
+		     internal_parse_cache,
+		     least_recent_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry: %d.",
+			 function,
+			 least_recent_entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,243 @@
+/*
+ * Parse cache functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_PARSE_CACHE_H )
+#define _LIBAGDB_PARSE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_definitions.h"
+#include "libagdb_extern.h"
+#include "libagdb_libcdata.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_libcthreads.h"
+#include "libagdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_SYS_STAT_H ) && !defined( WINAPI )
+#define LIBAGDB_HAVE_FILE_IDENTITY	1
+#endif
+
+/* The default maximum memory size of the cached files
+ */
+#define LIBAGDB_PARSE_CACHE_DEFAULT_MAXIMUM_MEMORY_SIZE	( 64 * 1024 * 1024 )
+
+typedef struct libagdb_parse_cache_entry libagdb_parse_cache_entry_t;
+
+struct libagdb_parse_cache_entry
+{
+	/* The fingerprint of the file data
+	 */
+	uint8_t data_fingerprint[ LIBAGDB_CONTENT_FINGERPRINT_SIZE ];
+
+	/* The file data
+	 */
+	uint8_t *data;
+
+	/* The file data size
+	 */
+	size_t data_size;
+
+	/* The (shared) file
+	 */
+	libagdb_file_t *file;
+
+	/* The memory size of the parsed information
+	 */
+	size64_t memory_size;
+
+	/* The last access value, used to determine the least recently used entry
+	 */
+	uint64_t last_access;
+
+	/* The number of references
+	 */
+	int reference_count;
+};
+
+typedef struct libagdb_parse_cache_identity libagdb_parse_cache_identity_t;
+
+struct libagdb_parse_cache_identity
+{
+	/* The device identifier
+	 */
+	uint64_t device_identifier;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The modification time
+	 */
+	int64_t modification_time;
+
+	/* The entry of the file data, which is not owned by the identity
+	 */
+	libagdb_parse_cache_entry_t *parse_cache_entry;
+};
+
+typedef struct libagdb_internal_parse_cache libagdb_internal_parse_cache_t;
+
+struct libagdb_internal_parse_cache
+{
+	/* The entries array
+	 */
+	libcdata_array_t *entries_array;
+
+	/* The identities array
+	 */
+	libcdata_array_t *identities_array;
+
+	/* The maximum memory size of the cached files
+	 */
+	size64_t maximum_memory_size;
+
+	/* The memory size of all files
+	 */
+	size64_t memory_size;
+
+	/* The access counter
+	 */
+	uint64_t access_counter;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libagdb_parse_cache_entry_free(
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     libcerror_error_t **error );
+
+int libagdb_parse_cache_entry_read_data(
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libagdb_parse_cache_entry_parse_file(
+     libagdb_parse_cache_entry_t *parse_cache_entry,
+     libcerror_error_t **error );
+
+int libagdb_parse_cache_identity_free(
+     libagdb_parse_cache_identity_t **parse_cache_identity,
+     libcerror_error_t **error );
+
+int libagdb_parse_cache_get_file_identity(
+     const char *filename,
+     libagdb_parse_cache_identity_t *file_identity,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_parse_cache_initialize(
+     libagdb_parse_cache_t **parse_cache,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_parse_cache_free(
+     libagdb_parse_cache_t **parse_cache,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_parse_cache_set_maximum_memory_size(
+     libagdb_parse_cache_t *parse_cache,
+     size64_t maximum_memory_size,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_parse_cache_get_memory_size(
+     libagdb_parse_cache_t *parse_cache,
+     size64_t *memory_size,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_parse_cache_get_number_of_files(
+     libagdb_parse_cache_t *parse_cache,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_parse_cache_open_file(
+     libagdb_parse_cache_t *parse_cache,
+     const char *filename,
+     libagdb_file_t **file,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_parse_cache_release_file(
+     libagdb_parse_cache_t *parse_cache,
+     libagdb_file_t **file,
+     libcerror_error_t **error );
+
+int libagdb_internal_parse_cache_get_entry_by_identity(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     const libagdb_parse_cache_identity_t *file_identity,
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     libcerror_error_t **error );
+
+int libagdb_internal_parse_cache_get_entry_by_data_fingerprint(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     const uint8_t *data_fingerprint,
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     libcerror_error_t **error );
+
+int libagdb_internal_parse_cache_set_identity(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     const libagdb_parse_cache_identity_t *file_identity,
+     libagdb_parse_cache_entry_t *parse_cache_entry,
+     libcerror_error_t **error );
+
+int libagdb_internal_parse_cache_open_file(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     const libagdb_parse_cache_identity_t *file_identity,
+     libagdb_parse_cache_entry_t **parse_cache_entry,
+     libagdb_file_t **file,
+     libcerror_error_t **error );
+
+int libagdb_internal_parse_cache_release_file(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     libagdb_file_t **file,
+     libcerror_error_t **error );
+
+int libagdb_internal_parse_cache_remove_entry(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libagdb_internal_parse_cache_evict_entries(
+     libagdb_internal_parse_cache_t *internal_parse_cache,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_PARSE_CACHE_H ) */
+
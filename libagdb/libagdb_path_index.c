@@ -0,0 +1,995 @@
+/*
+ * Path index functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_allocator.h"
+#include "libagdb_libcdata.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_path_index.h"
+
+/* Case folds an UTF-8 character, only ASCII characters are folded
+ */
+#define libagdb_path_index_fold_character( character ) \
+	( ( ( character ) >= (uint8_t) 'a' ) && ( ( character ) <= (uint8_t) 'z' ) ? (uint8_t) ( ( character ) - 0x20 ) : ( character ) )
+
+/* Determines if an UTF-8 byte is a continuation byte of a multi-byte character
+ */
+#define libagdb_path_index_is_continuation_byte( byte_value ) \
+	( ( ( byte_value ) & 0xc0 ) == 0x80 )
+
+/* Creates a path index
+ * Make sure the value path_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_path_index_initialize(
+     libagdb_path_index_t **path_index,
+     int number_of_entries,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_path_index_initialize";
+	int entry_index       = 0;
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size < (size_t) number_of_entries )
+	 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*path_index = libagdb_allocator_allocate_structure(
+	               libagdb_path_index_t );
+
+	if( *path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_index,
+	     0,
+	     sizeof( libagdb_path_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path index.",
+		 function );
+
+		libagdb_allocator_free(
+		 *path_index );
+
+		*path_index = NULL;
+
+		return( -1 );
+	}
+	if( number_of_entries > 0 )
+	{
+		( *path_index )->utf8_string = (uint8_t *) libagdb_allocator_allocate(
+		                                            sizeof( uint8_t ) * utf8_string_size );
+
+		if( ( *path_index )->utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		( *path_index )->utf8_string_offsets = (size_t *) libagdb_allocator_allocate(
+		                                                   sizeof( size_t ) * number_of_entries );
+
+		if( ( *path_index )->utf8_string_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string offsets.",
+			 function );
+
+			goto on_error;
+		}
+		( *path_index )->sorted_entry_indexes = (int *) libagdb_allocator_allocate(
+		                                                 sizeof( int ) * number_of_entries );
+
+		if( ( *path_index )->sorted_entry_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted entry indexes.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			( *path_index )->sorted_entry_indexes[ entry_index ] = entry_index;
+		}
+	}
+	( *path_index )->number_of_entries = number_of_entries;
+	( *path_index )->utf8_string_size  = utf8_string_size;
+
+	return( 1 );
+
+on_error:
+	if( *path_index != NULL )
+	{
+		if( ( *path_index )->utf8_string_offsets != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *path_index )->utf8_string_offsets );
+		}
+		if( ( *path_index )->utf8_string != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *path_index )->utf8_string );
+		}
+		libagdb_allocator_free(
+		 *path_index );
+
+		*path_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path index
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_path_index_free(
+     libagdb_path_index_t **path_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_path_index_free";
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_index != NULL )
+	{
+		if( ( *path_index )->sorted_entry_indexes != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *path_index )->sorted_entry_indexes );
+		}
+		if( ( *path_index )->utf8_string_offsets != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *path_index )->utf8_string_offsets );
+		}
+		if( ( *path_index )->utf8_string != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *path_index )->utf8_string );
+		}
+		libagdb_allocator_free(
+		 *path_index );
+
+		*path_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two case folded paths
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libagdb_path_index_compare_paths(
+     const uint8_t *first_utf8_string,
+     const uint8_t *second_utf8_string,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_path_index_compare_paths";
+	size_t string_index   = 0;
+
+	if( first_utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	while( first_utf8_string[ string_index ] == second_utf8_string[ string_index ] )
+	{
+		if( first_utf8_string[ string_index ] == 0 )
+		{
+			return( LIBCDATA_COMPARE_EQUAL );
+		}
+		string_index++;
+	}
+	if( first_utf8_string[ string_index ] < second_utf8_string[ string_index ] )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	return( LIBCDATA_COMPARE_GREATER );
+}
+
+/* Compares the start of a case folded path with a prefix
+ * The prefix is case folded during the comparison
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL if the path starts with the prefix,
+ * LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libagdb_path_index_compare_prefix(
+     const uint8_t *utf8_string,
+     const uint8_t *prefix,
+     size_t prefix_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_path_index_compare_prefix";
+	size_t string_index   = 0;
+	uint8_t prefix_byte   = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( prefix == NULL )
+	 && ( prefix_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefix.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < prefix_length;
+	     string_index++ )
+	{
+		prefix_byte = libagdb_path_index_fold_character(
+		               prefix[ string_index ] );
+
+		if( utf8_string[ string_index ] != prefix_byte )
+		{
+			if( utf8_string[ string_index ] < prefix_byte )
+			{
+				return( LIBCDATA_COMPARE_LESS );
+			}
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Determines if a case folded path matches a glob pattern
+ * The pattern is case folded during the matching
+ * A * matches any sequence of characters including the path segment separator
+ * and a ? matches a single character
+ * Returns 1 if the path matches, 0 if not or -1 on error
+ */
+int libagdb_path_index_match_glob(
+     const uint8_t *utf8_string,
+     const uint8_t *pattern,
+     size_t pattern_length,
+     libcerror_error_t **error )
+{
+	static char *function     = "libagdb_path_index_match_glob";
+	size_t pattern_index      = 0;
+	size_t star_pattern_index = 0;
+	size_t star_string_index  = 0;
+	size_t string_index       = 0;
+	uint8_t has_star          = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern == NULL )
+	 && ( pattern_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string[ string_index ] != 0 )
+	{
+		if( ( pattern_index < pattern_length )
+		 && ( pattern[ pattern_index ] == (uint8_t) '*' ) )
+		{
+			has_star           = 1;
+			star_pattern_index = pattern_index++;
+			star_string_index  = string_index;
+
+			continue;
+		}
+		if( ( pattern_index < pattern_length )
+		 && ( pattern[ pattern_index ] == (uint8_t) '?' ) )
+		{
+			string_index++;
+
+			while( libagdb_path_index_is_continuation_byte( utf8_string[ string_index ] ) )
+			{
+				string_index++;
+			}
+			pattern_index++;
+
+			continue;
+		}
+		if( ( pattern_index < pattern_length )
+		 && ( utf8_string[ string_index ] == libagdb_path_index_fold_character( pattern[ pattern_index ] ) ) )
+		{
+			string_index++;
+			pattern_index++;
+
+			continue;
+		}
+		if( has_star == 0 )
+		{
+			return( 0 );
+		}
+		/* Let the last * consume one more character and retry
+		 */
+		star_string_index++;
+
+		while( libagdb_path_index_is_continuation_byte( utf8_string[ star_string_index ] ) )
+		{
+			star_string_index++;
+		}
+		pattern_index = star_pattern_index + 1;
+		string_index  = star_string_index;
+	}
+	while( ( pattern_index < pattern_length )
+	    && ( pattern[ pattern_index ] == (uint8_t) '*' ) )
+	{
+		pattern_index++;
+	}
+	if( pattern_index != pattern_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Case folds the paths and sorts the entry indexes by path
+ * The UTF-8 string and UTF-8 string offsets must be set before sorting
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_path_index_sort(
+     libagdb_path_index_t *path_index,
+     libcerror_error_t **error )
+{
+	int *merged_entry_indexes = NULL;
+	int *swap_entry_indexes   = NULL;
+	static char *function     = "libagdb_path_index_sort";
+	size_t string_index       = 0;
+	int entry_index           = 0;
+	int left_index            = 0;
+	int left_end_index        = 0;
+	int merged_index          = 0;
+	int result                = 0;
+	int right_index           = 0;
+	int right_end_index       = 0;
+	int run_size              = 0;
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( ( path_index->utf8_string == NULL )
+	 || ( path_index->utf8_string_offsets == NULL )
+	 || ( path_index->sorted_entry_indexes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid path index - missing values.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index->utf8_string[ path_index->utf8_string_size - 1 ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid path index - UTF-8 string is not terminated.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < path_index->number_of_entries;
+	     entry_index++ )
+	{
+		if( path_index->utf8_string_offsets[ entry_index ] >= path_index->utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid path index - entry: %d UTF-8 string offset value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	for( string_index = 0;
+	     string_index < path_index->utf8_string_size;
+	     string_index++ )
+	{
+		path_index->utf8_string[ string_index ] = libagdb_path_index_fold_character(
+		                                           path_index->utf8_string[ string_index ] );
+	}
+	merged_entry_indexes = (int *) libagdb_allocator_allocate(
+	                                sizeof( int ) * path_index->number_of_entries );
+
+	if( merged_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merged entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	/* A bottom-up merge sort is used so that entries with the same path retain their order
+	 */
+	for( run_size = 1;
+	     run_size < path_index->number_of_entries;
+	     run_size *= 2 )
+	{
+		merged_index = 0;
+
+		for( left_index = 0;
+		     left_index < path_index->number_of_entries;
+		     left_index = right_end_index )
+		{
+			left_end_index = left_index + run_size;
+
+			if( left_end_index > path_index->number_of_entries )
+			{
+				left_end_index = path_index->number_of_entries;
+			}
+			right_index     = left_end_index;
+			right_end_index = right_index + run_size;
+
+			if( right_end_index > path_index->number_of_entries )
+			{
+				right_end_index = path_index->number_of_entries;
+			}
+			entry_index = left_index;
+
+			while( ( entry_index < left_end_index )
+			    || ( right_index < right_end_index ) )
+			{
+				if( entry_index >= left_end_index )
+				{
+					result = LIBCDATA_COMPARE_GREATER;
+				}
+				else if( right_index >= right_end_index )
+				{
+					result = LIBCDATA_COMPARE_LESS;
+				}
+				else
+				{
+					result = libagdb_path_index_compare_paths(
+					          &( path_index->utf8_string[ path_index->utf8_string_offsets[ path_index->sorted_entry_indexes[ entry_index ] ] ] ),
+					          &( path_index->utf8_string[ path_index->utf8_string_offsets[ path_index->sorted_entry_indexes[ right_index ] ] ] ),
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to compare paths.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( result == LIBCDATA_COMPARE_GREATER )
+				{
+					merged_entry_indexes[ merged_index++ ] = path_index->sorted_entry_indexes[ right_index++ ];
+				}
+				else
+				{
+					merged_entry_indexes[ merged_index++ ] = path_index->sorted_entry_indexes[ entry_index++ ];
+				}
+			}
+		}
+		swap_entry_indexes               = path_index->sorted_entry_indexes;
+		path_index->sorted_entry_indexes = merged_entry_indexes;
+		merged_entry_indexes             = swap_entry_indexes;
+	}
+	libagdb_allocator_free(
+	 merged_entry_indexes );
+
+	return( 1 );
+
+on_error:
+	if( merged_entry_indexes != NULL )
+	{
+		libagdb_allocator_free(
+		 merged_entry_indexes );
+	}
+	return( -1 );
+}
+
+/* Retrieves the range of sorted indexes of the paths that start with a prefix
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_path_index_get_prefix_range(
+     libagdb_path_index_t *path_index,
+     const uint8_t *prefix,
+     size_t prefix_length,
+     int *first_sorted_index,
+     int *number_of_sorted_indexes,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_path_index_get_prefix_range";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int result            = 0;
+	int start_index       = 0;
+	int upper_index       = 0;
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( prefix == NULL )
+	 && ( prefix_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefix_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid prefix length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first sorted index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sorted_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sorted indexes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the first path that is not less than the prefix
+	 */
+	lower_index = 0;
+	upper_index = path_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		result = libagdb_path_index_compare_prefix(
+		          &( path_index->utf8_string[ path_index->utf8_string_offsets[ path_index->sorted_entry_indexes[ middle_index ] ] ] ),
+		          prefix,
+		          prefix_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare path with prefix.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == LIBCDATA_COMPARE_LESS )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	start_index = lower_index;
+
+	/* Determine the first path that is greater than the prefix
+	 */
+	upper_index = path_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		result = libagdb_path_index_compare_prefix(
+		          &( path_index->utf8_string[ path_index->utf8_string_offsets[ path_index->sorted_entry_indexes[ middle_index ] ] ] ),
+		          prefix,
+		          prefix_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare path with prefix.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == LIBCDATA_COMPARE_GREATER )
+		{
+			upper_index = middle_index;
+		}
+		else
+		{
+			lower_index = middle_index + 1;
+		}
+	}
+	*first_sorted_index       = start_index;
+	*number_of_sorted_indexes = lower_index - start_index;
+
+	return( 1 );
+}
+
+/* Retrieves the entry indexes of the paths that start with a prefix
+ * The entry indexes are stored in path order, at most number_of_entry_indexes are stored
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_path_index_get_entry_indexes_by_prefix(
+     libagdb_path_index_t *path_index,
+     const uint8_t *prefix,
+     size_t prefix_length,
+     int *entry_indexes,
+     int number_of_entry_indexes,
+     int *number_of_matches,
+     libcerror_error_t **error )
+{
+	static char *function        = "libagdb_path_index_get_entry_indexes_by_prefix";
+	int first_sorted_index       = 0;
+	int match_index              = 0;
+	int number_of_sorted_indexes = 0;
+
+	if( ( entry_indexes == NULL )
+	 && ( number_of_entry_indexes > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entry_indexes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of entry indexes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of matches.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_path_index_get_prefix_range(
+	     path_index,
+	     prefix,
+	     prefix_length,
+	     &first_sorted_index,
+	     &number_of_sorted_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefix range.",
+		 function );
+
+		return( -1 );
+	}
+	for( match_index = 0;
+	     ( match_index < number_of_sorted_indexes ) && ( match_index < number_of_entry_indexes );
+	     match_index++ )
+	{
+		entry_indexes[ match_index ] = path_index->sorted_entry_indexes[ first_sorted_index + match_index ];
+	}
+	*number_of_matches = number_of_sorted_indexes;
+
+	return( 1 );
+}
+
+/* Retrieves the entry indexes of the paths that match a glob pattern
+ * Only the paths that start with the literal part of the pattern, before the first * or ?, are matched
+ * The entry indexes are stored in path order, at most number_of_entry_indexes are stored
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_path_index_get_entry_indexes_by_glob(
+     libagdb_path_index_t *path_index,
+     const uint8_t *pattern,
+     size_t pattern_length,
+     int *entry_indexes,
+     int number_of_entry_indexes,
+     int *number_of_matches,
+     libcerror_error_t **error )
+{
+	static char *function        = "libagdb_path_index_get_entry_indexes_by_glob";
+	size_t prefix_length         = 0;
+	int entry_index              = 0;
+	int first_sorted_index       = 0;
+	int number_of_sorted_indexes = 0;
+	int result                   = 0;
+	int safe_number_of_matches   = 0;
+	int sorted_index             = 0;
+
+	if( ( entry_indexes == NULL )
+	 && ( number_of_entry_indexes > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entry_indexes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of entry indexes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of matches.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern != NULL )
+	{
+		while( ( prefix_length < pattern_length )
+		    && ( pattern[ prefix_length ] != (uint8_t) '*' )
+		    && ( pattern[ prefix_length ] != (uint8_t) '?' ) )
+		{
+			prefix_length++;
+		}
+	}
+	if( libagdb_path_index_get_prefix_range(
+	     path_index,
+	     pattern,
+	     prefix_length,
+	     &first_sorted_index,
+	     &number_of_sorted_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefix range.",
+		 function );
+
+		return( -1 );
+	}
+	for( sorted_index = first_sorted_index;
+	     sorted_index < ( first_sorted_index + number_of_sorted_indexes );
+	     sorted_index++ )
+	{
+		entry_index = path_index->sorted_entry_indexes[ sorted_index ];
+
+		result = libagdb_path_index_match_glob(
+		          &( path_index->utf8_string[ path_index->utf8_string_offsets[ entry_index ] ] ),
+		          pattern,
+		          pattern_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match entry: %d path with pattern.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( safe_number_of_matches < number_of_entry_indexes )
+			{
+				entry_indexes[ safe_number_of_matches ] = entry_index;
+			}
+			safe_number_of_matches++;
+		}
+	}
+	*number_of_matches = safe_number_of_matches;
+
+	return( 1 );
+}
+
@@ -0,0 +1,121 @@
+/*
+ * Path index functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_PATH_INDEX_H )
+#define _LIBAGDB_PATH_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_path_index libagdb_path_index_t;
+
+struct libagdb_path_index
+{
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The UTF-8 string containing the paths
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string size
+	 */
+	size_t utf8_string_size;
+
+	/* The UTF-8 string offsets of the path of each entry
+	 */
+	size_t *utf8_string_offsets;
+
+	/* The entry indexes sorted by path
+	 */
+	int *sorted_entry_indexes;
+};
+
+int libagdb_path_index_initialize(
+     libagdb_path_index_t **path_index,
+     int number_of_entries,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libagdb_path_index_free(
+     libagdb_path_index_t **path_index,
+     libcerror_error_t **error );
+
+int libagdb_path_index_compare_paths(
+     const uint8_t *first_utf8_string,
+     const uint8_t *second_utf8_string,
+     libcerror_error_t **error );
+
+int libagdb_path_index_compare_prefix(
+     const uint8_t *utf8_string,
+     const uint8_t *prefix,
+     size_t prefix_length,
+     libcerror_error_t **error );
+
+int libagdb_path_index_match_glob(
+     const uint8_t *utf8_string,
+     const uint8_t *pattern,
+     size_t pattern_length,
+     libcerror_error_t **error );
+
+int libagdb_path_index_sort(
+     libagdb_path_index_t *path_index,
+     libcerror_error_t **error );
+
+int libagdb_path_index_get_prefix_range(
+     libagdb_path_index_t *path_index,
+     const uint8_t *prefix,
+     size_t prefix_length,
+     int *first_sorted_index,
+     int *number_of_sorted_indexes,
+     libcerror_error_t **error );
+
+int libagdb_path_index_get_entry_indexes_by_prefix(
+     libagdb_path_index_t *path_index,
+     const uint8_t *prefix,
+     size_t prefix_length,
+     int *entry_indexes,
+     int number_of_entry_indexes,
+     int *number_of_matches,
+     libcerror_error_t **error );
+
+int libagdb_path_index_get_entry_indexes_by_glob(
+     libagdb_path_index_t *path_index,
+     const uint8_t *pattern,
+     size_t pattern_length,
+     int *entry_indexes,
+     int number_of_entry_indexes,
+     int *number_of_matches,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_PATH_INDEX_H ) */
+
@@ -0,0 +1,585 @@
+/*
+ * Source index functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_allocator.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_source_index.h"
+
+/* Case folds an executable filename character, only ASCII characters are folded
+ */
+#define libagdb_source_index_fold_character( character ) \
+	( ( ( character ) >= (uint8_t) 'a' ) && ( ( character ) <= (uint8_t) 'z' ) ? (uint8_t) ( ( character ) - 0x20 ) : ( character ) )
+
+/* Determines the bucket of a prefetch hash
+ */
+#define libagdb_source_index_get_prefetch_hash_bucket( source_index, prefetch_hash ) \
+	(int) ( ( ( ( prefetch_hash ) ^ ( ( prefetch_hash ) >> 16 ) ) * 0x045d9f3bUL ) & (uint32_t) ( ( source_index )->number_of_buckets - 1 ) )
+
+/* Creates a source index
+ * Make sure the value source_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_source_index_initialize(
+     libagdb_source_index_t **source_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_source_index_initialize";
+	int bucket_index      = 0;
+	int number_of_buckets = 1;
+
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid source index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( int ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use at least twice the number of entries as buckets to keep the chains short
+	 */
+	while( number_of_buckets < number_of_entries )
+	{
+		number_of_buckets *= 2;
+	}
+	if( number_of_entries > 0 )
+	{
+		number_of_buckets *= 2;
+	}
+	*source_index = libagdb_allocator_allocate_structure(
+	                 libagdb_source_index_t );
+
+	if( *source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *source_index,
+	     0,
+	     sizeof( libagdb_source_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear source index.",
+		 function );
+
+		libagdb_allocator_free(
+		 *source_index );
+
+		*source_index = NULL;
+
+		return( -1 );
+	}
+	( *source_index )->prefetch_hash_buckets = (int *) libagdb_allocator_allocate(
+	                                                    sizeof( int ) * number_of_buckets );
+
+	if( ( *source_index )->prefetch_hash_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create prefetch hash buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *source_index )->executable_filename_buckets = (int *) libagdb_allocator_allocate(
+	                                                          sizeof( int ) * number_of_buckets );
+
+	if( ( *source_index )->executable_filename_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create executable filename buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		( *source_index )->prefetch_hash_buckets[ bucket_index ]       = -1;
+		( *source_index )->executable_filename_buckets[ bucket_index ] = -1;
+	}
+	if( number_of_entries > 0 )
+	{
+		( *source_index )->prefetch_hashes = (uint32_t *) libagdb_allocator_allocate(
+		                                                   sizeof( uint32_t ) * number_of_entries );
+
+		if( ( *source_index )->prefetch_hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create prefetch hashes.",
+			 function );
+
+			goto on_error;
+		}
+		( *source_index )->executable_filenames = (uint8_t *) libagdb_allocator_allocate(
+		                                                       sizeof( uint8_t ) * 16 * number_of_entries );
+
+		if( ( *source_index )->executable_filenames == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create executable filenames.",
+			 function );
+
+			goto on_error;
+		}
+		( *source_index )->executable_filename_lengths = (uint8_t *) libagdb_allocator_allocate(
+		                                                              sizeof( uint8_t ) * number_of_entries );
+
+		if( ( *source_index )->executable_filename_lengths == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create executable filename lengths.",
+			 function );
+
+			goto on_error;
+		}
+		( *source_index )->prefetch_hash_next_entries = (int *) libagdb_allocator_allocate(
+		                                                         sizeof( int ) * number_of_entries );
+
+		if( ( *source_index )->prefetch_hash_next_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create prefetch hash next entries.",
+			 function );
+
+			goto on_error;
+		}
+		( *source_index )->executable_filename_next_entries = (int *) libagdb_allocator_allocate(
+		                                                               sizeof( int ) * number_of_entries );
+
+		if( ( *source_index )->executable_filename_next_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create executable filename next entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *source_index )->number_of_entries = number_of_entries;
+	( *source_index )->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( *source_index != NULL )
+	{
+		libagdb_source_index_free(
+		 source_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a source index
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_source_index_free(
+     libagdb_source_index_t **source_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_source_index_free";
+
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source_index != NULL )
+	{
+		if( ( *source_index )->executable_filename_next_entries != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *source_index )->executable_filename_next_entries );
+		}
+		if( ( *source_index )->prefetch_hash_next_entries != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *source_index )->prefetch_hash_next_entries );
+		}
+		if( ( *source_index )->executable_filename_lengths != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *source_index )->executable_filename_lengths );
+		}
+		if( ( *source_index )->executable_filenames != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *source_index )->executable_filenames );
+		}
+		if( ( *source_index )->prefetch_hashes != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *source_index )->prefetch_hashes );
+		}
+		if( ( *source_index )->executable_filename_buckets != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *source_index )->executable_filename_buckets );
+		}
+		if( ( *source_index )->prefetch_hash_buckets != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *source_index )->prefetch_hash_buckets );
+		}
+		libagdb_allocator_free(
+		 *source_index );
+
+		*source_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of an executable filename
+ * The executable filename is case folded during the calculation
+ * Returns the 32-bit FNV-1a hash of the case folded executable filename
+ */
+uint32_t libagdb_source_index_get_executable_filename_hash(
+          const uint8_t *executable_filename,
+          size_t executable_filename_length )
+{
+	size_t string_index = 0;
+	uint32_t hash_value = 0x811c9dc5UL;
+
+	if( executable_filename == NULL )
+	{
+		return( hash_value );
+	}
+	for( string_index = 0;
+	     string_index < executable_filename_length;
+	     string_index++ )
+	{
+		hash_value ^= libagdb_source_index_fold_character(
+		               executable_filename[ string_index ] );
+		hash_value *= 0x01000193UL;
+	}
+	return( hash_value );
+}
+
+/* Inserts an entry into the source index
+ * Entries with an empty executable filename are only indexed by prefetch hash
+ * Lookups return the most recently inserted matching entry, hence entries should be
+ * inserted last to first for lookups to return the first matching entry
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_source_index_insert_entry(
+     libagdb_source_index_t *source_index,
+     int entry_index,
+     uint32_t prefetch_hash,
+     const uint8_t *executable_filename,
+     size_t executable_filename_length,
+     libcerror_error_t **error )
+{
+	uint8_t *indexed_executable_filename = NULL;
+	static char *function                = "libagdb_source_index_insert_entry";
+	size_t string_index                  = 0;
+	int bucket_index                     = 0;
+
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= source_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( executable_filename == NULL )
+	 && ( executable_filename_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( executable_filename_length > 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid executable filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	source_index->prefetch_hashes[ entry_index ] = prefetch_hash;
+
+	bucket_index = libagdb_source_index_get_prefetch_hash_bucket(
+	                source_index,
+	                prefetch_hash );
+
+	source_index->prefetch_hash_next_entries[ entry_index ] = source_index->prefetch_hash_buckets[ bucket_index ];
+	source_index->prefetch_hash_buckets[ bucket_index ]     = entry_index;
+
+	indexed_executable_filename = &( source_index->executable_filenames[ entry_index * 16 ] );
+
+	for( string_index = 0;
+	     string_index < executable_filename_length;
+	     string_index++ )
+	{
+		indexed_executable_filename[ string_index ] = libagdb_source_index_fold_character(
+		                                               executable_filename[ string_index ] );
+	}
+	source_index->executable_filename_lengths[ entry_index ] = (uint8_t) executable_filename_length;
+	source_index->executable_filename_next_entries[ entry_index ] = -1;
+
+	if( executable_filename_length > 0 )
+	{
+		bucket_index = (int) ( libagdb_source_index_get_executable_filename_hash(
+		                        executable_filename,
+		                        executable_filename_length ) & (uint32_t) ( source_index->number_of_buckets - 1 ) );
+
+		source_index->executable_filename_next_entries[ entry_index ] = source_index->executable_filename_buckets[ bucket_index ];
+		source_index->executable_filename_buckets[ bucket_index ]     = entry_index;
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the entry with a specific prefetch hash
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libagdb_source_index_get_entry_index_by_prefetch_hash(
+     libagdb_source_index_t *source_index,
+     uint32_t prefetch_hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_source_index_get_entry_index_by_prefetch_hash";
+	int bucket_index      = 0;
+	int safe_entry_index  = 0;
+
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libagdb_source_index_get_prefetch_hash_bucket(
+	                source_index,
+	                prefetch_hash );
+
+	safe_entry_index = source_index->prefetch_hash_buckets[ bucket_index ];
+
+	while( safe_entry_index != -1 )
+	{
+		if( source_index->prefetch_hashes[ safe_entry_index ] == prefetch_hash )
+		{
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+		safe_entry_index = source_index->prefetch_hash_next_entries[ safe_entry_index ];
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the entry with a specific executable filename
+ * The comparison is case insensitive for ASCII characters
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libagdb_source_index_get_entry_index_by_executable_filename(
+     libagdb_source_index_t *source_index,
+     const uint8_t *executable_filename,
+     size_t executable_filename_length,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	uint8_t *indexed_executable_filename = NULL;
+	static char *function                = "libagdb_source_index_get_entry_index_by_executable_filename";
+	size_t string_index                  = 0;
+	int bucket_index                     = 0;
+	int safe_entry_index                 = 0;
+
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( executable_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The stored executable filenames are at most 16 characters and never empty
+	 */
+	if( ( executable_filename_length == 0 )
+	 || ( executable_filename_length > 16 ) )
+	{
+		return( 0 );
+	}
+	bucket_index = (int) ( libagdb_source_index_get_executable_filename_hash(
+	                        executable_filename,
+	                        executable_filename_length ) & (uint32_t) ( source_index->number_of_buckets - 1 ) );
+
+	safe_entry_index = source_index->executable_filename_buckets[ bucket_index ];
+
+	while( safe_entry_index != -1 )
+	{
+		if( (size_t) source_index->executable_filename_lengths[ safe_entry_index ] == executable_filename_length )
+		{
+			indexed_executable_filename = &( source_index->executable_filenames[ safe_entry_index * 16 ] );
+
+			for( string_index = 0;
+			     string_index < executable_filename_length;
+			     string_index++ )
+			{
+				if( indexed_executable_filename[ string_index ] != libagdb_source_index_fold_character( executable_filename[ string_index ] ) )
+				{
+					break;
+				}
+			}
+			if( string_index == executable_filename_length )
+			{
+				*entry_index = safe_entry_index;
+
+				return( 1 );
+			}
+		}
+		safe_entry_index = source_index->executable_filename_next_entries[ safe_entry_index ];
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,116 @@
+/*
+ * Source index functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_SOURCE_INDEX_H )
+#define _LIBAGDB_SOURCE_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_source_index libagdb_source_index_t;
+
+struct libagdb_source_index
+{
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of buckets
+	 * Which is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The prefetch hash of each entry
+	 */
+	uint32_t *prefetch_hashes;
+
+	/* The case folded executable filename of each entry
+	 * Each executable filename consists of 16 bytes
+	 */
+	uint8_t *executable_filenames;
+
+	/* The executable filename length of each entry
+	 */
+	uint8_t *executable_filename_lengths;
+
+	/* The first entry index of each prefetch hash bucket or -1 if empty
+	 */
+	int *prefetch_hash_buckets;
+
+	/* The next entry index in the same prefetch hash bucket or -1 if none
+	 */
+	int *prefetch_hash_next_entries;
+
+	/* The first entry index of each executable filename bucket or -1 if empty
+	 */
+	int *executable_filename_buckets;
+
+	/* The next entry index in the same executable filename bucket or -1 if none
+	 */
+	int *executable_filename_next_entries;
+};
+
+int libagdb_source_index_initialize(
+     libagdb_source_index_t **source_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libagdb_source_index_free(
+     libagdb_source_index_t **source_index,
+     libcerror_error_t **error );
+
+uint32_t libagdb_source_index_get_executable_filename_hash(
+          const uint8_t *executable_filename,
+          size_t executable_filename_length );
+
+int libagdb_source_index_insert_entry(
+     libagdb_source_index_t *source_index,
+     int entry_index,
+     uint32_t prefetch_hash,
+     const uint8_t *executable_filename,
+     size_t executable_filename_length,
+     libcerror_error_t **error );
+
+int libagdb_source_index_get_entry_index_by_prefetch_hash(
+     libagdb_source_index_t *source_index,
+     uint32_t prefetch_hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libagdb_source_index_get_entry_index_by_executable_filename(
+     libagdb_source_index_t *source_index,
+     const uint8_t *executable_filename,
+     size_t executable_filename_length,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_SOURCE_INDEX_H ) */
+
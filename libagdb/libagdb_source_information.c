@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libagdb_allocator.h"
 #include "libagdb_debug.h"
 #include "libagdb_definitions.h"
 #include "libagdb_io_handle.h"
@@ -72,7 +73,7 @@ int libagdb_source_information_initialize(
 
 		return( -1 );
 	}
-	internal_source_information = memory_allocate_structure(
+	internal_source_information = libagdb_allocator_allocate_structure(
 	                               libagdb_internal_source_information_t );
 
 	if( internal_source_information == NULL )
@@ -107,7 +108,7 @@ int libagdb_source_information_initialize(
 on_error:
 	if( internal_source_information != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 internal_source_information );
 	}
 	return( -1 );
@@ -162,7 +163,7 @@ int libagdb_internal_source_information_free(
 	}
 	if( *internal_source_information != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 *internal_source_information );
 
 		*internal_source_information = NULL;
@@ -184,6 +185,8 @@ ssize_t libagdb_source_information_read(
 {
 	uint8_t sub_entry_data[ 32 ];
 
+	const uint8_t *entry_data        = NULL;
+	const uint8_t *sub_entry_view    = NULL;
 	uint8_t *source_information_data = NULL;
 	static char *function            = "libagdb_source_information_read";
 	ssize_t read_count               = 0;
@@ -191,6 +194,7 @@ ssize_t libagdb_source_information_read(
 	uint32_t entry_index             = 0;
 	uint32_t number_of_entries       = 0;
 	uint32_t sub_entry_data_size     = 0;
+	int result                       = 0;
 
 	if( internal_source_information == NULL )
 	{
@@ -226,20 +230,6 @@ ssize_t libagdb_source_information_read(
 
 		return( -1 );
 	}
-	source_information_data = (uint8_t *) memory_allocate(
-	                                       sizeof( uint8_t ) * (size_t) io_handle->source_information_entry_size );
-
-	if( source_information_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create source information data.",
-		 function );
-
-		goto on_error;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -251,35 +241,83 @@ ssize_t libagdb_source_information_read(
 		 file_offset );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              uncompressed_data_stream,
-	              (intptr_t *) file_io_handle,
-	              source_information_data,
-	              (size_t) io_handle->source_information_entry_size,
-	              file_offset,
-	              0,
-	              error );
-
-	if( read_count != (ssize_t) io_handle->source_information_entry_size )
+	/* For uncompressed files that are memory mapped the source information
+	 * is read directly from the mapped data
+	 */
+	if( io_handle->file_type == LIBAGDB_FILE_TYPE_UNCOMPRESSED )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read source: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 source_information_index,
-		 file_offset,
-		 file_offset );
+		result = libagdb_io_handle_get_mapped_data(
+		          io_handle,
+		          file_offset,
+		          (size_t) io_handle->source_information_entry_size,
+		          &entry_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped source: %" PRIu32 " information data.",
+			 function,
+			 source_information_index );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
+	if( result != 0 )
+	{
+		read_count = (ssize_t) io_handle->source_information_entry_size;
+	}
+	else
+	{
+		source_information_data = (uint8_t *) libagdb_allocator_allocate(
+		                                       sizeof( uint8_t ) * (size_t) io_handle->source_information_entry_size );
+
+		if( source_information_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create source information data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              uncompressed_data_stream,
+		              (intptr_t *) file_io_handle,
+		              source_information_data,
+		              (size_t) io_handle->source_information_entry_size,
+		              file_offset,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) io_handle->source_information_entry_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read source: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 source_information_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		entry_data = source_information_data;
+	}
+	file_offset += read_count;
 	total_read_count += read_count;
 
 	if( libagdb_source_information_read_data(
 	     internal_source_information,
 	     io_handle,
-	     source_information_data,
+	     entry_data,
 	     (size_t) io_handle->source_information_entry_size,
 	     &number_of_entries,
 	     error ) != 1 )
@@ -294,15 +332,31 @@ ssize_t libagdb_source_information_read(
 
 		goto on_error;
 	}
-	memory_free(
-	 source_information_data );
-
-	source_information_data = NULL;
+	if( source_information_data != NULL )
+	{
+		libagdb_allocator_free(
+		 source_information_data );
 
+		source_information_data = NULL;
+	}
 	if( number_of_entries > 0 )
 	{
+		if( ( io_handle->file_information_sub_entry_type2_size == 0 )
+		 || ( io_handle->file_information_sub_entry_type2_size > 32 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file information sub entry type 2 size: %" PRIu32 " value out of bounds.",
+			 function,
+			 io_handle->file_information_sub_entry_type2_size );
+
+			return( -1 );
+		}
 /* TODO is this the correct sub entry type ? */
-		if( ( io_handle->file_information_sub_entry_type2_size != 16 )
+		if( ( io_handle->validation_level != LIBAGDB_VALIDATION_LEVEL_NONE )
+		 && ( io_handle->file_information_sub_entry_type2_size != 16 )
 		 && ( io_handle->file_information_sub_entry_type2_size != 24 ) )
 		{
 			libcerror_error_set(
@@ -321,25 +375,50 @@ ssize_t libagdb_source_information_read(
 		     entry_index < number_of_entries;
 		     entry_index++ )
 		{
-			read_count = libfdata_stream_read_buffer(
-				      uncompressed_data_stream,
-				      (intptr_t *) file_io_handle,
-				      sub_entry_data,
-				      (size_t) sub_entry_data_size,
-				      0,
-				      error );
-
-			if( read_count != (ssize_t) sub_entry_data_size )
+			if( result != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub entry: %" PRIu32 " data.",
-				 function,
-				 entry_index );
+				if( libagdb_io_handle_get_mapped_data(
+				     io_handle,
+				     file_offset,
+				     (size_t) sub_entry_data_size,
+				     &sub_entry_view,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve mapped sub entry: %" PRIu32 " data.",
+					 function,
+					 entry_index );
 
-				goto on_error;
+					goto on_error;
+				}
+				read_count = (ssize_t) sub_entry_data_size;
+			}
+			else
+			{
+				read_count = libfdata_stream_read_buffer(
+					      uncompressed_data_stream,
+					      (intptr_t *) file_io_handle,
+					      sub_entry_data,
+					      (size_t) sub_entry_data_size,
+					      0,
+					      error );
+
+				if( read_count != (ssize_t) sub_entry_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read sub entry: %" PRIu32 " data.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				sub_entry_view = sub_entry_data;
 			}
 			total_read_count += read_count;
 			file_offset      += read_count;
@@ -352,7 +431,7 @@ ssize_t libagdb_source_information_read(
 				 function,
 				 entry_index );
 				libcnotify_print_data(
-				 sub_entry_data,
+				 sub_entry_view,
 				 (size_t) sub_entry_data_size,
 				 0 );
 			}
@@ -366,7 +445,7 @@ on_error:
 
 	if( source_information_data != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 source_information_data );
 	}
 	return( -1 );
@@ -383,15 +462,16 @@ int libagdb_source_information_read_data(
      uint32_t *number_of_entries,
      libcerror_error_t **error )
 {
-	static char *function           = "libagdb_source_information_read_data";
-	int string_index                = 0;
-	size_t name_offset              = 0;
-	uint32_t safe_number_of_entries = 0;
-	uint8_t number_of_bits          = 0;
+	const libagdb_source_information_layout_t *layout = NULL;
+	static char *function                             = "libagdb_source_information_read_data";
+	int string_index                                  = 0;
+	size_t name_offset                                = 0;
+	uint32_t safe_number_of_entries                   = 0;
+	uint8_t number_of_bits                            = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit            = 0;
-	uint32_t value_32bit            = 0;
+	uint64_t value_64bit                              = 0;
+	uint32_t value_32bit                              = 0;
 #endif
 
 	if( internal_source_information == NULL )
@@ -472,49 +552,7 @@ int libagdb_source_information_read_data(
 		 0 );
 	}
 #endif
-	switch( io_handle->file_header_signature )
-	{
-		case 0x00000003UL:
-			if( io_handle->source_information_entry_size == 60 )
-			{
-				number_of_bits = 32;
-			}
-			else if( ( io_handle->source_information_entry_size == 80 )
-			      || ( io_handle->source_information_entry_size == 88 ) )
-			{
-				number_of_bits = 64;
-			}
-			break;
-
-		case 0x0000000eUL:
-			if( ( io_handle->source_information_entry_size == 60 )
-			 || ( io_handle->source_information_entry_size == 100 ) )
-			{
-				number_of_bits = 32;
-			}
-			else if( ( io_handle->source_information_entry_size == 88 )
-			      || ( io_handle->source_information_entry_size == 144 ) )
-			{
-				number_of_bits = 64;
-			}
-			break;
-
-		case 0x0000000fUL:
-			if( io_handle->source_information_entry_size == 100 )
-			{
-				number_of_bits = 32;
-			}
-			else if( io_handle->source_information_entry_size == 144 )
-			{
-				number_of_bits = 64;
-			}
-			break;
-
-		default:
-			break;
-
-	}
-	if( number_of_bits == 0 )
+	if( io_handle->source_information_layout == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -526,49 +564,20 @@ int libagdb_source_information_read_data(
 
 		return( -1 );
 	}
-	if( io_handle->file_header_signature == 0x00000003UL )
-	{
-		if( io_handle->source_information_entry_size == 80 )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 &( data[ 56 ] ),
-			 safe_number_of_entries );
-		}
-	}
-	else if( io_handle->file_header_signature == 0x0000000eUL )
+	layout         = io_handle->source_information_layout;
+	number_of_bits = layout->number_of_bits;
+	name_offset    = (size_t) layout->executable_filename_offset;
+
+	if( layout->number_of_entries_offset > 0 )
 	{
-		if( number_of_bits == 32 )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (agdb_source_information_60_32bit_t *) data )->unknown2,
-			 safe_number_of_entries );
-		}
-		else if( number_of_bits == 64 )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (agdb_source_information_88_64bit_t *) data )->unknown2,
-			 safe_number_of_entries );
-		}
-		if( io_handle->source_information_entry_size == 100 )
-		{
-			name_offset = 44;
-		}
-		else if( io_handle->source_information_entry_size == 144 )
-		{
-			name_offset = 72;
-		}
-	}
-	else if( io_handle->file_header_signature == 0x0000000fUL )
-	{
-		if( io_handle->source_information_entry_size == 100 )
-		{
-			name_offset = 24;
-		}
-		else if( io_handle->source_information_entry_size == 144 )
-		{
-			name_offset = 40;
-		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ layout->number_of_entries_offset ] ),
+		 safe_number_of_entries );
 	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ layout->prefetch_hash_offset ] ),
+	 internal_source_information->prefetch_hash );
+
 	if( name_offset > 0 )
 	{
 		if( memory_copy(
@@ -1327,6 +1336,46 @@ int libagdb_source_information_read_data(
 	return( 1 );
 }
 
+/* Retrieves the prefetch hash
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_source_information_get_prefetch_hash(
+     libagdb_source_information_t *source_information,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	static char *function                                              = "libagdb_source_information_get_prefetch_hash";
+
+	if( source_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_information = (libagdb_internal_source_information_t *) source_information;
+
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	*prefetch_hash = internal_source_information->prefetch_hash;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded executable filename
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -48,6 +48,10 @@ struct libagdb_internal_source_information
 	/* The executable filename size
 	 */
 	uint32_t executable_filename_size;
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
 };
 
 int libagdb_source_information_initialize(
@@ -80,6 +84,12 @@ int libagdb_source_information_read_data(
      uint32_t *number_of_entries,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_source_information_get_prefetch_hash(
+     libagdb_source_information_t *source_information,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_source_information_get_utf8_executable_filename_size(
      libagdb_source_information_t *source_information,
@@ -0,0 +1,304 @@
+/*
+ * String functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+#include "libagdb_libuna.h"
+#include "libagdb_string.h"
+
+/* Determines the number of characters of an UTF-16 little-endian stream
+ * if it only contains ASCII characters, up to the first end-of-string character
+ * 4 code units are checked at a time, which covers most paths in the database
+ * Returns 1 if the stream only contains ASCII characters, 0 if not or -1 on error
+ */
+int libagdb_string_get_utf16_stream_ascii_length(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *ascii_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_string_get_utf16_stream_ascii_length";
+	size_t stream_index   = 0;
+	uint64_t value_64bit  = 0;
+	uint16_t value_16bit  = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+	/* Streams with an odd size are left to libuna to report
+	 */
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		return( 0 );
+	}
+	while( ( stream_index + 8 ) <= utf16_stream_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf16_stream[ stream_index ] ),
+		 value_64bit );
+
+		/* Stop if any of the 4 code units is 0
+		 */
+		if( ( ( value_64bit - 0x0001000100010001ULL ) & ~value_64bit & 0x8000800080008000ULL ) != 0 )
+		{
+			break;
+		}
+		if( ( value_64bit & 0xff80ff80ff80ff80ULL ) != 0 )
+		{
+			return( 0 );
+		}
+		stream_index += 8;
+	}
+	while( stream_index < utf16_stream_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ stream_index ] ),
+		 value_16bit );
+
+		if( value_16bit == 0 )
+		{
+			break;
+		}
+		if( value_16bit >= 0x0080 )
+		{
+			return( 0 );
+		}
+		stream_index += 2;
+	}
+	*ascii_length = stream_index / 2;
+
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-16 little-endian stream
+ * The size includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_string_get_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_string_get_utf8_string_size_from_utf16_stream";
+	size_t ascii_length   = 0;
+	int result            = 0;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          utf16_stream,
+	          utf16_stream_size,
+	          &ascii_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII length of UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*utf8_string_size = ascii_length + 1;
+	}
+	else if( libuna_utf8_string_size_from_utf16_stream(
+	          utf16_stream,
+	          utf16_stream_size,
+	          LIBUNA_ENDIAN_LITTLE,
+	          utf8_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-16 little-endian stream to an UTF-8 string
+ * The UTF-8 string index is set to the position after the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_string_copy_utf8_string_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_string_copy_utf8_string_from_utf16_stream";
+	size_t ascii_index    = 0;
+	size_t ascii_length   = 0;
+	size_t string_index   = 0;
+	int result            = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          utf16_stream,
+	          utf16_stream_size,
+	          &ascii_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII length of UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		string_index = *utf8_string_index;
+
+		if( ( string_index >= utf8_string_size )
+		 || ( ascii_length >= ( utf8_string_size - string_index ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		for( ascii_index = 0;
+		     ascii_index < ascii_length;
+		     ascii_index++ )
+		{
+			utf8_string[ string_index++ ] = utf16_stream[ ascii_index * 2 ];
+		}
+		utf8_string[ string_index++ ] = 0;
+
+		*utf8_string_index = string_index;
+	}
+	else if( libuna_utf8_string_with_index_copy_from_utf16_stream(
+	          utf8_string,
+	          utf8_string_size,
+	          utf8_string_index,
+	          utf16_stream,
+	          utf16_stream_size,
+	          LIBUNA_ENDIAN_LITTLE,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
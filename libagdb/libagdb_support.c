@@ -333,8 +333,9 @@ int libagdb_check_file_signature_file_io_handle(
 	size64_t file_size              = 0;
 	ssize_t read_count              = 0;
 	uint32_t uncompressed_data_size = 0;
-	uint32_t value32_bit            = 0;
+	uint8_t file_type               = 0;
 	int file_io_handle_is_open      = -1;
+	int result                      = 0;
 
 	if( file_io_handle == NULL )
 	{
@@ -427,61 +428,159 @@ int libagdb_check_file_signature_file_io_handle(
 			goto on_error;
 		}
 	}
+	result = libagdb_check_file_signature_data(
+	          signature,
+	          8,
+	          file_size,
+	          &file_type,
+	          &uncompressed_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to check signature.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if data contains an AGDB file signature
+ * The data should contain at least the first 8 bytes of the file and file_size
+ * the size of the file, which is needed to detect an uncompressed file
+ * On a match file_type is set to a LIBAGDB_FILE_TYPES value and uncompressed_data_size
+ * to the uncompressed data size from the file header, otherwise both are set to 0
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libagdb_check_file_signature_data(
+     const uint8_t *data,
+     size_t data_size,
+     size64_t file_size,
+     uint8_t *file_type,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                = "libagdb_check_file_signature_data";
+	uint32_t safe_uncompressed_data_size = 0;
+	uint32_t value_32bit                 = 0;
+	uint8_t safe_file_type               = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 8 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 safe_uncompressed_data_size );
+
 	if( memory_compare(
 	     agdb_mem_file_signature_vista,
-	     signature,
+	     data,
 	     4 ) == 0 )
 	{
-		return( 1 );
+		safe_file_type = LIBAGDB_FILE_TYPE_COMPRESSED_VISTA;
 	}
 	else if( memory_compare(
 	          agdb_mem_file_signature_win7,
-	          signature,
+	          data,
 	          4 ) == 0 )
 	{
-		return( 1 );
+		safe_file_type = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7;
 	}
 	else if( memory_compare(
 	          agdb_mem_file_signature_win8_0,
-	          signature,
+	          data,
 	          4 ) == 0 )
 	{
-		return( 1 );
+		safe_file_type = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0;
 	}
 	else if( memory_compare(
 	          agdb_mam_file_signature_win8_1,
-	          signature,
+	          data,
 	          4 ) == 0 )
 	{
-		return( 1 );
+		safe_file_type = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1;
 	}
-/* TODO improve detection */
-	byte_stream_copy_to_uint32_little_endian(
-	 signature,
-	 value32_bit );
-
-	if( ( value32_bit == 0x00000005UL )
-	 || ( value32_bit == 0x0000000eUL )
-	 || ( value32_bit == 0x0000000fUL ) )
+	else
 	{
+/* TODO improve detection */
 		byte_stream_copy_to_uint32_little_endian(
-		 &( signature[ 4 ] ),
-		 uncompressed_data_size );
+		 data,
+		 value_32bit );
 
-		if( file_size == (size64_t) uncompressed_data_size )
+		if( ( ( value_32bit == 0x00000005UL )
+		  || ( value_32bit == 0x0000000eUL )
+		  || ( value_32bit == 0x0000000fUL ) )
+		 && ( file_size == (size64_t) safe_uncompressed_data_size ) )
 		{
-			return( 1 );
+			safe_file_type = LIBAGDB_FILE_TYPE_UNCOMPRESSED;
 		}
 	}
-	return( 0 );
-
-on_error:
-	if( file_io_handle_is_open == 0 )
+	if( safe_file_type == 0 )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 NULL );
+		*file_type              = 0;
+		*uncompressed_data_size = 0;
+
+		return( 0 );
 	}
-	return( -1 );
+	*file_type              = safe_file_type;
+	*uncompressed_data_size = safe_uncompressed_data_size;
+
+	return( 1 );
 }
 
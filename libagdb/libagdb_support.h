@@ -74,6 +74,15 @@ int libagdb_check_file_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_check_file_signature_data(
+     const uint8_t *data,
+     size_t data_size,
+     size64_t file_size,
+     uint8_t *file_type,
+     uint32_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
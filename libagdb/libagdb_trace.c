@@ -0,0 +1,133 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+#include "libagdb_trace.h"
+
+/* Sets the trace callbacks
+ * The file is passed to the callbacks to identify the file the phase belongs to
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_trace_callbacks_set(
+     libagdb_trace_callbacks_t *trace_callbacks,
+     libagdb_file_t *file,
+     void (*begin_callback)(
+            intptr_t *callback_data,
+            libagdb_file_t *file,
+            int trace_phase,
+            uint32_t trace_index,
+            uint8_t file_type,
+            off64_t offset,
+            size64_t size ),
+     void (*end_callback)(
+            intptr_t *callback_data,
+            libagdb_file_t *file,
+            int trace_phase,
+            uint32_t trace_index,
+            int result,
+            size64_t size ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_trace_callbacks_set";
+
+	if( trace_callbacks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( begin_callback == NULL )
+	 && ( end_callback == NULL )
+	 && ( callback_data != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data value set without callbacks.",
+		 function );
+
+		return( -1 );
+	}
+	trace_callbacks->begin_callback = begin_callback;
+	trace_callbacks->end_callback   = end_callback;
+	trace_callbacks->callback_data  = callback_data;
+	trace_callbacks->file           = file;
+
+	return( 1 );
+}
+
+/* Signals the begin of a phase
+ */
+void libagdb_trace_begin(
+      const libagdb_trace_callbacks_t *trace_callbacks,
+      int trace_phase,
+      uint32_t trace_index,
+      uint8_t file_type,
+      off64_t offset,
+      size64_t size )
+{
+	if( ( trace_callbacks != NULL )
+	 && ( trace_callbacks->begin_callback != NULL ) )
+	{
+		trace_callbacks->begin_callback(
+		 trace_callbacks->callback_data,
+		 trace_callbacks->file,
+		 trace_phase,
+		 trace_index,
+		 file_type,
+		 offset,
+		 size );
+	}
+}
+
+/* Signals the end of a phase
+ * The result is 1 if the phase was successful or -1 on error
+ */
+void libagdb_trace_end(
+      const libagdb_trace_callbacks_t *trace_callbacks,
+      int trace_phase,
+      uint32_t trace_index,
+      int result,
+      size64_t size )
+{
+	if( ( trace_callbacks != NULL )
+	 && ( trace_callbacks->end_callback != NULL ) )
+	{
+		trace_callbacks->end_callback(
+		 trace_callbacks->callback_data,
+		 trace_callbacks->file,
+		 trace_phase,
+		 trace_index,
+		 result,
+		 size );
+	}
+}
+
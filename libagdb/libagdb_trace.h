@@ -0,0 +1,110 @@
+/*
+ * Trace functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_TRACE_H )
+#define _LIBAGDB_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+#include "libagdb_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_trace_callbacks libagdb_trace_callbacks_t;
+
+struct libagdb_trace_callbacks
+{
+	/* The begin callback
+	 */
+	void (*begin_callback)(
+	       intptr_t *callback_data,
+	       libagdb_file_t *file,
+	       int trace_phase,
+	       uint32_t trace_index,
+	       uint8_t file_type,
+	       off64_t offset,
+	       size64_t size );
+
+	/* The end callback
+	 */
+	void (*end_callback)(
+	       intptr_t *callback_data,
+	       libagdb_file_t *file,
+	       int trace_phase,
+	       uint32_t trace_index,
+	       int result,
+	       size64_t size );
+
+	/* The callback data
+	 */
+	intptr_t *callback_data;
+
+	/* The file that is passed to the callbacks
+	 */
+	libagdb_file_t *file;
+};
+
+int libagdb_trace_callbacks_set(
+     libagdb_trace_callbacks_t *trace_callbacks,
+     libagdb_file_t *file,
+     void (*begin_callback)(
+            intptr_t *callback_data,
+            libagdb_file_t *file,
+            int trace_phase,
+            uint32_t trace_index,
+            uint8_t file_type,
+            off64_t offset,
+            size64_t size ),
+     void (*end_callback)(
+            intptr_t *callback_data,
+            libagdb_file_t *file,
+            int trace_phase,
+            uint32_t trace_index,
+            int result,
+            size64_t size ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+void libagdb_trace_begin(
+      const libagdb_trace_callbacks_t *trace_callbacks,
+      int trace_phase,
+      uint32_t trace_index,
+      uint8_t file_type,
+      off64_t offset,
+      size64_t size );
+
+void libagdb_trace_end(
+      const libagdb_trace_callbacks_t *trace_callbacks,
+      int trace_phase,
+      uint32_t trace_index,
+      int result,
+      size64_t size );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_TRACE_H ) */
+
@@ -34,19 +34,111 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libagdb_diff {}			libagdb_diff_t;
 typedef struct libagdb_file {}			libagdb_file_t;
 typedef struct libagdb_file_information {}	libagdb_file_information_t;
+typedef struct libagdb_generator {}		libagdb_generator_t;
+typedef struct libagdb_parse_cache {}		libagdb_parse_cache_t;
 typedef struct libagdb_source_information {}	libagdb_source_information_t;
 typedef struct libagdb_volume_information {}	libagdb_volume_information_t;
 
 #else
+typedef intptr_t libagdb_diff_t;
 typedef intptr_t libagdb_file_t;
 typedef intptr_t libagdb_file_information_t;
+typedef intptr_t libagdb_generator_t;
+typedef intptr_t libagdb_parse_cache_t;
 typedef intptr_t libagdb_source_information_t;
 typedef intptr_t libagdb_volume_information_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The following structures are filled by the bulk summary functions
+ * The values are ordered by size to prevent padding between them
+ */
+typedef struct libagdb_volume_summary libagdb_volume_summary_t;
+
+struct libagdb_volume_summary
+{
+	/* The creation time
+	 */
+	uint64_t creation_time;
+
+	/* The size of the UTF-8 encoded device path including the end of string character
+	 */
+	size_t utf8_device_path_size;
+
+	/* The serial number
+	 */
+	uint32_t serial_number;
+
+	/* The number of files
+	 */
+	uint32_t number_of_files;
+};
+
+typedef struct libagdb_file_summary libagdb_file_summary_t;
+
+struct libagdb_file_summary
+{
+	/* The size of the UTF-8 encoded path including the end of string character
+	 */
+	size_t utf8_path_size;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+};
+
+typedef struct libagdb_source_summary libagdb_source_summary_t;
+
+struct libagdb_source_summary
+{
+	/* The size of the UTF-8 encoded executable filename including the end of string character
+	 */
+	size_t utf8_executable_filename_size;
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+};
+
+/* The following structure is filled by the diff functions
+ * An index is -1 if it does not apply to the type of difference
+ */
+typedef struct libagdb_difference libagdb_difference_t;
+
+struct libagdb_difference
+{
+	/* The index of the volume in the previous file
+	 */
+	int previous_volume_index;
+
+	/* The index of the file or source in the previous file
+	 */
+	int previous_entry_index;
+
+	/* The index of the volume in the current file
+	 */
+	int current_volume_index;
+
+	/* The index of the file or source in the current file
+	 */
+	int current_entry_index;
+
+	/* The number of entries of the file in the previous file
+	 */
+	uint32_t previous_number_of_entries;
+
+	/* The number of entries of the file in the current file
+	 */
+	uint32_t current_number_of_entries;
+
+	/* The difference type
+	 */
+	uint8_t type;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBAGDB ) */
 
 #endif /* !defined( _LIBAGDB_INTERNAL_TYPES_H ) */
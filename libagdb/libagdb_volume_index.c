@@ -0,0 +1,605 @@
+/*
+ * Volume index functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libagdb_allocator.h"
+#include "libagdb_libcerror.h"
+#include "libagdb_volume_index.h"
+
+/* Case folds a device path character, only ASCII characters are folded
+ */
+#define libagdb_volume_index_fold_character( character ) \
+	( ( ( character ) >= (uint8_t) 'a' ) && ( ( character ) <= (uint8_t) 'z' ) ? (uint8_t) ( ( character ) - 0x20 ) : ( character ) )
+
+/* Determines the bucket of a serial number
+ */
+#define libagdb_volume_index_get_serial_number_bucket( volume_index, serial_number ) \
+	(int) ( ( ( ( serial_number ) ^ ( ( serial_number ) >> 16 ) ) * 0x045d9f3bUL ) & (uint32_t) ( ( volume_index )->number_of_buckets - 1 ) )
+
+/* Creates a volume index
+ * Make sure the value volume_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_index_initialize(
+     libagdb_volume_index_t **volume_index,
+     int number_of_entries,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_volume_index_initialize";
+	int bucket_index      = 0;
+	int number_of_buckets = 1;
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( size_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every device path consists of at least the end-of-string character
+	 */
+	if( ( utf8_string_size < (size_t) number_of_entries )
+	 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use at least twice the number of entries as buckets to keep the chains short
+	 */
+	while( number_of_buckets < number_of_entries )
+	{
+		number_of_buckets *= 2;
+	}
+	if( number_of_entries > 0 )
+	{
+		number_of_buckets *= 2;
+	}
+	*volume_index = libagdb_allocator_allocate_structure(
+	                 libagdb_volume_index_t );
+
+	if( *volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create volume index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *volume_index,
+	     0,
+	     sizeof( libagdb_volume_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume index.",
+		 function );
+
+		libagdb_allocator_free(
+		 *volume_index );
+
+		*volume_index = NULL;
+
+		return( -1 );
+	}
+	( *volume_index )->serial_number_buckets = (int *) libagdb_allocator_allocate(
+	                                                    sizeof( int ) * number_of_buckets );
+
+	if( ( *volume_index )->serial_number_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create serial number buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *volume_index )->device_path_buckets = (int *) libagdb_allocator_allocate(
+	                                                  sizeof( int ) * number_of_buckets );
+
+	if( ( *volume_index )->device_path_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device path buckets.",
+		 function );
+
+		goto on_error;
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		( *volume_index )->serial_number_buckets[ bucket_index ] = -1;
+		( *volume_index )->device_path_buckets[ bucket_index ]   = -1;
+	}
+	if( number_of_entries > 0 )
+	{
+		( *volume_index )->serial_numbers = (uint32_t *) libagdb_allocator_allocate(
+		                                                  sizeof( uint32_t ) * number_of_entries );
+
+		if( ( *volume_index )->serial_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create serial numbers.",
+			 function );
+
+			goto on_error;
+		}
+		( *volume_index )->utf8_string = (uint8_t *) libagdb_allocator_allocate(
+		                                              sizeof( uint8_t ) * utf8_string_size );
+
+		if( ( *volume_index )->utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		( *volume_index )->utf8_string_offsets = (size_t *) libagdb_allocator_allocate(
+		                                                     sizeof( size_t ) * number_of_entries );
+
+		if( ( *volume_index )->utf8_string_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string offsets.",
+			 function );
+
+			goto on_error;
+		}
+		( *volume_index )->serial_number_next_entries = (int *) libagdb_allocator_allocate(
+		                                                         sizeof( int ) * number_of_entries );
+
+		if( ( *volume_index )->serial_number_next_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create serial number next entries.",
+			 function );
+
+			goto on_error;
+		}
+		( *volume_index )->device_path_next_entries = (int *) libagdb_allocator_allocate(
+		                                                       sizeof( int ) * number_of_entries );
+
+		if( ( *volume_index )->device_path_next_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create device path next entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *volume_index )->number_of_entries = number_of_entries;
+	( *volume_index )->number_of_buckets = number_of_buckets;
+	( *volume_index )->utf8_string_size  = utf8_string_size;
+
+	return( 1 );
+
+on_error:
+	if( *volume_index != NULL )
+	{
+		libagdb_volume_index_free(
+		 volume_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a volume index
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_index_free(
+     libagdb_volume_index_t **volume_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_volume_index_free";
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_index != NULL )
+	{
+		if( ( *volume_index )->device_path_next_entries != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *volume_index )->device_path_next_entries );
+		}
+		if( ( *volume_index )->serial_number_next_entries != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *volume_index )->serial_number_next_entries );
+		}
+		if( ( *volume_index )->utf8_string_offsets != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *volume_index )->utf8_string_offsets );
+		}
+		if( ( *volume_index )->utf8_string != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *volume_index )->utf8_string );
+		}
+		if( ( *volume_index )->serial_numbers != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *volume_index )->serial_numbers );
+		}
+		if( ( *volume_index )->device_path_buckets != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *volume_index )->device_path_buckets );
+		}
+		if( ( *volume_index )->serial_number_buckets != NULL )
+		{
+			libagdb_allocator_free(
+			 ( *volume_index )->serial_number_buckets );
+		}
+		libagdb_allocator_free(
+		 *volume_index );
+
+		*volume_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of an UTF-8 encoded device path
+ * The device path is case folded during the calculation
+ * Returns the 32-bit FNV-1a hash of the case folded device path
+ */
+uint32_t libagdb_volume_index_get_device_path_hash(
+          const uint8_t *utf8_string,
+          size_t utf8_string_length )
+{
+	size_t string_index = 0;
+	uint32_t hash_value = 0x811c9dc5UL;
+
+	if( utf8_string == NULL )
+	{
+		return( hash_value );
+	}
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		hash_value ^= libagdb_volume_index_fold_character(
+		               utf8_string[ string_index ] );
+		hash_value *= 0x01000193UL;
+	}
+	return( hash_value );
+}
+
+/* Inserts an entry into the volume index
+ * The device path of the entry must be stored in the UTF-8 string before insertion
+ * Entries with an empty device path are only indexed by serial number
+ * Lookups return the most recently inserted matching entry, hence entries should be
+ * inserted last to first for lookups to return the first matching entry
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_index_insert_entry(
+     libagdb_volume_index_t *volume_index,
+     int entry_index,
+     uint32_t serial_number,
+     libcerror_error_t **error )
+{
+	const uint8_t *device_path = NULL;
+	static char *function      = "libagdb_volume_index_insert_entry";
+	size_t device_path_length  = 0;
+	size_t utf8_string_offset  = 0;
+	int bucket_index           = 0;
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= volume_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string_offset = volume_index->utf8_string_offsets[ entry_index ];
+
+	if( utf8_string_offset >= volume_index->utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index - entry: %d UTF-8 string offset value out of bounds.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	device_path = &( volume_index->utf8_string[ utf8_string_offset ] );
+
+	while( device_path[ device_path_length ] != 0 )
+	{
+		device_path_length++;
+
+		if( device_path_length >= ( volume_index->utf8_string_size - utf8_string_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid volume index - entry: %d device path is not terminated.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	volume_index->serial_numbers[ entry_index ] = serial_number;
+
+	bucket_index = libagdb_volume_index_get_serial_number_bucket(
+	                volume_index,
+	                serial_number );
+
+	volume_index->serial_number_next_entries[ entry_index ] = volume_index->serial_number_buckets[ bucket_index ];
+	volume_index->serial_number_buckets[ bucket_index ]     = entry_index;
+
+	volume_index->device_path_next_entries[ entry_index ] = -1;
+
+	if( device_path_length > 0 )
+	{
+		bucket_index = (int) ( libagdb_volume_index_get_device_path_hash(
+		                        device_path,
+		                        device_path_length ) & (uint32_t) ( volume_index->number_of_buckets - 1 ) );
+
+		volume_index->device_path_next_entries[ entry_index ] = volume_index->device_path_buckets[ bucket_index ];
+		volume_index->device_path_buckets[ bucket_index ]     = entry_index;
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the entry with a specific serial number
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libagdb_volume_index_get_entry_index_by_serial_number(
+     libagdb_volume_index_t *volume_index,
+     uint32_t serial_number,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libagdb_volume_index_get_entry_index_by_serial_number";
+	int bucket_index      = 0;
+	int safe_entry_index  = 0;
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libagdb_volume_index_get_serial_number_bucket(
+	                volume_index,
+	                serial_number );
+
+	safe_entry_index = volume_index->serial_number_buckets[ bucket_index ];
+
+	while( safe_entry_index != -1 )
+	{
+		if( volume_index->serial_numbers[ safe_entry_index ] == serial_number )
+		{
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+		safe_entry_index = volume_index->serial_number_next_entries[ safe_entry_index ];
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the entry with a specific UTF-8 encoded device path
+ * The comparison is case insensitive for ASCII characters
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libagdb_volume_index_get_entry_index_by_utf8_device_path(
+     libagdb_volume_index_t *volume_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	const uint8_t *device_path = NULL;
+	static char *function      = "libagdb_volume_index_get_entry_index_by_utf8_device_path";
+	size_t maximum_length      = 0;
+	size_t string_index        = 0;
+	int bucket_index           = 0;
+	int safe_entry_index       = 0;
+
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Empty device paths are not indexed
+	 */
+	if( utf8_string_length == 0 )
+	{
+		return( 0 );
+	}
+	bucket_index = (int) ( libagdb_volume_index_get_device_path_hash(
+	                        utf8_string,
+	                        utf8_string_length ) & (uint32_t) ( volume_index->number_of_buckets - 1 ) );
+
+	safe_entry_index = volume_index->device_path_buckets[ bucket_index ];
+
+	while( safe_entry_index != -1 )
+	{
+		device_path    = &( volume_index->utf8_string[ volume_index->utf8_string_offsets[ safe_entry_index ] ] );
+		maximum_length = volume_index->utf8_string_size - volume_index->utf8_string_offsets[ safe_entry_index ];
+
+		/* The device path was checked to be terminated on insertion
+		 */
+		if( utf8_string_length < maximum_length )
+		{
+			for( string_index = 0;
+			     string_index < utf8_string_length;
+			     string_index++ )
+			{
+				if( libagdb_volume_index_fold_character( device_path[ string_index ] ) != libagdb_volume_index_fold_character( utf8_string[ string_index ] ) )
+				{
+					break;
+				}
+			}
+			if( ( string_index == utf8_string_length )
+			 && ( device_path[ string_index ] == 0 ) )
+			{
+				*entry_index = safe_entry_index;
+
+				return( 1 );
+			}
+		}
+		safe_entry_index = volume_index->device_path_next_entries[ safe_entry_index ];
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,118 @@
+/*
+ * Volume index functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBAGDB_VOLUME_INDEX_H )
+#define _LIBAGDB_VOLUME_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libagdb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libagdb_volume_index libagdb_volume_index_t;
+
+struct libagdb_volume_index
+{
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of buckets
+	 * Which is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The serial number of each entry
+	 */
+	uint32_t *serial_numbers;
+
+	/* The UTF-8 string containing the device paths
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string size
+	 */
+	size_t utf8_string_size;
+
+	/* The UTF-8 string offsets of the device path of each entry
+	 */
+	size_t *utf8_string_offsets;
+
+	/* The first entry index of each serial number bucket or -1 if empty
+	 */
+	int *serial_number_buckets;
+
+	/* The next entry index in the same serial number bucket or -1 if none
+	 */
+	int *serial_number_next_entries;
+
+	/* The first entry index of each device path bucket or -1 if empty
+	 */
+	int *device_path_buckets;
+
+	/* The next entry index in the same device path bucket or -1 if none
+	 */
+	int *device_path_next_entries;
+};
+
+int libagdb_volume_index_initialize(
+     libagdb_volume_index_t **volume_index,
+     int number_of_entries,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libagdb_volume_index_free(
+     libagdb_volume_index_t **volume_index,
+     libcerror_error_t **error );
+
+uint32_t libagdb_volume_index_get_device_path_hash(
+          const uint8_t *utf8_string,
+          size_t utf8_string_length );
+
+int libagdb_volume_index_insert_entry(
+     libagdb_volume_index_t *volume_index,
+     int entry_index,
+     uint32_t serial_number,
+     libcerror_error_t **error );
+
+int libagdb_volume_index_get_entry_index_by_serial_number(
+     libagdb_volume_index_t *volume_index,
+     uint32_t serial_number,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libagdb_volume_index_get_entry_index_by_utf8_device_path(
+     libagdb_volume_index_t *volume_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBAGDB_VOLUME_INDEX_H ) */
+
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libagdb_allocator.h"
 #include "libagdb_debug.h"
 #include "libagdb_definitions.h"
 #include "libagdb_file_information.h"
@@ -33,10 +34,13 @@
 #include "libagdb_libcdata.h"
 #include "libagdb_libcerror.h"
 #include "libagdb_libcnotify.h"
+#include "libagdb_libcthreads.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdatetime.h"
 #include "libagdb_libfdata.h"
 #include "libagdb_libuna.h"
+#include "libagdb_string.h"
+#include "libagdb_trace.h"
 #include "libagdb_volume_information.h"
 
 #include "agdb_volume_information.h"
@@ -74,7 +78,7 @@ int libagdb_volume_information_initialize(
 
 		return( -1 );
 	}
-	internal_volume_information = memory_allocate_structure(
+	internal_volume_information = libagdb_allocator_allocate_structure(
 	                               libagdb_internal_volume_information_t );
 
 	if( internal_volume_information == NULL )
@@ -116,6 +120,21 @@ int libagdb_volume_information_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_volume_information->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*volume_information = (libagdb_volume_information_t *) internal_volume_information;
 
 	return( 1 );
@@ -123,7 +142,14 @@ int libagdb_volume_information_initialize(
 on_error:
 	if( internal_volume_information != NULL )
 	{
-		memory_free(
+		if( internal_volume_information->files_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_volume_information->files_array ),
+			 NULL,
+			 NULL );
+		}
+		libagdb_allocator_free(
 		 internal_volume_information );
 	}
 	return( -1 );
@@ -179,9 +205,10 @@ int libagdb_internal_volume_information_free(
 	}
 	if( *internal_volume_information != NULL )
 	{
-		if( ( *internal_volume_information )->device_path != NULL )
+		if( ( ( *internal_volume_information )->device_path != NULL )
+		 && ( ( *internal_volume_information )->device_path_is_mapped == 0 ) )
 		{
-			memory_free(
+			libagdb_allocator_free(
 			 ( *internal_volume_information )->device_path );
 		}
 		if( libcdata_array_free(
@@ -198,7 +225,38 @@ int libagdb_internal_volume_information_free(
 
 			result = -1;
 		}
-		memory_free(
+		if( ( *internal_volume_information )->path_index != NULL )
+		{
+			if( libagdb_path_index_free(
+			     &( ( *internal_volume_information )->path_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free path index.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *internal_volume_information )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		libagdb_allocator_free(
 		 *internal_volume_information );
 
 		*internal_volume_information = NULL;
@@ -216,14 +274,14 @@ int libagdb_internal_volume_information_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function  = "libagdb_internal_volume_information_read_data";
-	uint8_t number_of_bits = 0;
+	const libagdb_volume_information_layout_t *layout = NULL;
+	static char *function                             = "libagdb_internal_volume_information_read_data";
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *filetime_data = NULL;
-	uint64_t value_64bit   = 0;
-	uint32_t value_32bit   = 0;
-	uint16_t value_16bit   = 0;
+	uint8_t *filetime_data                            = NULL;
+	uint64_t value_64bit                              = 0;
+	uint32_t value_32bit                              = 0;
+	uint16_t value_16bit                              = 0;
 #endif
 
 	if( internal_volume_information == NULL )
@@ -271,36 +329,7 @@ int libagdb_internal_volume_information_read_data(
 
 		return( -1 );
 	}
-	switch( io_handle->file_header_signature )
-	{
-		case 0x00000003UL:
-			if( io_handle->volume_information_entry_size == 72 )
-			{
-				number_of_bits = 32;
-			}
-			else if( io_handle->volume_information_entry_size == 96 )
-			{
-				number_of_bits = 64;
-			}
-			break;
-
-		case 0x0000000eUL:
-		case 0x0000000fUL:
-			if( io_handle->volume_information_entry_size == 56 )
-			{
-				number_of_bits = 32;
-			}
-			else if( io_handle->volume_information_entry_size == 72 )
-			{
-				number_of_bits = 64;
-			}
-			break;
-
-		default:
-			break;
-
-	}
-	if( number_of_bits == 0 )
+	if( io_handle->volume_information_layout == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -312,6 +341,7 @@ int libagdb_internal_volume_information_read_data(
 
 		return( -1 );
 	}
+	layout = io_handle->volume_information_layout;
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -324,52 +354,32 @@ int libagdb_internal_volume_information_read_data(
 		 0 );
 	}
 #endif
-	if( number_of_bits == 32 )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (agdb_volume_information_56_32bit_t *) data )->number_of_files,
-		 internal_volume_information->number_of_files );
-
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (agdb_volume_information_56_32bit_t *) data )->creation_time,
-		 internal_volume_information->creation_time );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (agdb_volume_information_56_32bit_t *) data )->serial_number,
-		 internal_volume_information->serial_number );
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ layout->number_of_files_offset ] ),
+	 internal_volume_information->number_of_files );
 
-		byte_stream_copy_to_uint16_little_endian(
-		 ( (agdb_volume_information_56_32bit_t *) data )->device_path_number_of_characters,
-		 internal_volume_information->device_path_size );
-	}
-	else if( number_of_bits == 64 )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (agdb_volume_information_72_64bit_t *) data )->number_of_files,
-		 internal_volume_information->number_of_files );
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ layout->creation_time_offset ] ),
+	 internal_volume_information->creation_time );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (agdb_volume_information_72_64bit_t *) data )->creation_time,
-		 internal_volume_information->creation_time );
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ layout->serial_number_offset ] ),
+	 internal_volume_information->serial_number );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (agdb_volume_information_72_64bit_t *) data )->serial_number,
-		 internal_volume_information->serial_number );
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ layout->device_path_number_of_characters_offset ] ),
+	 internal_volume_information->device_path_size );
 
-		byte_stream_copy_to_uint16_little_endian(
-		 ( (agdb_volume_information_72_64bit_t *) data )->device_path_number_of_characters,
-		 internal_volume_information->device_path_size );
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( number_of_bits == 32 )
+		if( layout->number_of_bits == 32 )
 		{
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (agdb_volume_information_56_32bit_t *) data )->unknown1,
 			 value_64bit );
 		}
-		else if( number_of_bits == 64 )
+		else if( layout->number_of_bits == 64 )
 		{
 			byte_stream_copy_to_uint64_little_endian(
 			 ( (agdb_volume_information_72_64bit_t *) data )->unknown1,
@@ -380,13 +390,13 @@ int libagdb_internal_volume_information_read_data(
 		 function,
 		 value_64bit );
 
-		if( number_of_bits == 32 )
+		if( layout->number_of_bits == 32 )
 		{
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (agdb_volume_information_56_32bit_t *) data )->unknown2,
 			 value_64bit );
 		}
-		else if( number_of_bits == 64 )
+		else if( layout->number_of_bits == 64 )
 		{
 			byte_stream_copy_to_uint64_little_endian(
 			 ( (agdb_volume_information_72_64bit_t *) data )->unknown2,
@@ -402,13 +412,13 @@ int libagdb_internal_volume_information_read_data(
 		 function,
 		 internal_volume_information->number_of_files );
 
-		if( number_of_bits == 32 )
+		if( layout->number_of_bits == 32 )
 		{
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (agdb_volume_information_56_32bit_t *) data )->unknown3,
 			 value_32bit );
 		}
-		else if( number_of_bits == 64 )
+		else if( layout->number_of_bits == 64 )
 		{
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (agdb_volume_information_72_64bit_t *) data )->unknown3,
@@ -419,13 +429,13 @@ int libagdb_internal_volume_information_read_data(
 		 function,
 		 value_32bit );
 
-		if( number_of_bits == 32 )
+		if( layout->number_of_bits == 32 )
 		{
 			byte_stream_copy_to_uint64_little_endian(
 			 ( (agdb_volume_information_56_32bit_t *) data )->unknown4,
 			 value_64bit );
 		}
-		else if( number_of_bits == 64 )
+		else if( layout->number_of_bits == 64 )
 		{
 			byte_stream_copy_to_uint64_little_endian(
 			 ( (agdb_volume_information_72_64bit_t *) data )->unknown4,
@@ -436,11 +446,11 @@ int libagdb_internal_volume_information_read_data(
 		 function,
 		 value_64bit );
 
-		if( number_of_bits == 32 )
+		if( layout->number_of_bits == 32 )
 		{
 			filetime_data = ( (agdb_volume_information_56_32bit_t *) data )->creation_time;
 		}
-		else if( number_of_bits == 64 )
+		else if( layout->number_of_bits == 64 )
 		{
 			filetime_data = ( (agdb_volume_information_72_64bit_t *) data )->creation_time;
 		}
@@ -467,13 +477,13 @@ int libagdb_internal_volume_information_read_data(
 		 function,
 		 internal_volume_information->serial_number );
 
-		if( number_of_bits == 32 )
+		if( layout->number_of_bits == 32 )
 		{
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (agdb_volume_information_56_32bit_t *) data )->unknown5,
 			 value_32bit );
 		}
-		else if( number_of_bits == 64 )
+		else if( layout->number_of_bits == 64 )
 		{
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (agdb_volume_information_72_64bit_t *) data )->unknown5,
@@ -484,13 +494,13 @@ int libagdb_internal_volume_information_read_data(
 		 function,
 		 value_32bit );
 
-		if( number_of_bits == 32 )
+		if( layout->number_of_bits == 32 )
 		{
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (agdb_volume_information_56_32bit_t *) data )->unknown6,
 			 value_64bit );
 		}
-		else if( number_of_bits == 64 )
+		else if( layout->number_of_bits == 64 )
 		{
 			byte_stream_copy_to_uint64_little_endian(
 			 ( (agdb_volume_information_72_64bit_t *) data )->unknown6,
@@ -506,13 +516,13 @@ int libagdb_internal_volume_information_read_data(
 		 function,
 		 internal_volume_information->device_path_size );
 
-		if( number_of_bits == 32 )
+		if( layout->number_of_bits == 32 )
 		{
 			byte_stream_copy_to_uint16_little_endian(
 			 ( (agdb_volume_information_56_32bit_t *) data )->unknown7,
 			 value_16bit );
 		}
-		else if( number_of_bits == 64 )
+		else if( layout->number_of_bits == 64 )
 		{
 			byte_stream_copy_to_uint16_little_endian(
 			 ( (agdb_volume_information_72_64bit_t *) data )->unknown7,
@@ -523,7 +533,7 @@ int libagdb_internal_volume_information_read_data(
 		 function,
 		 value_16bit );
 
-		if( number_of_bits == 64 )
+		if( layout->number_of_bits == 64 )
 		{
 			byte_stream_copy_to_uint32_little_endian(
 			 ( (agdb_volume_information_72_64bit_t *) data )->unknown8,
@@ -533,13 +543,13 @@ int libagdb_internal_volume_information_read_data(
 			 function,
 			 value_32bit );
 		}
-		if( number_of_bits == 32 )
+		if( layout->number_of_bits == 32 )
 		{
 			byte_stream_copy_to_uint64_little_endian(
 			 ( (agdb_volume_information_56_32bit_t *) data )->unknown9,
 			 value_64bit );
 		}
-		else if( number_of_bits == 64 )
+		else if( layout->number_of_bits == 64 )
 		{
 			byte_stream_copy_to_uint64_little_endian(
 			 ( (agdb_volume_information_72_64bit_t *) data )->unknown9,
@@ -550,7 +560,7 @@ int libagdb_internal_volume_information_read_data(
 		 function,
 		 value_64bit );
 
-		if( ( number_of_bits == 32 )
+		if( ( layout->number_of_bits == 32 )
 		 && ( io_handle->volume_information_entry_size == 72 ) )
 		{
 			byte_stream_copy_to_uint32_little_endian(
@@ -577,7 +587,7 @@ int libagdb_internal_volume_information_read_data(
 			 function,
 			 value_64bit );
 		}
-		else if( ( number_of_bits == 64 )
+		else if( ( layout->number_of_bits == 64 )
 		      && ( io_handle->volume_information_entry_size == 96 ) )
 		{
 			byte_stream_copy_to_uint64_little_endian(
@@ -699,7 +709,7 @@ int libagdb_internal_volume_information_read_device_path_data(
 
 			goto on_error;
 		}
-		internal_volume_information->device_path = (uint8_t *) memory_allocate(
+		internal_volume_information->device_path = (uint8_t *) libagdb_allocator_allocate(
 		                                                        sizeof( uint8_t ) * internal_volume_information->device_path_size );
 
 		if( internal_volume_information->device_path == NULL )
@@ -733,7 +743,7 @@ int libagdb_internal_volume_information_read_device_path_data(
 on_error:
 	if( internal_volume_information->device_path != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 internal_volume_information->device_path );
 
 		internal_volume_information->device_path = NULL;
@@ -758,15 +768,21 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 	uint8_t alignment_padding_data[ 8 ];
 
 	libagdb_file_information_t *file_information = NULL;
+	const uint8_t *entry_data                    = NULL;
+	const uint8_t *mapped_data                   = NULL;
 	uint8_t *volume_information_data             = NULL;
 	static char *function                        = "libagdb_internal_volume_information_read_file_io_handle";
 	ssize64_t total_read_count                   = 0;
 	size_t alignment_padding_size                = 0;
 	size_t alignment_size                        = 0;
 	ssize_t read_count                           = 0;
-	uint32_t calculated_hash_value               = 0;
 	uint32_t file_index                          = 0;
 	int entry_index                              = 0;
+	int result                                   = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t calculated_hash_value               = 0;
+#endif
 
 	if( internal_volume_information == NULL )
 	{
@@ -824,51 +840,107 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	volume_information_data = (uint8_t *) memory_allocate(
-	                                       sizeof( uint8_t ) * (size_t) io_handle->volume_information_entry_size );
-
-	if( volume_information_data == NULL )
+	/* For uncompressed files that are memory mapped the volume information
+	 * is read directly from the mapped data
+	 */
+	if( io_handle->file_type == LIBAGDB_FILE_TYPE_UNCOMPRESSED )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create volume: %" PRIu32 " information data.",
-		 function,
-		 volume_index );
+		result = libagdb_io_handle_get_mapped_data(
+		          io_handle,
+		          file_offset,
+		          (size_t) io_handle->volume_information_entry_size,
+		          &entry_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped volume: %" PRIu32 " information data.",
+			 function,
+			 volume_index );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              data_stream,
-	              (intptr_t *) file_io_handle,
-	              volume_information_data,
-	              (size_t) io_handle->volume_information_entry_size,
-	              file_offset,
-	              0,
-	              error );
-
-	if( read_count != (ssize_t) io_handle->volume_information_entry_size )
+	if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read volume: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 volume_index,
-		 file_offset,
-		 file_offset );
+		read_count = (ssize_t) io_handle->volume_information_entry_size;
+	}
+	else
+	{
+		volume_information_data = (uint8_t *) libagdb_allocator_allocate(
+		                                       sizeof( uint8_t ) * (size_t) io_handle->volume_information_entry_size );
 
-		goto on_error;
+		if( volume_information_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create volume: %" PRIu32 " information data.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              data_stream,
+		              (intptr_t *) file_io_handle,
+		              volume_information_data,
+		              (size_t) io_handle->volume_information_entry_size,
+		              file_offset,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) io_handle->volume_information_entry_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volume: %" PRIu32 " information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 volume_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		entry_data = volume_information_data;
 	}
 	total_read_count += read_count;
 	file_offset      += read_count;
 
+	if( result != 0 )
+	{
+		/* Keep the data stream offset in sync with the data read from the mapped data
+		 */
+		if( libfdata_stream_seek_offset(
+		     data_stream,
+		     file_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek volume: %" PRIu32 " information data end offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 volume_index,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+	}
 	if( libagdb_internal_volume_information_read_data(
 	     internal_volume_information,
 	     io_handle,
-	     volume_information_data,
+	     entry_data,
 	     (size_t) io_handle->volume_information_entry_size,
 	     error ) != 1 )
 	{
@@ -882,32 +954,17 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 
 		goto on_error;
 	}
-	memory_free(
-	 volume_information_data );
-
-	volume_information_data = NULL;
-
-	if( io_handle->volume_information_entry_size == 56 )
-	{
-		alignment_size = 4;
-	}
-	else if( ( io_handle->volume_information_entry_size == 72 )
-	      || ( io_handle->volume_information_entry_size == 96 ) )
-	{
-		alignment_size = 8;
-	}
-	else
+	if( volume_information_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported volume information entry size: %" PRIu32 ".",
-		 function,
-		 io_handle->volume_information_entry_size );
+		libagdb_allocator_free(
+		 volume_information_data );
 
-		goto on_error;
+		volume_information_data = NULL;
 	}
+	result = 0;
+
+	alignment_size = (size_t) io_handle->volume_information_layout->alignment_size;
+
 	if( internal_volume_information->device_path_size > 0 )
 	{
 		if( internal_volume_information->device_path_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
@@ -921,43 +978,104 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 
 			goto on_error;
 		}
-		internal_volume_information->device_path = (uint8_t *) memory_allocate(
-		                                                        sizeof( uint8_t ) * internal_volume_information->device_path_size );
-
-		if( internal_volume_information->device_path == NULL )
+		/* For uncompressed files that are memory mapped the device path
+		 * references the mapped data
+		 */
+		if( io_handle->file_type == LIBAGDB_FILE_TYPE_UNCOMPRESSED )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create device path.",
-			 function );
+			result = libagdb_io_handle_get_mapped_data(
+			          io_handle,
+			          file_offset,
+			          (size_t) internal_volume_information->device_path_size,
+			          &mapped_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve mapped volume: %" PRIu32 " device path data.",
+				 function,
+				 volume_index );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		read_count = libfdata_stream_read_buffer(
-		              data_stream,
-		              (intptr_t *) file_io_handle,
-		              internal_volume_information->device_path,
-		              internal_volume_information->device_path_size,
-		              0,
-		              error );
+		if( result != 0 )
+		{
+			internal_volume_information->device_path           = (uint8_t *) mapped_data;
+			internal_volume_information->device_path_is_mapped = 1;
 
-		if( read_count != (ssize_t) internal_volume_information->device_path_size )
+			read_count = (ssize_t) internal_volume_information->device_path_size;
+		}
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read volume: %" PRIu32 " information data.",
-			 function,
-			 volume_index );
+			internal_volume_information->device_path = (uint8_t *) libagdb_allocator_allocate(
+			                                                        sizeof( uint8_t ) * internal_volume_information->device_path_size );
 
-			goto on_error;
+			if( internal_volume_information->device_path == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create device path.",
+				 function );
+
+				goto on_error;
+			}
+			io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_ALLOCATIONS ] += 1;
+			io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_SIZE ]        += internal_volume_information->device_path_size;
+
+			read_count = libfdata_stream_read_buffer(
+			              data_stream,
+			              (intptr_t *) file_io_handle,
+			              internal_volume_information->device_path,
+			              internal_volume_information->device_path_size,
+			              0,
+			              error );
+
+			if( read_count != (ssize_t) internal_volume_information->device_path_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read volume: %" PRIu32 " information data.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
 		}
 		total_read_count += read_count;
 		file_offset      += read_count;
 
+		if( result != 0 )
+		{
+			/* Keep the data stream offset in sync with the data read from the mapped data
+			 */
+			if( libfdata_stream_seek_offset(
+			     data_stream,
+			     file_offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek volume: %" PRIu32 " alignment padding offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 volume_index,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -971,25 +1089,43 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 			 0 );
 		}
 #endif
-		if( libagdb_hash_calculate(
-		     &calculated_hash_value,
-		     internal_volume_information->device_path,
-		     internal_volume_information->device_path_size - 2,
-		     error ) != 1 )
+		if( io_handle->validation_level == LIBAGDB_VALIDATION_LEVEL_STRICT )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve volume: %" PRIu32 " device path hash value.",
-			 function,
-			 volume_index );
+			if( ( internal_volume_information->device_path[ internal_volume_information->device_path_size - 2 ] != 0 )
+			 || ( internal_volume_information->device_path[ internal_volume_information->device_path_size - 1 ] != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid volume: %" PRIu32 " device path - missing end-of-string character.",
+				 function,
+				 volume_index );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
+			/* The device path hash value is only calculated for the debug output
+			 */
+			if( libagdb_hash_calculate(
+			     &calculated_hash_value,
+			     internal_volume_information->device_path,
+			     internal_volume_information->device_path_size - 2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %" PRIu32 " device path hash value.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
 			if( libagdb_debug_print_utf16_string_value(
 			     function,
 			     "volume device path\t\t\t",
@@ -1032,42 +1168,82 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 				 alignment_padding_size );
 			}
 #endif
-			read_count = libfdata_stream_read_buffer(
-			              data_stream,
-			              (intptr_t *) file_io_handle,
-			              alignment_padding_data,
-			              alignment_padding_size,
-			              0,
-			              error );
-
-			if( read_count != (ssize_t) alignment_padding_size )
+			if( io_handle->validation_level == LIBAGDB_VALIDATION_LEVEL_STRICT )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read file: %" PRIu32 " alignment padding data.",
-				 function,
-				 file_index );
-
-				goto on_error;
+				read_count = libfdata_stream_read_buffer(
+				              data_stream,
+				              (intptr_t *) file_io_handle,
+				              alignment_padding_data,
+				              alignment_padding_size,
+				              0,
+				              error );
+
+				if( read_count != (ssize_t) alignment_padding_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read volume: %" PRIu32 " alignment padding data.",
+					 function,
+					 volume_index );
+
+					goto on_error;
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: volume: %" PRIu32 " alignment padding data:\n",
+					 function,
+					 volume_index );
+					libcnotify_print_data(
+					 alignment_padding_data,
+					 alignment_padding_size,
+					 0 );
+				}
+#endif
+				if( libagdb_io_handle_check_padding_data(
+				     alignment_padding_data,
+				     alignment_padding_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: invalid volume: %" PRIu32 " alignment padding data.",
+					 function,
+					 volume_index );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				/* The alignment padding is skipped without reading it
+				 */
+				read_count = (ssize_t) alignment_padding_size;
+
+				if( libfdata_stream_seek_offset(
+				     data_stream,
+				     file_offset + read_count,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek volume: %" PRIu32 " alignment padding.",
+					 function,
+					 volume_index );
+
+					goto on_error;
+				}
 			}
 			total_read_count += read_count;
 			file_offset      += read_count;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: file: %" PRIu32 " alignment padding data:\n",
-				 function,
-				 file_index );
-				libcnotify_print_data(
-				 alignment_padding_data,
-				 alignment_padding_size,
-				 0 );
-			}
-#endif
 		}
 	}
 	for( file_index = 0;
@@ -1088,6 +1264,17 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 
 			goto on_error;
 		}
+		io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_ALLOCATIONS ] += 1;
+		io_handle->statistics[ LIBAGDB_STATISTIC_METADATA_SIZE ]        += sizeof( libagdb_internal_file_information_t );
+
+		libagdb_trace_begin(
+		 &( io_handle->trace_callbacks ),
+		 LIBAGDB_TRACE_PHASE_FILE_INFORMATION,
+		 file_index,
+		 io_handle->file_type,
+		 file_offset,
+		 (size64_t) io_handle->file_information_entry_size );
+
 		read_count = libagdb_internal_file_information_read_file_io_handle(
 		              (libagdb_internal_file_information_t *) file_information,
 		              io_handle,
@@ -1097,6 +1284,13 @@ ssize64_t libagdb_internal_volume_information_read_file_io_handle(
 		              file_index,
 		              error );
 
+		libagdb_trace_end(
+		 &( io_handle->trace_callbacks ),
+		 LIBAGDB_TRACE_PHASE_FILE_INFORMATION,
+		 file_index,
+		 ( read_count == -1 ) ? -1 : 1,
+		 ( read_count == -1 ) ? 0 : (size64_t) read_count );
+
 		if( read_count == -1 )
 		{
 			libcerror_error_set(
@@ -1141,16 +1335,19 @@ on_error:
 	}
 	if( internal_volume_information->device_path != NULL )
 	{
-		memory_free(
-		 internal_volume_information->device_path );
-
+		if( internal_volume_information->device_path_is_mapped == 0 )
+		{
+			libagdb_allocator_free(
+			 internal_volume_information->device_path );
+		}
 		internal_volume_information->device_path = NULL;
 	}
-	internal_volume_information->device_path_size = 0;
+	internal_volume_information->device_path_size      = 0;
+	internal_volume_information->device_path_is_mapped = 0;
 
 	if( volume_information_data != NULL )
 	{
-		memory_free(
+		libagdb_allocator_free(
 		 volume_information_data );
 	}
 	return( -1 );
@@ -1261,10 +1458,9 @@ int libagdb_volume_information_get_utf8_device_path_size(
 	}
 	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
 
-	if( libuna_utf8_string_size_from_utf16_stream(
+	if( libagdb_string_get_utf8_string_size_from_utf16_stream(
 	     internal_volume_information->device_path,
-	     internal_volume_information->device_path_size,
-	     LIBUNA_ENDIAN_LITTLE,
+	     (size_t) internal_volume_information->device_path_size,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -1292,6 +1488,7 @@ int libagdb_volume_information_get_utf8_device_path(
 {
 	libagdb_internal_volume_information_t *internal_volume_information = NULL;
 	static char *function                                              = "libagdb_volume_information_get_utf8_device_path";
+	size_t utf8_string_index                                           = 0;
 
 	if( volume_information == NULL )
 	{
@@ -1306,12 +1503,12 @@ int libagdb_volume_information_get_utf8_device_path(
 	}
 	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
 
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libagdb_string_copy_utf8_string_from_utf16_stream(
 	     utf8_string,
 	     utf8_string_size,
+	     &utf8_string_index,
 	     internal_volume_information->device_path,
-	     internal_volume_information->device_path_size,
-	     LIBUNA_ENDIAN_LITTLE,
+	     (size_t) internal_volume_information->device_path_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1416,6 +1613,67 @@ int libagdb_volume_information_get_utf16_device_path(
 	return( 1 );
 }
 
+/* Retrieves the device path data
+ * The data contains an UTF-16 little-endian string with end-of-string character
+ * If the file is memory mapped the data references the mapped file data
+ * The data remains valid until the file is closed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libagdb_volume_information_get_device_path_data(
+     libagdb_volume_information_t *volume_information,
+     const uint8_t **device_path_data,
+     size_t *device_path_data_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_volume_information_get_device_path_data";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	if( device_path_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device path data.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_path_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device path data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_volume_information->device_path == NULL )
+	 || ( internal_volume_information->device_path_size == 0 ) )
+	{
+		return( 0 );
+	}
+	*device_path_data      = internal_volume_information->device_path;
+	*device_path_data_size = (size_t) internal_volume_information->device_path_size;
+
+	return( 1 );
+}
+
 /* Retrieves the number of files
  * Returns 1 if successful or -1 on error
  */
@@ -1523,3 +1781,862 @@ int libagdb_volume_information_get_file_information(
 	return( 1 );
 }
 
+/* Retrieves summaries of the files
+ * At most number_of_file_summaries summaries are stored and number_of_files
+ * is set to the total number of files
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_information_get_file_summaries(
+     libagdb_volume_information_t *volume_information,
+     libagdb_file_summary_t *file_summaries,
+     int number_of_file_summaries,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_information_t *internal_file_information     = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_volume_information_get_file_summaries";
+	int file_index                                                     = 0;
+	int safe_number_of_files                                           = 0;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	if( number_of_file_summaries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of file summaries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_summaries == NULL )
+	 && ( number_of_file_summaries > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file summaries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume_information->files_array,
+	     &safe_number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     ( file_index < safe_number_of_files ) && ( file_index < number_of_file_summaries );
+	     file_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_volume_information->files_array,
+		     file_index,
+		     (intptr_t **) &internal_file_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d information.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		if( internal_file_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file: %d information.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		/* A file without a path is represented by an empty string
+		 */
+		if( ( internal_file_information->path == NULL )
+		 || ( internal_file_information->path_size == 0 ) )
+		{
+			file_summaries[ file_index ].utf8_path_size = 1;
+		}
+		else if( libagdb_string_get_utf8_string_size_from_utf16_stream(
+		          internal_file_information->path,
+		          (size_t) internal_file_information->path_size,
+		          &( file_summaries[ file_index ].utf8_path_size ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d path UTF-8 string size.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		file_summaries[ file_index ].number_of_entries = internal_file_information->number_of_entries;
+	}
+	*number_of_files = safe_number_of_files;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded paths of all the files
+ * The size includes an end-of-string character per path
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_information_get_utf8_paths_size(
+     libagdb_volume_information_t *volume_information,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_information_t *internal_file_information     = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_volume_information_get_utf8_paths_size";
+	size_t path_utf8_string_size                                       = 0;
+	size_t safe_utf8_string_size                                       = 0;
+	int file_index                                                     = 0;
+	int number_of_files                                                = 0;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume_information->files_array,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_volume_information->files_array,
+		     file_index,
+		     (intptr_t **) &internal_file_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d information.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		if( internal_file_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file: %d information.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		/* A file without a path is represented by an empty string
+		 */
+		if( ( internal_file_information->path == NULL )
+		 || ( internal_file_information->path_size == 0 ) )
+		{
+			path_utf8_string_size = 1;
+		}
+		else if( libagdb_string_get_utf8_string_size_from_utf16_stream(
+		          internal_file_information->path,
+		          (size_t) internal_file_information->path_size,
+		          &path_utf8_string_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d path UTF-8 string size.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		if( path_utf8_string_size > ( (size_t) SSIZE_MAX - safe_utf8_string_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid UTF-8 string size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_utf8_string_size += path_utf8_string_size;
+	}
+	*utf8_string_size = safe_utf8_string_size;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded paths of all the files
+ * The paths are stored consecutively in the UTF-8 string, each with an end-of-string character
+ * The offset of the path of each file is stored in the UTF-8 string offsets
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_information_get_utf8_paths(
+     libagdb_volume_information_t *volume_information,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error )
+{
+	libagdb_internal_file_information_t *internal_file_information     = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libagdb_volume_information_get_utf8_paths";
+	size_t utf8_string_index                                           = 0;
+	int file_index                                                     = 0;
+	int number_of_files                                                = 0;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume_information->files_array,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets < number_of_files )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of offsets value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_volume_information->files_array,
+		     file_index,
+		     (intptr_t **) &internal_file_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d information.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		if( internal_file_information == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file: %d information.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+		utf8_string_offsets[ file_index ] = utf8_string_index;
+
+		if( ( internal_file_information->path == NULL )
+		 || ( internal_file_information->path_size == 0 ) )
+		{
+			if( utf8_string_index >= utf8_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ utf8_string_index++ ] = 0;
+		}
+		else if( libagdb_string_copy_utf8_string_from_utf16_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          &utf8_string_index,
+		          internal_file_information->path,
+		          (size_t) internal_file_information->path_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy file: %d path to UTF-8 string.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Builds the path index
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_volume_information_build_path_index(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     libagdb_path_index_t **path_index,
+     libcerror_error_t **error )
+{
+	libagdb_path_index_t *safe_path_index = NULL;
+	static char *function                 = "libagdb_internal_volume_information_build_path_index";
+	size_t utf8_string_size               = 0;
+	int number_of_files                   = 0;
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume_information->files_array,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_volume_information_get_utf8_paths_size(
+	     (libagdb_volume_information_t *) internal_volume_information,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve paths size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_path_index_initialize(
+	     &safe_path_index,
+	     number_of_files,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path index.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_files > 0 )
+	{
+		if( libagdb_volume_information_get_utf8_paths(
+		     (libagdb_volume_information_t *) internal_volume_information,
+		     safe_path_index->utf8_string,
+		     safe_path_index->utf8_string_size,
+		     safe_path_index->utf8_string_offsets,
+		     number_of_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve paths.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libagdb_path_index_sort(
+	     safe_path_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort path index.",
+		 function );
+
+		goto on_error;
+	}
+	*path_index = safe_path_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_path_index != NULL )
+	{
+		libagdb_path_index_free(
+		 &safe_path_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the path index
+ * The path index is built on first use, while holding the write lock
+ * since the volume information can be shared by multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_internal_volume_information_get_path_index(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     libagdb_path_index_t **path_index,
+     libcerror_error_t **error )
+{
+	libagdb_path_index_t *safe_path_index = NULL;
+	static char *function                 = "libagdb_internal_volume_information_get_path_index";
+	int result                            = 1;
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume_information->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_path_index = internal_volume_information->path_index;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume_information->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_path_index == NULL )
+	{
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_volume_information->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		/* Another thread can have built the path index in the meantime
+		 */
+		if( internal_volume_information->path_index == NULL )
+		{
+			result = libagdb_internal_volume_information_build_path_index(
+			          internal_volume_information,
+			          &( internal_volume_information->path_index ),
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build path index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		safe_path_index = internal_volume_information->path_index;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_volume_information->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	*path_index = safe_path_index;
+
+	return( 1 );
+}
+
+/* Retrieves the indexes of the files of which the path starts with a prefix
+ * The comparison is case insensitive for ASCII characters
+ * An empty prefix retrieves the indexes of all the files sorted by path
+ * The file indexes are stored sorted by path, at most number_of_file_indexes are stored
+ * and number_of_files is set to the total number of matching files
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_information_get_file_indexes_by_utf8_path_prefix(
+     libagdb_volume_information_t *volume_information,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *file_indexes,
+     int number_of_file_indexes,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	libagdb_path_index_t *path_index                                   = NULL;
+	static char *function                                              = "libagdb_volume_information_get_file_indexes_by_utf8_path_prefix";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_volume_information_get_path_index(
+	     internal_volume_information,
+	     &path_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_path_index_get_entry_indexes_by_prefix(
+	     path_index,
+	     utf8_string,
+	     utf8_string_length,
+	     file_indexes,
+	     number_of_file_indexes,
+	     number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file indexes by path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the indexes of the files of which the path matches a glob pattern
+ * The comparison is case insensitive for ASCII characters
+ * A * in the pattern matches any sequence of characters and a ? a single character
+ * The file indexes are stored sorted by path, at most number_of_file_indexes are stored
+ * and number_of_files is set to the total number of matching files
+ * Returns 1 if successful or -1 on error
+ */
+int libagdb_volume_information_get_file_indexes_by_utf8_path_glob(
+     libagdb_volume_information_t *volume_information,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *file_indexes,
+     int number_of_file_indexes,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	libagdb_path_index_t *path_index                                   = NULL;
+	static char *function                                              = "libagdb_volume_information_get_file_indexes_by_utf8_path_glob";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_internal_volume_information_get_path_index(
+	     internal_volume_information,
+	     &path_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_path_index_get_entry_indexes_by_glob(
+	     path_index,
+	     utf8_string,
+	     utf8_string_length,
+	     file_indexes,
+	     number_of_file_indexes,
+	     number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file indexes by path glob.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
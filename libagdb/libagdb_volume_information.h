@@ -30,8 +30,10 @@
 #include "libagdb_libbfio.h"
 #include "libagdb_libcdata.h"
 #include "libagdb_libcerror.h"
+#include "libagdb_libcthreads.h"
 #include "libagdb_libfcache.h"
 #include "libagdb_libfdata.h"
+#include "libagdb_path_index.h"
 #include "libagdb_types.h"
 
 #if defined( __cplusplus )
@@ -50,6 +52,10 @@ struct libagdb_internal_volume_information
 	 */
 	uint32_t device_path_size;
 
+	/* Value to indicate the device path references the mapped file data
+	 */
+	uint8_t device_path_is_mapped;
+
 	/* The volume creation time
 	 */
 	uint64_t creation_time;
@@ -65,6 +71,16 @@ struct libagdb_internal_volume_information
 	/* The files array
 	 */
 	libcdata_array_t *files_array;
+
+	/* The path index
+	 */
+	libagdb_path_index_t *path_index;
+
+#if defined( HAVE_LIBAGDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libagdb_volume_information_initialize(
@@ -140,6 +156,13 @@ int libagdb_volume_information_get_utf16_device_path(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_volume_information_get_device_path_data(
+     libagdb_volume_information_t *volume_information,
+     const uint8_t **device_path_data,
+     size_t *device_path_data_size,
+     libcerror_error_t **error );
+
 LIBAGDB_EXTERN \
 int libagdb_volume_information_get_number_of_files(
      libagdb_volume_information_t *volume_information,
@@ -153,6 +176,59 @@ int libagdb_volume_information_get_file_information(
      libagdb_file_information_t **file_information,
      libcerror_error_t **error );
 
+LIBAGDB_EXTERN \
+int libagdb_volume_information_get_file_summaries(
+     libagdb_volume_information_t *volume_information,
+     libagdb_file_summary_t *file_summaries,
+     int number_of_file_summaries,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_volume_information_get_utf8_paths_size(
+     libagdb_volume_information_t *volume_information,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_volume_information_get_utf8_paths(
+     libagdb_volume_information_t *volume_information,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error );
+
+int libagdb_internal_volume_information_build_path_index(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     libagdb_path_index_t **path_index,
+     libcerror_error_t **error );
+
+int libagdb_internal_volume_information_get_path_index(
+     libagdb_internal_volume_information_t *internal_volume_information,
+     libagdb_path_index_t **path_index,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_volume_information_get_file_indexes_by_utf8_path_prefix(
+     libagdb_volume_information_t *volume_information,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *file_indexes,
+     int number_of_file_indexes,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_volume_information_get_file_indexes_by_utf8_path_glob(
+     libagdb_volume_information_t *volume_information,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *file_indexes,
+     int number_of_file_indexes,
+     int *number_of_files,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,393 @@
+/*
+ * Library allocator functions test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_allocator.h"
+
+/* The number of allocate, reallocate and free function invocations
+ */
+static int agdb_test_allocator_number_of_allocate_calls   = 0;
+static int agdb_test_allocator_number_of_reallocate_calls = 0;
+static int agdb_test_allocator_number_of_free_calls       = 0;
+
+/* Test allocate function
+ */
+void *agdb_test_allocator_allocate_function(
+       intptr_t *allocator_data,
+       size_t size )
+{
+	if( allocator_data != NULL )
+	{
+		*( (size_t *) allocator_data ) += size;
+	}
+	agdb_test_allocator_number_of_allocate_calls++;
+
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Test reallocate function
+ */
+void *agdb_test_allocator_reallocate_function(
+       intptr_t *allocator_data,
+       void *buffer,
+       size_t size )
+{
+	if( allocator_data != NULL )
+	{
+		*( (size_t *) allocator_data ) += size;
+	}
+	agdb_test_allocator_number_of_reallocate_calls++;
+
+	return( memory_reallocate(
+	         buffer,
+	         size ) );
+}
+
+/* Test free function
+ */
+void agdb_test_allocator_free_function(
+      intptr_t *allocator_data AGDB_TEST_ATTRIBUTE_UNUSED,
+      void *buffer )
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( allocator_data )
+
+	agdb_test_allocator_number_of_free_calls++;
+
+	memory_free(
+	 buffer );
+}
+
+/* Tests the libagdb_set_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_set_allocator(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t allocated_size    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_set_allocator(
+	          &agdb_test_allocator_allocate_function,
+	          &agdb_test_allocator_reallocate_function,
+	          &agdb_test_allocator_free_function,
+	          (intptr_t *) &allocated_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_set_allocator(
+	          &agdb_test_allocator_allocate_function,
+	          &agdb_test_allocator_reallocate_function,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_set_allocator(
+	          &agdb_test_allocator_allocate_function,
+	          NULL,
+	          &agdb_test_allocator_free_function,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_set_allocator(
+	          NULL,
+	          NULL,
+	          &agdb_test_allocator_free_function,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          (intptr_t *) &allocated_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* The allocated size passed as allocator data, this must remain
+ * available after the test function returns
+ */
+static size_t agdb_test_allocator_allocated_size = 0;
+
+/* Tests the libagdb_allocator_allocate, libagdb_allocator_reallocate and libagdb_allocator_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_allocator_allocate_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	uint8_t *reallocated     = NULL;
+	int result               = 0;
+
+	agdb_test_allocator_number_of_allocate_calls   = 0;
+	agdb_test_allocator_number_of_reallocate_calls = 0;
+	agdb_test_allocator_number_of_free_calls       = 0;
+
+	/* Test with a custom allocator
+	 */
+	result = libagdb_set_allocator(
+	          &agdb_test_allocator_allocate_function,
+	          &agdb_test_allocator_reallocate_function,
+	          &agdb_test_allocator_free_function,
+	          (intptr_t *) &agdb_test_allocator_allocated_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer = (uint8_t *) libagdb_allocator_allocate(
+	                      16 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_allocator_number_of_allocate_calls",
+	 agdb_test_allocator_number_of_allocate_calls,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "agdb_test_allocator_allocated_size",
+	 agdb_test_allocator_allocated_size,
+	 (size_t) 16 );
+
+	reallocated = (uint8_t *) libagdb_allocator_reallocate(
+	                           buffer,
+	                           32 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "reallocated",
+	 reallocated );
+
+	buffer = reallocated;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_allocator_number_of_reallocate_calls",
+	 agdb_test_allocator_number_of_reallocate_calls,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "agdb_test_allocator_allocated_size",
+	 agdb_test_allocator_allocated_size,
+	 (size_t) 48 );
+
+	libagdb_allocator_free(
+	 buffer );
+
+	buffer = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_allocator_number_of_free_calls",
+	 agdb_test_allocator_number_of_free_calls,
+	 1 );
+
+	/* Freeing NULL does not invoke the free function
+	 */
+	libagdb_allocator_free(
+	 NULL );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_allocator_number_of_free_calls",
+	 agdb_test_allocator_number_of_free_calls,
+	 1 );
+
+	/* Test error case where the library already allocated memory
+	 */
+	result = libagdb_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		libagdb_allocator_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	AGDB_TEST_RUN(
+	 "libagdb_set_allocator",
+	 agdb_test_set_allocator )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_allocator_allocate_free",
+	 agdb_test_allocator_allocate_free )
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
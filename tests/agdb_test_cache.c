@@ -0,0 +1,854 @@
+/*
+ * Library cache functions test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_cache.h"
+#include "../libagdb/libagdb_file_information.h"
+#include "../libagdb/libagdb_io_handle.h"
+#include "../libagdb/libagdb_libcdata.h"
+#include "../libagdb/libagdb_source_information.h"
+#include "../libagdb/libagdb_volume_information.h"
+
+/* The UTF-16 little-endian device path and paths
+ */
+uint8_t agdb_test_cache_device_path[ 20 ] = {
+	'\\', 0, 'D', 0, 'E', 0, 'V', 0, 'I', 0, 'C', 0, 'E', 0, '\\', 0, 'X', 0, 0, 0 };
+
+uint8_t agdb_test_cache_path1[ 12 ] = {
+	'\\', 0, 'A', 0, '.', 0, 'E', 0, 'X', 0, 'E', 0 };
+
+uint8_t agdb_test_cache_path2[ 8 ] = {
+	'\\', 0, 'B', 0, '.', 0, 'D', 0 };
+
+/* The cache data size: header (56), 1 volume record (28), 2 file records (24),
+ * 1 source record (24) and string data (40)
+ */
+#define AGDB_TEST_CACHE_DATA_SIZE	172
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Creates test volumes and sources arrays with 1 volume of 2 files and 1 source
+ * The device path and paths reference the test data
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_test_cache_create_arrays(
+     libcdata_array_t **volumes_array,
+     libcdata_array_t **sources_array,
+     libcerror_error_t **error )
+{
+	libagdb_file_information_t *file_information                       = NULL;
+	libagdb_internal_file_information_t *internal_file_information     = NULL;
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	libagdb_source_information_t *source_information                   = NULL;
+	libagdb_volume_information_t *volume_information                   = NULL;
+	int entry_index                                                    = 0;
+
+	if( libcdata_array_initialize(
+	     volumes_array,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     sources_array,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libagdb_volume_information_initialize(
+	     &volume_information,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	internal_volume_information = (libagdb_internal_volume_information_t *) volume_information;
+
+	internal_volume_information->device_path           = agdb_test_cache_device_path;
+	internal_volume_information->device_path_size      = 20;
+	internal_volume_information->device_path_is_mapped = 1;
+	internal_volume_information->creation_time         = 0x01d0123456789abcUL;
+	internal_volume_information->serial_number         = 0x12345678UL;
+	internal_volume_information->number_of_files       = 2;
+
+	if( libagdb_file_information_initialize(
+	     &file_information,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	internal_file_information = (libagdb_internal_file_information_t *) file_information;
+
+	internal_file_information->path              = agdb_test_cache_path1;
+	internal_file_information->path_size         = 12;
+	internal_file_information->path_is_mapped    = 1;
+	internal_file_information->number_of_entries = 3;
+
+	if( libcdata_array_append_entry(
+	     internal_volume_information->files_array,
+	     &entry_index,
+	     (intptr_t *) file_information,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	file_information = NULL;
+
+	if( libagdb_file_information_initialize(
+	     &file_information,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	internal_file_information = (libagdb_internal_file_information_t *) file_information;
+
+	internal_file_information->path              = agdb_test_cache_path2;
+	internal_file_information->path_size         = 8;
+	internal_file_information->path_is_mapped    = 1;
+	internal_file_information->number_of_entries = 0;
+
+	if( libcdata_array_append_entry(
+	     internal_volume_information->files_array,
+	     &entry_index,
+	     (intptr_t *) file_information,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     *volumes_array,
+	     &entry_index,
+	     (intptr_t *) volume_information,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libagdb_source_information_initialize(
+	     &source_information,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	internal_source_information = (libagdb_internal_source_information_t *) source_information;
+
+	internal_source_information->prefetch_hash            = 0xaabbccddUL;
+	internal_source_information->executable_filename_size = 6;
+
+	if( memory_copy(
+	     internal_source_information->executable_filename,
+	     "A.EXE",
+	     6 ) == NULL )
+	{
+		return( -1 );
+	}
+	return( libcdata_array_append_entry(
+	         *sources_array,
+	         &entry_index,
+	         (intptr_t *) source_information,
+	         error ) );
+}
+
+/* Frees test volumes and sources arrays
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_test_cache_free_arrays(
+     libcdata_array_t **volumes_array,
+     libcdata_array_t **sources_array,
+     libcerror_error_t **error )
+{
+	int result = 1;
+
+	if( *volumes_array != NULL )
+	{
+		if( libcdata_array_free(
+		     volumes_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_volume_information_free,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( *sources_array != NULL )
+	{
+		if( libcdata_array_free(
+		     sources_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libagdb_internal_source_information_free,
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Tests the libagdb_cache_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_cache_get_data_size(
+     void )
+{
+	libcdata_array_t *sources_array = NULL;
+	libcdata_array_t *volumes_array = NULL;
+	libcerror_error_t *error        = NULL;
+	size_t data_size                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_cache_create_arrays(
+	          &volumes_array,
+	          &sources_array,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_cache_get_data_size(
+	          volumes_array,
+	          sources_array,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) AGDB_TEST_CACHE_DATA_SIZE );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_cache_get_data_size(
+	          NULL,
+	          sources_array,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_cache_get_data_size(
+	          volumes_array,
+	          sources_array,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = agdb_test_cache_free_arrays(
+	          &volumes_array,
+	          &sources_array,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	agdb_test_cache_free_arrays(
+	 &volumes_array,
+	 &sources_array,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libagdb_cache_write_data and libagdb_cache_read_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_cache_write_and_read_data(
+     void )
+{
+	uint8_t data[ AGDB_TEST_CACHE_DATA_SIZE ];
+
+	libagdb_internal_file_information_t *internal_file_information     = NULL;
+	libagdb_internal_source_information_t *internal_source_information = NULL;
+	libagdb_internal_volume_information_t *internal_volume_information = NULL;
+	libagdb_io_handle_t *io_handle                                     = NULL;
+	libcdata_array_t *read_sources_array                               = NULL;
+	libcdata_array_t *read_volumes_array                               = NULL;
+	libcdata_array_t *sources_array                                    = NULL;
+	libcdata_array_t *volumes_array                                    = NULL;
+	libcerror_error_t *error                                           = NULL;
+	int number_of_entries                                              = 0;
+	int result                                                         = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_cache_create_arrays(
+	          &volumes_array,
+	          &sources_array,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &read_volumes_array,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_initialize(
+	          &read_sources_array,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_type              = LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7;
+	io_handle->file_size              = 4096;
+	io_handle->uncompressed_data_size = 8192;
+
+	/* Test regular cases
+	 */
+	result = libagdb_cache_write_data(
+	          io_handle,
+	          volumes_array,
+	          sources_array,
+	          data,
+	          AGDB_TEST_CACHE_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "AGDBcach",
+	          8 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libagdb_io_handle_clear(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libagdb_cache_read_data(
+	          io_handle,
+	          read_volumes_array,
+	          read_sources_array,
+	          data,
+	          AGDB_TEST_CACHE_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle->file_type",
+	 io_handle->file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->file_size",
+	 (uint64_t) io_handle->file_size,
+	 (uint64_t) 4096 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "io_handle->uncompressed_data_size",
+	 io_handle->uncompressed_data_size,
+	 (uint32_t) 8192 );
+
+	result = libcdata_array_get_number_of_entries(
+	          read_volumes_array,
+	          &number_of_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	result = libcdata_array_get_entry_by_index(
+	          read_volumes_array,
+	          0,
+	          (intptr_t **) &internal_volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_volume_information->creation_time",
+	 internal_volume_information->creation_time,
+	 (uint64_t) 0x01d0123456789abcUL );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_volume_information->serial_number",
+	 internal_volume_information->serial_number,
+	 (uint32_t) 0x12345678UL );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_volume_information->device_path_size",
+	 internal_volume_information->device_path_size,
+	 (uint32_t) 20 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_volume_information->device_path_is_mapped",
+	 internal_volume_information->device_path_is_mapped,
+	 1 );
+
+	result = memory_compare(
+	          internal_volume_information->device_path,
+	          agdb_test_cache_device_path,
+	          20 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdata_array_get_number_of_entries(
+	          internal_volume_information->files_array,
+	          &number_of_entries,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	result = libcdata_array_get_entry_by_index(
+	          internal_volume_information->files_array,
+	          1,
+	          (intptr_t **) &internal_file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_file_information->path_size",
+	 internal_file_information->path_size,
+	 (uint32_t) 8 );
+
+	result = memory_compare(
+	          internal_file_information->path,
+	          agdb_test_cache_path2,
+	          8 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdata_array_get_entry_by_index(
+	          internal_volume_information->files_array,
+	          0,
+	          (intptr_t **) &internal_file_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_file_information->number_of_entries",
+	 internal_file_information->number_of_entries,
+	 (uint32_t) 3 );
+
+	result = libcdata_array_get_entry_by_index(
+	          read_sources_array,
+	          0,
+	          (intptr_t **) &internal_source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_source_information->prefetch_hash",
+	 internal_source_information->prefetch_hash,
+	 (uint32_t) 0xaabbccddUL );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_source_information->executable_filename_size",
+	 internal_source_information->executable_filename_size,
+	 (uint32_t) 6 );
+
+	result = memory_compare(
+	          internal_source_information->executable_filename,
+	          "A.EXE",
+	          6 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_cache_write_data(
+	          io_handle,
+	          volumes_array,
+	          sources_array,
+	          data,
+	          AGDB_TEST_CACHE_DATA_SIZE - 1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_cache_read_data(
+	          io_handle,
+	          read_volumes_array,
+	          read_sources_array,
+	          data,
+	          AGDB_TEST_CACHE_DATA_SIZE - 1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_cache_read_data(
+	          NULL,
+	          read_volumes_array,
+	          read_sources_array,
+	          data,
+	          AGDB_TEST_CACHE_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an out of bounds path offset
+	 */
+	data[ 56 + 28 ] = 0xff;
+
+	result = libagdb_cache_read_data(
+	          io_handle,
+	          read_volumes_array,
+	          read_sources_array,
+	          data,
+	          AGDB_TEST_CACHE_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported format version
+	 */
+	data[ 8 ] = 0xff;
+
+	result = libagdb_cache_read_data(
+	          io_handle,
+	          read_volumes_array,
+	          read_sources_array,
+	          data,
+	          AGDB_TEST_CACHE_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid signature
+	 */
+	data[ 0 ] = 0xff;
+
+	result = libagdb_cache_read_data(
+	          io_handle,
+	          read_volumes_array,
+	          read_sources_array,
+	          data,
+	          AGDB_TEST_CACHE_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = agdb_test_cache_free_arrays(
+	          &read_volumes_array,
+	          &read_sources_array,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = agdb_test_cache_free_arrays(
+	          &volumes_array,
+	          &sources_array,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	agdb_test_cache_free_arrays(
+	 &read_volumes_array,
+	 &read_sources_array,
+	 NULL );
+
+	agdb_test_cache_free_arrays(
+	 &volumes_array,
+	 &sources_array,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_cache_get_data_size",
+	 agdb_test_cache_get_data_size );
+
+	AGDB_TEST_RUN(
+	 "libagdb_cache_write_data",
+	 agdb_test_cache_write_and_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
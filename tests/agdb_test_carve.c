@@ -0,0 +1,776 @@
+/*
+ * Library carve functions test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_carve.h"
+
+/* Writes a Windows 7 compressed file header with 2 compressed blocks of 100 bytes
+ * The resulting file is 216 bytes in size
+ */
+void agdb_test_carve_write_windows7_file(
+      uint8_t *data )
+{
+	memory_copy(
+	 data,
+	 "MEM0",
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 131072 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 8 ] ),
+	 100 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 112 ] ),
+	 100 );
+}
+
+/* Tests the libagdb_carve_scan_data function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_carve_scan_data(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t scan_offset              = 0;
+	uint32_t uncompressed_data_size = 0;
+	uint8_t file_type               = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 4096 );
+
+	agdb_test_carve_write_windows7_file(
+	 &( data[ 1024 ] ) );
+
+	/* Test regular cases
+	 */
+	scan_offset = 0;
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          0,
+	          512,
+	          &scan_offset,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "scan_offset",
+	 scan_offset,
+	 (size_t) 1024 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "file_type",
+	 file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (uint32_t) 131072 );
+
+	/* Test that the alignment is relative to the data offset
+	 */
+	scan_offset = 0;
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          256,
+	          512,
+	          &scan_offset,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "file_type",
+	 file_type,
+	 0 );
+
+	/* Test scanning at every offset
+	 */
+	scan_offset = 1;
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          256,
+	          1,
+	          &scan_offset,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "scan_offset",
+	 scan_offset,
+	 (size_t) 1024 );
+
+	/* Test continuing the scan after the file header
+	 */
+	scan_offset = 1025;
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          0,
+	          1,
+	          &scan_offset,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "scan_offset",
+	 scan_offset,
+	 (size_t) ( 4096 - LIBAGDB_CARVE_SIGNATURE_DATA_SIZE + 1 ) );
+
+	/* Test error cases
+	 */
+	scan_offset = 0;
+
+	result = libagdb_carve_scan_data(
+	          NULL,
+	          4096,
+	          0,
+	          512,
+	          &scan_offset,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          -1,
+	          512,
+	          &scan_offset,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          0,
+	          0,
+	          &scan_offset,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          0,
+	          512,
+	          NULL,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_offset = 4097;
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          0,
+	          512,
+	          &scan_offset,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_offset = 0;
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          0,
+	          512,
+	          &scan_offset,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_carve_scan_data(
+	          data,
+	          4096,
+	          0,
+	          512,
+	          &scan_offset,
+	          &file_type,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_carve_get_maximum_file_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_carve_get_maximum_file_size(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	size64_t maximum_file_size = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_carve_get_maximum_file_size(
+	          LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	          4096,
+	          &maximum_file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_file_size",
+	 (uint64_t) maximum_file_size,
+	 (uint64_t) 4096 );
+
+	result = libagdb_carve_get_maximum_file_size(
+	          LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	          131072,
+	          &maximum_file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_file_size",
+	 (uint64_t) maximum_file_size,
+	 (uint64_t) 147992 );
+
+	/* Test error cases
+	 */
+	result = libagdb_carve_get_maximum_file_size(
+	          0,
+	          4096,
+	          &maximum_file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_carve_get_maximum_file_size(
+	          LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	          4096,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_carve_get_file_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_carve_get_file_size(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	libcerror_error_t *error = NULL;
+	size64_t file_size       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 4096 );
+
+	agdb_test_carve_write_windows7_file(
+	 data );
+
+	/* Test regular cases
+	 */
+	result = libagdb_carve_get_file_size(
+	          data,
+	          4096,
+	          LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	          131072,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) 216 );
+
+	/* Test with data that does not contain the last compressed block
+	 */
+	result = libagdb_carve_get_file_size(
+	          data,
+	          200,
+	          LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	          131072,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an uncompressed file
+	 */
+	result = libagdb_carve_get_file_size(
+	          data,
+	          4096,
+	          LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	          2048,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) 2048 );
+
+	result = libagdb_carve_get_file_size(
+	          data,
+	          1024,
+	          LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	          2048,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_carve_get_file_size(
+	          NULL,
+	          4096,
+	          LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	          131072,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_carve_get_file_size(
+	          data,
+	          4096,
+	          0,
+	          131072,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_carve_get_file_size(
+	          data,
+	          4096,
+	          LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	          131072,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_carve_check_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_carve_check_signature(
+     void )
+{
+	uint8_t data[ 16 ] = {
+		'M', 'E', 'M', 'O', 0x00, 0x20, 0x00, 0x00, 0x09, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	uint32_t uncompressed_data_size = 0;
+	uint8_t file_type               = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_carve_check_signature(
+	          data,
+	          &file_type,
+	          &uncompressed_data_size );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "file_type",
+	 file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (uint32_t) 8192 );
+
+	/* Test with an invalid LZNT1 chunk header
+	 */
+	data[ 9 ] = 0x00;
+
+	result = libagdb_carve_check_signature(
+	          data,
+	          &file_type,
+	          &uncompressed_data_size );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an uncompressed data size that is too small
+	 */
+	data[ 5 ] = 0x00;
+	data[ 9 ] = 0x30;
+
+	result = libagdb_carve_check_signature(
+	          data,
+	          &file_type,
+	          &uncompressed_data_size );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	AGDB_TEST_RUN(
+	 "libagdb_carve_scan_data",
+	 agdb_test_carve_scan_data );
+
+	AGDB_TEST_RUN(
+	 "libagdb_carve_get_maximum_file_size",
+	 agdb_test_carve_get_maximum_file_size );
+
+	AGDB_TEST_RUN(
+	 "libagdb_carve_get_file_size",
+	 agdb_test_carve_get_file_size );
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_carve_check_signature",
+	 agdb_test_carve_check_signature );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
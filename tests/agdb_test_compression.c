@@ -0,0 +1,703 @@
+/*
+ * Library compression functions test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_compression.h"
+
+uint8_t agdb_test_compression_uncompressed_data1[ 4 ] = {
+	0x61, 0x62, 0x63, 0x64 };
+
+uint8_t agdb_test_compression_lznt1_compressed_data1[ 6 ] = {
+	0x03, 0x30, 0x61, 0x62, 0x63, 0x64 };
+
+uint8_t agdb_test_compression_uncompressed_data2[ 2 ] = {
+	0x61, 0x62 };
+
+uint8_t agdb_test_compression_uncompressed_data3[ 2 ] = {
+	0xff, 0x61 };
+
+/* The bit stream of the LZXPRESS Huffman compressed data2 without the 256 byte table
+ */
+uint8_t agdb_test_compression_lzxpress_huffman_compressed_data2[ 6 ] = {
+	0x62, 0x61, 0x80, 0xff, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_compression_get_lznt1_chunk_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compression_get_lznt1_chunk_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_compression_get_lznt1_chunk_size(
+	          4,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 6 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compression_get_lznt1_chunk_size(
+	          4096,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 4098 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_compression_get_lznt1_chunk_size(
+	          0,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_get_lznt1_chunk_size(
+	          4097,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_get_lznt1_chunk_size(
+	          4,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compression_lznt1_compress_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compression_lznt1_compress_chunk(
+     void )
+{
+	uint8_t compressed_data[ 16 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_size = 16;
+
+	result = libagdb_compression_lznt1_compress_chunk(
+	          agdb_test_compression_uncompressed_data1,
+	          4,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 6 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          compressed_data,
+	          agdb_test_compression_lznt1_compressed_data1,
+	          6 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 16;
+
+	result = libagdb_compression_lznt1_compress_chunk(
+	          NULL,
+	          4,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_lznt1_compress_chunk(
+	          agdb_test_compression_uncompressed_data1,
+	          4,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_lznt1_compress_chunk(
+	          agdb_test_compression_uncompressed_data1,
+	          4,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_lznt1_compress_chunk(
+	          agdb_test_compression_uncompressed_data1,
+	          0,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = 5;
+
+	result = libagdb_compression_lznt1_compress_chunk(
+	          agdb_test_compression_uncompressed_data1,
+	          4,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compression_get_lzxpress_huffman_chunk_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compression_get_lzxpress_huffman_chunk_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_compression_get_lzxpress_huffman_chunk_size(
+	          agdb_test_compression_uncompressed_data2,
+	          2,
+	          1,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 262 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_compression_get_lzxpress_huffman_chunk_size(
+	          agdb_test_compression_uncompressed_data2,
+	          2,
+	          0,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 260 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The byte value 0xff is stored as a 9-bit code
+	 */
+	result = libagdb_compression_get_lzxpress_huffman_chunk_size(
+	          agdb_test_compression_uncompressed_data3,
+	          2,
+	          0,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 262 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_compression_get_lzxpress_huffman_chunk_size(
+	          NULL,
+	          2,
+	          1,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_get_lzxpress_huffman_chunk_size(
+	          agdb_test_compression_uncompressed_data2,
+	          0,
+	          1,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_get_lzxpress_huffman_chunk_size(
+	          agdb_test_compression_uncompressed_data2,
+	          65537,
+	          1,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_get_lzxpress_huffman_chunk_size(
+	          agdb_test_compression_uncompressed_data2,
+	          2,
+	          1,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_compression_lzxpress_huffman_compress_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_compression_lzxpress_huffman_compress_chunk(
+     void )
+{
+	uint8_t compressed_data[ 512 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	compressed_data_size = 512;
+
+	result = libagdb_compression_lzxpress_huffman_compress_chunk(
+	          agdb_test_compression_uncompressed_data2,
+	          2,
+	          1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 262 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 0 ]",
+	 compressed_data[ 0 ],
+	 (uint8_t) 0x88 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 127 ]",
+	 compressed_data[ 127 ],
+	 (uint8_t) 0x98 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 128 ]",
+	 compressed_data[ 128 ],
+	 (uint8_t) 0x09 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 129 ]",
+	 compressed_data[ 129 ],
+	 (uint8_t) 0x00 );
+
+	result = memory_compare(
+	          &( compressed_data[ 256 ] ),
+	          agdb_test_compression_lzxpress_huffman_compressed_data2,
+	          6 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 512;
+
+	result = libagdb_compression_lzxpress_huffman_compress_chunk(
+	          NULL,
+	          2,
+	          1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_lzxpress_huffman_compress_chunk(
+	          agdb_test_compression_uncompressed_data2,
+	          2,
+	          1,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_compression_lzxpress_huffman_compress_chunk(
+	          agdb_test_compression_uncompressed_data2,
+	          2,
+	          1,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = 261;
+
+	result = libagdb_compression_lzxpress_huffman_compress_chunk(
+	          agdb_test_compression_uncompressed_data2,
+	          2,
+	          1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_compression_get_lznt1_chunk_size",
+	 agdb_test_compression_get_lznt1_chunk_size );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compression_lznt1_compress_chunk",
+	 agdb_test_compression_lznt1_compress_chunk );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compression_get_lzxpress_huffman_chunk_size",
+	 agdb_test_compression_get_lzxpress_huffman_chunk_size );
+
+	AGDB_TEST_RUN(
+	 "libagdb_compression_lzxpress_huffman_compress_chunk",
+	 agdb_test_compression_lzxpress_huffman_compress_chunk );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
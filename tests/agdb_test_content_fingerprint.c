@@ -0,0 +1,603 @@
+/*
+ * Library content fingerprint functions test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_content_fingerprint.h"
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* The test data size, which is not a multiple of the block size
+ */
+#define AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE	( ( 3 * LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE ) + 100 )
+
+/* Fills the test data
+ */
+void agdb_test_content_fingerprint_fill_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) + ( data_offset / 251 ) );
+	}
+}
+
+/* Tests the libagdb_content_fingerprint_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_content_fingerprint_initialize(
+     void )
+{
+	libagdb_content_fingerprint_t *content_fingerprint = NULL;
+	libcerror_error_t *error                           = NULL;
+	int result                                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_content_fingerprint_initialize(
+	          &content_fingerprint,
+	          AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "content_fingerprint",
+	 content_fingerprint );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "content_fingerprint->number_of_blocks",
+	 content_fingerprint->number_of_blocks,
+	 (uint64_t) 4 );
+
+	result = libagdb_content_fingerprint_free(
+	          &content_fingerprint,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "content_fingerprint",
+	 content_fingerprint );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_content_fingerprint_initialize(
+	          NULL,
+	          AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	content_fingerprint = (libagdb_content_fingerprint_t *) 0x12345678UL;
+
+	result = libagdb_content_fingerprint_initialize(
+	          &content_fingerprint,
+	          AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE,
+	          &error );
+
+	content_fingerprint = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( content_fingerprint != NULL )
+	{
+		libagdb_content_fingerprint_free(
+		 &content_fingerprint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_content_fingerprint_update and libagdb_content_fingerprint_finalize functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_content_fingerprint_update(
+     void )
+{
+	uint8_t data[ AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE ];
+	uint8_t block_fingerprint[ LIBAGDB_CONTENT_FINGERPRINT_SIZE ];
+	uint8_t fingerprint[ LIBAGDB_CONTENT_FINGERPRINT_SIZE ];
+
+	libagdb_content_fingerprint_t *content_fingerprint = NULL;
+	libcerror_error_t *error                           = NULL;
+	size_t data_offset                                 = 0;
+	size_t read_size                                   = 0;
+	int result                                         = 0;
+
+	agdb_test_content_fingerprint_fill_data(
+	 data,
+	 AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE );
+
+	/* Test updating with all data at once
+	 */
+	result = libagdb_content_fingerprint_initialize(
+	          &content_fingerprint,
+	          AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The uncompressed data of the last compressed block can exceed the data size
+	 */
+	result = libagdb_content_fingerprint_update(
+	          content_fingerprint,
+	          0,
+	          data,
+	          AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_content_fingerprint_finalize(
+	          content_fingerprint,
+	          fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_content_fingerprint_free(
+	          &content_fingerprint,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test updating per block in reverse order with duplicate updates
+	 */
+	result = libagdb_content_fingerprint_initialize(
+	          &content_fingerprint,
+	          AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = 3 * LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE;
+
+	while( data_offset > 0 )
+	{
+		read_size = LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE;
+
+		if( read_size > ( AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE - data_offset ) )
+		{
+			read_size = AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE - data_offset;
+		}
+		result = libagdb_content_fingerprint_update(
+		          content_fingerprint,
+		          (off64_t) data_offset,
+		          &( data[ data_offset ] ),
+		          read_size,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_offset -= LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE;
+	}
+	result = libagdb_content_fingerprint_is_block_hashed(
+	          content_fingerprint,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test finalize with a block that was not hashed
+	 */
+	result = libagdb_content_fingerprint_finalize(
+	          content_fingerprint,
+	          block_fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a partial block is not hashed
+	 */
+	result = libagdb_content_fingerprint_update(
+	          content_fingerprint,
+	          0,
+	          data,
+	          100,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_content_fingerprint_is_block_hashed(
+	          content_fingerprint,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that blocks that were already hashed are not hashed again
+	 */
+	result = libagdb_content_fingerprint_update(
+	          content_fingerprint,
+	          0,
+	          data,
+	          AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "content_fingerprint->number_of_hashed_blocks",
+	 content_fingerprint->number_of_hashed_blocks,
+	 (uint64_t) 4 );
+
+	result = libagdb_content_fingerprint_finalize(
+	          content_fingerprint,
+	          block_fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          block_fingerprint,
+	          fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_content_fingerprint_update(
+	          content_fingerprint,
+	          100,
+	          data,
+	          LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_content_fingerprint_update(
+	          content_fingerprint,
+	          0,
+	          NULL,
+	          LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_content_fingerprint_finalize(
+	          content_fingerprint,
+	          block_fingerprint,
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_content_fingerprint_free(
+	          &content_fingerprint,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the fingerprint depends on the data
+	 */
+	data[ LIBAGDB_CONTENT_FINGERPRINT_BLOCK_SIZE ] ^= 0x01;
+
+	result = libagdb_content_fingerprint_initialize(
+	          &content_fingerprint,
+	          AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_content_fingerprint_update(
+	          content_fingerprint,
+	          0,
+	          data,
+	          AGDB_TEST_CONTENT_FINGERPRINT_DATA_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_content_fingerprint_finalize(
+	          content_fingerprint,
+	          block_fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          block_fingerprint,
+	          fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libagdb_content_fingerprint_free(
+	          &content_fingerprint,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( content_fingerprint != NULL )
+	{
+		libagdb_content_fingerprint_free(
+		 &content_fingerprint,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_content_fingerprint_initialize",
+	 agdb_test_content_fingerprint_initialize )
+
+	AGDB_TEST_RUN(
+	 "libagdb_content_fingerprint_update",
+	 agdb_test_content_fingerprint_update )
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
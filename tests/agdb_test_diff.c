@@ -0,0 +1,711 @@
+/*
+ * Library diff type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_diff.h"
+
+/* Tests the libagdb_diff_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_diff_initialize(
+     void )
+{
+	libagdb_diff_t *diff   = NULL;
+	libagdb_error_t *error = NULL;
+	int result             = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_diff_initialize(
+	          &diff,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "diff",
+	 diff );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_diff_free(
+	          &diff,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "diff",
+	 diff );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_diff_initialize(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	diff = (libagdb_diff_t *) 0x12345678UL;
+
+	result = libagdb_diff_initialize(
+	          &diff,
+	          &error );
+
+	diff = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libagdb_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libagdb_diff_free(
+		 &diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_diff_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_diff_free(
+     void )
+{
+	libagdb_error_t *error = NULL;
+	int result             = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_diff_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libagdb_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_diff_compare_files function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_diff_compare_files(
+     void )
+{
+	libagdb_difference_t difference;
+
+	libagdb_diff_t *diff          = NULL;
+	libagdb_error_t *error        = NULL;
+	libagdb_file_t *current_file  = NULL;
+	libagdb_file_t *previous_file = NULL;
+	int number_of_differences     = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_diff_initialize(
+	          &diff,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "diff",
+	 diff );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &previous_file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &current_file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_diff_compare_files(
+	          diff,
+	          previous_file,
+	          current_file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_diff_get_number_of_differences(
+	          diff,
+	          &number_of_differences,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_differences",
+	 number_of_differences,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_diff_compare_files(
+	          NULL,
+	          previous_file,
+	          current_file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_diff_compare_files(
+	          diff,
+	          NULL,
+	          current_file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_diff_compare_files(
+	          diff,
+	          previous_file,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_diff_get_number_of_differences(
+	          NULL,
+	          &number_of_differences,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_diff_get_number_of_differences(
+	          diff,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_diff_get_difference(
+	          NULL,
+	          0,
+	          &difference,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_diff_get_difference(
+	          diff,
+	          0,
+	          &difference,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &current_file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_free(
+	          &previous_file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_diff_free(
+	          &diff,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libagdb_error_free(
+		 &error );
+	}
+	if( current_file != NULL )
+	{
+		libagdb_file_free(
+		 &current_file,
+		 NULL );
+	}
+	if( previous_file != NULL )
+	{
+		libagdb_file_free(
+		 &previous_file,
+		 NULL );
+	}
+	if( diff != NULL )
+	{
+		libagdb_diff_free(
+		 &diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_diff_join_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_diff_join_keys(
+     void )
+{
+	libagdb_diff_key_t current_keys[ 3 ];
+	libagdb_diff_key_t previous_keys[ 3 ];
+	int current_matches[ 3 ];
+	int previous_matches[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 * The previous keys contain a duplicate key, the current keys
+	 * a key with the same data but a different value
+	 */
+	result = libagdb_diff_key_set(
+	          &( previous_keys[ 0 ] ),
+	          (uint8_t *) "A.EXE",
+	          5,
+	          1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libagdb_diff_key_set(
+	          &( previous_keys[ 1 ] ),
+	          (uint8_t *) "B.EXE",
+	          5,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libagdb_diff_key_set(
+	          &( previous_keys[ 2 ] ),
+	          (uint8_t *) "B.EXE",
+	          5,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libagdb_diff_key_set(
+	          &( current_keys[ 0 ] ),
+	          (uint8_t *) "B.EXE",
+	          5,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libagdb_diff_key_set(
+	          &( current_keys[ 1 ] ),
+	          (uint8_t *) "A.EXE",
+	          5,
+	          3,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libagdb_diff_key_set(
+	          &( current_keys[ 2 ] ),
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_diff_join_keys(
+	          previous_keys,
+	          3,
+	          current_keys,
+	          3,
+	          previous_matches,
+	          current_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "previous_matches[ 0 ]",
+	 previous_matches[ 0 ],
+	 -1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "previous_matches[ 1 ]",
+	 previous_matches[ 1 ],
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "previous_matches[ 2 ]",
+	 previous_matches[ 2 ],
+	 -1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "current_matches[ 0 ]",
+	 current_matches[ 0 ],
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "current_matches[ 1 ]",
+	 current_matches[ 1 ],
+	 -1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "current_matches[ 2 ]",
+	 current_matches[ 2 ],
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libagdb_diff_join_keys(
+	          previous_keys,
+	          -1,
+	          current_keys,
+	          3,
+	          previous_matches,
+	          current_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_diff_join_keys(
+	          previous_keys,
+	          3,
+	          NULL,
+	          3,
+	          previous_matches,
+	          current_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	AGDB_TEST_RUN(
+	 "libagdb_diff_initialize",
+	 agdb_test_diff_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_diff_free",
+	 agdb_test_diff_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_diff_compare_files",
+	 agdb_test_diff_compare_files );
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_diff_join_keys",
+	 agdb_test_diff_join_keys );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
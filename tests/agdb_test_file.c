@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -37,6 +38,7 @@
 #include "agdb_test_libcerror.h"
 #include "agdb_test_macros.h"
 #include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
 
 #include "../libagdb/libagdb_file.h"
 
@@ -1001,56 +1003,100 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_file_close function
+/* Tests the libagdb_file_open_memory function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_close(
-     void )
+int agdb_test_file_open_memory(
+     libbfio_handle_t *file_io_handle )
 {
+	uint64_t statistics[ LIBAGDB_NUMBER_OF_STATISTICS ];
+
+	libagdb_file_t *file     = NULL;
 	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	size64_t file_size       = 0;
+	ssize_t read_count       = 0;
+	int expected_volumes     = 0;
+	int number_of_volumes    = 0;
 	int result               = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libagdb_file_close(
-	          NULL,
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
 
-	return( 1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only test files up to 64 MiB are read into memory
+	 */
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) ( 64 * 1024 * 1024 ) ) )
 	{
-		libcerror_error_free(
-		 &error );
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+
+		return( 1 );
 	}
-	return( 0 );
-}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) file_size );
 
-/* Tests the libagdb_file_open and libagdb_file_close functions
- * Returns 1 if successful or 0 if not
- */
-int agdb_test_file_open_close(
-     const system_character_t *source )
-{
-	libagdb_file_t *file     = NULL;
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              (size_t) file_size,
+	              0,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
 	result = libagdb_file_initialize(
 	          &file,
 	          &error );
@@ -1068,21 +1114,14 @@ int agdb_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test open
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libagdb_file_open_wide(
+	result = libagdb_file_open_memory(
 	          file,
-	          source,
-	          LIBAGDB_OPEN_READ,
-	          &error );
-#else
-	result = libagdb_file_open(
-	          file,
-	          source,
+	          data,
+	          (size_t) file_size,
 	          LIBAGDB_OPEN_READ,
 	          &error );
-#endif
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1093,34 +1132,27 @@ int agdb_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libagdb_file_close(
+	result = libagdb_file_get_number_of_volumes(
 	          file,
+	          &expected_volumes,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
+	/* Data read from memory is not counted as read using the file IO handle
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libagdb_file_open_wide(
-	          file,
-	          source,
-	          LIBAGDB_OPEN_READ,
-	          &error );
-#else
-	result = libagdb_file_open(
+	result = libagdb_file_get_statistics(
 	          file,
-	          source,
-	          LIBAGDB_OPEN_READ,
+	          statistics,
+	          LIBAGDB_NUMBER_OF_STATISTICS,
 	          &error );
-#endif
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1131,83 +1163,78 @@ int agdb_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libagdb_file_close(
-	          file,
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBAGDB_STATISTIC_BYTES_READ ]",
+	 statistics[ LIBAGDB_STATISTIC_BYTES_READ ],
+	 (uint64_t) 0 );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics[ LIBAGDB_STATISTIC_MAPPED_BYTES_READ ]",
+	 (int64_t) statistics[ LIBAGDB_STATISTIC_MAPPED_BYTES_READ ],
+	 (int64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_open_memory(
+	          NULL,
+	          data,
+	          (size_t) file_size,
+	          LIBAGDB_OPEN_READ,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
 	 */
-	result = libagdb_file_free(
-	          &file,
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) file_size,
+	          LIBAGDB_OPEN_READ,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( file != NULL )
-	{
-		libagdb_file_free(
-		 &file,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libagdb_file_signal_abort function
- * Returns 1 if successful or 0 if not
- */
-int agdb_test_file_signal_abort(
-     libagdb_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_free(
+	 &error );
 
-	/* Test regular cases
-	 */
-	result = libagdb_file_signal_abort(
+	result = libagdb_file_close(
 	          file,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test error cases on a closed file
 	 */
-	result = libagdb_file_signal_abort(
+	result = libagdb_file_open_memory(
+	          file,
 	          NULL,
+	          (size_t) file_size,
+	          LIBAGDB_OPEN_READ,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1222,48 +1249,30 @@ int agdb_test_file_signal_abort(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libagdb_file_get_number_of_volumes function
- * Returns 1 if successful or 0 if not
- */
-int agdb_test_file_get_number_of_volumes(
-     libagdb_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int number_of_volumes    = 0;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libagdb_file_get_number_of_volumes(
+	result = libagdb_file_open_memory(
 	          file,
-	          &number_of_volumes,
+	          data,
+	          0,
+	          LIBAGDB_OPEN_READ,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libagdb_file_get_number_of_volumes(
-	          NULL,
-	          &number_of_volumes,
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) file_size,
+	          -1,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1278,9 +1287,13 @@ int agdb_test_file_get_number_of_volumes(
 	libcerror_error_free(
 	 &error );
 
-	result = libagdb_file_get_number_of_volumes(
+	/* Test open with truncated data
+	 */
+	result = libagdb_file_open_memory(
 	          file,
-	          NULL,
+	          data,
+	          8,
+	          LIBAGDB_OPEN_READ,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1295,30 +1308,48 @@ int agdb_test_file_get_number_of_volumes(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	/* Test open after a failed open with data truncated halfway
+	 * the volumes read before the failure should not be retained
+	 */
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) ( file_size / 2 ),
+	          LIBAGDB_OPEN_READ,
+	          &error );
 
-on_error:
-	if( error != NULL )
+	if( result == 1 )
+	{
+		result = libagdb_file_close(
+		          file,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	else
 	{
 		libcerror_error_free(
 		 &error );
 	}
-	return( 0 );
-}
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          (size_t) file_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
 
-/* Tests the libagdb_file_get_volume_information function
- * Returns 1 if successful or 0 if not
- */
-int agdb_test_file_get_volume_information(
-     libagdb_file_t *file )
-{
-	libagdb_volume_information_t *volume_information = 0;
-	libcerror_error_t *error                         = NULL;
-	int number_of_volumes                            = 0;
-	int result                                       = 0;
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
 	result = libagdb_file_get_number_of_volumes(
 	          file,
 	          &number_of_volumes,
@@ -1329,54 +1360,2761 @@ int agdb_test_file_get_volume_information(
 	 result,
 	 1 );
 
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 expected_volumes );
+
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( number_of_volumes == 0 )
-	{
-		return( 1 );
-	}
-	/* Test regular cases
-	 */
-	result = libagdb_file_get_volume_information(
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_file_close(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_open and libagdb_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_open_close(
+     const system_character_t *source )
+{
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#endif
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#endif
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_reset(
+     const system_character_t *source )
+{
+	libagdb_file_t *file           = NULL;
+	libcerror_error_t *error       = NULL;
+	int expected_number_of_sources = 0;
+	int expected_number_of_volumes = 0;
+	int number_of_sources          = 0;
+	int number_of_volumes          = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reset of a file that is not open
+	 */
+	result = libagdb_file_reset(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and reset
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#endif
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &expected_number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &expected_number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_reset(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open a second time to validate the retained containers are reused
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#endif
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 expected_number_of_volumes );
+
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 expected_number_of_sources );
+
+	result = libagdb_file_reset(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_reset(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_release_io_resources function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_release_io_resources(
+     const system_character_t *source )
+{
+	uint8_t fingerprint[ LIBAGDB_CONTENT_FINGERPRINT_SIZE ];
+
+	libagdb_file_t *file                             = NULL;
+	libagdb_volume_information_t *volume_information = NULL;
+	libcerror_error_t *error                         = NULL;
+	int number_of_volumes                            = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases on a file that is not open
+	 */
+	result = libagdb_file_release_io_resources(
+	          file,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          source,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#endif
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_release_io_resources(
+	          file,
+	          LIBAGDB_RELEASE_FLAG_CLOSE_FILE_IO_HANDLE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the information remains available after release
+	 */
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_volumes > 0 )
+	{
+		result = libagdb_file_get_volume_information(
+		          file,
+		          0,
+		          &volume_information,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "volume_information",
+		 volume_information );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_volume_information_free(
+		          &volume_information,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libagdb_file_get_content_fingerprint(
+	          file,
+	          fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test release a second time
+	 */
+	result = libagdb_file_release_io_resources(
+	          file,
+	          LIBAGDB_RELEASE_FLAG_CLOSE_FILE_IO_HANDLE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_release_io_resources(
+	          NULL,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_release_io_resources(
+	          file,
+	          0xff,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_information != NULL )
+	{
+		libagdb_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_signal_abort(
+     libagdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_signal_abort(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_signal_abort(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_validation_level and libagdb_file_set_validation_level functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_validation_level(
+     void )
+{
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int validation_level     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_validation_level(
+	          file,
+	          &validation_level,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "validation_level",
+	 validation_level,
+	 LIBAGDB_VALIDATION_LEVEL_FAST );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_set_validation_level(
+	          file,
+	          LIBAGDB_VALIDATION_LEVEL_STRICT,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_validation_level(
+	          file,
+	          &validation_level,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "validation_level",
+	 validation_level,
+	 LIBAGDB_VALIDATION_LEVEL_STRICT );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_set_validation_level(
+	          file,
+	          LIBAGDB_VALIDATION_LEVEL_NONE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_validation_level(
+	          file,
+	          &validation_level,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "validation_level",
+	 validation_level,
+	 LIBAGDB_VALIDATION_LEVEL_NONE );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_validation_level(
+	          NULL,
+	          &validation_level,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_validation_level(
+	          file,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_set_validation_level(
+	          NULL,
+	          LIBAGDB_VALIDATION_LEVEL_FAST,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_set_validation_level(
+	          file,
+	          -1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests opening generated data of a specific file type with each validation level
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_validation_level_with_file_type(
+     uint8_t file_type,
+     uint8_t number_of_bits )
+{
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	uint8_t *data            = NULL;
+	size_t data_size         = 0;
+	uint8_t opened_file_type = 0;
+	int number_of_sources    = 0;
+	int number_of_volumes    = 0;
+	int result               = 0;
+	int validation_level     = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_generate_data(
+	          file_type,
+	          number_of_bits,
+	          &data,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( validation_level = LIBAGDB_VALIDATION_LEVEL_NONE;
+	     validation_level <= LIBAGDB_VALIDATION_LEVEL_STRICT;
+	     validation_level++ )
+	{
+		result = libagdb_file_initialize(
+		          &file,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_file_set_validation_level(
+		          file,
+		          validation_level,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_file_open_memory(
+		          file,
+		          data,
+		          data_size,
+		          LIBAGDB_OPEN_READ,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The validation level cannot be changed while the file is open
+		 */
+		result = libagdb_file_set_validation_level(
+		          file,
+		          LIBAGDB_VALIDATION_LEVEL_FAST,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libagdb_file_get_file_type(
+		          file,
+		          &opened_file_type,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_UINT8(
+		 "opened_file_type",
+		 opened_file_type,
+		 file_type );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_file_get_number_of_volumes(
+		          file,
+		          &number_of_volumes,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_volumes",
+		 number_of_volumes,
+		 2 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_file_get_number_of_sources(
+		          file,
+		          &number_of_sources,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_sources",
+		 number_of_sources,
+		 2 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_file_close(
+		          file,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_file_free(
+		          &file,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Test trace begin callback
+ */
+void agdb_test_file_trace_begin_callback(
+      intptr_t *callback_data,
+      libagdb_file_t *file AGDB_TEST_ATTRIBUTE_UNUSED,
+      int trace_phase AGDB_TEST_ATTRIBUTE_UNUSED,
+      uint32_t trace_index AGDB_TEST_ATTRIBUTE_UNUSED,
+      uint8_t file_type AGDB_TEST_ATTRIBUTE_UNUSED,
+      off64_t offset AGDB_TEST_ATTRIBUTE_UNUSED,
+      size64_t size AGDB_TEST_ATTRIBUTE_UNUSED )
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( file )
+	AGDB_TEST_UNREFERENCED_PARAMETER( trace_phase )
+	AGDB_TEST_UNREFERENCED_PARAMETER( trace_index )
+	AGDB_TEST_UNREFERENCED_PARAMETER( file_type )
+	AGDB_TEST_UNREFERENCED_PARAMETER( offset )
+	AGDB_TEST_UNREFERENCED_PARAMETER( size )
+
+	if( callback_data != NULL )
+	{
+		*( (int *) callback_data ) += 1;
+	}
+}
+
+/* Tests the libagdb_file_set_trace_callbacks function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_set_trace_callbacks(
+     void )
+{
+	libagdb_file_t *file     = NULL;
+	libcerror_error_t *error = NULL;
+	int number_of_calls      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_set_trace_callbacks(
+	          file,
+	          &agdb_test_file_trace_begin_callback,
+	          NULL,
+	          (intptr_t *) &number_of_calls,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_set_trace_callbacks(
+	          file,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_set_trace_callbacks(
+	          NULL,
+	          &agdb_test_file_trace_begin_callback,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_set_trace_callbacks(
+	          file,
+	          NULL,
+	          NULL,
+	          (intptr_t *) &number_of_calls,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_file_type function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_file_type(
+     libagdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t file_type        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_file_type(
+	          file,
+	          &file_type,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "file_type",
+	 (int) file_type,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_file_type(
+	          NULL,
+	          &file_type,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_file_type(
+	          file,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_uncompressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_uncompressed_data_size(
+     libagdb_file_t *file )
+{
+	libcerror_error_t *error        = NULL;
+	uint32_t uncompressed_data_size = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_uncompressed_data_size(
+	          file,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_uncompressed_data_size(
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_uncompressed_data_size(
+	          file,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_statistics(
+     libagdb_file_t *file )
+{
+	uint64_t statistics[ LIBAGDB_NUMBER_OF_STATISTICS + 1 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	statistics[ LIBAGDB_NUMBER_OF_STATISTICS ] = 0xffffffffffffffffULL;
+
+	result = libagdb_file_get_statistics(
+	          file,
+	          statistics,
+	          LIBAGDB_NUMBER_OF_STATISTICS + 1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics[ LIBAGDB_STATISTIC_BYTES_READ ]",
+	 (int64_t) statistics[ LIBAGDB_STATISTIC_BYTES_READ ],
+	 (int64_t) 0 );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "statistics[ LIBAGDB_STATISTIC_READ_CALLS ]",
+	 (int64_t) statistics[ LIBAGDB_STATISTIC_READ_CALLS ],
+	 (int64_t) 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics[ LIBAGDB_NUMBER_OF_STATISTICS ]",
+	 statistics[ LIBAGDB_NUMBER_OF_STATISTICS ],
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_statistics(
+	          NULL,
+	          statistics,
+	          LIBAGDB_NUMBER_OF_STATISTICS,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_statistics(
+	          file,
+	          NULL,
+	          LIBAGDB_NUMBER_OF_STATISTICS,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_statistics(
+	          file,
+	          statistics,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_content_fingerprint function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_content_fingerprint(
+     libagdb_file_t *file )
+{
+	uint8_t fingerprint[ LIBAGDB_CONTENT_FINGERPRINT_SIZE ];
+	uint8_t second_fingerprint[ LIBAGDB_CONTENT_FINGERPRINT_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_content_fingerprint(
+	          file,
+	          fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the fingerprint is retained
+	 */
+	result = libagdb_file_get_content_fingerprint(
+	          file,
+	          second_fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          fingerprint,
+	          second_fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_content_fingerprint(
+	          NULL,
+	          fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_content_fingerprint(
+	          file,
+	          NULL,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_content_fingerprint(
+	          file,
+	          fingerprint,
+	          LIBAGDB_CONTENT_FINGERPRINT_SIZE - 1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_number_of_volumes function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_number_of_volumes(
+     libagdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_volumes    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_number_of_volumes(
+	          NULL,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_volume_information function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_volume_information(
+     libagdb_file_t *file )
+{
+	libagdb_volume_information_t *volume_information = 0;
+	libcerror_error_t *error                         = NULL;
+	int number_of_volumes                            = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_volumes == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_volume_information(
+	          file,
+	          0,
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	result = libagdb_volume_information_free(
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_volume_information(
+	          NULL,
+	          0,
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_volume_information(
+	          file,
+	          -1,
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_volume_information(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_number_of_sources function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_number_of_sources(
+     libagdb_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_sources    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_number_of_sources(
+	          NULL,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_source_information function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_source_information(
+     libagdb_file_t *file )
+{
+	libagdb_source_information_t *source_information = 0;
+	libcerror_error_t *error                         = NULL;
+	int number_of_sources                            = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_sources == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_source_information(
+	          file,
+	          0,
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "source_information",
+	 source_information );
+
+	result = libagdb_source_information_free(
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_source_information(
+	          NULL,
+	          0,
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_source_information(
+	          file,
+	          -1,
+	          &source_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_source_information(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_information",
+	 source_information );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_volume_information_by_serial_number and
+ * libagdb_file_get_volume_information_by_utf8_device_path functions with generated data
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_volume_information_by_serial_number(
+     uint8_t file_type,
+     uint8_t number_of_bits )
+{
+	libagdb_file_t *file                                   = NULL;
+	libagdb_volume_information_t *found_volume_information = NULL;
+	libagdb_volume_information_t *volume_information       = NULL;
+	libcerror_error_t *error                               = NULL;
+	uint8_t *data                                          = NULL;
+	size_t data_size                                       = 0;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_generate_data(
+	          file_type,
+	          number_of_bits,
+	          &data,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          data_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_volume_information(
+	          file,
+	          1,
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_volume_information_by_serial_number(
+	          file,
+	          0x5a5a0001UL,
+	          &found_volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "found_volume_information == volume_information",
+	 (int) ( found_volume_information == volume_information ),
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	found_volume_information = NULL;
+
+	result = libagdb_file_get_volume_information_by_utf8_device_path(
+	          file,
+	          (uint8_t *) "\\Device\\HarddiskVolume2",
+	          23,
+	          &found_volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "found_volume_information == volume_information",
+	 (int) ( found_volume_information == volume_information ),
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	found_volume_information = NULL;
+
+	result = libagdb_file_get_volume_information_by_serial_number(
+	          file,
+	          0x12345678UL,
+	          &found_volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "found_volume_information",
+	 found_volume_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_volume_information_by_utf8_device_path(
 	          file,
+	          (uint8_t *) "\\Device\\HarddiskVolume9",
+	          23,
+	          &found_volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "found_volume_information",
+	 found_volume_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_volume_information_by_serial_number(
+	          NULL,
+	          0x5a5a0001UL,
+	          &found_volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_volume_information_by_utf8_device_path(
+	          file,
+	          NULL,
+	          23,
+	          &found_volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_file_get_volume_summaries function with generated data
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_get_volume_summaries(
+     uint8_t file_type,
+     uint8_t number_of_bits )
+{
+	libagdb_volume_summary_t volume_summaries[ 2 ];
+
+	libagdb_file_t *file                             = NULL;
+	libagdb_volume_information_t *volume_information = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint8_t *data                                    = NULL;
+	size_t data_size                                 = 0;
+	size_t utf8_device_path_size                     = 0;
+	uint64_t creation_time                           = 0;
+	uint32_t serial_number                           = 0;
+	int number_of_files                              = 0;
+	int number_of_volumes                            = 0;
+	int result                                       = 0;
+	int volume_index                                 = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_generate_data(
+	          file_type,
+	          number_of_bits,
+	          &data,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          data_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_volume_summaries(
+	          file,
+	          volume_summaries,
+	          2,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		volume_information = NULL;
+
+		result = libagdb_file_get_volume_information(
+		          file,
+		          volume_index,
+		          &volume_information,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_volume_information_get_creation_time(
+		          volume_information,
+		          &creation_time,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_UINT64(
+		 "volume_summaries[ volume_index ].creation_time",
+		 volume_summaries[ volume_index ].creation_time,
+		 creation_time );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_volume_information_get_utf8_device_path_size(
+		          volume_information,
+		          &utf8_device_path_size,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_SIZE(
+		 "volume_summaries[ volume_index ].utf8_device_path_size",
+		 volume_summaries[ volume_index ].utf8_device_path_size,
+		 utf8_device_path_size );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_volume_information_get_serial_number(
+		          volume_information,
+		          &serial_number,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_UINT32(
+		 "volume_summaries[ volume_index ].serial_number",
+		 volume_summaries[ volume_index ].serial_number,
+		 serial_number );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_volume_information_get_number_of_files(
+		          volume_information,
+		          &number_of_files,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_UINT32(
+		 "volume_summaries[ volume_index ].number_of_files",
+		 volume_summaries[ volume_index ].number_of_files,
+		 (uint32_t) number_of_files );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test with fewer summaries than volumes
+	 */
+	result = libagdb_file_get_volume_summaries(
+	          file,
+	          volume_summaries,
+	          1,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_volume_summaries(
+	          file,
+	          NULL,
 	          0,
-	          &volume_information,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_volume_summaries(
+	          NULL,
+	          volume_summaries,
+	          2,
+	          &number_of_volumes,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_information",
-	 volume_information );
+	libcerror_error_free(
+	 &error );
 
-	result = libagdb_volume_information_free(
-	          &volume_information,
+	result = libagdb_file_get_volume_summaries(
+	          file,
+	          volume_summaries,
+	          -1,
+	          &number_of_volumes,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libagdb_file_get_volume_information(
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_volume_summaries(
+	          file,
 	          NULL,
-	          0,
-	          &volume_information,
+	          2,
+	          &number_of_volumes,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1384,10 +4122,6 @@ int agdb_test_file_get_volume_information(
 	 result,
 	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1395,10 +4129,11 @@ int agdb_test_file_get_volume_information(
 	libcerror_error_free(
 	 &error );
 
-	result = libagdb_file_get_volume_information(
+	result = libagdb_file_get_volume_summaries(
 	          file,
-	          -1,
-	          &volume_information,
+	          volume_summaries,
+	          2,
+	          NULL,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1406,10 +4141,6 @@ int agdb_test_file_get_volume_information(
 	 result,
 	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1417,27 +4148,36 @@ int agdb_test_file_get_volume_information(
 	libcerror_error_free(
 	 &error );
 
-	result = libagdb_file_get_volume_information(
+	/* Clean up
+	 */
+	result = libagdb_file_close(
 	          file,
-	          0,
-	          NULL,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
+	 "error",
+	 error );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	memory_free(
+	 data );
 
 	return( 1 );
 
@@ -1447,24 +4187,45 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
 	return( 0 );
 }
 
-/* Tests the libagdb_file_get_number_of_sources function
+/* Tests the libagdb_file_get_source_information_by_prefetch_hash and
+ * libagdb_file_get_source_information_by_utf8_executable_filename functions with generated data
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_file_get_number_of_sources(
-     libagdb_file_t *file )
+int agdb_test_file_get_source_information_by_prefetch_hash(
+     uint8_t file_type,
+     uint8_t number_of_bits )
 {
-	libcerror_error_t *error = NULL;
-	int number_of_sources    = 0;
-	int result               = 0;
+	libagdb_file_t *file                                   = NULL;
+	libagdb_source_information_t *found_source_information = NULL;
+	libagdb_source_information_t *source_information       = NULL;
+	libcerror_error_t *error                               = NULL;
+	uint8_t *data                                          = NULL;
+	size_t data_size                                       = 0;
+	uint32_t prefetch_hash                                 = 0;
+	int expected_result                                    = 0;
+	int result                                             = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libagdb_file_get_number_of_sources(
-	          file,
-	          &number_of_sources,
+	result = agdb_test_generate_data(
+	          file_type,
+	          number_of_bits,
+	          &data,
+	          &data_size,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1476,69 +4237,70 @@ int agdb_test_file_get_number_of_sources(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libagdb_file_get_number_of_sources(
-	          NULL,
-	          &number_of_sources,
+	result = libagdb_file_initialize(
+	          &file,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libagdb_file_get_number_of_sources(
+	result = libagdb_file_open_memory(
 	          file,
-	          NULL,
+	          data,
+	          data_size,
+	          LIBAGDB_OPEN_READ,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_source_information(
+	          file,
+	          1,
+	          &source_information,
+	          &error );
 
-	return( 1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libagdb_file_get_source_information function
- * Returns 1 if successful or 0 if not
- */
-int agdb_test_file_get_source_information(
-     libagdb_file_t *file )
-{
-	libagdb_source_information_t *source_information = 0;
-	libcerror_error_t *error                         = NULL;
-	int number_of_sources                            = 0;
-	int result                                       = 0;
+	result = libagdb_source_information_get_prefetch_hash(
+	          source_information,
+	          &prefetch_hash,
+	          &error );
 
-	/* Initialize test
-	 */
-	result = libagdb_file_get_number_of_sources(
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_source_information_by_prefetch_hash(
 	          file,
-	          &number_of_sources,
+	          prefetch_hash,
+	          &found_source_information,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1546,43 +4308,67 @@ int agdb_test_file_get_source_information(
 	 result,
 	 1 );
 
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "found_source_information == source_information",
+	 (int) ( found_source_information == source_information ),
+	 1 );
+
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( number_of_sources == 0 )
+	/* Only the Vista and Windows 7 source information entries contain the executable filename
+	 */
+	if( ( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0 )
+	 || ( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1 ) )
 	{
-		return( 1 );
+		expected_result = 0;
 	}
-	/* Test regular cases
-	 */
-	result = libagdb_file_get_source_information(
+	else
+	{
+		expected_result = 1;
+	}
+	found_source_information = NULL;
+
+	result = libagdb_file_get_source_information_by_utf8_executable_filename(
 	          file,
-	          0,
-	          &source_information,
+	          (uint8_t *) "APP00000001.EXE",
+	          15,
+	          &found_source_information,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 expected_result );
 
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "source_information",
-	 source_information );
+	if( expected_result == 1 )
+	{
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "found_source_information == source_information",
+		 (int) ( found_source_information == source_information ),
+		 1 );
+	}
+	found_source_information = NULL;
 
-	result = libagdb_source_information_free(
-	          &source_information,
+	result = libagdb_file_get_source_information_by_prefetch_hash(
+	          file,
+	          prefetch_hash ^ 0xffffffffUL,
+	          &found_source_information,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "found_source_information",
+	 found_source_information );
 
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1590,10 +4376,10 @@ int agdb_test_file_get_source_information(
 
 	/* Test error cases
 	 */
-	result = libagdb_file_get_source_information(
+	result = libagdb_file_get_source_information_by_prefetch_hash(
 	          NULL,
-	          0,
-	          &source_information,
+	          prefetch_hash,
+	          &found_source_information,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1601,10 +4387,6 @@ int agdb_test_file_get_source_information(
 	 result,
 	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "source_information",
-	 source_information );
-
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1612,10 +4394,10 @@ int agdb_test_file_get_source_information(
 	libcerror_error_free(
 	 &error );
 
-	result = libagdb_file_get_source_information(
+	result = libagdb_file_get_source_information_by_prefetch_hash(
 	          file,
-	          -1,
-	          &source_information,
+	          prefetch_hash,
+	          NULL,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1623,10 +4405,6 @@ int agdb_test_file_get_source_information(
 	 result,
 	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "source_information",
-	 source_information );
-
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1634,27 +4412,36 @@ int agdb_test_file_get_source_information(
 	libcerror_error_free(
 	 &error );
 
-	result = libagdb_file_get_source_information(
+	/* Clean up
+	 */
+	result = libagdb_file_close(
 	          file,
-	          0,
-	          NULL,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
-	 "source_information",
-	 source_information );
+	 "error",
+	 error );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	memory_free(
+	 data );
 
 	return( 1 );
 
@@ -1664,6 +4451,17 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
 	return( 0 );
 }
 
@@ -1724,7 +4522,160 @@ int main(
 	 "libagdb_file_free",
 	 agdb_test_file_free );
 
+	AGDB_TEST_RUN(
+	 "libagdb_file_validation_level",
+	 agdb_test_file_validation_level );
+
+	AGDB_TEST_RUN(
+	 "libagdb_file_set_trace_callbacks",
+	 agdb_test_file_set_trace_callbacks );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_validation_level",
+	 agdb_test_file_validation_level_with_file_type,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_validation_level",
+	 agdb_test_file_validation_level_with_file_type,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_validation_level",
+	 agdb_test_file_validation_level_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_validation_level",
+	 agdb_test_file_validation_level_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_validation_level",
+	 agdb_test_file_validation_level_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_validation_level",
+	 agdb_test_file_validation_level_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_information_by_serial_number",
+	 agdb_test_file_get_volume_information_by_serial_number,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_information_by_serial_number",
+	 agdb_test_file_get_volume_information_by_serial_number,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_information_by_serial_number",
+	 agdb_test_file_get_volume_information_by_serial_number,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_information_by_serial_number",
+	 agdb_test_file_get_volume_information_by_serial_number,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_information_by_serial_number",
+	 agdb_test_file_get_volume_information_by_serial_number,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_information_by_serial_number",
+	 agdb_test_file_get_volume_information_by_serial_number,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_summaries",
+	 agdb_test_file_get_volume_summaries,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_summaries",
+	 agdb_test_file_get_volume_summaries,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_summaries",
+	 agdb_test_file_get_volume_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_summaries",
+	 agdb_test_file_get_volume_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_summaries",
+	 agdb_test_file_get_volume_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_volume_summaries",
+	 agdb_test_file_get_volume_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_information_by_prefetch_hash",
+	 agdb_test_file_get_source_information_by_prefetch_hash,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_information_by_prefetch_hash",
+	 agdb_test_file_get_source_information_by_prefetch_hash,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_information_by_prefetch_hash",
+	 agdb_test_file_get_source_information_by_prefetch_hash,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_information_by_prefetch_hash",
+	 agdb_test_file_get_source_information_by_prefetch_hash,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_information_by_prefetch_hash",
+	 agdb_test_file_get_source_information_by_prefetch_hash,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_information_by_prefetch_hash",
+	 agdb_test_file_get_source_information_by_prefetch_hash,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 64 );
+
 	if( source != NULL )
 	{
 		result = libbfio_file_initialize(
@@ -1803,6 +4754,11 @@ int main(
 		 agdb_test_file_open_file_io_handle,
 		 source );
 
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_open_memory",
+		 agdb_test_file_open_memory,
+		 file_io_handle );
+
 		AGDB_TEST_RUN(
 		 "libagdb_file_close",
 		 agdb_test_file_close );
@@ -1812,6 +4768,16 @@ int main(
 		 agdb_test_file_open_close,
 		 source );
 
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_reset",
+		 agdb_test_file_reset,
+		 source );
+
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_release_io_resources",
+		 agdb_test_file_release_io_resources,
+		 source );
+
 		/* Initialize file for tests
 		 */
 		result = agdb_test_file_open_source(
@@ -1843,6 +4809,26 @@ int main(
 
 #endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
 
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_get_file_type",
+		 agdb_test_file_get_file_type,
+		 file );
+
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_get_uncompressed_data_size",
+		 agdb_test_file_get_uncompressed_data_size,
+		 file );
+
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_get_statistics",
+		 agdb_test_file_get_statistics,
+		 file );
+
+		AGDB_TEST_RUN_WITH_ARGS(
+		 "libagdb_file_get_content_fingerprint",
+		 agdb_test_file_get_content_fingerprint,
+		 file );
+
 		AGDB_TEST_RUN_WITH_ARGS(
 		 "libagdb_file_get_number_of_volumes",
 		 agdb_test_file_get_number_of_volumes,
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -454,6 +455,19 @@ int agdb_test_internal_file_information_read_data(
 	io_handle->file_information_sub_entry_type1_size = 16;
 	io_handle->file_information_sub_entry_type2_size = 20;
 
+	result = libagdb_io_handle_set_layouts(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libagdb_file_information_initialize(
 	          &file_information,
 	          &error );
@@ -711,6 +725,19 @@ int agdb_test_internal_file_information_read_file_io_handle(
 	io_handle->file_information_sub_entry_type1_size = 16;
 	io_handle->file_information_sub_entry_type2_size = 20;
 
+	result = libagdb_io_handle_set_layouts(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libfdata_stream_initialize(
 	          &data_stream,
 	          NULL,
@@ -1077,6 +1104,316 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libagdb_internal_file_information_read_file_io_handle function with the validation levels
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_internal_file_information_read_file_io_handle_with_validation_level(
+     void )
+{
+	uint8_t file_information_data[ 276 ];
+
+	uint32_t test_sub_entry_type1_sizes[ 5 ] = { 16, 16, 16, 12, 12 };
+	ssize64_t test_read_counts[ 5 ]          = { 276, -1, 276, 272, -1 };
+	uint8_t *test_data[ 5 ]                  = { NULL, NULL, NULL, NULL, NULL };
+	int test_validation_levels[ 5 ]          = {
+		LIBAGDB_VALIDATION_LEVEL_STRICT,
+		LIBAGDB_VALIDATION_LEVEL_STRICT,
+		LIBAGDB_VALIDATION_LEVEL_FAST,
+		LIBAGDB_VALIDATION_LEVEL_NONE,
+		LIBAGDB_VALIDATION_LEVEL_FAST };
+
+	libagdb_file_information_t *file_information = NULL;
+	libagdb_io_handle_t *io_handle               = NULL;
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	libfdata_stream_t *data_stream               = NULL;
+	void *memcpy_result                          = NULL;
+	ssize64_t read_count                         = 0;
+	int element_index                            = 0;
+	int result                                   = 0;
+	int test_index                               = 0;
+
+	/* Initialize test
+	 */
+	memcpy_result = memory_copy(
+	                 file_information_data,
+	                 agdb_test_file_information_data1,
+	                 276 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	/* Overwrite the end-of-string character of the path
+	 */
+	file_information_data[ 258 ] = 0x41;
+
+	test_data[ 0 ] = agdb_test_file_information_data1;
+	test_data[ 1 ] = file_information_data;
+	test_data[ 2 ] = file_information_data;
+	test_data[ 3 ] = agdb_test_file_information_data1;
+	test_data[ 4 ] = agdb_test_file_information_data1;
+
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->validation_level",
+	 io_handle->validation_level,
+	 LIBAGDB_VALIDATION_LEVEL_FAST );
+
+	io_handle->file_header_signature                 = 0x0000000eUL;
+	io_handle->volume_information_entry_size         = 56;
+	io_handle->file_information_entry_size           = 52;
+	io_handle->file_information_sub_entry_type2_size = 20;
+
+	result = libagdb_io_handle_set_layouts(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_initialize(
+	          &data_stream,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &agdb_test_file_information_read_segment_data,
+	          NULL,
+	          (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &agdb_test_file_information_seek_segment_offset,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_stream",
+	 data_stream );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_append_segment(
+	          data_stream,
+	          &element_index,
+	          0,
+	          0,
+	          276,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the validation levels
+	 * strict fails on a path without end-of-string character, which fast accepts
+	 * none accepts an unsupported sub entry size, which fast rejects
+	 */
+	for( test_index = 0;
+	     test_index < 5;
+	     test_index++ )
+	{
+		io_handle->validation_level                      = test_validation_levels[ test_index ];
+		io_handle->file_information_sub_entry_type1_size = test_sub_entry_type1_sizes[ test_index ];
+
+		result = libagdb_file_information_initialize(
+		          &file_information,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file_information",
+		 file_information );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = agdb_test_open_file_io_handle(
+		          &file_io_handle,
+		          test_data[ test_index ],
+		          276,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_count = libagdb_internal_file_information_read_file_io_handle(
+		              (libagdb_internal_file_information_t *) file_information,
+		              io_handle,
+		              data_stream,
+		              file_io_handle,
+		              0,
+		              1,
+		              &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT64(
+		 "read_count",
+		 read_count,
+		 (int64_t) test_read_counts[ test_index ] );
+
+		if( test_read_counts[ test_index ] == -1 )
+		{
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = agdb_test_close_file_io_handle(
+		          &file_io_handle,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_internal_file_information_free(
+		          (libagdb_internal_file_information_t **) &file_information,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "file_information",
+		 file_information );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libfdata_stream_free(
+	          &data_stream,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "data_stream",
+	 data_stream );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_information != NULL )
+	{
+		libagdb_internal_file_information_free(
+		 (libagdb_internal_file_information_t **) &file_information,
+		 NULL );
+	}
+	if( data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libagdb_file_information_get_utf8_path_size function
  * Returns 1 if successful or 0 if not
  */
@@ -1469,6 +1806,115 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libagdb_file_information_get_path_data function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_file_information_get_path_data(
+     libagdb_file_information_t *file_information )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *path_data = NULL;
+	size_t path_data_size    = 0;
+	int result               = 0;
+	int path_data_is_set     = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_information_get_path_data(
+	          file_information,
+	          &path_data,
+	          &path_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	path_data_is_set = result;
+
+	if( path_data_is_set != 0 )
+	{
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "path_data",
+		 path_data );
+
+		AGDB_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "path_data_size",
+		 (ssize_t) path_data_size,
+		 (ssize_t) 0 );
+	}
+	/* Test error cases
+	 */
+	result = libagdb_file_information_get_path_data(
+	          NULL,
+	          &path_data,
+	          &path_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_information_get_path_data(
+	          file_information,
+	          NULL,
+	          &path_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_information_get_path_data(
+	          file_information,
+	          &path_data,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
 
 /* The main program
@@ -1521,6 +1967,10 @@ int main(
 	 "libagdb_internal_file_information_read_file_io_handle",
 	 agdb_test_internal_file_information_read_file_io_handle );
 
+	AGDB_TEST_RUN(
+	 "libagdb_internal_file_information_read_file_io_handle_with_validation_level",
+	 agdb_test_internal_file_information_read_file_io_handle_with_validation_level );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize file_information for tests
@@ -1548,6 +1998,19 @@ int main(
 	io_handle->file_information_sub_entry_type1_size = 16;
 	io_handle->file_information_sub_entry_type2_size = 20;
 
+	result = libagdb_io_handle_set_layouts(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libagdb_file_information_initialize(
 	          &file_information,
 	          &error );
@@ -1619,6 +2082,11 @@ int main(
 	 agdb_test_file_information_get_utf16_path,
 	 file_information );
 
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_information_get_path_data",
+	 agdb_test_file_information_get_path_data,
+	 file_information );
+
 	/* Clean up
 	 */
 	result = libagdb_internal_file_information_free(
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -30,11 +31,22 @@
 #include <stdlib.h>
 #endif
 
+#include "agdb_test_libagdb.h"
 #include "agdb_test_libbfio.h"
 #include "agdb_test_libcerror.h"
 #include "agdb_test_libclocale.h"
 #include "agdb_test_libuna.h"
 
+#if !defined( LIBAGDB_HAVE_BFIO )
+
+LIBAGDB_EXTERN \
+int libagdb_generator_write_file_io_handle(
+     libagdb_generator_t *generator,
+     libbfio_handle_t *file_io_handle,
+     libagdb_error_t **error );
+
+#endif /* !defined( LIBAGDB_HAVE_BFIO ) */
+
 /* Retrieves source as a narrow string
  * Returns 1 if successful or -1 on error
  */
@@ -560,3 +572,236 @@ int agdb_test_close_file_io_handle(
 	return( result );
 }
 
+/* Generates test data of a specific file type in memory
+ * The test data contains 2 volumes with 3 files of 2 sub entries each and 2 sources
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_test_generate_data(
+     uint8_t file_type,
+     uint8_t number_of_bits,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "agdb_test_generate_data";
+	libagdb_generator_t *generator   = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	uint8_t *safe_data               = NULL;
+	size64_t file_size               = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libagdb_generator_initialize(
+	     &generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create generator.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( libagdb_generator_set_file_type(
+	       generator,
+	       file_type,
+	       error ) != 1 )
+	 || ( libagdb_generator_set_number_of_bits(
+	       generator,
+	       number_of_bits,
+	       error ) != 1 )
+	 || ( libagdb_generator_set_number_of_volumes(
+	       generator,
+	       2,
+	       error ) != 1 )
+	 || ( libagdb_generator_set_number_of_files(
+	       generator,
+	       3,
+	       error ) != 1 )
+	 || ( libagdb_generator_set_number_of_sub_entries(
+	       generator,
+	       2,
+	       error ) != 1 )
+	 || ( libagdb_generator_set_number_of_sources(
+	       generator,
+	       2,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set generator values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_generator_get_file_size(
+	     generator,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * (size_t) file_size );
+
+	if( safe_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     safe_data,
+	     (size_t) file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_generator_write_file_io_handle(
+	     generator,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write generated data.",
+		 function );
+
+		goto on_error;
+	}
+	if( agdb_test_close_file_io_handle(
+	     &file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libagdb_generator_free(
+	     &generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free generator.",
+		 function );
+
+		goto on_error;
+	}
+	*data      = safe_data;
+	*data_size = (size_t) file_size;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( -1 );
+}
@@ -58,6 +58,13 @@ int agdb_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int agdb_test_generate_data(
+     uint8_t file_type,
+     uint8_t number_of_bits,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
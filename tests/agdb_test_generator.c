@@ -0,0 +1,2180 @@
+/*
+ * Library generator type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_functions.h"
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libbfio.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#if !defined( LIBAGDB_HAVE_BFIO )
+
+LIBAGDB_EXTERN \
+int libagdb_file_open_file_io_handle(
+     libagdb_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libagdb_error_t **error );
+
+LIBAGDB_EXTERN \
+int libagdb_generator_write_file_io_handle(
+     libagdb_generator_t *generator,
+     libbfio_handle_t *file_io_handle,
+     libagdb_error_t **error );
+
+#endif /* !defined( LIBAGDB_HAVE_BFIO ) */
+
+/* Tests the libagdb_generator_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_initialize(
+     void )
+{
+	libagdb_error_t *error          = NULL;
+	libagdb_generator_t *generator  = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_initialize(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	generator = (libagdb_generator_t *) 0x12345678UL;
+
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	generator = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_generator_initialize with malloc failing
+		 */
+		agdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libagdb_generator_initialize(
+		          &generator,
+		          &error );
+
+		if( agdb_test_malloc_attempts_before_fail != -1 )
+		{
+			agdb_test_malloc_attempts_before_fail = -1;
+
+			if( generator != NULL )
+			{
+				libagdb_generator_free(
+				 &generator,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "generator",
+			 generator );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_generator_initialize with memset failing
+		 */
+		agdb_test_memset_attempts_before_fail = test_number;
+
+		result = libagdb_generator_initialize(
+		          &generator,
+		          &error );
+
+		if( agdb_test_memset_attempts_before_fail != -1 )
+		{
+			agdb_test_memset_attempts_before_fail = -1;
+
+			if( generator != NULL )
+			{
+				libagdb_generator_free(
+				 &generator,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "generator",
+			 generator );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_AGDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_generator_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_free(
+     void )
+{
+	libagdb_error_t *error = NULL;
+	int result             = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_generator_set_file_type function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_set_file_type(
+     void )
+{
+	libagdb_error_t *error         = NULL;
+	libagdb_generator_t *generator = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_generator_set_file_type(
+	          generator,
+	          LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_set_file_type(
+	          NULL,
+	          LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_generator_set_file_type(
+	          generator,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_generator_set_file_type(
+	          generator,
+	          6,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_generator_set_number_of_bits function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_set_number_of_bits(
+     void )
+{
+	libagdb_error_t *error         = NULL;
+	libagdb_generator_t *generator = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_generator_set_number_of_bits(
+	          generator,
+	          64,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_set_number_of_bits(
+	          NULL,
+	          64,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_generator_set_number_of_bits(
+	          generator,
+	          16,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_generator_set_number_of_volumes function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_set_number_of_volumes(
+     void )
+{
+	libagdb_error_t *error         = NULL;
+	libagdb_generator_t *generator = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_generator_set_number_of_volumes(
+	          generator,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_set_number_of_volumes(
+	          NULL,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_generator_set_number_of_files function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_set_number_of_files(
+     void )
+{
+	libagdb_error_t *error         = NULL;
+	libagdb_generator_t *generator = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_generator_set_number_of_files(
+	          generator,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_set_number_of_files(
+	          NULL,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_generator_set_number_of_sub_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_set_number_of_sub_entries(
+     void )
+{
+	libagdb_error_t *error         = NULL;
+	libagdb_generator_t *generator = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_generator_set_number_of_sub_entries(
+	          generator,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_set_number_of_sub_entries(
+	          NULL,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_generator_set_number_of_sources function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_set_number_of_sources(
+     void )
+{
+	libagdb_error_t *error         = NULL;
+	libagdb_generator_t *generator = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_generator_set_number_of_sources(
+	          generator,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_set_number_of_sources(
+	          NULL,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_generator_get_uncompressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_get_uncompressed_data_size(
+     void )
+{
+	libagdb_error_t *error          = NULL;
+	libagdb_generator_t *generator  = NULL;
+	uint32_t uncompressed_data_size = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_generator_get_uncompressed_data_size(
+	          generator,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (uint32_t) 476 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_get_uncompressed_data_size(
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_generator_get_uncompressed_data_size(
+	          generator,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_generator_get_file_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_get_file_size(
+     void )
+{
+	libagdb_error_t *error         = NULL;
+	libagdb_generator_t *generator = NULL;
+	size64_t file_size             = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_generator_get_file_size(
+	          generator,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) 476 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_get_file_size(
+	          NULL,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_generator_get_file_size(
+	          generator,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Writes a generated file to a memory range and opens it
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_write_file_io_handle_with_file_type(
+     uint8_t file_type,
+     uint8_t number_of_bits )
+{
+	libagdb_error_t *error                       = NULL;
+	libagdb_file_t *file                         = NULL;
+	libagdb_generator_t *generator               = NULL;
+	libbfio_handle_t *file_io_handle             = NULL;
+	uint8_t *data                                = NULL;
+	size64_t file_size                           = 0;
+	uint32_t expected_uncompressed_data_size     = 0;
+	uint32_t uncompressed_data_size              = 0;
+	uint8_t generated_file_type                  = 0;
+	int number_of_sources                        = 0;
+	int number_of_volumes                        = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_file_type(
+	          generator,
+	          file_type,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_number_of_bits(
+	          generator,
+	          number_of_bits,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_number_of_volumes(
+	          generator,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_number_of_files(
+	          generator,
+	          3,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_number_of_sub_entries(
+	          generator,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_number_of_sources(
+	          generator,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_get_uncompressed_data_size(
+	          generator,
+	          &expected_uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_get_file_size(
+	          generator,
+	          &file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) file_size );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          (size_t) file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test write
+	 */
+	result = libagdb_generator_write_file_io_handle(
+	          generator,
+	          file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_write_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_generator_write_file_io_handle(
+	          generator,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the generated file can be read
+	 */
+	result = agdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          (size_t) file_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_file_type(
+	          file,
+	          &generated_file_type,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "generated_file_type",
+	 generated_file_type,
+	 file_type );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_uncompressed_data_size(
+	          file,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 expected_uncompressed_data_size );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Writes a generated file and opens it
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_generator_write_with_file_type(
+     uint8_t file_type,
+     uint8_t number_of_bits )
+{
+	libagdb_error_t *error                     = NULL;
+	libagdb_file_t *file                       = NULL;
+	libagdb_generator_t *generator             = NULL;
+	libagdb_volume_information_t *volume       = NULL;
+	const char *filename                       = "agdb_test_generator.agdb";
+	uint8_t generated_file_type                = 0;
+	int number_of_files                        = 0;
+	int number_of_sources                      = 0;
+	int number_of_volumes                      = 0;
+	int result                                 = 0;
+	int volume_index                           = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_generator_initialize(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_file_type(
+	          generator,
+	          file_type,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_number_of_bits(
+	          generator,
+	          number_of_bits,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_number_of_volumes(
+	          generator,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_number_of_files(
+	          generator,
+	          3,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_set_number_of_sources(
+	          generator,
+	          4,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test write
+	 */
+	result = libagdb_generator_write(
+	          generator,
+	          filename,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_generator_write(
+	          NULL,
+	          filename,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_generator_write(
+	          generator,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if the generated file can be opened
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_open(
+	          file,
+	          filename,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_file_type(
+	          file,
+	          &generated_file_type,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "generated_file_type",
+	 generated_file_type,
+	 file_type );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		volume = NULL;
+
+		result = libagdb_file_get_volume_information(
+		          file,
+		          volume_index,
+		          &volume,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_volume_information_get_number_of_files(
+		          volume,
+		          &number_of_files,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_files",
+		 number_of_files,
+		 3 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 4 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_generator_free(
+	          &generator,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generator",
+	 generator );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = remove(
+	          filename );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( generator != NULL )
+	{
+		libagdb_generator_free(
+		 &generator,
+		 NULL );
+	}
+	remove(
+	 filename );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_initialize",
+	 agdb_test_generator_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_free",
+	 agdb_test_generator_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_set_file_type",
+	 agdb_test_generator_set_file_type );
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_set_number_of_bits",
+	 agdb_test_generator_set_number_of_bits );
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_set_number_of_volumes",
+	 agdb_test_generator_set_number_of_volumes );
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_set_number_of_files",
+	 agdb_test_generator_set_number_of_files );
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_set_number_of_sub_entries",
+	 agdb_test_generator_set_number_of_sub_entries );
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_set_number_of_sources",
+	 agdb_test_generator_set_number_of_sources );
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_get_uncompressed_data_size",
+	 agdb_test_generator_get_uncompressed_data_size );
+
+	AGDB_TEST_RUN(
+	 "libagdb_generator_get_file_size",
+	 agdb_test_generator_get_file_size );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write",
+	 agdb_test_generator_write_with_file_type,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write",
+	 agdb_test_generator_write_with_file_type,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write",
+	 agdb_test_generator_write_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write",
+	 agdb_test_generator_write_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write",
+	 agdb_test_generator_write_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write",
+	 agdb_test_generator_write_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 64 );
+
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write_file_io_handle",
+	 agdb_test_generator_write_file_io_handle_with_file_type,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write_file_io_handle",
+	 agdb_test_generator_write_file_io_handle_with_file_type,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write_file_io_handle",
+	 agdb_test_generator_write_file_io_handle_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write_file_io_handle",
+	 agdb_test_generator_write_file_io_handle_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write_file_io_handle",
+	 agdb_test_generator_write_file_io_handle_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_generator_write_file_io_handle",
+	 agdb_test_generator_write_file_io_handle_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 64 );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -301,6 +301,8 @@ int agdb_test_io_handle_clear(
 
 	/* Test regular cases
 	 */
+	io_handle->validation_level = LIBAGDB_VALIDATION_LEVEL_STRICT;
+
 	result = libagdb_io_handle_clear(
 	          io_handle,
 	          &error );
@@ -314,6 +316,11 @@ int agdb_test_io_handle_clear(
 	 "error",
 	 error );
 
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->validation_level",
+	 io_handle->validation_level,
+	 LIBAGDB_VALIDATION_LEVEL_STRICT );
+
 	/* Test error cases
 	 */
 	result = libagdb_io_handle_clear(
@@ -398,6 +405,395 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libagdb_io_handle_set_layouts function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_io_handle_set_layouts(
+     void )
+{
+	libagdb_io_handle_t *io_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_header_signature         = 0x0000000eUL;
+	io_handle->volume_information_entry_size = 56;
+	io_handle->file_information_entry_size   = 52;
+	io_handle->source_information_entry_size = 1;
+
+	/* Test regular cases
+	 */
+	result = libagdb_io_handle_set_layouts(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle->volume_information_layout",
+	 io_handle->volume_information_layout );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle->file_information_layout",
+	 io_handle->file_information_layout );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle->source_information_layout",
+	 io_handle->source_information_layout );
+
+	/* Test error cases
+	 */
+	result = libagdb_io_handle_set_layouts(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_io_handle_check_padding_data function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_io_handle_check_padding_data(
+     void )
+{
+	uint8_t padding_data[ 8 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error  = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_io_handle_check_padding_data(
+	          padding_data,
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	padding_data[ 7 ] = 0xff;
+
+	result = libagdb_io_handle_check_padding_data(
+	          padding_data,
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_io_handle_check_padding_data(
+	          NULL,
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_io_handle_check_padding_data(
+	          padding_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_io_handle_get_mapped_data function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_io_handle_get_mapped_data(
+     void )
+{
+	uint8_t mapped_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+		0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	const uint8_t *data            = NULL;
+	libagdb_io_handle_t *io_handle = NULL;
+	libcerror_error_t *error       = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          0,
+	          4,
+	          &data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_set_mapped_data(
+	          io_handle,
+	          mapped_data,
+	          16,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          12,
+	          4,
+	          &data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "data[ 0 ]",
+	 (int) data[ 0 ],
+	 0x0c );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_io_handle_get_mapped_data(
+	          NULL,
+	          0,
+	          4,
+	          &data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          0,
+	          4,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_io_handle_get_mapped_data(
+	          io_handle,
+	          13,
+	          4,
+	          &data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +825,18 @@ int main(
 	 "libagdb_io_handle_clear",
 	 agdb_test_io_handle_clear );
 
+	AGDB_TEST_RUN(
+	 "libagdb_io_handle_set_layouts",
+	 agdb_test_io_handle_set_layouts );
+
+	AGDB_TEST_RUN(
+	 "libagdb_io_handle_check_padding_data",
+	 agdb_test_io_handle_check_padding_data );
+
+	AGDB_TEST_RUN(
+	 "libagdb_io_handle_get_mapped_data",
+	 agdb_test_io_handle_get_mapped_data );
+
 	/* TODO: add tests for libagdb_io_handle_read_compressed_blocks */
 
 	/* TODO: add tests for libagdb_io_handle_read_uncompressed_file_header */
@@ -0,0 +1,385 @@
+/*
+ * Library layout functions test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_layout.h"
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_layout_get_volume_information_layout function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_layout_get_volume_information_layout(
+     void )
+{
+	const libagdb_volume_information_layout_t *layout = NULL;
+	libcerror_error_t *error                          = NULL;
+	int result                                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_layout_get_volume_information_layout(
+	          0x0000000eUL,
+	          56,
+	          &layout,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "layout",
+	 layout );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "layout->number_of_bits",
+	 layout->number_of_bits,
+	 32 );
+
+	result = libagdb_layout_get_volume_information_layout(
+	          0x0000000eUL,
+	          60,
+	          &layout,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "layout",
+	 layout );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_layout_get_volume_information_layout(
+	          0x00000000UL,
+	          56,
+	          &layout,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_layout_get_volume_information_layout(
+	          0x0000000eUL,
+	          56,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_layout_get_file_information_layout function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_layout_get_file_information_layout(
+     void )
+{
+	const libagdb_file_information_layout_t *layout = NULL;
+	libcerror_error_t *error                        = NULL;
+	int result                                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_layout_get_file_information_layout(
+	          0x0000000eUL,
+	          52,
+	          &layout,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "layout",
+	 layout );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "layout->number_of_bits",
+	 layout->number_of_bits,
+	 32 );
+
+	result = libagdb_layout_get_file_information_layout(
+	          0x0000000eUL,
+	          56,
+	          &layout,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "layout",
+	 layout );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_layout_get_file_information_layout(
+	          0x00000000UL,
+	          52,
+	          &layout,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_layout_get_file_information_layout(
+	          0x0000000eUL,
+	          52,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_layout_get_source_information_layout function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_layout_get_source_information_layout(
+     void )
+{
+	const libagdb_source_information_layout_t *layout = NULL;
+	libcerror_error_t *error                          = NULL;
+	int result                                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_layout_get_source_information_layout(
+	          0x0000000fUL,
+	          144,
+	          &layout,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "layout",
+	 layout );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "layout->number_of_bits",
+	 layout->number_of_bits,
+	 64 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "layout->prefetch_hash_offset",
+	 layout->prefetch_hash_offset,
+	 24 );
+
+	result = libagdb_layout_get_source_information_layout(
+	          0x0000000fUL,
+	          88,
+	          &layout,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "layout",
+	 layout );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_layout_get_source_information_layout(
+	          0x00000000UL,
+	          144,
+	          &layout,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_layout_get_source_information_layout(
+	          0x0000000fUL,
+	          144,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_layout_get_volume_information_layout",
+	 agdb_test_layout_get_volume_information_layout );
+
+	AGDB_TEST_RUN(
+	 "libagdb_layout_get_file_information_layout",
+	 agdb_test_layout_get_file_information_layout );
+
+	AGDB_TEST_RUN(
+	 "libagdb_layout_get_source_information_layout",
+	 agdb_test_layout_get_source_information_layout );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,594 @@
+/*
+ * Library parse cache type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+/* Tests the libagdb_parse_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_parse_cache_initialize(
+     void )
+{
+	libagdb_error_t *error             = NULL;
+	libagdb_parse_cache_t *parse_cache = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_parse_cache_initialize(
+	          &parse_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_cache",
+	 parse_cache );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_parse_cache_free(
+	          &parse_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "parse_cache",
+	 parse_cache );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_parse_cache_initialize(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	parse_cache = (libagdb_parse_cache_t *) 0x12345678UL;
+
+	result = libagdb_parse_cache_initialize(
+	          &parse_cache,
+	          &error );
+
+	parse_cache = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libagdb_error_free(
+		 &error );
+	}
+	if( parse_cache != NULL )
+	{
+		libagdb_parse_cache_free(
+		 &parse_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_parse_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_parse_cache_free(
+     void )
+{
+	libagdb_error_t *error = NULL;
+	int result             = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_parse_cache_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libagdb_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_parse_cache_set_maximum_memory_size and libagdb_parse_cache_get_memory_size functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_parse_cache_memory_size(
+     void )
+{
+	libagdb_error_t *error             = NULL;
+	libagdb_parse_cache_t *parse_cache = NULL;
+	size64_t memory_size               = 0;
+	int number_of_files                = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_parse_cache_initialize(
+	          &parse_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_parse_cache_set_maximum_memory_size(
+	          parse_cache,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_parse_cache_get_memory_size(
+	          parse_cache,
+	          &memory_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_size",
+	 (uint64_t) memory_size,
+	 (uint64_t) 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_parse_cache_get_number_of_files(
+	          parse_cache,
+	          &number_of_files,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_parse_cache_set_maximum_memory_size(
+	          NULL,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_parse_cache_get_memory_size(
+	          parse_cache,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_parse_cache_get_number_of_files(
+	          parse_cache,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_parse_cache_free(
+	          &parse_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libagdb_error_free(
+		 &error );
+	}
+	if( parse_cache != NULL )
+	{
+		libagdb_parse_cache_free(
+		 &parse_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_parse_cache_open_file and libagdb_parse_cache_release_file functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_parse_cache_open_file(
+     void )
+{
+	libagdb_error_t *error             = NULL;
+	libagdb_file_t *file               = NULL;
+	libagdb_parse_cache_t *parse_cache = NULL;
+	int number_of_files                = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_parse_cache_initialize(
+	          &parse_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_parse_cache_open_file(
+	          NULL,
+	          "missing.db",
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_parse_cache_open_file(
+	          parse_cache,
+	          NULL,
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_parse_cache_open_file(
+	          parse_cache,
+	          "missing.db",
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	/* Test with a file that does not exist
+	 */
+	result = libagdb_parse_cache_open_file(
+	          parse_cache,
+	          "missing.db",
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_parse_cache_get_number_of_files(
+	          parse_cache,
+	          &number_of_files,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 0 );
+
+	/* Test releasing a file that was not opened using the parse cache
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libagdb_parse_cache_release_file(
+	          parse_cache,
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libagdb_parse_cache_release_file(
+	          parse_cache,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libagdb_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_parse_cache_free(
+	          &parse_cache,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libagdb_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( parse_cache != NULL )
+	{
+		libagdb_parse_cache_free(
+		 &parse_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	AGDB_TEST_RUN(
+	 "libagdb_parse_cache_initialize",
+	 agdb_test_parse_cache_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_parse_cache_free",
+	 agdb_test_parse_cache_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_parse_cache_set_maximum_memory_size",
+	 agdb_test_parse_cache_memory_size );
+
+	AGDB_TEST_RUN(
+	 "libagdb_parse_cache_open_file",
+	 agdb_test_parse_cache_open_file );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1242 @@
+/*
+ * Library path_index type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_libcdata.h"
+#include "../libagdb/libagdb_path_index.h"
+
+/* The paths, each followed by an end-of-string character
+ */
+uint8_t agdb_test_path_index_utf8_string[ 119 ] = {
+	'\\', 'W', 'I', 'N', 'D', 'O', 'W', 'S', '\\', 'S', 'Y', 'S', 'T', 'E', 'M', '3', '2', '\\',
+	'N', 'T', 'D', 'L', 'L', '.', 'D', 'L', 'L', 0,
+	'\\', 'U', 's', 'e', 'r', 's', '\\', 'T', 'e', 's', 't', '\\', 'A', 'p', 'p', 'D', 'a', 't',
+	'a', '\\', 'L', 'o', 'c', 'a', 'l', '\\', 'a', 'p', 'p', '.', 'e', 'x', 'e', 0,
+	'\\', 'W', 'I', 'N', 'D', 'O', 'W', 'S', '\\', 'E', 'X', 'P', 'L', 'O', 'R', 'E', 'R', '.',
+	'E', 'X', 'E', 0,
+	0,
+	'\\', 'U', 'S', 'E', 'R', 'S', '\\', 'T', 'E', 'S', 'T', '\\', 'A', 'P', 'P', 'D', 'A', 'T',
+	'A', '\\', 'R', 'O', 'A', 'M', 'I', 'N', 'G', '\\', 'X', '.', 'D', 'A', 'T', 0 };
+
+size_t agdb_test_path_index_utf8_string_offsets[ 5 ] = {
+	0, 28, 62, 84, 85 };
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Creates a sorted path index of the test paths
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_test_path_index_create(
+     libagdb_path_index_t **path_index,
+     libcerror_error_t **error )
+{
+	int result = 0;
+
+	result = libagdb_path_index_initialize(
+	          path_index,
+	          5,
+	          119,
+	          error );
+
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( *path_index )->utf8_string,
+	     agdb_test_path_index_utf8_string,
+	     119 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( *path_index )->utf8_string_offsets,
+	     agdb_test_path_index_utf8_string_offsets,
+	     sizeof( size_t ) * 5 ) == NULL )
+	{
+		return( -1 );
+	}
+	return( libagdb_path_index_sort(
+	         *path_index,
+	         error ) );
+}
+
+/* Tests the libagdb_path_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_index_initialize(
+     void )
+{
+	libagdb_path_index_t *path_index = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 4;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libagdb_path_index_initialize(
+	          &path_index,
+	          5,
+	          119,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "path_index",
+	 path_index );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "path_index->sorted_entry_indexes[ 4 ]",
+	 path_index->sorted_entry_indexes[ 4 ],
+	 4 );
+
+	result = libagdb_path_index_free(
+	          &path_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "path_index",
+	 path_index );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_index_initialize(
+	          &path_index,
+	          0,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "path_index",
+	 path_index );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_index_free(
+	          &path_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_path_index_initialize(
+	          NULL,
+	          5,
+	          119,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_index = (libagdb_path_index_t *) 0x12345678UL;
+
+	result = libagdb_path_index_initialize(
+	          &path_index,
+	          5,
+	          119,
+	          &error );
+
+	path_index = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_index_initialize(
+	          &path_index,
+	          -1,
+	          119,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_index_initialize(
+	          &path_index,
+	          5,
+	          4,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_path_index_initialize with malloc failing
+		 */
+		agdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libagdb_path_index_initialize(
+		          &path_index,
+		          5,
+		          119,
+		          &error );
+
+		if( agdb_test_malloc_attempts_before_fail != -1 )
+		{
+			agdb_test_malloc_attempts_before_fail = -1;
+
+			if( path_index != NULL )
+			{
+				libagdb_path_index_free(
+				 &path_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "path_index",
+			 path_index );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_path_index_initialize with memset failing
+		 */
+		agdb_test_memset_attempts_before_fail = test_number;
+
+		result = libagdb_path_index_initialize(
+		          &path_index,
+		          5,
+		          119,
+		          &error );
+
+		if( agdb_test_memset_attempts_before_fail != -1 )
+		{
+			agdb_test_memset_attempts_before_fail = -1;
+
+			if( path_index != NULL )
+			{
+				libagdb_path_index_free(
+				 &path_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "path_index",
+			 path_index );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_AGDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_index != NULL )
+	{
+		libagdb_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_path_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_path_index_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_path_index_compare_prefix function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_index_compare_prefix(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_path_index_compare_prefix(
+	          (uint8_t *) "\\WINDOWS\\EXPLORER.EXE",
+	          (uint8_t *) "\\windows\\",
+	          9,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_index_compare_prefix(
+	          (uint8_t *) "\\USERS",
+	          (uint8_t *) "\\WINDOWS",
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_index_compare_prefix(
+	          (uint8_t *) "\\WINDOWS",
+	          (uint8_t *) "\\WINDOWS\\",
+	          9,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_index_compare_prefix(
+	          (uint8_t *) "\\WINDOWS",
+	          (uint8_t *) "\\USERS",
+	          6,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_path_index_compare_prefix(
+	          NULL,
+	          (uint8_t *) "\\USERS",
+	          6,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_index_compare_prefix(
+	          (uint8_t *) "\\WINDOWS",
+	          NULL,
+	          6,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_path_index_match_glob function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_index_match_glob(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_path_index_match_glob(
+	          (uint8_t *) "\\WINDOWS\\SYSTEM32\\NTDLL.DLL",
+	          (uint8_t *) "\\windows\\*.dll",
+	          14,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_index_match_glob(
+	          (uint8_t *) "\\WINDOWS\\SYSTEM32\\NTDLL.DLL",
+	          (uint8_t *) "*\\NT??L.*",
+	          9,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_index_match_glob(
+	          (uint8_t *) "\\CAF\xc3\xa9",
+	          (uint8_t *) "\\CAF?",
+	          5,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_index_match_glob(
+	          (uint8_t *) "\\WINDOWS\\EXPLORER.EXE",
+	          (uint8_t *) "\\WINDOWS\\*.DLL",
+	          14,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_path_index_match_glob(
+	          (uint8_t *) "\\WINDOWS",
+	          (uint8_t *) "\\WINDOWS?",
+	          9,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_path_index_match_glob(
+	          NULL,
+	          (uint8_t *) "*",
+	          1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_index_match_glob(
+	          (uint8_t *) "\\WINDOWS",
+	          NULL,
+	          1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_path_index_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_index_sort(
+     void )
+{
+	libagdb_path_index_t *path_index = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = agdb_test_path_index_create(
+	          &path_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "path_index->sorted_entry_indexes[ 0 ]",
+	 path_index->sorted_entry_indexes[ 0 ],
+	 3 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "path_index->sorted_entry_indexes[ 1 ]",
+	 path_index->sorted_entry_indexes[ 1 ],
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "path_index->sorted_entry_indexes[ 2 ]",
+	 path_index->sorted_entry_indexes[ 2 ],
+	 4 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "path_index->sorted_entry_indexes[ 3 ]",
+	 path_index->sorted_entry_indexes[ 3 ],
+	 2 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "path_index->sorted_entry_indexes[ 4 ]",
+	 path_index->sorted_entry_indexes[ 4 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_path_index_sort(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_index->utf8_string_offsets[ 0 ] = 119;
+
+	result = libagdb_path_index_sort(
+	          path_index,
+	          &error );
+
+	path_index->utf8_string_offsets[ 0 ] = 0;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_path_index_free(
+	          &path_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_index != NULL )
+	{
+		libagdb_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_path_index_get_entry_indexes_by_prefix function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_index_get_entry_indexes_by_prefix(
+     void )
+{
+	int entry_indexes[ 5 ];
+
+	libagdb_path_index_t *path_index = NULL;
+	libcerror_error_t *error         = NULL;
+	int number_of_matches            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_path_index_create(
+	          &path_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_path_index_get_entry_indexes_by_prefix(
+	          path_index,
+	          (uint8_t *) "\\users\\test\\appdata\\",
+	          20,
+	          entry_indexes,
+	          5,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 2 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_indexes[ 0 ]",
+	 entry_indexes[ 0 ],
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_indexes[ 1 ]",
+	 entry_indexes[ 1 ],
+	 4 );
+
+	result = libagdb_path_index_get_entry_indexes_by_prefix(
+	          path_index,
+	          (uint8_t *) "\\WINDOWS\\",
+	          9,
+	          NULL,
+	          0,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 2 );
+
+	result = libagdb_path_index_get_entry_indexes_by_prefix(
+	          path_index,
+	          (uint8_t *) "",
+	          0,
+	          entry_indexes,
+	          5,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 5 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_indexes[ 4 ]",
+	 entry_indexes[ 4 ],
+	 0 );
+
+	result = libagdb_path_index_get_entry_indexes_by_prefix(
+	          path_index,
+	          (uint8_t *) "\\PROGRAM FILES\\",
+	          15,
+	          entry_indexes,
+	          5,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_path_index_get_entry_indexes_by_prefix(
+	          NULL,
+	          (uint8_t *) "\\WINDOWS\\",
+	          9,
+	          entry_indexes,
+	          5,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_index_get_entry_indexes_by_prefix(
+	          path_index,
+	          (uint8_t *) "\\WINDOWS\\",
+	          9,
+	          NULL,
+	          5,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_index_get_entry_indexes_by_prefix(
+	          path_index,
+	          (uint8_t *) "\\WINDOWS\\",
+	          9,
+	          entry_indexes,
+	          5,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_path_index_free(
+	          &path_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_index != NULL )
+	{
+		libagdb_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_path_index_get_entry_indexes_by_glob function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_path_index_get_entry_indexes_by_glob(
+     void )
+{
+	int entry_indexes[ 5 ];
+
+	libagdb_path_index_t *path_index = NULL;
+	libcerror_error_t *error         = NULL;
+	int number_of_matches            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_path_index_create(
+	          &path_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_path_index_get_entry_indexes_by_glob(
+	          path_index,
+	          (uint8_t *) "*.exe",
+	          5,
+	          entry_indexes,
+	          5,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 2 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_indexes[ 0 ]",
+	 entry_indexes[ 0 ],
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_indexes[ 1 ]",
+	 entry_indexes[ 1 ],
+	 2 );
+
+	result = libagdb_path_index_get_entry_indexes_by_glob(
+	          path_index,
+	          (uint8_t *) "\\Users\\*\\AppData\\Roaming\\*",
+	          26,
+	          entry_indexes,
+	          1,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_indexes[ 0 ]",
+	 entry_indexes[ 0 ],
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libagdb_path_index_get_entry_indexes_by_glob(
+	          NULL,
+	          (uint8_t *) "*.exe",
+	          5,
+	          entry_indexes,
+	          5,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_path_index_get_entry_indexes_by_glob(
+	          path_index,
+	          (uint8_t *) "*.exe",
+	          5,
+	          entry_indexes,
+	          -1,
+	          &number_of_matches,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_path_index_free(
+	          &path_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_index != NULL )
+	{
+		libagdb_path_index_free(
+		 &path_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_index_initialize",
+	 agdb_test_path_index_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_index_free",
+	 agdb_test_path_index_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_index_compare_prefix",
+	 agdb_test_path_index_compare_prefix );
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_index_match_glob",
+	 agdb_test_path_index_match_glob );
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_index_sort",
+	 agdb_test_path_index_sort );
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_index_get_entry_indexes_by_prefix",
+	 agdb_test_path_index_get_entry_indexes_by_prefix );
+
+	AGDB_TEST_RUN(
+	 "libagdb_path_index_get_entry_indexes_by_glob",
+	 agdb_test_path_index_get_entry_indexes_by_glob );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
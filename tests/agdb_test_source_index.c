@@ -0,0 +1,1002 @@
+/*
+ * Library source_index type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_source_index.h"
+
+/* The prefetch hashes of the test entries
+ */
+uint32_t agdb_test_source_index_prefetch_hashes[ 4 ] = {
+	0x12345678UL, 0x9abcdef0UL, 0x12345678UL, 0x00000001UL };
+
+/* The executable filenames of the test entries
+ */
+const char *agdb_test_source_index_executable_filenames[ 4 ] = {
+	"NOTEPAD.EXE", "CALC.EXE", "notepad.exe", "" };
+
+/* The executable filename lengths of the test entries
+ */
+size_t agdb_test_source_index_executable_filename_lengths[ 4 ] = {
+	11, 8, 11, 0 };
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Creates a source index of the test entries
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_test_source_index_create(
+     libagdb_source_index_t **source_index,
+     libcerror_error_t **error )
+{
+	int entry_index = 0;
+	int result      = 0;
+
+	result = libagdb_source_index_initialize(
+	          source_index,
+	          4,
+	          error );
+
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	for( entry_index = 3;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		result = libagdb_source_index_insert_entry(
+		          *source_index,
+		          entry_index,
+		          agdb_test_source_index_prefetch_hashes[ entry_index ],
+		          (uint8_t *) agdb_test_source_index_executable_filenames[ entry_index ],
+		          agdb_test_source_index_executable_filename_lengths[ entry_index ],
+		          error );
+
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libagdb_source_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_index_initialize(
+     void )
+{
+	libagdb_source_index_t *source_index = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 8;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libagdb_source_index_initialize(
+	          &source_index,
+	          4,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "source_index",
+	 source_index );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "source_index->number_of_buckets",
+	 source_index->number_of_buckets,
+	 8 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "source_index->prefetch_hash_buckets[ 7 ]",
+	 source_index->prefetch_hash_buckets[ 7 ],
+	 -1 );
+
+	result = libagdb_source_index_free(
+	          &source_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "source_index",
+	 source_index );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_source_index_initialize(
+	          &source_index,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "source_index",
+	 source_index );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_source_index_free(
+	          &source_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_source_index_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	source_index = (libagdb_source_index_t *) 0x12345678UL;
+
+	result = libagdb_source_index_initialize(
+	          &source_index,
+	          4,
+	          &error );
+
+	source_index = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_index_initialize(
+	          &source_index,
+	          -1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_source_index_initialize with malloc failing
+		 */
+		agdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libagdb_source_index_initialize(
+		          &source_index,
+		          4,
+		          &error );
+
+		if( agdb_test_malloc_attempts_before_fail != -1 )
+		{
+			agdb_test_malloc_attempts_before_fail = -1;
+
+			if( source_index != NULL )
+			{
+				libagdb_source_index_free(
+				 &source_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "source_index",
+			 source_index );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_source_index_initialize with memset failing
+		 */
+		agdb_test_memset_attempts_before_fail = test_number;
+
+		result = libagdb_source_index_initialize(
+		          &source_index,
+		          4,
+		          &error );
+
+		if( agdb_test_memset_attempts_before_fail != -1 )
+		{
+			agdb_test_memset_attempts_before_fail = -1;
+
+			if( source_index != NULL )
+			{
+				libagdb_source_index_free(
+				 &source_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "source_index",
+			 source_index );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_AGDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_index != NULL )
+	{
+		libagdb_source_index_free(
+		 &source_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_source_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_source_index_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_source_index_get_executable_filename_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_index_get_executable_filename_hash(
+     void )
+{
+	uint32_t hash_value = 0;
+
+	/* Test regular cases
+	 */
+	hash_value = libagdb_source_index_get_executable_filename_hash(
+	              (uint8_t *) "",
+	              0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_value",
+	 hash_value,
+	 (uint32_t) 0x811c9dc5UL );
+
+	hash_value = libagdb_source_index_get_executable_filename_hash(
+	              (uint8_t *) "notepad.exe",
+	              11 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_value",
+	 hash_value,
+	 libagdb_source_index_get_executable_filename_hash(
+	  (uint8_t *) "NOTEPAD.EXE",
+	  11 ) );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libagdb_source_index_insert_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_index_insert_entry(
+     void )
+{
+	libagdb_source_index_t *source_index = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_source_index_initialize(
+	          &source_index,
+	          4,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_source_index_insert_entry(
+	          source_index,
+	          1,
+	          0x9abcdef0UL,
+	          (uint8_t *) "calc.exe",
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "source_index->prefetch_hashes[ 1 ]",
+	 source_index->prefetch_hashes[ 1 ],
+	 (uint32_t) 0x9abcdef0UL );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "source_index->executable_filename_lengths[ 1 ]",
+	 (int) source_index->executable_filename_lengths[ 1 ],
+	 8 );
+
+	result = memory_compare(
+	          &( source_index->executable_filenames[ 16 ] ),
+	          "CALC.EXE",
+	          8 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_source_index_insert_entry(
+	          NULL,
+	          1,
+	          0x9abcdef0UL,
+	          (uint8_t *) "calc.exe",
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_index_insert_entry(
+	          source_index,
+	          4,
+	          0x9abcdef0UL,
+	          (uint8_t *) "calc.exe",
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_index_insert_entry(
+	          source_index,
+	          1,
+	          0x9abcdef0UL,
+	          NULL,
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_index_insert_entry(
+	          source_index,
+	          1,
+	          0x9abcdef0UL,
+	          (uint8_t *) "calc.exe",
+	          17,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_source_index_free(
+	          &source_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_index != NULL )
+	{
+		libagdb_source_index_free(
+		 &source_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_source_index_get_entry_index_by_prefetch_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_index_get_entry_index_by_prefetch_hash(
+     void )
+{
+	libagdb_source_index_t *source_index = NULL;
+	libcerror_error_t *error             = NULL;
+	int entry_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_source_index_create(
+	          &source_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_source_index_get_entry_index_by_prefetch_hash(
+	          source_index,
+	          0x12345678UL,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libagdb_source_index_get_entry_index_by_prefetch_hash(
+	          source_index,
+	          0x00000001UL,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 3 );
+
+	result = libagdb_source_index_get_entry_index_by_prefetch_hash(
+	          source_index,
+	          0xdeadbeefUL,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_source_index_get_entry_index_by_prefetch_hash(
+	          NULL,
+	          0x12345678UL,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_index_get_entry_index_by_prefetch_hash(
+	          source_index,
+	          0x12345678UL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_source_index_free(
+	          &source_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_index != NULL )
+	{
+		libagdb_source_index_free(
+		 &source_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_source_index_get_entry_index_by_executable_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_index_get_entry_index_by_executable_filename(
+     void )
+{
+	libagdb_source_index_t *source_index = NULL;
+	libcerror_error_t *error             = NULL;
+	int entry_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_source_index_create(
+	          &source_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_source_index_get_entry_index_by_executable_filename(
+	          source_index,
+	          (uint8_t *) "Notepad.exe",
+	          11,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libagdb_source_index_get_entry_index_by_executable_filename(
+	          source_index,
+	          (uint8_t *) "calc.exe",
+	          8,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	result = libagdb_source_index_get_entry_index_by_executable_filename(
+	          source_index,
+	          (uint8_t *) "calc.ex",
+	          7,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_source_index_get_entry_index_by_executable_filename(
+	          source_index,
+	          (uint8_t *) "",
+	          0,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_source_index_get_entry_index_by_executable_filename(
+	          NULL,
+	          (uint8_t *) "calc.exe",
+	          8,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_index_get_entry_index_by_executable_filename(
+	          source_index,
+	          NULL,
+	          8,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_source_index_get_entry_index_by_executable_filename(
+	          source_index,
+	          (uint8_t *) "calc.exe",
+	          8,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_source_index_free(
+	          &source_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_index != NULL )
+	{
+		libagdb_source_index_free(
+		 &source_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_source_index_initialize",
+	 agdb_test_source_index_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_source_index_free",
+	 agdb_test_source_index_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_source_index_get_executable_filename_hash",
+	 agdb_test_source_index_get_executable_filename_hash );
+
+	AGDB_TEST_RUN(
+	 "libagdb_source_index_insert_entry",
+	 agdb_test_source_index_insert_entry );
+
+	AGDB_TEST_RUN(
+	 "libagdb_source_index_get_entry_index_by_prefetch_hash",
+	 agdb_test_source_index_get_entry_index_by_prefetch_hash );
+
+	AGDB_TEST_RUN(
+	 "libagdb_source_index_get_entry_index_by_executable_filename",
+	 agdb_test_source_index_get_entry_index_by_executable_filename );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
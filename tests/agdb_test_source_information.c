@@ -21,12 +21,14 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "agdb_test_functions.h"
 #include "agdb_test_libagdb.h"
 #include "agdb_test_libcerror.h"
 #include "agdb_test_macros.h"
@@ -848,6 +850,339 @@ on_error:
 
 #endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
 
+/* Tests the libagdb_file_get_source_summaries function against the source information with generated data
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_source_information_get_source_summaries(
+     uint8_t file_type,
+     uint8_t number_of_bits )
+{
+	libagdb_source_summary_t source_summaries[ 2 ];
+
+	libagdb_file_t *file                             = NULL;
+	libagdb_source_information_t *source_information = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint8_t *data                                    = NULL;
+	size_t data_size                                 = 0;
+	size_t utf8_executable_filename_size             = 0;
+	uint32_t prefetch_hash                           = 0;
+	int number_of_sources                            = 0;
+	int result                                       = 0;
+	int source_index                                 = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_generate_data(
+	          file_type,
+	          number_of_bits,
+	          &data,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          data_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_file_get_source_summaries(
+	          file,
+	          source_summaries,
+	          2,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		source_information = NULL;
+
+		result = libagdb_file_get_source_information(
+		          file,
+		          source_index,
+		          &source_information,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_source_information_get_prefetch_hash(
+		          source_information,
+		          &prefetch_hash,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_UINT32(
+		 "source_summaries[ source_index ].prefetch_hash",
+		 source_summaries[ source_index ].prefetch_hash,
+		 prefetch_hash );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Only the Vista and Windows 7 source information entries contain the executable filename
+		 */
+		if( ( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0 )
+		 || ( file_type == LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1 ) )
+		{
+			utf8_executable_filename_size = 1;
+		}
+		else
+		{
+			result = libagdb_source_information_get_utf8_executable_filename_size(
+			          source_information,
+			          &utf8_executable_filename_size,
+			          &error );
+
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		AGDB_TEST_ASSERT_EQUAL_SIZE(
+		 "source_summaries[ source_index ].utf8_executable_filename_size",
+		 source_summaries[ source_index ].utf8_executable_filename_size,
+		 utf8_executable_filename_size );
+	}
+	/* Test with fewer summaries than sources
+	 */
+	result = libagdb_file_get_source_summaries(
+	          file,
+	          source_summaries,
+	          1,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_source_summaries(
+	          file,
+	          NULL,
+	          0,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_file_get_source_summaries(
+	          NULL,
+	          source_summaries,
+	          2,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_source_summaries(
+	          file,
+	          source_summaries,
+	          -1,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_source_summaries(
+	          file,
+	          NULL,
+	          2,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_file_get_source_summaries(
+	          file,
+	          source_summaries,
+	          2,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -899,6 +1234,46 @@ int main(
 
 #endif /* defined( __GNUC__ ) && defined( TODO ) */
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_summaries",
+	 agdb_test_source_information_get_source_summaries,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_summaries",
+	 agdb_test_source_information_get_source_summaries,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_summaries",
+	 agdb_test_source_information_get_source_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_summaries",
+	 agdb_test_source_information_get_source_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_summaries",
+	 agdb_test_source_information_get_source_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_file_get_source_summaries",
+	 agdb_test_source_information_get_source_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 64 );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
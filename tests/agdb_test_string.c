@@ -0,0 +1,566 @@
+/*
+ * Library string functions test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_string.h"
+
+/* "\DEVICE\HARDDISKVOLUME2" followed by an end-of-string character
+ */
+uint8_t agdb_test_string_utf16_stream1[ 48 ] = {
+	0x5c, 0x00, 0x44, 0x00, 0x45, 0x00, 0x56, 0x00, 0x49, 0x00, 0x43, 0x00, 0x45, 0x00, 0x5c, 0x00,
+	0x48, 0x00, 0x41, 0x00, 0x52, 0x00, 0x44, 0x00, 0x44, 0x00, 0x49, 0x00, 0x53, 0x00, 0x4b, 0x00,
+	0x56, 0x00, 0x4f, 0x00, 0x4c, 0x00, 0x55, 0x00, 0x4d, 0x00, 0x45, 0x00, 0x32, 0x00, 0x00, 0x00 };
+
+/* "\CAF\xe9\WIN" followed by an end-of-string character
+ */
+uint8_t agdb_test_string_utf16_stream2[ 20 ] = {
+	0x5c, 0x00, 0x43, 0x00, 0x41, 0x00, 0x46, 0x00, 0xe9, 0x00, 0x5c, 0x00, 0x57, 0x00, 0x49, 0x00,
+	0x4e, 0x00, 0x00, 0x00 };
+
+/* "AB" followed by an end-of-string character and a non-ASCII character
+ */
+uint8_t agdb_test_string_utf16_stream3[ 8 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Tests the libagdb_string_get_utf16_stream_ascii_length function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_string_get_utf16_stream_ascii_length(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t ascii_length      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          agdb_test_string_utf16_stream1,
+	          48,
+	          &ascii_length,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 23 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream without end-of-string character
+	 */
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          agdb_test_string_utf16_stream1,
+	          46,
+	          &ascii_length,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 23 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream with non-ASCII characters after the end-of-string character
+	 */
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          agdb_test_string_utf16_stream3,
+	          8,
+	          &ascii_length,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream with non-ASCII characters
+	 */
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          agdb_test_string_utf16_stream2,
+	          20,
+	          &ascii_length,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream with an odd size
+	 */
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          agdb_test_string_utf16_stream1,
+	          47,
+	          &ascii_length,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          NULL,
+	          48,
+	          &ascii_length,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          agdb_test_string_utf16_stream1,
+	          (size_t) SSIZE_MAX + 1,
+	          &ascii_length,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_string_get_utf16_stream_ascii_length(
+	          agdb_test_string_utf16_stream1,
+	          48,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_string_get_utf8_string_size_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_string_get_utf8_string_size_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_string_get_utf8_string_size_from_utf16_stream(
+	          agdb_test_string_utf16_stream1,
+	          48,
+	          &utf8_string_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 24 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream with non-ASCII characters
+	 */
+	result = libagdb_string_get_utf8_string_size_from_utf16_stream(
+	          agdb_test_string_utf16_stream2,
+	          20,
+	          &utf8_string_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 11 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_string_get_utf8_string_size_from_utf16_stream(
+	          NULL,
+	          48,
+	          &utf8_string_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_string_get_utf8_string_size_from_utf16_stream(
+	          agdb_test_string_utf16_stream1,
+	          48,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_string_copy_utf8_string_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_string_copy_utf8_string_from_utf16_stream(
+     void )
+{
+	uint8_t expected_utf8_string[ 35 ] = {
+		'\\', 'D', 'E', 'V', 'I', 'C', 'E', '\\', 'H', 'A', 'R', 'D', 'D', 'I', 'S', 'K',
+		'V', 'O', 'L', 'U', 'M', 'E', '2', 0, '\\', 'C', 'A', 'F', 0xc3, 0xa9, '\\', 'W',
+		'I', 'N', 0 };
+
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_string_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          agdb_test_string_utf16_stream1,
+	          48,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 24 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_string_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          agdb_test_string_utf16_stream2,
+	          20,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 35 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          35 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libagdb_string_copy_utf8_string_from_utf16_stream(
+	          NULL,
+	          64,
+	          &utf8_string_index,
+	          agdb_test_string_utf16_stream1,
+	          48,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_string_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_index,
+	          agdb_test_string_utf16_stream1,
+	          48,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_string_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          64,
+	          NULL,
+	          agdb_test_string_utf16_stream1,
+	          48,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_string_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          NULL,
+	          48,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test UTF-8 string too small
+	 */
+	result = libagdb_string_copy_utf8_string_from_utf16_stream(
+	          utf8_string,
+	          23,
+	          &utf8_string_index,
+	          agdb_test_string_utf16_stream1,
+	          48,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_string_get_utf16_stream_ascii_length",
+	 agdb_test_string_get_utf16_stream_ascii_length );
+
+	AGDB_TEST_RUN(
+	 "libagdb_string_get_utf8_string_size_from_utf16_stream",
+	 agdb_test_string_get_utf8_string_size_from_utf16_stream );
+
+	AGDB_TEST_RUN(
+	 "libagdb_string_copy_utf8_string_from_utf16_stream",
+	 agdb_test_string_copy_utf8_string_from_utf16_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
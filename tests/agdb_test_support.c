@@ -447,6 +447,412 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+/* Tests the libagdb_check_file_signature_data function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_check_file_signature_data(
+     void )
+{
+	uint8_t compressed_data[ 8 ] = {
+		'M', 'A', 'M', 0x84, 0x00, 0x10, 0x00, 0x00 };
+	uint8_t uncompressed_data[ 8 ] = {
+		0x0e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00 };
+
+	libcerror_error_t *error        = NULL;
+	uint32_t uncompressed_data_size = 0;
+	uint8_t file_type               = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_check_file_signature_data(
+	          compressed_data,
+	          8,
+	          128,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "file_type",
+	 file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (uint32_t) 4096 );
+
+	result = libagdb_check_file_signature_data(
+	          uncompressed_data,
+	          8,
+	          512,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "file_type",
+	 file_type,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (uint32_t) 512 );
+
+	/* Test with a file size that does not match the uncompressed data size
+	 */
+	result = libagdb_check_file_signature_data(
+	          uncompressed_data,
+	          8,
+	          1024,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "file_type",
+	 file_type,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libagdb_check_file_signature_data(
+	          NULL,
+	          8,
+	          128,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_check_file_signature_data(
+	          compressed_data,
+	          4,
+	          128,
+	          &file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_check_file_signature_data(
+	          compressed_data,
+	          8,
+	          128,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_check_file_signature_data(
+	          compressed_data,
+	          8,
+	          128,
+	          &file_type,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_check_file_signature_data and libagdb_check_file_signature_file_io_handle
+ * functions with generated data of a specific file type
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_check_file_signature_data_with_file_type(
+     uint8_t file_type,
+     uint8_t number_of_bits )
+{
+	libagdb_file_t *file                     = NULL;
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_size                         = 0;
+	uint32_t expected_uncompressed_data_size = 0;
+	uint32_t uncompressed_data_size          = 0;
+	uint8_t signature_file_type              = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_generate_data(
+	          file_type,
+	          number_of_bits,
+	          &data,
+	          &data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          data_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_uncompressed_data_size(
+	          file,
+	          &expected_uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_check_file_signature_data(
+	          data,
+	          8,
+	          (size64_t) data_size,
+	          &signature_file_type,
+	          &uncompressed_data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "signature_file_type",
+	 signature_file_type,
+	 file_type );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 expected_uncompressed_data_size );
+
+	result = agdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          data_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_check_file_signature_file_io_handle(
+	          file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
 /* Tests the libagdb_check_file_signature_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
@@ -765,6 +1171,10 @@ int main(
 	 "libagdb_set_codepage",
 	 agdb_test_set_codepage );
 
+	AGDB_TEST_RUN(
+	 "libagdb_check_file_signature_data",
+	 agdb_test_check_file_signature_data );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	AGDB_TEST_RUN_WITH_ARGS(
@@ -786,6 +1196,42 @@ int main(
 	 agdb_test_check_file_signature_file_io_handle,
 	 source );
 
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_check_file_signature_data",
+	 agdb_test_check_file_signature_data_with_file_type,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_check_file_signature_data",
+	 agdb_test_check_file_signature_data_with_file_type,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_check_file_signature_data",
+	 agdb_test_check_file_signature_data_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_check_file_signature_data",
+	 agdb_test_check_file_signature_data_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_check_file_signature_data",
+	 agdb_test_check_file_signature_data_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_check_file_signature_data",
+	 agdb_test_check_file_signature_data_with_file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 64 );
+
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 
 	return( EXIT_SUCCESS );
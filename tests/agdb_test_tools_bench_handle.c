@@ -0,0 +1,771 @@
+/*
+ * Tools bench_handle type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../agdbtools/bench_handle.h"
+
+/* Tests the bench_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_bench_handle_initialize(
+     void )
+{
+	bench_handle_t *bench_handle    = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bench_handle_free(
+	          &bench_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = bench_handle_initialize(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	bench_handle = (bench_handle_t *) 0x12345678UL;
+
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	bench_handle = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test bench_handle_initialize with malloc failing
+		 */
+		agdb_test_malloc_attempts_before_fail = test_number;
+
+		result = bench_handle_initialize(
+		          &bench_handle,
+		          &error );
+
+		if( agdb_test_malloc_attempts_before_fail != -1 )
+		{
+			agdb_test_malloc_attempts_before_fail = -1;
+
+			if( bench_handle != NULL )
+			{
+				bench_handle_free(
+				 &bench_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "bench_handle",
+			 bench_handle );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test bench_handle_initialize with memset failing
+		 */
+		agdb_test_memset_attempts_before_fail = test_number;
+
+		result = bench_handle_initialize(
+		          &bench_handle,
+		          &error );
+
+		if( agdb_test_memset_attempts_before_fail != -1 )
+		{
+			agdb_test_memset_attempts_before_fail = -1;
+
+			if( bench_handle != NULL )
+			{
+				bench_handle_free(
+				 &bench_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "bench_handle",
+			 bench_handle );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_AGDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &bench_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_bench_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = bench_handle_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_get_current_time function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_bench_handle_get_current_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t current_time    = 0;
+	uint64_t previous_time   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = bench_handle_get_current_time(
+	          &previous_time,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bench_handle_get_current_time(
+	          &current_time,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "current_time",
+	 (int) ( current_time >= previous_time ),
+	 0 );
+
+	/* Test error cases
+	 */
+	result = bench_handle_get_current_time(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_set_number_of_iterations function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_bench_handle_set_number_of_iterations(
+     void )
+{
+	bench_handle_t *bench_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = bench_handle_set_number_of_iterations(
+	          bench_handle,
+	          _SYSTEM_STRING( "25" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->number_of_iterations",
+	 bench_handle->number_of_iterations,
+	 25 );
+
+	result = bench_handle_set_number_of_iterations(
+	          bench_handle,
+	          _SYSTEM_STRING( "0" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = bench_handle_set_number_of_iterations(
+	          bench_handle,
+	          _SYSTEM_STRING( "ten" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->number_of_iterations",
+	 bench_handle->number_of_iterations,
+	 25 );
+
+	/* Test error cases
+	 */
+	result = bench_handle_set_number_of_iterations(
+	          NULL,
+	          _SYSTEM_STRING( "25" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = bench_handle_set_number_of_iterations(
+	          bench_handle,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = bench_handle_free(
+	          &bench_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &bench_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the bench_handle_get_phase_from_trace_phase function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_bench_handle_get_phase_from_trace_phase(
+     void )
+{
+	int phase = 0;
+
+	/* Test regular cases
+	 */
+	phase = bench_handle_get_phase_from_trace_phase(
+	         LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "phase",
+	 phase,
+	 BENCH_HANDLE_PHASE_DECOMPRESS );
+
+	phase = bench_handle_get_phase_from_trace_phase(
+	         LIBAGDB_TRACE_PHASE_FILE_INFORMATION );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "phase",
+	 phase,
+	 BENCH_HANDLE_PHASE_FILE_PARSE );
+
+	phase = bench_handle_get_phase_from_trace_phase(
+	         LIBAGDB_TRACE_PHASE_OPEN_READ );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "phase",
+	 phase,
+	 -1 );
+
+	/* Test error cases
+	 */
+	phase = bench_handle_get_phase_from_trace_phase(
+	         -1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "phase",
+	 phase,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the bench_handle_trace_begin_callback and bench_handle_trace_end_callback functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_bench_handle_trace_callbacks(
+     void )
+{
+	bench_handle_t *bench_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = bench_handle_initialize(
+	          &bench_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	bench_handle_trace_begin_callback(
+	 (intptr_t *) bench_handle,
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_OPEN_READ,
+	 0,
+	 0,
+	 0,
+	 0 );
+
+	bench_handle_trace_begin_callback(
+	 (intptr_t *) bench_handle,
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_VOLUME_INFORMATION,
+	 0,
+	 0,
+	 0,
+	 0 );
+
+	bench_handle_trace_begin_callback(
+	 (intptr_t *) bench_handle,
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 2,
+	 0,
+	 0,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->trace_depth",
+	 bench_handle->trace_depth,
+	 3 );
+
+	bench_handle_trace_end_callback(
+	 (intptr_t *) bench_handle,
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 2,
+	 1,
+	 4096 );
+
+	bench_handle_trace_end_callback(
+	 (intptr_t *) bench_handle,
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_VOLUME_INFORMATION,
+	 0,
+	 1,
+	 0 );
+
+	bench_handle_trace_end_callback(
+	 (intptr_t *) bench_handle,
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_OPEN_READ,
+	 0,
+	 1,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->trace_depth",
+	 bench_handle->trace_depth,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->trace_number_of_blocks",
+	 bench_handle->trace_number_of_blocks,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT64(
+	 "bench_handle->trace_decompressed_data_size",
+	 bench_handle->trace_decompressed_data_size,
+	 (uint64_t) 4096 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "bench_handle->trace_slowest_block_index",
+	 bench_handle->trace_slowest_block_index,
+	 (uint32_t) 2 );
+
+	/* Test an unbalanced end callback
+	 */
+	bench_handle_trace_end_callback(
+	 (intptr_t *) bench_handle,
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_OPEN_READ,
+	 0,
+	 1,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "bench_handle->trace_depth",
+	 bench_handle->trace_depth,
+	 0 );
+
+	/* Test error cases
+	 */
+	bench_handle_trace_begin_callback(
+	 NULL,
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_OPEN_READ,
+	 0,
+	 0,
+	 0,
+	 0 );
+
+	bench_handle_trace_end_callback(
+	 NULL,
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_OPEN_READ,
+	 0,
+	 1,
+	 0 );
+
+	/* Clean up
+	 */
+	result = bench_handle_free(
+	          &bench_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "bench_handle",
+	 bench_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bench_handle != NULL )
+	{
+		bench_handle_free(
+		 &bench_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	AGDB_TEST_RUN(
+	 "bench_handle_initialize",
+	 agdb_test_tools_bench_handle_initialize );
+
+	AGDB_TEST_RUN(
+	 "bench_handle_free",
+	 agdb_test_tools_bench_handle_free );
+
+	AGDB_TEST_RUN(
+	 "bench_handle_get_current_time",
+	 agdb_test_tools_bench_handle_get_current_time );
+
+	AGDB_TEST_RUN(
+	 "bench_handle_set_number_of_iterations",
+	 agdb_test_tools_bench_handle_set_number_of_iterations );
+
+	AGDB_TEST_RUN(
+	 "bench_handle_get_phase_from_trace_phase",
+	 agdb_test_tools_bench_handle_get_phase_from_trace_phase );
+
+	AGDB_TEST_RUN(
+	 "bench_handle_trace_callbacks",
+	 agdb_test_tools_bench_handle_trace_callbacks );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
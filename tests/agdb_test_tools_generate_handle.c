@@ -0,0 +1,1792 @@
+/*
+ * Tools generate_handle type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../agdbtools/generate_handle.h"
+
+/* Tests the generate_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_initialize(
+     void )
+{
+	generate_handle_t *generate_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = generate_handle_initialize(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_free(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = generate_handle_initialize(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	generate_handle = (generate_handle_t *) 0x12345678UL;
+
+	result = generate_handle_initialize(
+	          &generate_handle,
+	          &error );
+
+	generate_handle = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test generate_handle_initialize with malloc failing
+		 */
+		agdb_test_malloc_attempts_before_fail = test_number;
+
+		result = generate_handle_initialize(
+		          &generate_handle,
+		          &error );
+
+		if( agdb_test_malloc_attempts_before_fail != -1 )
+		{
+			agdb_test_malloc_attempts_before_fail = -1;
+
+			if( generate_handle != NULL )
+			{
+				generate_handle_free(
+				 &generate_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "generate_handle",
+			 generate_handle );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test generate_handle_initialize with memset failing
+		 */
+		agdb_test_memset_attempts_before_fail = test_number;
+
+		result = generate_handle_initialize(
+		          &generate_handle,
+		          &error );
+
+		if( agdb_test_memset_attempts_before_fail != -1 )
+		{
+			agdb_test_memset_attempts_before_fail = -1;
+
+			if( generate_handle != NULL )
+			{
+				generate_handle_free(
+				 &generate_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "generate_handle",
+			 generate_handle );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_AGDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &generate_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the generate_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = generate_handle_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the generate_handle_set_file_type function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_set_file_type(
+     void )
+{
+	generate_handle_t *generate_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = generate_handle_initialize(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = generate_handle_set_file_type(
+	          generate_handle,
+	          _SYSTEM_STRING( "win7" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "generate_handle->file_type",
+	 generate_handle->file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 );
+
+	result = generate_handle_set_file_type(
+	          generate_handle,
+	          _SYSTEM_STRING( "win9" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_file_type(
+	          generate_handle,
+	          _SYSTEM_STRING( "memo" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "generate_handle->file_type",
+	 generate_handle->file_type,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 );
+
+	/* Test error cases
+	 */
+	result = generate_handle_set_file_type(
+	          NULL,
+	          _SYSTEM_STRING( "win7" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = generate_handle_set_file_type(
+	          generate_handle,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = generate_handle_free(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &generate_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the generate_handle_set_number_of_bits function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_set_number_of_bits(
+     void )
+{
+	generate_handle_t *generate_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = generate_handle_initialize(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = generate_handle_set_number_of_bits(
+	          generate_handle,
+	          _SYSTEM_STRING( "64" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "generate_handle->number_of_bits",
+	 generate_handle->number_of_bits,
+	 64 );
+
+	result = generate_handle_set_number_of_bits(
+	          generate_handle,
+	          _SYSTEM_STRING( "16" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_bits(
+	          generate_handle,
+	          _SYSTEM_STRING( "sixtyfour" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "generate_handle->number_of_bits",
+	 generate_handle->number_of_bits,
+	 64 );
+
+	/* Test error cases
+	 */
+	result = generate_handle_set_number_of_bits(
+	          NULL,
+	          _SYSTEM_STRING( "64" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = generate_handle_set_number_of_bits(
+	          generate_handle,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = generate_handle_free(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &generate_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the generate_handle_determine_number_value function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_determine_number_value(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t value_32bit     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = generate_handle_determine_number_value(
+	          _SYSTEM_STRING( "4294967295" ),
+	          &value_32bit,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xffffffffUL );
+
+	result = generate_handle_determine_number_value(
+	          _SYSTEM_STRING( "4294967296" ),
+	          &value_32bit,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_determine_number_value(
+	          _SYSTEM_STRING( "-1" ),
+	          &value_32bit,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xffffffffUL );
+
+	/* Test error cases
+	 */
+	result = generate_handle_determine_number_value(
+	          NULL,
+	          &value_32bit,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = generate_handle_determine_number_value(
+	          _SYSTEM_STRING( "1" ),
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the generate_handle_set_number_of_volumes function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_set_number_of_volumes(
+     void )
+{
+	generate_handle_t *generate_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = generate_handle_initialize(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = generate_handle_set_number_of_volumes(
+	          generate_handle,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "generate_handle->number_of_volumes",
+	 generate_handle->number_of_volumes,
+	 5 );
+
+	result = generate_handle_set_number_of_volumes(
+	          generate_handle,
+	          _SYSTEM_STRING( "4294967296" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_volumes(
+	          generate_handle,
+	          _SYSTEM_STRING( "five" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "generate_handle->number_of_volumes",
+	 generate_handle->number_of_volumes,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = generate_handle_set_number_of_volumes(
+	          NULL,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = generate_handle_set_number_of_volumes(
+	          generate_handle,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = generate_handle_free(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &generate_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the generate_handle_set_number_of_files function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_set_number_of_files(
+     void )
+{
+	generate_handle_t *generate_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = generate_handle_initialize(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = generate_handle_set_number_of_files(
+	          generate_handle,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "generate_handle->number_of_files",
+	 generate_handle->number_of_files,
+	 5 );
+
+	result = generate_handle_set_number_of_files(
+	          generate_handle,
+	          _SYSTEM_STRING( "4294967296" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_files(
+	          generate_handle,
+	          _SYSTEM_STRING( "five" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "generate_handle->number_of_files",
+	 generate_handle->number_of_files,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = generate_handle_set_number_of_files(
+	          NULL,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = generate_handle_set_number_of_files(
+	          generate_handle,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = generate_handle_free(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &generate_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the generate_handle_set_number_of_sub_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_set_number_of_sub_entries(
+     void )
+{
+	generate_handle_t *generate_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = generate_handle_initialize(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = generate_handle_set_number_of_sub_entries(
+	          generate_handle,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "generate_handle->number_of_sub_entries",
+	 generate_handle->number_of_sub_entries,
+	 5 );
+
+	result = generate_handle_set_number_of_sub_entries(
+	          generate_handle,
+	          _SYSTEM_STRING( "4294967296" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_sub_entries(
+	          generate_handle,
+	          _SYSTEM_STRING( "five" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "generate_handle->number_of_sub_entries",
+	 generate_handle->number_of_sub_entries,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = generate_handle_set_number_of_sub_entries(
+	          NULL,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = generate_handle_set_number_of_sub_entries(
+	          generate_handle,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = generate_handle_free(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &generate_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the generate_handle_set_number_of_sources function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_set_number_of_sources(
+     void )
+{
+	generate_handle_t *generate_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = generate_handle_initialize(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = generate_handle_set_number_of_sources(
+	          generate_handle,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "generate_handle->number_of_sources",
+	 generate_handle->number_of_sources,
+	 5 );
+
+	result = generate_handle_set_number_of_sources(
+	          generate_handle,
+	          _SYSTEM_STRING( "4294967296" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_sources(
+	          generate_handle,
+	          _SYSTEM_STRING( "five" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "generate_handle->number_of_sources",
+	 generate_handle->number_of_sources,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = generate_handle_set_number_of_sources(
+	          NULL,
+	          _SYSTEM_STRING( "5" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = generate_handle_set_number_of_sources(
+	          generate_handle,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = generate_handle_free(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &generate_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the generate_handle_write_file function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_generate_handle_write_file_with_file_type(
+     const system_character_t *file_type_string,
+     const system_character_t *number_of_bits_string,
+     uint8_t file_type )
+{
+	generate_handle_t *generate_handle   = NULL;
+	libagdb_file_t *file                 = NULL;
+	libagdb_volume_information_t *volume = NULL;
+	libcerror_error_t *error             = NULL;
+	const system_character_t *filename   = _SYSTEM_STRING( "agdb_test_tools_generate_handle.agdb" );
+	uint8_t generated_file_type          = 0;
+	int number_of_files                  = 0;
+	int number_of_sources                = 0;
+	int number_of_volumes                = 0;
+	int result                           = 0;
+	int volume_index                     = 0;
+
+	/* Initialize test
+	 */
+	result = generate_handle_initialize(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_file_type(
+	          generate_handle,
+	          file_type_string,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_bits(
+	          generate_handle,
+	          number_of_bits_string,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_volumes(
+	          generate_handle,
+	          _SYSTEM_STRING( "2" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_files(
+	          generate_handle,
+	          _SYSTEM_STRING( "3" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_sub_entries(
+	          generate_handle,
+	          _SYSTEM_STRING( "2" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = generate_handle_set_number_of_sources(
+	          generate_handle,
+	          _SYSTEM_STRING( "4" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = generate_handle_write_file(
+	          generate_handle,
+	          filename,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the generated file can be opened
+	 */
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libagdb_file_open_wide(
+	          file,
+	          filename,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#else
+	result = libagdb_file_open(
+	          file,
+	          filename,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+#endif
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_file_type(
+	          file,
+	          &generated_file_type,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "generated_file_type",
+	 generated_file_type,
+	 file_type );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 2 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		volume = NULL;
+
+		result = libagdb_file_get_volume_information(
+		          file,
+		          volume_index,
+		          &volume,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libagdb_volume_information_get_number_of_files(
+		          volume,
+		          &number_of_files,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_files",
+		 number_of_files,
+		 3 );
+
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libagdb_file_get_number_of_sources(
+	          file,
+	          &number_of_sources,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 4 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_close(
+	          file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = generate_handle_write_file(
+	          NULL,
+	          filename,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = generate_handle_free(
+	          &generate_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "generate_handle",
+	 generate_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = _wremove(
+	          filename );
+#else
+	result = remove(
+	          filename );
+#endif
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( generate_handle != NULL )
+	{
+		generate_handle_free(
+		 &generate_handle,
+		 NULL );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	_wremove(
+	 filename );
+#else
+	remove(
+	 filename );
+#endif
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+	AGDB_TEST_RUN(
+	 "generate_handle_initialize",
+	 agdb_test_tools_generate_handle_initialize );
+
+	AGDB_TEST_RUN(
+	 "generate_handle_free",
+	 agdb_test_tools_generate_handle_free );
+
+	AGDB_TEST_RUN(
+	 "generate_handle_set_file_type",
+	 agdb_test_tools_generate_handle_set_file_type );
+
+	AGDB_TEST_RUN(
+	 "generate_handle_set_number_of_bits",
+	 agdb_test_tools_generate_handle_set_number_of_bits );
+
+	AGDB_TEST_RUN(
+	 "generate_handle_determine_number_value",
+	 agdb_test_tools_generate_handle_determine_number_value );
+
+	AGDB_TEST_RUN(
+	 "generate_handle_set_number_of_volumes",
+	 agdb_test_tools_generate_handle_set_number_of_volumes );
+
+	AGDB_TEST_RUN(
+	 "generate_handle_set_number_of_files",
+	 agdb_test_tools_generate_handle_set_number_of_files );
+
+	AGDB_TEST_RUN(
+	 "generate_handle_set_number_of_sub_entries",
+	 agdb_test_tools_generate_handle_set_number_of_sub_entries );
+
+	AGDB_TEST_RUN(
+	 "generate_handle_set_number_of_sources",
+	 agdb_test_tools_generate_handle_set_number_of_sources );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "generate_handle_write_file",
+	 agdb_test_tools_generate_handle_write_file_with_file_type,
+	 _SYSTEM_STRING( "uncompressed" ),
+	 _SYSTEM_STRING( "32" ),
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "generate_handle_write_file",
+	 agdb_test_tools_generate_handle_write_file_with_file_type,
+	 _SYSTEM_STRING( "vista" ),
+	 _SYSTEM_STRING( "32" ),
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "generate_handle_write_file",
+	 agdb_test_tools_generate_handle_write_file_with_file_type,
+	 _SYSTEM_STRING( "win7" ),
+	 _SYSTEM_STRING( "64" ),
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "generate_handle_write_file",
+	 agdb_test_tools_generate_handle_write_file_with_file_type,
+	 _SYSTEM_STRING( "win8.0" ),
+	 _SYSTEM_STRING( "32" ),
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "generate_handle_write_file",
+	 agdb_test_tools_generate_handle_write_file_with_file_type,
+	 _SYSTEM_STRING( "win8.1" ),
+	 _SYSTEM_STRING( "64" ),
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1 );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -268,6 +269,353 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the info_handle_set_output_format function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_info_handle_set_output_format(
+     void )
+{
+	info_handle_t *info_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "info_handle",
+	 info_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = info_handle_set_output_format(
+	          info_handle,
+	          _SYSTEM_STRING( "ndjson" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "info_handle->output_format",
+	 info_handle->output_format,
+	 INFO_HANDLE_OUTPUT_FORMAT_NDJSON );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_set_output_format(
+	          info_handle,
+	          _SYSTEM_STRING( "json" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "info_handle->output_format",
+	 info_handle->output_format,
+	 INFO_HANDLE_OUTPUT_FORMAT_JSON );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_set_output_format(
+	          info_handle,
+	          _SYSTEM_STRING( "xml" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "info_handle->output_format",
+	 info_handle->output_format,
+	 INFO_HANDLE_OUTPUT_FORMAT_JSON );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = info_handle_set_output_format(
+	          NULL,
+	          _SYSTEM_STRING( "json" ),
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_set_output_format(
+	          info_handle,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "info_handle",
+	 info_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the info_handle_output_write_json_string function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_tools_info_handle_output_write_json_string(
+     void )
+{
+	uint8_t expected_json_string[ 20 ] = {
+		'"', 'C', ':', '\\', '\\', 'a', '\\', '"', 'b', '\\', 'n', '\\', 'u', '0', '0', '0', '1', 0xc3, 0xa9, '"' };
+
+	uint8_t expected_replaced_json_string[ 40 ] = {
+		'"', 'a', '\\', 'u', 'f', 'f', 'f', 'd', 'b', 0xc3, 0xa9, '\\', 'u', 'f', 'f', 'f', 'd',
+		'\\', 'u', 'f', 'f', 'f', 'd', '\\', 'u', 'f', 'f', 'f', 'd', 0xf0, 0x9f, 0x98, 0x80,
+		'\\', 'u', 'f', 'f', 'f', 'd', '"' };
+
+	uint8_t utf8_string[ 10 ] = {
+		'C', ':', '\\', 'a', '"', 'b', '\n', 0x01, 0xc3, 0xa9 };
+
+	/* Contains an invalid byte, a surrogate, a 4-byte sequence and a truncated sequence
+	 */
+	uint8_t invalid_utf8_string[ 13 ] = {
+		'a', 0xe9, 'b', 0xc3, 0xa9, 0xed, 0xa0, 0x80, 0xf0, 0x9f, 0x98, 0x80, 0xc3 };
+
+	info_handle_t *info_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "info_handle",
+	 info_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = info_handle_output_write_json_string(
+	          info_handle,
+	          utf8_string,
+	          10,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "info_handle->output_buffer_offset",
+	 info_handle->output_buffer_offset,
+	 (size_t) 20 );
+
+	result = memory_compare(
+	          info_handle->output_buffer,
+	          expected_json_string,
+	          20 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Discard the buffered output
+	 */
+	info_handle->output_buffer_offset = 0;
+
+	result = info_handle_output_write_json_string(
+	          info_handle,
+	          invalid_utf8_string,
+	          13,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "info_handle->output_buffer_offset",
+	 info_handle->output_buffer_offset,
+	 (size_t) 40 );
+
+	result = memory_compare(
+	          info_handle->output_buffer,
+	          expected_replaced_json_string,
+	          40 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	info_handle->output_buffer_offset = 0;
+
+	/* Test error cases
+	 */
+	result = info_handle_output_write_json_string(
+	          NULL,
+	          utf8_string,
+	          10,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_output_write_json_string(
+	          info_handle,
+	          NULL,
+	          10,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "info_handle",
+	 info_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -291,6 +639,14 @@ int main(
 	 "info_handle_free",
 	 agdb_test_tools_info_handle_free );
 
+	AGDB_TEST_RUN(
+	 "info_handle_set_output_format",
+	 agdb_test_tools_info_handle_set_output_format );
+
+	AGDB_TEST_RUN(
+	 "info_handle_output_write_json_string",
+	 agdb_test_tools_info_handle_output_write_json_string );
+
 	return( EXIT_SUCCESS );
 
 on_error:
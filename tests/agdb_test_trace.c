@@ -0,0 +1,379 @@
+/*
+ * Library trace functions test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_trace.h"
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* The number of begin and end callback invocations
+ */
+static int agdb_test_trace_number_of_begin_calls = 0;
+static int agdb_test_trace_number_of_end_calls   = 0;
+
+/* The last trace file, phase, index and result
+ */
+static libagdb_file_t *agdb_test_trace_last_file = NULL;
+static int agdb_test_trace_last_phase            = -1;
+static uint32_t agdb_test_trace_last_index       = 0;
+static int agdb_test_trace_last_result           = 0;
+
+/* Test trace begin callback
+ */
+void agdb_test_trace_begin_callback(
+      intptr_t *callback_data AGDB_TEST_ATTRIBUTE_UNUSED,
+      libagdb_file_t *file,
+      int trace_phase,
+      uint32_t trace_index,
+      uint8_t file_type AGDB_TEST_ATTRIBUTE_UNUSED,
+      off64_t offset AGDB_TEST_ATTRIBUTE_UNUSED,
+      size64_t size AGDB_TEST_ATTRIBUTE_UNUSED )
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( callback_data )
+	AGDB_TEST_UNREFERENCED_PARAMETER( file_type )
+	AGDB_TEST_UNREFERENCED_PARAMETER( offset )
+	AGDB_TEST_UNREFERENCED_PARAMETER( size )
+
+	agdb_test_trace_number_of_begin_calls++;
+
+	agdb_test_trace_last_file  = file;
+	agdb_test_trace_last_phase = trace_phase;
+	agdb_test_trace_last_index = trace_index;
+}
+
+/* Test trace end callback
+ */
+void agdb_test_trace_end_callback(
+      intptr_t *callback_data AGDB_TEST_ATTRIBUTE_UNUSED,
+      libagdb_file_t *file,
+      int trace_phase,
+      uint32_t trace_index,
+      int result,
+      size64_t size AGDB_TEST_ATTRIBUTE_UNUSED )
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( callback_data )
+	AGDB_TEST_UNREFERENCED_PARAMETER( size )
+
+	agdb_test_trace_number_of_end_calls++;
+
+	agdb_test_trace_last_file   = file;
+	agdb_test_trace_last_phase  = trace_phase;
+	agdb_test_trace_last_index  = trace_index;
+	agdb_test_trace_last_result = result;
+}
+
+/* Tests the libagdb_trace_callbacks_set function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_trace_callbacks_set(
+     void )
+{
+	libagdb_trace_callbacks_t trace_callbacks;
+
+	libcerror_error_t *error = NULL;
+	int callback_data        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_trace_callbacks_set(
+	          &trace_callbacks,
+	          (libagdb_file_t *) &callback_data,
+	          &agdb_test_trace_begin_callback,
+	          &agdb_test_trace_end_callback,
+	          (intptr_t *) &callback_data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_trace_callbacks_set(
+	          &trace_callbacks,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_trace_callbacks_set(
+	          NULL,
+	          NULL,
+	          &agdb_test_trace_begin_callback,
+	          &agdb_test_trace_end_callback,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_trace_callbacks_set(
+	          &trace_callbacks,
+	          NULL,
+	          NULL,
+	          NULL,
+	          (intptr_t *) &callback_data,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_trace_begin and libagdb_trace_end functions
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_trace_begin_end(
+     void )
+{
+	libagdb_trace_callbacks_t trace_callbacks;
+
+	libcerror_error_t *error = NULL;
+	int file_value           = 0;
+	int result               = 0;
+
+	agdb_test_trace_number_of_begin_calls = 0;
+	agdb_test_trace_number_of_end_calls   = 0;
+
+	/* Test without callbacks
+	 */
+	libagdb_trace_begin(
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 3,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 1024,
+	 512 );
+
+	libagdb_trace_end(
+	 NULL,
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 3,
+	 1,
+	 4096 );
+
+	result = libagdb_trace_callbacks_set(
+	          &trace_callbacks,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libagdb_trace_begin(
+	 &trace_callbacks,
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 3,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 1024,
+	 512 );
+
+	libagdb_trace_end(
+	 &trace_callbacks,
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 3,
+	 1,
+	 4096 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_trace_number_of_begin_calls",
+	 agdb_test_trace_number_of_begin_calls,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_trace_number_of_end_calls",
+	 agdb_test_trace_number_of_end_calls,
+	 0 );
+
+	/* Test with callbacks
+	 */
+	result = libagdb_trace_callbacks_set(
+	          &trace_callbacks,
+	          (libagdb_file_t *) &file_value,
+	          &agdb_test_trace_begin_callback,
+	          &agdb_test_trace_end_callback,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libagdb_trace_begin(
+	 &trace_callbacks,
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 3,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 1024,
+	 512 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_trace_number_of_begin_calls",
+	 agdb_test_trace_number_of_begin_calls,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_trace_last_phase",
+	 agdb_test_trace_last_phase,
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "agdb_test_trace_last_index",
+	 agdb_test_trace_last_index,
+	 (uint32_t) 3 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_trace_last_file",
+	 ( agdb_test_trace_last_file == (libagdb_file_t *) &file_value ),
+	 1 );
+
+	libagdb_trace_end(
+	 &trace_callbacks,
+	 LIBAGDB_TRACE_PHASE_COMPRESSED_BLOCK,
+	 3,
+	 -1,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_trace_number_of_end_calls",
+	 agdb_test_trace_number_of_end_calls,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "agdb_test_trace_last_result",
+	 agdb_test_trace_last_result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_trace_callbacks_set",
+	 agdb_test_trace_callbacks_set )
+
+	AGDB_TEST_RUN(
+	 "libagdb_trace_begin_end",
+	 agdb_test_trace_begin_end )
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1025 @@
+/*
+ * Library volume_index type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "agdb_test_libagdb.h"
+#include "agdb_test_libcerror.h"
+#include "agdb_test_macros.h"
+#include "agdb_test_memory.h"
+#include "agdb_test_unused.h"
+
+#include "../libagdb/libagdb_volume_index.h"
+
+/* The device paths, each followed by an end-of-string character
+ */
+uint8_t agdb_test_volume_index_utf8_string[ 49 ] = {
+	'\\', 'D', 'E', 'V', 'I', 'C', 'E', '\\', 'H', 'A', 'R', 'D', 'D', 'I', 'S', 'K', 'V', 'O',
+	'L', 'U', 'M', 'E', '1', 0,
+	0,
+	'\\', 'D', 'E', 'V', 'I', 'C', 'E', '\\', 'H', 'A', 'R', 'D', 'D', 'I', 'S', 'K', 'V', 'O',
+	'L', 'U', 'M', 'E', '2', 0 };
+
+size_t agdb_test_volume_index_utf8_string_offsets[ 3 ] = {
+	0, 24, 25 };
+
+/* The serial numbers of the test entries
+ */
+uint32_t agdb_test_volume_index_serial_numbers[ 3 ] = {
+	0x5a5a0000UL, 0x5a5a0000UL, 0x5a5a0002UL };
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+/* Creates a volume index of the test entries
+ * Returns 1 if successful or -1 on error
+ */
+int agdb_test_volume_index_create(
+     libagdb_volume_index_t **volume_index,
+     libcerror_error_t **error )
+{
+	int entry_index = 0;
+	int result      = 0;
+
+	result = libagdb_volume_index_initialize(
+	          volume_index,
+	          3,
+	          49,
+	          error );
+
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( *volume_index )->utf8_string,
+	     agdb_test_volume_index_utf8_string,
+	     49 ) == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( *volume_index )->utf8_string_offsets,
+	     agdb_test_volume_index_utf8_string_offsets,
+	     sizeof( size_t ) * 3 ) == NULL )
+	{
+		return( -1 );
+	}
+	for( entry_index = 2;
+	     entry_index >= 0;
+	     entry_index-- )
+	{
+		result = libagdb_volume_index_insert_entry(
+		          *volume_index,
+		          entry_index,
+		          agdb_test_volume_index_serial_numbers[ entry_index ],
+		          error );
+
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libagdb_volume_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_index_initialize(
+     void )
+{
+	libagdb_volume_index_t *volume_index = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 8;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libagdb_volume_index_initialize(
+	          &volume_index,
+	          3,
+	          49,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_index",
+	 volume_index );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "volume_index->number_of_buckets",
+	 volume_index->number_of_buckets,
+	 8 );
+
+	result = libagdb_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "volume_index",
+	 volume_index );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_volume_index_initialize(
+	          &volume_index,
+	          0,
+	          0,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_index",
+	 volume_index );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_volume_index_initialize(
+	          NULL,
+	          3,
+	          49,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume_index = (libagdb_volume_index_t *) 0x12345678UL;
+
+	result = libagdb_volume_index_initialize(
+	          &volume_index,
+	          3,
+	          49,
+	          &error );
+
+	volume_index = NULL;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_index_initialize(
+	          &volume_index,
+	          -1,
+	          49,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_index_initialize(
+	          &volume_index,
+	          3,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_AGDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_volume_index_initialize with malloc failing
+		 */
+		agdb_test_malloc_attempts_before_fail = test_number;
+
+		result = libagdb_volume_index_initialize(
+		          &volume_index,
+		          3,
+		          49,
+		          &error );
+
+		if( agdb_test_malloc_attempts_before_fail != -1 )
+		{
+			agdb_test_malloc_attempts_before_fail = -1;
+
+			if( volume_index != NULL )
+			{
+				libagdb_volume_index_free(
+				 &volume_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "volume_index",
+			 volume_index );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libagdb_volume_index_initialize with memset failing
+		 */
+		agdb_test_memset_attempts_before_fail = test_number;
+
+		result = libagdb_volume_index_initialize(
+		          &volume_index,
+		          3,
+		          49,
+		          &error );
+
+		if( agdb_test_memset_attempts_before_fail != -1 )
+		{
+			agdb_test_memset_attempts_before_fail = -1;
+
+			if( volume_index != NULL )
+			{
+				libagdb_volume_index_free(
+				 &volume_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			AGDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			AGDB_TEST_ASSERT_IS_NULL(
+			 "volume_index",
+			 volume_index );
+
+			AGDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_AGDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_index != NULL )
+	{
+		libagdb_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_volume_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libagdb_volume_index_free(
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_volume_index_get_device_path_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_index_get_device_path_hash(
+     void )
+{
+	uint32_t hash_value = 0;
+
+	/* Test regular cases
+	 */
+	hash_value = libagdb_volume_index_get_device_path_hash(
+	              (uint8_t *) "",
+	              0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_value",
+	 hash_value,
+	 (uint32_t) 0x811c9dc5UL );
+
+	hash_value = libagdb_volume_index_get_device_path_hash(
+	              (uint8_t *) "\\Device\\HarddiskVolume1",
+	              23 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_value",
+	 hash_value,
+	 libagdb_volume_index_get_device_path_hash(
+	  (uint8_t *) "\\DEVICE\\HARDDISKVOLUME1",
+	  23 ) );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libagdb_volume_index_insert_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_index_insert_entry(
+     void )
+{
+	libagdb_volume_index_t *volume_index = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libagdb_volume_index_initialize(
+	          &volume_index,
+	          1,
+	          2,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	volume_index->utf8_string[ 0 ]         = (uint8_t) 'C';
+	volume_index->utf8_string[ 1 ]         = 0;
+	volume_index->utf8_string_offsets[ 0 ] = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_volume_index_insert_entry(
+	          volume_index,
+	          0,
+	          0x5a5a0000UL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT32(
+	 "volume_index->serial_numbers[ 0 ]",
+	 volume_index->serial_numbers[ 0 ],
+	 (uint32_t) 0x5a5a0000UL );
+
+	/* Test error cases
+	 */
+	result = libagdb_volume_index_insert_entry(
+	          NULL,
+	          0,
+	          0x5a5a0000UL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_index_insert_entry(
+	          volume_index,
+	          1,
+	          0x5a5a0000UL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume_index->utf8_string[ 1 ] = (uint8_t) 'D';
+
+	result = libagdb_volume_index_insert_entry(
+	          volume_index,
+	          0,
+	          0x5a5a0000UL,
+	          &error );
+
+	volume_index->utf8_string[ 1 ] = 0;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume_index->utf8_string_offsets[ 0 ] = 2;
+
+	result = libagdb_volume_index_insert_entry(
+	          volume_index,
+	          0,
+	          0x5a5a0000UL,
+	          &error );
+
+	volume_index->utf8_string_offsets[ 0 ] = 0;
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_index != NULL )
+	{
+		libagdb_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_volume_index_get_entry_index_by_serial_number function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_index_get_entry_index_by_serial_number(
+     void )
+{
+	libagdb_volume_index_t *volume_index = NULL;
+	libcerror_error_t *error             = NULL;
+	int entry_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_volume_index_create(
+	          &volume_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_volume_index_get_entry_index_by_serial_number(
+	          volume_index,
+	          0x5a5a0000UL,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libagdb_volume_index_get_entry_index_by_serial_number(
+	          volume_index,
+	          0x5a5a0002UL,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	result = libagdb_volume_index_get_entry_index_by_serial_number(
+	          volume_index,
+	          0x12345678UL,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_volume_index_get_entry_index_by_serial_number(
+	          NULL,
+	          0x5a5a0000UL,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_index_get_entry_index_by_serial_number(
+	          volume_index,
+	          0x5a5a0000UL,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_index != NULL )
+	{
+		libagdb_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_volume_index_get_entry_index_by_utf8_device_path function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_index_get_entry_index_by_utf8_device_path(
+     void )
+{
+	libagdb_volume_index_t *volume_index = NULL;
+	libcerror_error_t *error             = NULL;
+	int entry_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = agdb_test_volume_index_create(
+	          &volume_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libagdb_volume_index_get_entry_index_by_utf8_device_path(
+	          volume_index,
+	          (uint8_t *) "\\device\\harddiskvolume2",
+	          23,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	result = libagdb_volume_index_get_entry_index_by_utf8_device_path(
+	          volume_index,
+	          (uint8_t *) "\\DEVICE\\HARDDISKVOLUME1",
+	          23,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libagdb_volume_index_get_entry_index_by_utf8_device_path(
+	          volume_index,
+	          (uint8_t *) "\\DEVICE\\HARDDISKVOLUME",
+	          22,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_volume_index_get_entry_index_by_utf8_device_path(
+	          volume_index,
+	          (uint8_t *) "",
+	          0,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libagdb_volume_index_get_entry_index_by_utf8_device_path(
+	          NULL,
+	          (uint8_t *) "\\DEVICE\\HARDDISKVOLUME1",
+	          23,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_index_get_entry_index_by_utf8_device_path(
+	          volume_index,
+	          NULL,
+	          23,
+	          &entry_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_index_get_entry_index_by_utf8_device_path(
+	          volume_index,
+	          (uint8_t *) "\\DEVICE\\HARDDISKVOLUME1",
+	          23,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libagdb_volume_index_free(
+	          &volume_index,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_index != NULL )
+	{
+		libagdb_volume_index_free(
+		 &volume_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc AGDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] AGDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	AGDB_TEST_UNREFERENCED_PARAMETER( argc )
+	AGDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT )
+
+	AGDB_TEST_RUN(
+	 "libagdb_volume_index_initialize",
+	 agdb_test_volume_index_initialize );
+
+	AGDB_TEST_RUN(
+	 "libagdb_volume_index_free",
+	 agdb_test_volume_index_free );
+
+	AGDB_TEST_RUN(
+	 "libagdb_volume_index_get_device_path_hash",
+	 agdb_test_volume_index_get_device_path_hash );
+
+	AGDB_TEST_RUN(
+	 "libagdb_volume_index_insert_entry",
+	 agdb_test_volume_index_insert_entry );
+
+	AGDB_TEST_RUN(
+	 "libagdb_volume_index_get_entry_index_by_serial_number",
+	 agdb_test_volume_index_get_entry_index_by_serial_number );
+
+	AGDB_TEST_RUN(
+	 "libagdb_volume_index_get_entry_index_by_utf8_device_path",
+	 agdb_test_volume_index_get_entry_index_by_utf8_device_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -460,6 +461,19 @@ int agdb_test_internal_volume_information_read_data(
 	io_handle->file_information_sub_entry_type1_size = 16;
 	io_handle->file_information_sub_entry_type2_size = 20;
 
+	result = libagdb_io_handle_set_layouts(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libagdb_volume_information_initialize(
 	          &volume_information,
 	          &error );
@@ -657,13 +671,19 @@ on_error:
 int agdb_test_internal_volume_information_read_file_io_handle(
      void )
 {
+	uint8_t utf8_string[ 128 ];
+	size_t utf8_string_offsets[ 1 ];
+	int file_indexes[ 1 ];
+
 	libagdb_io_handle_t *io_handle                   = NULL;
 	libagdb_volume_information_t *volume_information = NULL;
 	libbfio_handle_t *file_io_handle                 = NULL;
 	libcerror_error_t *error                         = NULL;
 	libfdata_stream_t *data_stream                   = NULL;
 	ssize64_t read_count                             = 0;
+	size_t utf8_string_size                          = 0;
 	int element_index                                = 0;
+	int number_of_files                              = 0;
 	int result                                       = 0;
 
 	/* Initialize test
@@ -691,6 +711,19 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	io_handle->file_information_sub_entry_type1_size = 16;
 	io_handle->file_information_sub_entry_type2_size = 20;
 
+	result = libagdb_io_handle_set_layouts(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libfdata_stream_initialize(
 	          &data_stream,
 	          NULL,
@@ -792,42 +825,73 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test retrieving the paths of the files that were read
 	 */
-	read_count = libagdb_internal_volume_information_read_file_io_handle(
-	              NULL,
-	              io_handle,
-	              data_stream,
-	              file_io_handle,
-	              0,
-	              1,
-	              &error );
+	result = libagdb_volume_information_get_utf8_paths_size(
+	          volume_information,
+	          &utf8_string_size,
+	          &error );
 
-	AGDB_TEST_ASSERT_EQUAL_INT64(
-	 "read_count",
-	 read_count,
-	 (int64_t) -1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 104 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libagdb_volume_information_get_utf8_paths(
+	          volume_information,
+	          utf8_string,
+	          128,
+	          utf8_string_offsets,
+	          1,
+	          &error );
 
-	read_count = libagdb_internal_volume_information_read_file_io_handle(
-	              (libagdb_internal_volume_information_t *) volume_information,
-	              NULL,
-	              data_stream,
-	              file_io_handle,
-	              0,
-	              1,
-	              &error );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	AGDB_TEST_ASSERT_EQUAL_INT64(
-	 "read_count",
-	 read_count,
-	 (int64_t) -1 );
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	AGDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 0 ]",
+	 utf8_string_offsets[ 0 ],
+	 (size_t) 0 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\WINDOWS\\WINSXS\\FILEMAPS\\",
+	          25 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_EQUAL_UINT8(
+	 "utf8_string[ 103 ]",
+	 utf8_string[ 103 ],
+	 0 );
+
+	result = libagdb_volume_information_get_utf8_paths_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -836,19 +900,15 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libagdb_internal_volume_information_read_file_io_handle(
-	              (libagdb_internal_volume_information_t *) volume_information,
-	              io_handle,
-	              NULL,
-	              file_io_handle,
-	              0,
-	              1,
-	              &error );
+	result = libagdb_volume_information_get_utf8_paths_size(
+	          volume_information,
+	          NULL,
+	          &error );
 
-	AGDB_TEST_ASSERT_EQUAL_INT64(
-	 "read_count",
-	 read_count,
-	 (int64_t) -1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -857,19 +917,18 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libagdb_internal_volume_information_read_file_io_handle(
-	              (libagdb_internal_volume_information_t *) volume_information,
-	              io_handle,
-	              data_stream,
-	              NULL,
-	              0,
-	              1,
-	              &error );
+	result = libagdb_volume_information_get_utf8_paths(
+	          NULL,
+	          utf8_string,
+	          128,
+	          utf8_string_offsets,
+	          1,
+	          &error );
 
-	AGDB_TEST_ASSERT_EQUAL_INT64(
-	 "read_count",
-	 read_count,
-	 (int64_t) -1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -878,19 +937,18 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	read_count = libagdb_internal_volume_information_read_file_io_handle(
-	              (libagdb_internal_volume_information_t *) volume_information,
-	              io_handle,
-	              data_stream,
-	              file_io_handle,
-	              -1,
-	              1,
-	              &error );
+	result = libagdb_volume_information_get_utf8_paths(
+	          volume_information,
+	          NULL,
+	          128,
+	          utf8_string_offsets,
+	          1,
+	          &error );
 
-	AGDB_TEST_ASSERT_EQUAL_INT64(
-	 "read_count",
-	 read_count,
-	 (int64_t) -1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -899,55 +957,60 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up file IO handle
-	 */
-	result = agdb_test_close_file_io_handle(
-	          &file_io_handle,
+	result = libagdb_volume_information_get_utf8_paths(
+	          volume_information,
+	          utf8_string,
+	          128,
+	          NULL,
+	          1,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test data too small
-	 */
-	result = agdb_test_open_file_io_handle(
-	          &file_io_handle,
-	          agdb_test_volume_information_data1,
-	          8,
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_information_get_utf8_paths(
+	          volume_information,
+	          utf8_string,
+	          128,
+	          utf8_string_offsets,
+	          0,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	read_count = libagdb_internal_volume_information_read_file_io_handle(
-	              (libagdb_internal_volume_information_t *) volume_information,
-	              io_handle,
-	              data_stream,
-	              file_io_handle,
-	              0,
-	              1,
-	              &error );
+	libcerror_error_free(
+	 &error );
 
-	AGDB_TEST_ASSERT_EQUAL_INT64(
-	 "read_count",
-	 read_count,
-	 (int64_t) -1 );
+	/* Test UTF-8 string too small
+	 */
+	result = libagdb_volume_information_get_utf8_paths(
+	          volume_information,
+	          utf8_string,
+	          103,
+	          utf8_string_offsets,
+	          1,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -956,23 +1019,43 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = agdb_test_close_file_io_handle(
-	          &file_io_handle,
+	/* Test file indexes by path prefix and glob
+	 */
+	result = libagdb_volume_information_get_file_indexes_by_utf8_path_prefix(
+	          volume_information,
+	          (uint8_t *) "\\windows\\winsxs\\",
+	          16,
+	          file_indexes,
+	          1,
+	          &number_of_files,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
-	result = libagdb_internal_volume_information_free(
-	          (libagdb_internal_volume_information_t **) &volume_information,
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "file_indexes[ 0 ]",
+	 file_indexes[ 0 ],
+	 0 );
+
+	result = libagdb_volume_information_get_file_indexes_by_utf8_path_prefix(
+	          volume_information,
+	          (uint8_t *) "\\USERS\\",
+	          7,
+	          file_indexes,
+	          1,
+	          &number_of_files,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -980,16 +1063,22 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	 result,
 	 1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdata_stream_free(
-	          &data_stream,
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 0 );
+
+	result = libagdb_volume_information_get_file_indexes_by_utf8_path_glob(
+	          volume_information,
+	          (uint8_t *) "\\WINDOWS\\*\\FILEMAPS\\*",
+	          21,
+	          file_indexes,
+	          1,
+	          &number_of_files,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -997,16 +1086,27 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	 result,
 	 1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "data_stream",
-	 data_stream );
-
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libagdb_io_handle_free(
-	          &io_handle,
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "file_indexes[ 0 ]",
+	 file_indexes[ 0 ],
+	 0 );
+
+	result = libagdb_volume_information_get_file_indexes_by_utf8_path_glob(
+	          volume_information,
+	          (uint8_t *) "*.EXE",
+	          5,
+	          file_indexes,
+	          1,
+	          &number_of_files,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1014,65 +1114,574 @@ int agdb_test_internal_volume_information_read_file_io_handle(
 	 result,
 	 1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
-	 "io_handle",
-	 io_handle );
-
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 0 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	if( volume_information != NULL )
+	result = libagdb_volume_information_get_file_indexes_by_utf8_path_prefix(
+	          volume_information,
+	          NULL,
+	          0,
+	          file_indexes,
+	          1,
+	          &number_of_files,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_information_get_file_indexes_by_utf8_path_glob(
+	          NULL,
+	          (uint8_t *) "*",
+	          1,
+	          file_indexes,
+	          1,
+	          &number_of_files,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	read_count = libagdb_internal_volume_information_read_file_io_handle(
+	              NULL,
+	              io_handle,
+	              data_stream,
+	              file_io_handle,
+	              0,
+	              1,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (int64_t) -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libagdb_internal_volume_information_read_file_io_handle(
+	              (libagdb_internal_volume_information_t *) volume_information,
+	              NULL,
+	              data_stream,
+	              file_io_handle,
+	              0,
+	              1,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (int64_t) -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libagdb_internal_volume_information_read_file_io_handle(
+	              (libagdb_internal_volume_information_t *) volume_information,
+	              io_handle,
+	              NULL,
+	              file_io_handle,
+	              0,
+	              1,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (int64_t) -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libagdb_internal_volume_information_read_file_io_handle(
+	              (libagdb_internal_volume_information_t *) volume_information,
+	              io_handle,
+	              data_stream,
+	              NULL,
+	              0,
+	              1,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (int64_t) -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libagdb_internal_volume_information_read_file_io_handle(
+	              (libagdb_internal_volume_information_t *) volume_information,
+	              io_handle,
+	              data_stream,
+	              file_io_handle,
+	              -1,
+	              1,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (int64_t) -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data too small
+	 */
+	result = agdb_test_open_file_io_handle(
+	          &file_io_handle,
+	          agdb_test_volume_information_data1,
+	          8,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libagdb_internal_volume_information_read_file_io_handle(
+	              (libagdb_internal_volume_information_t *) volume_information,
+	              io_handle,
+	              data_stream,
+	              file_io_handle,
+	              0,
+	              1,
+	              &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (int64_t) -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = agdb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libagdb_internal_volume_information_free(
+	          (libagdb_internal_volume_information_t **) &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_free(
+	          &data_stream,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "data_stream",
+	 data_stream );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( volume_information != NULL )
+	{
+		libagdb_internal_volume_information_free(
+		 (libagdb_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	if( data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libagdb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_volume_information_get_creation_time function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_information_get_creation_time(
+     libagdb_volume_information_t *volume_information )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t creation_time   = 0;
+	int creation_time_is_set = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_volume_information_get_creation_time(
+	          volume_information,
+	          &creation_time,
+	          &error );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	creation_time_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libagdb_volume_information_get_creation_time(
+	          NULL,
+	          &creation_time,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( creation_time_is_set != 0 )
+	{
+		result = libagdb_volume_information_get_creation_time(
+		          volume_information,
+		          NULL,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_volume_information_get_serial_number function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_information_get_serial_number(
+     libagdb_volume_information_t *volume_information )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t serial_number   = 0;
+	int result               = 0;
+	int serial_number_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_volume_information_get_serial_number(
+	          volume_information,
+	          &serial_number,
+	          &error );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	serial_number_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libagdb_volume_information_get_serial_number(
+	          NULL,
+	          &serial_number,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( serial_number_is_set != 0 )
 	{
-		libagdb_internal_volume_information_free(
-		 (libagdb_internal_volume_information_t **) &volume_information,
-		 NULL );
+		result = libagdb_volume_information_get_serial_number(
+		          volume_information,
+		          NULL,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
 	}
-	if( data_stream != NULL )
+	return( 1 );
+
+on_error:
+	if( error != NULL )
 	{
-		libfdata_stream_free(
-		 &data_stream,
-		 NULL );
+		libcerror_error_free(
+		 &error );
 	}
-	if( io_handle != NULL )
+	return( 0 );
+}
+
+/* Tests the libagdb_volume_information_get_utf8_device_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_information_get_utf8_device_path_size(
+     libagdb_volume_information_t *volume_information )
+{
+	libcerror_error_t *error         = NULL;
+	size_t utf8_device_path_size     = 0;
+	int result                       = 0;
+	int utf8_device_path_size_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_volume_information_get_utf8_device_path_size(
+	          volume_information,
+	          &utf8_device_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_device_path_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libagdb_volume_information_get_utf8_device_path_size(
+	          NULL,
+	          &utf8_device_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf8_device_path_size_is_set != 0 )
 	{
-		libagdb_io_handle_free(
-		 &io_handle,
-		 NULL );
+		result = libagdb_volume_information_get_utf8_device_path_size(
+		          volume_information,
+		          NULL,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
 	}
 	return( 0 );
 }
 
-/* Tests the libagdb_volume_information_get_creation_time function
+/* Tests the libagdb_volume_information_get_utf8_device_path function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_volume_information_get_creation_time(
+int agdb_test_volume_information_get_utf8_device_path(
      libagdb_volume_information_t *volume_information )
 {
-	libcerror_error_t *error = NULL;
-	uint64_t creation_time   = 0;
-	int creation_time_is_set = 0;
-	int result               = 0;
+	uint8_t utf8_device_path[ 512 ];
+
+	libcerror_error_t *error    = NULL;
+	int result                  = 0;
+	int utf8_device_path_is_set = 0;
 
 	/* Test regular cases
 	 */
-	result = libagdb_volume_information_get_creation_time(
+	result = libagdb_volume_information_get_utf8_device_path(
 	          volume_information,
-	          &creation_time,
+	          utf8_device_path,
+	          512,
 	          &error );
 
 	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1084,13 +1693,14 @@ int agdb_test_volume_information_get_creation_time(
 	 "error",
 	 error );
 
-	creation_time_is_set = result;
+	utf8_device_path_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libagdb_volume_information_get_creation_time(
+	result = libagdb_volume_information_get_utf8_device_path(
 	          NULL,
-	          &creation_time,
+	          utf8_device_path,
+	          512,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1105,9 +1715,124 @@ int agdb_test_volume_information_get_creation_time(
 	libcerror_error_free(
 	 &error );
 
-	if( creation_time_is_set != 0 )
+	if( utf8_device_path_is_set != 0 )
+	{
+		result = libagdb_volume_information_get_utf8_device_path(
+		          volume_information,
+		          NULL,
+		          512,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libagdb_volume_information_get_utf8_device_path(
+		          volume_information,
+		          utf8_device_path,
+		          0,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libagdb_volume_information_get_utf8_device_path(
+		          volume_information,
+		          utf8_device_path,
+		          (size_t) SSIZE_MAX + 1,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libagdb_volume_information_get_utf16_device_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int agdb_test_volume_information_get_utf16_device_path_size(
+     libagdb_volume_information_t *volume_information )
+{
+	libcerror_error_t *error          = NULL;
+	size_t utf16_device_path_size     = 0;
+	int result                        = 0;
+	int utf16_device_path_size_is_set = 0;
+
+	/* Test regular cases
+	 */
+	result = libagdb_volume_information_get_utf16_device_path_size(
+	          volume_information,
+	          &utf16_device_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_device_path_size_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libagdb_volume_information_get_utf16_device_path_size(
+	          NULL,
+	          &utf16_device_path_size,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( utf16_device_path_size_is_set != 0 )
 	{
-		result = libagdb_volume_information_get_creation_time(
+		result = libagdb_volume_information_get_utf16_device_path_size(
 		          volume_information,
 		          NULL,
 		          &error );
@@ -1135,22 +1860,24 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_volume_information_get_serial_number function
+/* Tests the libagdb_volume_information_get_utf16_device_path function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_volume_information_get_serial_number(
+int agdb_test_volume_information_get_utf16_device_path(
      libagdb_volume_information_t *volume_information )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t serial_number   = 0;
-	int result               = 0;
-	int serial_number_is_set = 0;
+	uint16_t utf16_device_path[ 512 ];
+
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+	int utf16_device_path_is_set = 0;
 
 	/* Test regular cases
 	 */
-	result = libagdb_volume_information_get_serial_number(
+	result = libagdb_volume_information_get_utf16_device_path(
 	          volume_information,
-	          &serial_number,
+	          utf16_device_path,
+	          512,
 	          &error );
 
 	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1162,13 +1889,14 @@ int agdb_test_volume_information_get_serial_number(
 	 "error",
 	 error );
 
-	serial_number_is_set = result;
+	utf16_device_path_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libagdb_volume_information_get_serial_number(
+	result = libagdb_volume_information_get_utf16_device_path(
 	          NULL,
-	          &serial_number,
+	          utf16_device_path,
+	          512,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1183,11 +1911,48 @@ int agdb_test_volume_information_get_serial_number(
 	libcerror_error_free(
 	 &error );
 
-	if( serial_number_is_set != 0 )
+	if( utf16_device_path_is_set != 0 )
 	{
-		result = libagdb_volume_information_get_serial_number(
+		result = libagdb_volume_information_get_utf16_device_path(
 		          volume_information,
 		          NULL,
+		          512,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libagdb_volume_information_get_utf16_device_path(
+		          volume_information,
+		          utf16_device_path,
+		          0,
+		          &error );
+
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libagdb_volume_information_get_utf16_device_path(
+		          volume_information,
+		          utf16_device_path,
+		          (size_t) SSIZE_MAX + 1,
 		          &error );
 
 		AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1213,22 +1978,24 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_volume_information_get_utf8_device_path_size function
+/* Tests the libagdb_volume_information_get_device_path_data function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_volume_information_get_utf8_device_path_size(
+int agdb_test_volume_information_get_device_path_data(
      libagdb_volume_information_t *volume_information )
 {
-	libcerror_error_t *error         = NULL;
-	size_t utf8_device_path_size     = 0;
-	int result                       = 0;
-	int utf8_device_path_size_is_set = 0;
+	libcerror_error_t *error        = NULL;
+	const uint8_t *device_path_data = NULL;
+	size_t device_path_data_size    = 0;
+	int result                      = 0;
+	int device_path_data_is_set     = 0;
 
 	/* Test regular cases
 	 */
-	result = libagdb_volume_information_get_utf8_device_path_size(
+	result = libagdb_volume_information_get_device_path_data(
 	          volume_information,
-	          &utf8_device_path_size,
+	          &device_path_data,
+	          &device_path_data_size,
 	          &error );
 
 	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1240,13 +2007,25 @@ int agdb_test_volume_information_get_utf8_device_path_size(
 	 "error",
 	 error );
 
-	utf8_device_path_size_is_set = result;
+	device_path_data_is_set = result;
+
+	if( device_path_data_is_set != 0 )
+	{
+		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		 "device_path_data",
+		 device_path_data );
 
+		AGDB_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "device_path_data_size",
+		 (ssize_t) device_path_data_size,
+		 (ssize_t) 0 );
+	}
 	/* Test error cases
 	 */
-	result = libagdb_volume_information_get_utf8_device_path_size(
+	result = libagdb_volume_information_get_device_path_data(
 	          NULL,
-	          &utf8_device_path_size,
+	          &device_path_data,
+	          &device_path_data_size,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1261,25 +2040,42 @@ int agdb_test_volume_information_get_utf8_device_path_size(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_device_path_size_is_set != 0 )
-	{
-		result = libagdb_volume_information_get_utf8_device_path_size(
-		          volume_information,
-		          NULL,
-		          &error );
+	result = libagdb_volume_information_get_device_path_data(
+	          volume_information,
+	          NULL,
+	          &device_path_data_size,
+	          &error );
 
-		AGDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		AGDB_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libagdb_volume_information_get_device_path_data(
+	          volume_information,
+	          &device_path_data,
+	          NULL,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1291,24 +2087,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_volume_information_get_utf8_device_path function
+/* Tests the libagdb_volume_information_get_number_of_files function
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_volume_information_get_utf8_device_path(
+int agdb_test_volume_information_get_number_of_files(
      libagdb_volume_information_t *volume_information )
 {
-	uint8_t utf8_device_path[ 512 ];
-
-	libcerror_error_t *error    = NULL;
-	int result                  = 0;
-	int utf8_device_path_is_set = 0;
+	libcerror_error_t *error   = NULL;
+	int number_of_files        = 0;
+	int number_of_files_is_set = 0;
+	int result                 = 0;
 
 	/* Test regular cases
 	 */
-	result = libagdb_volume_information_get_utf8_device_path(
+	result = libagdb_volume_information_get_number_of_files(
 	          volume_information,
-	          utf8_device_path,
-	          512,
+	          &number_of_files,
 	          &error );
 
 	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1320,14 +2114,13 @@ int agdb_test_volume_information_get_utf8_device_path(
 	 "error",
 	 error );
 
-	utf8_device_path_is_set = result;
+	number_of_files_is_set = result;
 
 	/* Test error cases
 	 */
-	result = libagdb_volume_information_get_utf8_device_path(
+	result = libagdb_volume_information_get_number_of_files(
 	          NULL,
-	          utf8_device_path,
-	          512,
+	          &number_of_files,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1342,48 +2135,11 @@ int agdb_test_volume_information_get_utf8_device_path(
 	libcerror_error_free(
 	 &error );
 
-	if( utf8_device_path_is_set != 0 )
+	if( number_of_files_is_set != 0 )
 	{
-		result = libagdb_volume_information_get_utf8_device_path(
+		result = libagdb_volume_information_get_number_of_files(
 		          volume_information,
 		          NULL,
-		          512,
-		          &error );
-
-		AGDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		AGDB_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libagdb_volume_information_get_utf8_device_path(
-		          volume_information,
-		          utf8_device_path,
-		          0,
-		          &error );
-
-		AGDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		AGDB_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libagdb_volume_information_get_utf8_device_path(
-		          volume_information,
-		          utf8_device_path,
-		          (size_t) SSIZE_MAX + 1,
 		          &error );
 
 		AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1409,121 +2165,211 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libagdb_volume_information_get_utf16_device_path_size function
+#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
+
+/* Tests the libagdb_volume_information_get_file_summaries function with generated data
  * Returns 1 if successful or 0 if not
  */
-int agdb_test_volume_information_get_utf16_device_path_size(
-     libagdb_volume_information_t *volume_information )
+int agdb_test_volume_information_get_file_summaries(
+     uint8_t file_type,
+     uint8_t number_of_bits )
 {
-	libcerror_error_t *error          = NULL;
-	size_t utf16_device_path_size     = 0;
-	int result                        = 0;
-	int utf16_device_path_size_is_set = 0;
+	libagdb_file_summary_t file_summaries[ 3 ];
 
-	/* Test regular cases
+	libagdb_file_information_t *file_information     = NULL;
+	libagdb_file_t *file                             = NULL;
+	libagdb_volume_information_t *volume_information = NULL;
+	libcerror_error_t *error                         = NULL;
+	uint8_t *data                                    = NULL;
+	size_t data_size                                 = 0;
+	size_t utf8_path_size                            = 0;
+	int file_index                                   = 0;
+	int number_of_files                              = 0;
+	int result                                       = 0;
+
+	/* Initialize test
 	 */
-	result = libagdb_volume_information_get_utf16_device_path_size(
-	          volume_information,
-	          &utf16_device_path_size,
+	result = agdb_test_generate_data(
+	          file_type,
+	          number_of_bits,
+	          &data,
+	          &data_size,
 	          &error );
 
-	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	utf16_device_path_size_is_set = result;
+	result = libagdb_file_initialize(
+	          &file,
+	          &error );
 
-	/* Test error cases
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_open_memory(
+	          file,
+	          data,
+	          data_size,
+	          LIBAGDB_OPEN_READ,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_get_volume_information(
+	          file,
+	          1,
+	          &volume_information,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
 	 */
-	result = libagdb_volume_information_get_utf16_device_path_size(
-	          NULL,
-	          &utf16_device_path_size,
+	result = libagdb_volume_information_get_file_summaries(
+	          volume_information,
+	          file_summaries,
+	          3,
+	          &number_of_files,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 3 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	if( utf16_device_path_size_is_set != 0 )
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
 	{
-		result = libagdb_volume_information_get_utf16_device_path_size(
+		file_information = NULL;
+
+		result = libagdb_volume_information_get_file_information(
 		          volume_information,
-		          NULL,
+		          file_index,
+		          &file_information,
 		          &error );
 
 		AGDB_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		AGDB_TEST_ASSERT_IS_NOT_NULL(
+		AGDB_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+		result = libagdb_file_information_get_utf8_path_size(
+		          file_information,
+		          &utf8_path_size,
+		          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		AGDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-/* Tests the libagdb_volume_information_get_utf16_device_path function
- * Returns 1 if successful or 0 if not
- */
-int agdb_test_volume_information_get_utf16_device_path(
-     libagdb_volume_information_t *volume_information )
-{
-	uint16_t utf16_device_path[ 512 ];
+		AGDB_TEST_ASSERT_EQUAL_SIZE(
+		 "file_summaries[ file_index ].utf8_path_size",
+		 file_summaries[ file_index ].utf8_path_size,
+		 utf8_path_size );
 
-	libcerror_error_t *error     = NULL;
-	int result                   = 0;
-	int utf16_device_path_is_set = 0;
+		AGDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test regular cases
+		/* The generated files have 2 sub entries each
+		 */
+		AGDB_TEST_ASSERT_EQUAL_UINT32(
+		 "file_summaries[ file_index ].number_of_entries",
+		 file_summaries[ file_index ].number_of_entries,
+		 2 );
+	}
+	/* Test with fewer summaries than files
 	 */
-	result = libagdb_volume_information_get_utf16_device_path(
+	result = libagdb_volume_information_get_file_summaries(
 	          volume_information,
-	          utf16_device_path,
-	          512,
+	          file_summaries,
+	          1,
+	          &number_of_files,
 	          &error );
 
-	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 3 );
 
 	AGDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	utf16_device_path_is_set = result;
+	result = libagdb_volume_information_get_file_summaries(
+	          volume_information,
+	          NULL,
+	          0,
+	          &number_of_files,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 3 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libagdb_volume_information_get_utf16_device_path(
+	result = libagdb_volume_information_get_file_summaries(
 	          NULL,
-	          utf16_device_path,
-	          512,
+	          file_summaries,
+	          3,
+	          &number_of_files,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1538,107 +2384,49 @@ int agdb_test_volume_information_get_utf16_device_path(
 	libcerror_error_free(
 	 &error );
 
-	if( utf16_device_path_is_set != 0 )
-	{
-		result = libagdb_volume_information_get_utf16_device_path(
-		          volume_information,
-		          NULL,
-		          512,
-		          &error );
-
-		AGDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		AGDB_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libagdb_volume_information_get_utf16_device_path(
-		          volume_information,
-		          utf16_device_path,
-		          0,
-		          &error );
-
-		AGDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		AGDB_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		result = libagdb_volume_information_get_utf16_device_path(
-		          volume_information,
-		          utf16_device_path,
-		          (size_t) SSIZE_MAX + 1,
-		          &error );
-
-		AGDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		AGDB_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	result = libagdb_volume_information_get_file_summaries(
+	          volume_information,
+	          file_summaries,
+	          -1,
+	          &number_of_files,
+	          &error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-/* Tests the libagdb_volume_information_get_number_of_files function
- * Returns 1 if successful or 0 if not
- */
-int agdb_test_volume_information_get_number_of_files(
-     libagdb_volume_information_t *volume_information )
-{
-	libcerror_error_t *error   = NULL;
-	int number_of_files        = 0;
-	int number_of_files_is_set = 0;
-	int result                 = 0;
+	libcerror_error_free(
+	 &error );
 
-	/* Test regular cases
-	 */
-	result = libagdb_volume_information_get_number_of_files(
+	result = libagdb_volume_information_get_file_summaries(
 	          volume_information,
+	          NULL,
+	          3,
 	          &number_of_files,
 	          &error );
 
-	AGDB_TEST_ASSERT_NOT_EQUAL_INT(
+	AGDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	AGDB_TEST_ASSERT_IS_NULL(
+	AGDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	number_of_files_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libagdb_volume_information_get_number_of_files(
+	result = libagdb_volume_information_get_file_summaries(
+	          volume_information,
+	          file_summaries,
+	          3,
 	          NULL,
-	          &number_of_files,
 	          &error );
 
 	AGDB_TEST_ASSERT_EQUAL_INT(
@@ -1653,25 +2441,37 @@ int agdb_test_volume_information_get_number_of_files(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_files_is_set != 0 )
-	{
-		result = libagdb_volume_information_get_number_of_files(
-		          volume_information,
-		          NULL,
-		          &error );
+	/* Clean up
+	 */
+	result = libagdb_file_close(
+	          file,
+	          &error );
 
-		AGDB_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		AGDB_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libagdb_file_free(
+	          &file,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1680,11 +2480,20 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libagdb_file_free(
+		 &file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
-
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1762,6 +2571,19 @@ int main(
 	io_handle->file_information_sub_entry_type1_size = 16;
 	io_handle->file_information_sub_entry_type2_size = 20;
 
+	result = libagdb_io_handle_set_layouts(
+	          io_handle,
+	          &error );
+
+	AGDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	AGDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libagdb_volume_information_initialize(
 	          &volume_information,
 	          &error );
@@ -1842,6 +2664,11 @@ int main(
 	 agdb_test_volume_information_get_utf16_device_path,
 	 volume_information );
 
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_volume_information_get_device_path_data",
+	 agdb_test_volume_information_get_device_path_data,
+	 volume_information );
+
 	AGDB_TEST_RUN_WITH_ARGS(
 	 "libagdb_volume_information_get_number_of_files",
 	 agdb_test_volume_information_get_number_of_files,
@@ -1888,6 +2715,46 @@ int main(
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 #endif /* defined( __GNUC__ ) && !defined( LIBAGDB_DLL_IMPORT ) */
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_volume_information_get_file_summaries",
+	 agdb_test_volume_information_get_file_summaries,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_volume_information_get_file_summaries",
+	 agdb_test_volume_information_get_file_summaries,
+	 LIBAGDB_FILE_TYPE_UNCOMPRESSED,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_volume_information_get_file_summaries",
+	 agdb_test_volume_information_get_file_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_VISTA,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_volume_information_get_file_summaries",
+	 agdb_test_volume_information_get_file_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS7,
+	 64 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_volume_information_get_file_summaries",
+	 agdb_test_volume_information_get_file_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_0,
+	 32 );
+
+	AGDB_TEST_RUN_WITH_ARGS(
+	 "libagdb_volume_information_get_file_summaries",
+	 agdb_test_volume_information_get_file_summaries,
+	 LIBAGDB_FILE_TYPE_COMPRESSED_WINDOWS8_1,
+	 64 );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
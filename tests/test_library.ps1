@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "compressed_block compressed_blocks_stream_data_handle compressed_file_header error file_information io_handle notify source_information volume_information"
+$LibraryTests = "allocator cache carve compressed_block compressed_blocks_stream_data_handle compressed_file_header compression content_fingerprint diff error file_information generator io_handle layout memory_map notify parse_cache path_index source_index source_information string trace volume_index volume_information"
 $LibraryTestsWithInput = "file support"
 $OptionSets = "" -split " "
 